@@ -10,6 +10,8 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Audio/Wav.hpp"
 
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
 #include <iomanip>
 #include <filesystem>
 #include <functional>
@@ -51,7 +53,7 @@ public:
         std::size_t _my_id = 0;
         FileUtils::Wav* _wave_file{};
         std::vector<Channel*> _channels{};
-        std::mutex _cs{};
+        ProfiledMutex _cs{"AudioSystem::Sound"};
     };
 private:
     class Channel {
@@ -77,7 +79,7 @@ private:
         IXAudio2SourceVoice* _voice = nullptr;
         Sound* _sound = nullptr;
         AudioSystem* _audio_system = nullptr;
-        std::mutex _cs{};
+        ProfiledMutex _cs{"AudioSystem::Channel"};
     };
     struct ChannelGroup {
         Channel* channel = nullptr;
@@ -132,5 +134,5 @@ private:
     IXAudio2* _xaudio2 = nullptr;
     IXAudio2MasteringVoice* _master_voice = nullptr;
     EngineCallback _engine_callback{};
-    std::mutex _cs{};
+    ProfiledMutex _cs{"AudioSystem"};
 };
\ No newline at end of file
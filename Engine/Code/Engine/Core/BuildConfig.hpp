@@ -25,6 +25,16 @@
 
 #define MAX_LOGS 3u
 
+//Define to record wait/hold times of engine locks. See Profiling/InstrumentedMutex.hpp
+//#define PROFILE_LOCKS
+
+//SSE paths for the math library. Define MATH_NO_SIMD to build the scalar fallbacks instead.
+#if !defined(MATH_NO_SIMD)
+    #if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+        #define MATH_SIMD_SSE
+    #endif
+#endif
+
 #define TOKEN_PASTE_SIMPLE(x,y) x##y
 #define TOKEN_PASTE(x,y) TOKEN_PASTE_SIMPLE(x,y)
 #define TOKEN_STRINGIZE_SIMPLE(x) #x
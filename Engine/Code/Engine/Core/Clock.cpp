@@ -0,0 +1,107 @@
+#include "Engine/Core/Clock.hpp"
+
+#include <algorithm>
+
+Clock::Clock() noexcept
+    : _last_tick(TimeUtils::Now())
+{
+    /* DO NOTHING */
+}
+
+Clock::Clock(Clock& parent) noexcept
+    : _last_tick(TimeUtils::Now())
+{
+    SetParent(&parent);
+}
+
+Clock::~Clock() noexcept {
+    //Orphaned children become master clocks rather than dangling.
+    const auto now = TimeUtils::Now();
+    for(auto child : _children) {
+        child->_parent = nullptr;
+        child->_last_tick = now;
+    }
+    _children.clear();
+    SetParent(nullptr);
+}
+
+void Clock::Tick() noexcept {
+    const auto now = TimeUtils::Now();
+    const auto delta = seconds_t{now - _last_tick};
+    _last_tick = now;
+    Advance(delta);
+}
+
+void Clock::Tick(const TimeUtils::FPSeconds& deltaSeconds) noexcept {
+    _last_tick = TimeUtils::Now();
+    Advance(seconds_t{deltaSeconds});
+}
+
+void Clock::Advance(seconds_t deltaSeconds) noexcept {
+    _frame_time = _is_paused ? seconds_t{} : deltaSeconds * static_cast<double>(_scale);
+    _total_time += _frame_time;
+    ++_frame_count;
+    for(auto child : _children) {
+        child->Advance(_frame_time);
+    }
+}
+
+void Clock::Pause() noexcept {
+    _is_paused = true;
+}
+
+void Clock::Resume() noexcept {
+    _is_paused = false;
+}
+
+void Clock::TogglePause() noexcept {
+    _is_paused = !_is_paused;
+}
+
+bool Clock::IsPaused() const noexcept {
+    return _is_paused;
+}
+
+void Clock::SetScale(float scale) noexcept {
+    _scale = (std::max)(0.0f, scale);
+}
+
+float Clock::GetScale() const noexcept {
+    return _scale;
+}
+
+TimeUtils::FPSeconds Clock::GetFrameTime() const noexcept {
+    return TimeUtils::FPSeconds{_frame_time};
+}
+
+TimeUtils::FPSeconds Clock::GetTotalTime() const noexcept {
+    return TimeUtils::FPSeconds{_total_time};
+}
+
+std::uint64_t Clock::GetFrameCount() const noexcept {
+    return _frame_count;
+}
+
+Clock* Clock::GetParent() const noexcept {
+    return _parent;
+}
+
+void Clock::SetParent(Clock* parent) noexcept {
+    if(_parent) {
+        _parent->RemoveChild(this);
+    }
+    _parent = parent;
+    if(_parent) {
+        _parent->AddChild(this);
+    }
+    //Time spent under the old parent was already delivered by it; a detached clock's next Tick starts from now.
+    _last_tick = TimeUtils::Now();
+}
+
+void Clock::AddChild(Clock* child) noexcept {
+    _children.push_back(child);
+}
+
+void Clock::RemoveChild(Clock* child) noexcept {
+    _children.erase(std::remove(std::begin(_children), std::end(_children), child), std::end(_children));
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+//Hierarchical clock. A clock without a parent is a master clock and is advanced with Tick;
+//every child receives its parent's scaled delta multiplied by its own scale,
+//or nothing while it (or any ancestor) is paused.
+class Clock {
+public:
+    Clock() noexcept;
+    explicit Clock(Clock& parent) noexcept;
+    Clock(const Clock& other) = delete;
+    Clock(Clock&& r_other) = delete;
+    Clock& operator=(const Clock& rhs) = delete;
+    Clock& operator=(Clock&& rhs) = delete;
+    ~Clock() noexcept;
+
+    //Advances a master clock by the real time elapsed since the previous Tick.
+    void Tick() noexcept;
+    //Advances a master clock by a caller-supplied delta, e.g. a fixed playback step.
+    void Tick(const TimeUtils::FPSeconds& deltaSeconds) noexcept;
+
+    void Pause() noexcept;
+    void Resume() noexcept;
+    void TogglePause() noexcept;
+    bool IsPaused() const noexcept;
+
+    void SetScale(float scale) noexcept;
+    float GetScale() const noexcept;
+
+    TimeUtils::FPSeconds GetFrameTime() const noexcept;
+    TimeUtils::FPSeconds GetTotalTime() const noexcept;
+    std::uint64_t GetFrameCount() const noexcept;
+
+    Clock* GetParent() const noexcept;
+    void SetParent(Clock* parent) noexcept;
+
+protected:
+private:
+    using seconds_t = std::chrono::duration<double>;
+    using time_point_t = std::chrono::time_point<std::chrono::steady_clock>;
+
+    void Advance(seconds_t deltaSeconds) noexcept;
+    void AddChild(Clock* child) noexcept;
+    void RemoveChild(Clock* child) noexcept;
+
+    Clock* _parent = nullptr;
+    std::vector<Clock*> _children{};
+    seconds_t _frame_time{};
+    seconds_t _total_time{};
+    time_point_t _last_tick{};
+    std::uint64_t _frame_count = 0;
+    float _scale = 1.0f;
+    bool _is_paused = false;
+};
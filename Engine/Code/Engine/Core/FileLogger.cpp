@@ -34,7 +34,7 @@ void FileLogger::Log_worker() noexcept {
     _job_system->SetCategorySignal(JobType::Logging, &_signal);
 
     while(IsRunning()) {
-        std::unique_lock<std::mutex> lock(_cs);
+        std::unique_lock<std::mutex> lock(_cs.native());
         //Condition to wake up: not running or queue has jobs.
         _signal.wait(lock, [this]()->bool { return !_is_running || !_queue.empty(); });
         if(!_queue.empty()) {
@@ -57,7 +57,7 @@ void FileLogger::RequestFlush() noexcept {
 bool FileLogger::IsRunning() const noexcept {
     bool running = false;
     {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     running = _is_running;
     }
     return running;
@@ -89,7 +89,7 @@ void FileLogger::CopyLog(void* user_data) noexcept {
         auto job_data = reinterpret_cast<copy_log_job_t*>(user_data);
         auto from = job_data->from;
         auto to = job_data->to;
-        std::scoped_lock<std::mutex> _lock(_cs);
+        std::scoped_lock<ProfiledMutex> _lock(_cs);
         _stream.flush();
         _stream.close();
         std::cout.rdbuf(_old_cout);
@@ -180,7 +180,7 @@ void FileLogger::Shutdown() noexcept {
 
 void FileLogger::Log(const std::string& msg) noexcept {
     {
-        std::scoped_lock<std::mutex> _lock(_cs);
+        std::scoped_lock<ProfiledMutex> _lock(_cs);
         _queue.push(msg);
     }
     _signal.notify_all();
@@ -260,7 +260,7 @@ void FileLogger::Flush() noexcept {
 }
 
 void FileLogger::SetIsRunning(bool value /*= true*/) noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     _is_running = value;
 }
 
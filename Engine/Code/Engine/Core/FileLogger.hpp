@@ -2,6 +2,8 @@
 
 #include "Engine/Core/ThreadSafeQueue.hpp"
 
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
 #include <atomic>
 #include <condition_variable>
 #include <fstream>
@@ -52,7 +54,7 @@ private:
     void DoCopyLog() noexcept;
     void CopyLog(void* user_data) noexcept;
     void FinalizeLog() noexcept;
-    mutable std::mutex _cs{};
+    mutable ProfiledMutex _cs{"FileLogger"};
     std::ofstream _stream{};
     std::filesystem::path _current_log_path{};
     decltype(std::cout.rdbuf()) _old_cout{};
@@ -0,0 +1,64 @@
+#include "Engine/Core/FixedTimestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep(const TimeUtils::FPSeconds& step, unsigned int maxStepsPerFrame /*= 8*/) noexcept
+    : _step(step)
+    , _max_steps_per_frame((std::max)(1u, maxStepsPerFrame))
+{
+    /* DO NOTHING */
+}
+
+FixedTimestep::FixedTimestep(unsigned int frequency, unsigned int maxStepsPerFrame /*= 8*/) noexcept
+    : FixedTimestep(TimeUtils::FPSeconds{1.0f / static_cast<float>((std::max)(1u, frequency))}, maxStepsPerFrame)
+{
+    /* DO NOTHING */
+}
+
+unsigned int FixedTimestep::Accumulate(const TimeUtils::FPSeconds& deltaSeconds) noexcept {
+    _accumulator += seconds_t{deltaSeconds};
+    const auto max_accumulated = _step * static_cast<double>(_max_steps_per_frame);
+    if(_accumulator > max_accumulated) {
+        _dropped_steps += static_cast<unsigned int>(std::floor((_accumulator - max_accumulated) / _step));
+        _accumulator = max_accumulated;
+    }
+    return static_cast<unsigned int>(std::floor(_accumulator / _step));
+}
+
+bool FixedTimestep::Step() noexcept {
+    if(_accumulator < _step) {
+        return false;
+    }
+    _accumulator -= _step;
+    return true;
+}
+
+void FixedTimestep::Reset() noexcept {
+    _accumulator = seconds_t{};
+    _dropped_steps = 0;
+}
+
+float FixedTimestep::GetAlpha() const noexcept {
+    return static_cast<float>(_accumulator / _step);
+}
+
+TimeUtils::FPSeconds FixedTimestep::GetStep() const noexcept {
+    return TimeUtils::FPSeconds{_step};
+}
+
+void FixedTimestep::SetStep(const TimeUtils::FPSeconds& step) noexcept {
+    _step = step;
+}
+
+unsigned int FixedTimestep::GetMaxStepsPerFrame() const noexcept {
+    return _max_steps_per_frame;
+}
+
+void FixedTimestep::SetMaxStepsPerFrame(unsigned int maxStepsPerFrame) noexcept {
+    _max_steps_per_frame = (std::max)(1u, maxStepsPerFrame);
+}
+
+unsigned int FixedTimestep::GetDroppedStepCount() const noexcept {
+    return _dropped_steps;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <chrono>
+
+//Accumulates variable frame time and hands it out in fixed steps:
+//
+//    timestep.Accumulate(clock.GetFrameTime());
+//    while(timestep.Step()) { Simulate(timestep.GetStep()); }
+//    Render(timestep.GetAlpha());
+//
+//The alpha is how far the remaining time is into the next step, for interpolating
+//between the previous and current simulation states.
+class FixedTimestep {
+public:
+    FixedTimestep() = default;
+    FixedTimestep(const FixedTimestep& other) = default;
+    FixedTimestep(FixedTimestep&& r_other) = default;
+    FixedTimestep& operator=(const FixedTimestep& rhs) = default;
+    FixedTimestep& operator=(FixedTimestep&& rhs) = default;
+    explicit FixedTimestep(const TimeUtils::FPSeconds& step, unsigned int maxStepsPerFrame = 8) noexcept;
+    explicit FixedTimestep(unsigned int frequency, unsigned int maxStepsPerFrame = 8) noexcept;
+    ~FixedTimestep() = default;
+
+    //Returns the number of steps now available.
+    //Time beyond maxStepsPerFrame steps is dropped so a long stall cannot snowball.
+    unsigned int Accumulate(const TimeUtils::FPSeconds& deltaSeconds) noexcept;
+    bool Step() noexcept;
+    void Reset() noexcept;
+
+    float GetAlpha() const noexcept;
+    TimeUtils::FPSeconds GetStep() const noexcept;
+    void SetStep(const TimeUtils::FPSeconds& step) noexcept;
+    unsigned int GetMaxStepsPerFrame() const noexcept;
+    void SetMaxStepsPerFrame(unsigned int maxStepsPerFrame) noexcept;
+    unsigned int GetDroppedStepCount() const noexcept;
+
+protected:
+private:
+    using seconds_t = std::chrono::duration<double>;
+
+    seconds_t _step = TimeUtils::FPFrames{1.0f};
+    seconds_t _accumulator{};
+    unsigned int _max_steps_per_frame = 8;
+    unsigned int _dropped_steps = 0;
+};
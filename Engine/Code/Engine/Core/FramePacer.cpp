@@ -0,0 +1,68 @@
+#include "Engine/Core/FramePacer.hpp"
+
+#include <algorithm>
+#include <thread>
+
+FramePacer::FramePacer() noexcept
+    : FramePacer(60u)
+{
+    /* DO NOTHING */
+}
+
+FramePacer::FramePacer(const TimeUtils::FPSeconds& period) noexcept {
+    SetPeriod(period);
+    Reset();
+}
+
+FramePacer::FramePacer(unsigned int frequency) noexcept
+    : FramePacer(TimeUtils::FPSeconds{1.0f / static_cast<float>((std::max)(1u, frequency))})
+{
+    /* DO NOTHING */
+}
+
+TimeUtils::FPSeconds FramePacer::Wait() noexcept {
+    auto now = TimeUtils::Now<clock_t>();
+    if(_deadline > now) {
+        const auto remaining = _deadline - now;
+        if(remaining > _spin_slack) {
+            std::this_thread::sleep_for(remaining - _spin_slack);
+        }
+        while((now = TimeUtils::Now<clock_t>()) < _deadline) {
+            std::this_thread::yield();
+        }
+    }
+    //More than a full period late: resynchronize instead of rushing to catch up.
+    if(now - _deadline > _period) {
+        _deadline = now + _period;
+    } else {
+        _deadline += _period;
+    }
+    const auto elapsed = TimeUtils::FPSeconds{now - _last_wait};
+    _last_wait = now;
+    return elapsed;
+}
+
+void FramePacer::Reset() noexcept {
+    _last_wait = TimeUtils::Now<clock_t>();
+    _deadline = _last_wait + _period;
+}
+
+void FramePacer::SetPeriod(const TimeUtils::FPSeconds& period) noexcept {
+    _period = std::chrono::duration_cast<clock_t::duration>(period);
+}
+
+void FramePacer::SetFrequency(unsigned int hz) noexcept {
+    SetPeriod(TimeUtils::FPSeconds{1.0f / static_cast<float>((std::max)(1u, hz))});
+}
+
+TimeUtils::FPSeconds FramePacer::GetPeriod() const noexcept {
+    return TimeUtils::FPSeconds{_period};
+}
+
+void FramePacer::SetSpinSlack(const TimeUtils::FPMilliseconds& slack) noexcept {
+    _spin_slack = std::chrono::duration_cast<clock_t::duration>(slack);
+}
+
+TimeUtils::FPMilliseconds FramePacer::GetSpinSlack() const noexcept {
+    return TimeUtils::FPMilliseconds{_spin_slack};
+}
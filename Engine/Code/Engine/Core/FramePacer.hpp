@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <chrono>
+
+//Caps the frame rate by sleeping until the next frame deadline.
+//Deadlines advance by a fixed period so sleep overshoot does not accumulate.
+//Only the final spin_slack of each wait yields instead of sleeping;
+//set it to zero to never spin (lowest CPU use, coarser pacing).
+class FramePacer {
+public:
+    FramePacer() noexcept;
+    FramePacer(const FramePacer& other) = default;
+    FramePacer(FramePacer&& r_other) = default;
+    FramePacer& operator=(const FramePacer& rhs) = default;
+    FramePacer& operator=(FramePacer&& rhs) = default;
+    explicit FramePacer(const TimeUtils::FPSeconds& period) noexcept;
+    explicit FramePacer(unsigned int frequency) noexcept;
+    ~FramePacer() = default;
+
+    //Blocks until the current frame's deadline, then returns the time since the previous call.
+    TimeUtils::FPSeconds Wait() noexcept;
+    void Reset() noexcept;
+
+    void SetPeriod(const TimeUtils::FPSeconds& period) noexcept;
+    void SetFrequency(unsigned int hz) noexcept;
+    TimeUtils::FPSeconds GetPeriod() const noexcept;
+
+    void SetSpinSlack(const TimeUtils::FPMilliseconds& slack) noexcept;
+    TimeUtils::FPMilliseconds GetSpinSlack() const noexcept;
+
+protected:
+private:
+    using clock_t = std::chrono::steady_clock;
+    using time_point_t = std::chrono::time_point<clock_t>;
+
+    clock_t::duration _period{};
+    clock_t::duration _spin_slack = std::chrono::microseconds(500);
+    time_point_t _deadline{};
+    time_point_t _last_wait{};
+};
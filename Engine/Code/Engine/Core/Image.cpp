@@ -102,13 +102,13 @@ Image::Image(Image&& img) noexcept
     , m_filepath(std::move(img.m_filepath))
     , m_isGif(std::move(m_isGif))
 {
-    std::scoped_lock<std::mutex, std::mutex>(_cs, img._cs);
+    std::scoped_lock<ProfiledMutex, ProfiledMutex>(_cs, img._cs);
     m_texelBytes = std::move(img.m_texelBytes);
 }
 
 
 Image& Image::operator=(Image&& rhs) noexcept {
-    std::scoped_lock<std::mutex, std::mutex> _lock(_cs, rhs._cs);
+    std::scoped_lock<ProfiledMutex, ProfiledMutex> _lock(_cs, rhs._cs);
     m_bytesPerTexel = std::move(rhs.m_bytesPerTexel);
     m_dimensions = std::move(rhs.m_dimensions);
     m_filepath = std::move(rhs.m_filepath);
@@ -204,16 +204,16 @@ bool Image::Export(std::filesystem::path filepath, int bytes_per_pixel /*= 4*/,
     int quality = std::clamp(jpg_quality, 0, 100);
     int result = 0;
     if(extension == ".png") {
-        std::scoped_lock<std::mutex> lock(_cs);
+        std::scoped_lock<ProfiledMutex> lock(_cs);
         result = stbi_write_png(p_str.c_str(), w, h, bbp, m_texelBytes.data(), stride);
     } else if(extension == ".bmp") {
-        std::scoped_lock<std::mutex> lock(_cs);
+        std::scoped_lock<ProfiledMutex> lock(_cs);
         result = stbi_write_bmp(p_str.c_str(), w, h, bbp, m_texelBytes.data());
     } else if(extension == ".tga") {
-        std::scoped_lock<std::mutex> lock(_cs);
+        std::scoped_lock<ProfiledMutex> lock(_cs);
         result = stbi_write_tga(p_str.c_str(), w, h, bbp, m_texelBytes.data());
     } else if(extension == ".jpg") {
-        std::scoped_lock<std::mutex> lock(_cs);
+        std::scoped_lock<ProfiledMutex> lock(_cs);
         result = stbi_write_jpg(p_str.c_str(), w, h, bbp, m_texelBytes.data(), quality);
     } else if(extension == ".hdr") {
         std::ostringstream ss;
@@ -285,7 +285,7 @@ std::string Image::GetSupportedExtensionsList() noexcept {
 }
 
 void swap(Image& a, Image& b) noexcept {
-    std::scoped_lock<std::mutex, std::mutex> _lock(a._cs, b._cs);
+    std::scoped_lock<ProfiledMutex, ProfiledMutex> _lock(a._cs, b._cs);
     std::swap(a.m_bytesPerTexel, b.m_bytesPerTexel);
     std::swap(a.m_dimensions, b.m_dimensions);
     std::swap(a.m_filepath, b.m_filepath);
@@ -4,6 +4,8 @@
 
 #include "Engine/Math/IntVector2.hpp"
 
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
 #include <memory>
 #include <mutex>
 #include <string>
@@ -51,5 +53,5 @@ private:
     std::vector<int> m_gifDelays{};
     std::filesystem::path m_filepath{};
     bool m_isGif = false;
-    std::mutex _cs{};
+    ProfiledMutex _cs{"Image"};
 };
\ No newline at end of file
@@ -1,10 +1,15 @@
 #include "Engine/Core/JobSystem.hpp"
 
+#include "Engine/Core/BuildConfig.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 #include "Engine/Core/ThreadUtils.hpp"
 #include "Engine/Core/Win.hpp"
 
+#include "Engine/Profiling/HitchRecorder.hpp"
+
+#include <algorithm>
 #include <chrono>
+#include <memory>
 #include <sstream>
 
 std::vector<ThreadSafeQueue<Job*>*> JobSystem::_queues = std::vector<ThreadSafeQueue<Job*>*>{};
@@ -17,7 +22,7 @@ void JobSystem::GenericJobWorker(std::condition_variable* signal) noexcept {
     SetCategorySignal(JobType::Generic, signal);
     while(IsRunning()) {
         if(signal) {
-            std::unique_lock<std::mutex> lock(_cs);
+            std::unique_lock<std::mutex> lock(_cs.native());
             //Condition to wake up: Not running or has jobs available
             signal->wait(lock, [&jc, this]()->bool { return !_is_running || jc.HasJobs(); });
             if(jc.HasJobs()) {
@@ -52,10 +57,17 @@ bool JobConsumer::ConsumeJob() noexcept {
         }
         auto job = queue.front();
         queue.pop();
+#ifdef PROFILE_BUILD
+        const auto job_begin = TimeUtils::Now();
+        job->work_cb(job->user_data);
+        HitchRecorder::RecordJob(job->type, job_begin, TimeUtils::Now());
+#else
         job->work_cb(job->user_data);
+#endif
         job->OnFinish();
         job->state = JobState::Finished;
-        delete job;
+        //The queue's reference, taken in Dispatch; whoever created the job may still hold one.
+        job->_job_system->Release(job);
     }
     return true;
 }
@@ -234,6 +246,48 @@ void JobSystem::WaitAndRelease(Job* job) noexcept {
     Release(job);
 }
 
+void JobSystem::ParallelFor(std::size_t count, std::size_t minBatchSize, const std::function<void(std::size_t, std::size_t)>& cb) noexcept {
+    if(!count) {
+        return;
+    }
+    //A few batches per thread so uneven batches even out.
+    const auto thread_count = GetWorkerCount() + 1;
+    const auto batch_size = (std::max)((std::max)(minBatchSize, std::size_t{1}), (count + thread_count * 4 - 1) / (thread_count * 4));
+    const auto batch_count = (count + batch_size - 1) / batch_size;
+    if(batch_count < 2 || !IsRunning()) {
+        cb(0, count);
+        return;
+    }
+
+    //Jobs that start after every batch has been claimed return without touching cb,
+    //so only the counters need to outlive this call.
+    struct counters_t {
+        std::atomic_size_t next_batch{0};
+        std::atomic_size_t finished_batches{0};
+    };
+    auto counters = std::make_shared<counters_t>();
+    const auto* callback = &cb;
+    const auto run_batches = [counters, callback, count, batch_size, batch_count]() {
+        for(auto batch = counters->next_batch++; batch < batch_count; batch = counters->next_batch++) {
+            const auto begin = batch * batch_size;
+            (*callback)(begin, (std::min)(begin + batch_size, count));
+            ++counters->finished_batches;
+        }
+    };
+    const auto job_count = (std::min)(GetWorkerCount(), batch_count - 1);
+    for(std::size_t i = 0; i < job_count; ++i) {
+        Run(JobType::Generic, [run_batches](void*) { run_batches(); }, nullptr);
+    }
+    run_batches();
+    while(counters->finished_batches < batch_count) {
+        std::this_thread::yield();
+    }
+}
+
+std::size_t JobSystem::GetWorkerCount() const noexcept {
+    return _threads.size();
+}
+
 bool JobSystem::IsRunning() const noexcept {
     bool running = _is_running;
     return running;
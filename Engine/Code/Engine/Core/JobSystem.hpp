@@ -3,6 +3,8 @@
 #include "Engine/Core/EngineSubsystem.hpp"
 #include "Engine/Core/ThreadSafeQueue.hpp"
 
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
 #include <atomic>
 #include <condition_variable>
 #include <functional>
@@ -51,6 +53,7 @@ public:
 private:
     void AddDependent(Job* dependent) noexcept;
     JobSystem* _job_system = nullptr;
+    friend class JobConsumer;
 };
 
 class JobConsumer {
@@ -81,6 +84,12 @@ public:
     void Wait(Job* job) noexcept;
     void DispatchAndRelease(Job* job) noexcept;
     void WaitAndRelease(Job* job) noexcept;
+
+    //Splits [0, count) into batches of at least minBatchSize and calls cb(begin, end) for each
+    //on the Generic workers. The calling thread works on batches too and returns when all are done.
+    void ParallelFor(std::size_t count, std::size_t minBatchSize, const std::function<void(std::size_t, std::size_t)>& cb) noexcept;
+    std::size_t GetWorkerCount() const noexcept;
+
     bool IsRunning() const noexcept;
     void SetIsRunning(bool value = true) noexcept;
 
@@ -95,7 +104,7 @@ private:
     static std::vector<std::condition_variable*> _signals;
     static std::vector<std::thread> _threads;
     std::condition_variable* _main_job_signal = nullptr;
-    std::mutex _cs{};
+    ProfiledMutex _cs{"JobSystem"};
     std::atomic_bool _is_running = false;
     friend class JobConsumer;
 };
\ No newline at end of file
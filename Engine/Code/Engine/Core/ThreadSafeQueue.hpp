@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
 #include <queue>
 #include <mutex>
 
@@ -20,60 +22,60 @@ public:
 
 protected:
 private:
-    mutable std::mutex _cs{};
+    mutable ProfiledMutex _cs{"ThreadSafeQueue"};
     std::queue<T> _queue{};
 };
 
 template<typename T>
 void ThreadSafeQueue<T>::swap(ThreadSafeQueue<T>& b) noexcept {
-    std::scoped_lock<std::mutex, std::mutex> lock(_cs, b._cs);
+    std::scoped_lock<ProfiledMutex, ProfiledMutex> lock(_cs, b._cs);
     _queue.swap(b._queue);
 }
 
 template<typename T>
 void ThreadSafeQueue<T>::push(const T& t) noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     _queue.push(t);
 }
 
 template<typename T>
 void ThreadSafeQueue<T>::pop() noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     _queue.pop();
 }
 
 template<typename T>
 decltype(auto) ThreadSafeQueue<T>::size() const noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     return _queue.size();
 }
 
 template<typename T>
 bool ThreadSafeQueue<T>::empty() const noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     return _queue.empty();
 }
 
 template<typename T>
 T& ThreadSafeQueue<T>::back() const noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     return _queue.back();
 }
 
 template<typename T>
 T& ThreadSafeQueue<T>::back() noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     return _queue.back();
 }
 
 template<typename T>
 T& ThreadSafeQueue<T>::front() const noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     return _queue.front();
 }
 
 template<typename T>
 T& ThreadSafeQueue<T>::front() noexcept {
-    std::scoped_lock<std::mutex> lock(_cs);
+    std::scoped_lock<ProfiledMutex> lock(_cs);
     return _queue.front();
 }
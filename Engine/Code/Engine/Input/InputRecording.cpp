@@ -0,0 +1,284 @@
+#include "Engine/Input/InputRecording.hpp"
+
+#include <array>
+#include <fstream>
+
+namespace {
+
+constexpr std::array<char, 4> INPUT_RECORDING_MAGIC = {'I', 'R', 'E', 'C'};
+//Version 1 stored wheel deltas as 16 bits, which wrapped large deltas; it is still read.
+constexpr std::uint8_t INPUT_RECORDING_VERSION = 2;
+constexpr std::uint8_t INPUT_RECORDING_VERSION_16BIT_WHEEL = 1;
+
+//Each frame starts with a flags byte describing what changed since the previous frame.
+enum FrameFlags : std::uint8_t {
+    FRAME_KEYS_TOGGLED     = 0b0000'0001,
+    FRAME_KEYS_FULL        = 0b0000'0010,
+    FRAME_MOUSE_COORDS     = 0b0000'0100,
+    FRAME_MOUSE_DELTA      = 0b0000'1000,
+    FRAME_WHEEL            = 0b0001'0000,
+    FRAME_WHEEL_HORIZONTAL = 0b0010'0000,
+};
+
+//Beyond this many toggled keys the full bitset is smaller.
+constexpr std::size_t MAX_TOGGLED_KEYS = 32;
+
+template<typename T>
+void WriteValue(std::ostream& output, const T& value) noexcept {
+    output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool ReadValue(std::istream& input, T& value) noexcept {
+    return static_cast<bool>(input.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+void WriteKeys(std::ostream& output, const InputRecording::keys_t& keys) noexcept {
+    std::array<std::uint8_t, InputRecording::MAX_KEYS / 8> bytes{};
+    for(std::size_t i = 0; i < keys.size(); ++i) {
+        if(keys[i]) {
+            bytes[i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+        }
+    }
+    WriteValue(output, bytes);
+}
+
+bool ReadWheel(std::istream& input, std::uint8_t version, int& wheel) noexcept {
+    if(version == INPUT_RECORDING_VERSION_16BIT_WHEEL) {
+        std::int16_t value = 0;
+        if(!ReadValue(input, value)) {
+            return false;
+        }
+        wheel = value;
+        return true;
+    }
+    std::int32_t value = 0;
+    if(!ReadValue(input, value)) {
+        return false;
+    }
+    wheel = value;
+    return true;
+}
+
+bool ReadKeys(std::istream& input, InputRecording::keys_t& keys) noexcept {
+    std::array<std::uint8_t, InputRecording::MAX_KEYS / 8> bytes{};
+    if(!ReadValue(input, bytes)) {
+        return false;
+    }
+    for(std::size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = (bytes[i / 8] & (1u << (i % 8))) != 0;
+    }
+    return true;
+}
+
+//Reports how many bytes are left after the read position; false when the stream cannot seek.
+bool GetRemainingBytes(std::istream& input, std::streamoff& remaining) noexcept {
+    const auto current = input.tellg();
+    if(current == std::streampos(-1)) {
+        return false;
+    }
+    input.seekg(0, std::ios::end);
+    const auto end = input.tellg();
+    input.clear();
+    input.seekg(current);
+    if(end == std::streampos(-1) || !input) {
+        return false;
+    }
+    remaining = end - current;
+    return true;
+}
+
+} //End anonymous
+
+InputRecording::InputRecording(const TimeUtils::FPSeconds& timestep, const keys_t& initialKeys /*= keys_t{}*/) noexcept
+    : _initial_keys(initialKeys)
+    , _timestep(timestep)
+{
+    /* DO NOTHING */
+}
+
+void InputRecording::AddFrame(const frame_t& frame) noexcept {
+    _frames.push_back(frame);
+}
+
+const InputRecording::frame_t& InputRecording::GetFrame(std::size_t index) const noexcept {
+    return _frames[index];
+}
+
+std::size_t InputRecording::GetFrameCount() const noexcept {
+    return _frames.size();
+}
+
+bool InputRecording::empty() const noexcept {
+    return _frames.empty();
+}
+
+void InputRecording::Clear() noexcept {
+    _frames.clear();
+}
+
+const InputRecording::keys_t& InputRecording::GetInitialKeys() const noexcept {
+    return _initial_keys;
+}
+
+TimeUtils::FPSeconds InputRecording::GetTimestep() const noexcept {
+    return _timestep;
+}
+
+bool InputRecording::Serialize(std::ostream& output) const noexcept {
+    WriteValue(output, INPUT_RECORDING_MAGIC);
+    WriteValue(output, INPUT_RECORDING_VERSION);
+    WriteValue(output, _timestep.count());
+    WriteValue(output, static_cast<std::uint32_t>(_frames.size()));
+    WriteKeys(output, _initial_keys);
+
+    frame_t previous{};
+    previous.keys = _initial_keys;
+    for(const auto& frame : _frames) {
+        const auto toggled = previous.keys ^ frame.keys;
+        const auto toggled_count = toggled.count();
+        std::uint8_t flags = 0;
+        if(toggled_count) {
+            flags |= toggled_count <= MAX_TOGGLED_KEYS ? FRAME_KEYS_TOGGLED : FRAME_KEYS_FULL;
+        }
+        if(frame.mouse_coords != previous.mouse_coords) {
+            flags |= FRAME_MOUSE_COORDS;
+        }
+        if(frame.mouse_delta != previous.mouse_delta) {
+            flags |= FRAME_MOUSE_DELTA;
+        }
+        if(frame.wheel) {
+            flags |= FRAME_WHEEL;
+        }
+        if(frame.wheel_horizontal) {
+            flags |= FRAME_WHEEL_HORIZONTAL;
+        }
+        WriteValue(output, flags);
+        if(flags & FRAME_KEYS_TOGGLED) {
+            WriteValue(output, static_cast<std::uint8_t>(toggled_count));
+            for(std::size_t i = 0; i < toggled.size(); ++i) {
+                if(toggled[i]) {
+                    WriteValue(output, static_cast<std::uint8_t>(i));
+                }
+            }
+        }
+        if(flags & FRAME_KEYS_FULL) {
+            WriteKeys(output, frame.keys);
+        }
+        if(flags & FRAME_MOUSE_COORDS) {
+            WriteValue(output, frame.mouse_coords.x);
+            WriteValue(output, frame.mouse_coords.y);
+        }
+        if(flags & FRAME_MOUSE_DELTA) {
+            WriteValue(output, frame.mouse_delta.x);
+            WriteValue(output, frame.mouse_delta.y);
+        }
+        if(flags & FRAME_WHEEL) {
+            WriteValue(output, static_cast<std::int32_t>(frame.wheel));
+        }
+        if(flags & FRAME_WHEEL_HORIZONTAL) {
+            WriteValue(output, static_cast<std::int32_t>(frame.wheel_horizontal));
+        }
+        previous = frame;
+    }
+    return static_cast<bool>(output);
+}
+
+bool InputRecording::Deserialize(std::istream& input) noexcept {
+    std::array<char, 4> magic{};
+    std::uint8_t version = 0;
+    float timestep = 0.0f;
+    std::uint32_t frame_count = 0;
+    keys_t initial_keys{};
+    if(!ReadValue(input, magic) || magic != INPUT_RECORDING_MAGIC) {
+        return false;
+    }
+    if(!ReadValue(input, version) || (version != INPUT_RECORDING_VERSION && version != INPUT_RECORDING_VERSION_16BIT_WHEEL)) {
+        return false;
+    }
+    if(!ReadValue(input, timestep) || !ReadValue(input, frame_count) || !ReadKeys(input, initial_keys)) {
+        return false;
+    }
+
+    std::vector<frame_t> frames{};
+    //Every frame is at least its flags byte, so a count larger than what is left is a corrupt header;
+    //checking before reserving keeps it from asking for gigabytes. Unseekable streams just grow as they read.
+    std::streamoff remaining = 0;
+    if(GetRemainingBytes(input, remaining)) {
+        if(static_cast<std::streamoff>(frame_count) > remaining) {
+            return false;
+        }
+        frames.reserve(frame_count);
+    }
+    frame_t previous{};
+    previous.keys = initial_keys;
+    for(std::uint32_t i = 0; i < frame_count; ++i) {
+        std::uint8_t flags = 0;
+        if(!ReadValue(input, flags)) {
+            return false;
+        }
+        frame_t frame = previous;
+        frame.wheel = 0;
+        frame.wheel_horizontal = 0;
+        if(flags & FRAME_KEYS_TOGGLED) {
+            std::uint8_t count = 0;
+            if(!ReadValue(input, count)) {
+                return false;
+            }
+            for(std::uint8_t k = 0; k < count; ++k) {
+                std::uint8_t index = 0;
+                if(!ReadValue(input, index)) {
+                    return false;
+                }
+                frame.keys.flip(index);
+            }
+        }
+        if(flags & FRAME_KEYS_FULL) {
+            if(!ReadKeys(input, frame.keys)) {
+                return false;
+            }
+        }
+        if(flags & FRAME_MOUSE_COORDS) {
+            if(!ReadValue(input, frame.mouse_coords.x) || !ReadValue(input, frame.mouse_coords.y)) {
+                return false;
+            }
+        }
+        if(flags & FRAME_MOUSE_DELTA) {
+            if(!ReadValue(input, frame.mouse_delta.x) || !ReadValue(input, frame.mouse_delta.y)) {
+                return false;
+            }
+        }
+        if(flags & FRAME_WHEEL) {
+            if(!ReadWheel(input, version, frame.wheel)) {
+                return false;
+            }
+        }
+        if(flags & FRAME_WHEEL_HORIZONTAL) {
+            if(!ReadWheel(input, version, frame.wheel_horizontal)) {
+                return false;
+            }
+        }
+        frames.push_back(frame);
+        previous = frame;
+    }
+    _frames = std::move(frames);
+    _initial_keys = initial_keys;
+    _timestep = TimeUtils::FPSeconds{timestep};
+    return true;
+}
+
+bool InputRecording::Save(const std::filesystem::path& filepath) const noexcept {
+    std::ofstream ofs{filepath, std::ios_base::binary};
+    if(!ofs) {
+        return false;
+    }
+    return Serialize(ofs);
+}
+
+bool InputRecording::Load(const std::filesystem::path& filepath) noexcept {
+    std::ifstream ifs{filepath, std::ios_base::binary};
+    if(!ifs) {
+        return false;
+    }
+    return Deserialize(ifs);
+}
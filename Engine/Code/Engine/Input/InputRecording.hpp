@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Math/Vector2.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+//Per-frame InputSystem state captured for deterministic replay.
+//Frames are stored uncompressed in memory and delta-encoded on disk:
+//an unchanged frame costs one byte.
+class InputRecording {
+public:
+    static constexpr std::size_t MAX_KEYS = 256;
+    using keys_t = std::bitset<MAX_KEYS>;
+
+    struct frame_t {
+        keys_t keys{};
+        Vector2 mouse_coords = Vector2::ZERO;
+        Vector2 mouse_delta = Vector2::ZERO;
+        int wheel = 0;
+        int wheel_horizontal = 0;
+    };
+
+    InputRecording() = default;
+    InputRecording(const InputRecording& other) = default;
+    InputRecording(InputRecording&& r_other) = default;
+    InputRecording& operator=(const InputRecording& rhs) = default;
+    InputRecording& operator=(InputRecording&& rhs) = default;
+    explicit InputRecording(const TimeUtils::FPSeconds& timestep, const keys_t& initialKeys = keys_t{}) noexcept;
+    ~InputRecording() = default;
+
+    void AddFrame(const frame_t& frame) noexcept;
+    const frame_t& GetFrame(std::size_t index) const noexcept;
+    std::size_t GetFrameCount() const noexcept;
+    bool empty() const noexcept;
+    void Clear() noexcept;
+
+    const keys_t& GetInitialKeys() const noexcept;
+    TimeUtils::FPSeconds GetTimestep() const noexcept;
+
+    bool Serialize(std::ostream& output) const noexcept;
+    bool Deserialize(std::istream& input) noexcept;
+    bool Save(const std::filesystem::path& filepath) const noexcept;
+    bool Load(const std::filesystem::path& filepath) noexcept;
+
+protected:
+private:
+    std::vector<frame_t> _frames{};
+    keys_t _initial_keys{};
+    TimeUtils::FPSeconds _timestep = TimeUtils::FPFrames{1.0f};
+};
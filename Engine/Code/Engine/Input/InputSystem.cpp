@@ -1,5 +1,6 @@
 #include "Engine/Input/InputSystem.hpp"
 
+#include "Engine/Core/Clock.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/Win.hpp"
 
@@ -589,6 +590,10 @@ void InputSystem::RegisterKeyUp(unsigned char keyIndex) noexcept {
 
 bool InputSystem::ProcessSystemMessage(const EngineMessage& msg) noexcept {
 
+    if(_is_playing_back) {
+        return false;
+    }
+
     LPARAM lp = msg.lparam;
     WPARAM wp = msg.wparam;
     switch(msg.wmMessageCode) {
@@ -1222,6 +1227,13 @@ void InputSystem::BeginFrame() {
     for(int i = 0; i < _connected_controller_count; ++i) {
         _xboxControllers[i].Update(i);
     }
+    if(_is_playing_back) {
+        if(_playback_frame < _recording.GetFrameCount()) {
+            ApplyRecordingFrame(_recording.GetFrame(_playback_frame++));
+        } else {
+            StopPlayback();
+        }
+    }
 }
 
 void InputSystem::Update([[maybe_unused]]TimeUtils::FPSeconds deltaSeconds) {
@@ -1233,6 +1245,9 @@ void InputSystem::Render() const {
 }
 
 void InputSystem::EndFrame() {
+    if(_is_recording) {
+        _recording.AddFrame(CaptureRecordingFrame());
+    }
     _previousKeys = _currentKeys;
     _mouseWheelPosition = 0;
     _mouseWheelHPosition = 0;
@@ -1313,3 +1328,84 @@ const XboxController& InputSystem::GetXboxController(const std::size_t& controll
 XboxController& InputSystem::GetXboxController(const std::size_t& controllerIndex) noexcept {
     return _xboxControllers[controllerIndex];
 }
+
+void InputSystem::StartRecording(const TimeUtils::FPSeconds& timestep /*= TimeUtils::FPFrames{1.0f}*/) noexcept {
+    InputRecording::keys_t initial_keys{};
+    for(std::size_t i = 0; i < _previousKeys.size(); ++i) {
+        initial_keys[i] = _previousKeys[i];
+    }
+    _recording = InputRecording{timestep, initial_keys};
+    _is_recording = true;
+}
+
+InputRecording InputSystem::StopRecording() noexcept {
+    _is_recording = false;
+    return _recording;
+}
+
+bool InputSystem::IsRecording() const noexcept {
+    return _is_recording;
+}
+
+void InputSystem::StartPlayback(const InputRecording& recording) noexcept {
+    _recording = recording;
+    _playback_frame = 0;
+    _is_recording = false;
+    _is_playing_back = true;
+    const auto& initial_keys = _recording.GetInitialKeys();
+    for(std::size_t i = 0; i < _previousKeys.size(); ++i) {
+        _previousKeys[i] = initial_keys[i];
+    }
+    _currentKeys = _previousKeys;
+    _mouseCoords = Vector2::ZERO;
+    _mouseDelta = Vector2::ZERO;
+    _mouseWheelPosition = 0;
+    _mouseWheelHPosition = 0;
+}
+
+void InputSystem::StopPlayback() noexcept {
+    _is_playing_back = false;
+}
+
+bool InputSystem::IsPlayingBack() const noexcept {
+    return _is_playing_back;
+}
+
+std::size_t InputSystem::GetPlaybackFrame() const noexcept {
+    return _playback_frame;
+}
+
+TimeUtils::FPSeconds InputSystem::GetPlaybackTimestep() const noexcept {
+    return _recording.GetTimestep();
+}
+
+void InputSystem::TickClock(Clock& masterClock) const noexcept {
+    if(_is_playing_back) {
+        masterClock.Tick(GetPlaybackTimestep());
+    } else {
+        masterClock.Tick();
+    }
+}
+
+InputRecording::frame_t InputSystem::CaptureRecordingFrame() const noexcept {
+    static_assert(static_cast<std::size_t>(KeyCode::Max) <= InputRecording::MAX_KEYS, "InputRecording cannot hold every KeyCode.");
+    InputRecording::frame_t frame{};
+    for(std::size_t i = 0; i < _currentKeys.size(); ++i) {
+        frame.keys[i] = _currentKeys[i];
+    }
+    frame.mouse_coords = _mouseCoords;
+    frame.mouse_delta = _mouseDelta;
+    frame.wheel = _mouseWheelPosition;
+    frame.wheel_horizontal = _mouseWheelHPosition;
+    return frame;
+}
+
+void InputSystem::ApplyRecordingFrame(const InputRecording::frame_t& frame) noexcept {
+    for(std::size_t i = 0; i < _currentKeys.size(); ++i) {
+        _currentKeys[i] = frame.keys[i];
+    }
+    _mouseCoords = frame.mouse_coords;
+    _mouseDelta = frame.mouse_delta;
+    _mouseWheelPosition = frame.wheel;
+    _mouseWheelHPosition = frame.wheel_horizontal;
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "Engine/Input/InputRecording.hpp"
 #include "Engine/Input/XboxController.hpp"
 
 #include "Engine/Core/EngineSubsystem.hpp"
@@ -12,6 +13,7 @@
 #include <array>
 #include <bitset>
 
+class Clock;
 class Window;
 
 enum class KeyCode : int {
@@ -341,9 +343,28 @@ public:
 
     IntVector2 GetMouseWheelPositionAsIntVector2() const noexcept;
 
+    //Recording captures the key, mouse, and wheel state at the end of every frame.
+    //Playback applies one recorded frame per BeginFrame and ignores system input messages;
+    //drive the simulation with GetPlaybackTimestep() instead of wall-clock time for identical runs,
+    //e.g. by advancing the master clock with TickClock after BeginFrame.
+    void StartRecording(const TimeUtils::FPSeconds& timestep = TimeUtils::FPFrames{1.0f}) noexcept;
+    InputRecording StopRecording() noexcept;
+    bool IsRecording() const noexcept;
+
+    void StartPlayback(const InputRecording& recording) noexcept;
+    void StopPlayback() noexcept;
+    bool IsPlayingBack() const noexcept;
+    std::size_t GetPlaybackFrame() const noexcept;
+    TimeUtils::FPSeconds GetPlaybackTimestep() const noexcept;
+    //Ticks a master clock by the playback timestep while playing back, by real time otherwise.
+    void TickClock(Clock& masterClock) const noexcept;
+
 protected:
 private:
 
+    InputRecording::frame_t CaptureRecordingFrame() const noexcept;
+    void ApplyRecordingFrame(const InputRecording::frame_t& frame) noexcept;
+
     void UpdateXboxConnectedState() noexcept;
 
     Vector2 GetScreenCenter() const noexcept;
@@ -359,4 +380,8 @@ private:
     int _mouseWheelHPosition = 0;
     int _connected_controller_count = 0;
     bool _cursor_visible = true;
+    InputRecording _recording{};
+    std::size_t _playback_frame = 0;
+    bool _is_recording = false;
+    bool _is_playing_back = false;
 };
\ No newline at end of file
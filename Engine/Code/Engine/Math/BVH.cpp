@@ -0,0 +1,598 @@
+#include "Engine/Math/BVH.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+
+constexpr std::uint32_t BIN_COUNT = 16;
+constexpr std::uint32_t MAX_LEAF_SIZE = 4;
+//Cost of visiting an interior node relative to testing one primitive.
+constexpr float TRAVERSAL_COST = 1.0f;
+//Past this depth splits fall back to the median so the tree depth stays bounded.
+constexpr std::uint32_t MAX_SAH_DEPTH = 64;
+constexpr std::size_t MAX_STACK_SIZE = 128;
+//Builds smaller than this, and subtrees smaller than the subtree size, are not worth a job.
+constexpr std::size_t MIN_PARALLEL_BUILD_SIZE = 16384;
+constexpr std::size_t MIN_PARALLEL_SUBTREE_SIZE = 4096;
+
+using node_stack_t = std::array<std::uint32_t, MAX_STACK_SIZE>;
+
+const AABB3& EmptyAABB3() noexcept {
+    constexpr auto inf = std::numeric_limits<float>::infinity();
+    static const AABB3 empty{Vector3{inf, inf, inf}, Vector3{-inf, -inf, -inf}};
+    return empty;
+}
+
+void Expand(AABB3& box, const AABB3& other) noexcept {
+    box.mins.x = (std::min)(box.mins.x, other.mins.x);
+    box.mins.y = (std::min)(box.mins.y, other.mins.y);
+    box.mins.z = (std::min)(box.mins.z, other.mins.z);
+    box.maxs.x = (std::max)(box.maxs.x, other.maxs.x);
+    box.maxs.y = (std::max)(box.maxs.y, other.maxs.y);
+    box.maxs.z = (std::max)(box.maxs.z, other.maxs.z);
+}
+
+void Expand(AABB3& box, const Vector3& point) noexcept {
+    box.mins.x = (std::min)(box.mins.x, point.x);
+    box.mins.y = (std::min)(box.mins.y, point.y);
+    box.mins.z = (std::min)(box.mins.z, point.z);
+    box.maxs.x = (std::max)(box.maxs.x, point.x);
+    box.maxs.y = (std::max)(box.maxs.y, point.y);
+    box.maxs.z = (std::max)(box.maxs.z, point.z);
+}
+
+float CalcSurfaceArea(const AABB3& box) noexcept {
+    const float dx = box.maxs.x - box.mins.x;
+    const float dy = box.maxs.y - box.mins.y;
+    const float dz = box.maxs.z - box.mins.z;
+    if(dx < 0.0f || dy < 0.0f || dz < 0.0f) {
+        return 0.0f;
+    }
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+float GetAxis(const Vector3& v, std::uint32_t axis) noexcept {
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+struct bin_t {
+    AABB3 bounds = EmptyAABB3();
+    std::uint32_t count = 0;
+};
+
+class BinMapping {
+public:
+    BinMapping(float min, float extent) noexcept
+        : _min(min)
+        , _scale(extent > 0.0f ? static_cast<float>(BIN_COUNT) / extent : 0.0f)
+    {
+        /* DO NOTHING */
+    }
+    std::uint32_t operator()(float value) const noexcept {
+        const auto bin = static_cast<int>((value - _min) * _scale);
+        return static_cast<std::uint32_t>(std::clamp(bin, 0, static_cast<int>(BIN_COUNT) - 1));
+    }
+private:
+    float _min = 0.0f;
+    float _scale = 0.0f;
+};
+
+//Box behind or entirely in front of a plane, using the center/extent form.
+bool IsBoxBehindPlane(const Vector3& center, const Vector3& extents, const Plane3& plane, bool& isInFront) noexcept {
+    const float d = plane.normal.x * center.x + plane.normal.y * center.y + plane.normal.z * center.z;
+    const float r = std::fabs(plane.normal.x) * extents.x + std::fabs(plane.normal.y) * extents.y + std::fabs(plane.normal.z) * extents.z;
+    isInFront = plane.dist <= d - r;
+    return d + r < plane.dist;
+}
+
+class SegmentTester {
+public:
+    explicit SegmentTester(const LineSegment3& segment) noexcept
+        : _origin{segment.start.x, segment.start.y, segment.start.z}
+    {
+        const Vector3 d = segment.CalcDisplacement();
+        _direction = {d.x, d.y, d.z};
+        for(std::size_t axis = 0; axis < 3; ++axis) {
+            _inv_direction[axis] = _direction[axis] != 0.0f ? 1.0f / _direction[axis] : 0.0f;
+        }
+    }
+    //Slab test clipped to [0, tMax]; tEntry is where the segment enters the box.
+    bool Intersects(const AABB3& box, float tMax, float& tEntry) const noexcept {
+        const float mins[3] = {box.mins.x, box.mins.y, box.mins.z};
+        const float maxs[3] = {box.maxs.x, box.maxs.y, box.maxs.z};
+        float t0 = 0.0f;
+        float t1 = tMax;
+        for(std::size_t axis = 0; axis < 3; ++axis) {
+            if(_direction[axis] == 0.0f) {
+                if(_origin[axis] < mins[axis] || maxs[axis] < _origin[axis]) {
+                    return false;
+                }
+                continue;
+            }
+            float t_near = (mins[axis] - _origin[axis]) * _inv_direction[axis];
+            float t_far = (maxs[axis] - _origin[axis]) * _inv_direction[axis];
+            if(t_far < t_near) {
+                std::swap(t_near, t_far);
+            }
+            t0 = (std::max)(t0, t_near);
+            t1 = (std::min)(t1, t_far);
+            if(t1 < t0) {
+                return false;
+            }
+        }
+        tEntry = t0;
+        return true;
+    }
+private:
+    std::array<float, 3> _origin{};
+    std::array<float, 3> _direction{};
+    std::array<float, 3> _inv_direction{};
+};
+
+//Depth-first walk that descends into nodes passing test and appends primitives passing test.
+template<typename Test>
+std::size_t CollectPrimitives(const std::vector<BVH::Node>& nodes, const std::vector<std::uint32_t>& indices, const std::vector<AABB3>& bounds, Test&& test, std::vector<std::size_t>& results) noexcept {
+    if(nodes.empty()) {
+        return 0;
+    }
+    const auto old_size = results.size();
+    node_stack_t stack{};
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while(top) {
+        const auto& node = nodes[stack[--top]];
+        if(!test(node.bounds)) {
+            continue;
+        }
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                if(test(bounds[i])) {
+                    results.push_back(indices[i]);
+                }
+            }
+            continue;
+        }
+        stack[top++] = node.first + 1;
+        stack[top++] = node.first;
+    }
+    return results.size() - old_size;
+}
+
+void AppendSubtree(const std::vector<BVH::Node>& nodes, const std::vector<std::uint32_t>& indices, std::uint32_t root, std::vector<std::size_t>& results) noexcept {
+    node_stack_t stack{};
+    std::size_t top = 0;
+    stack[top++] = root;
+    while(top) {
+        const auto& node = nodes[stack[--top]];
+        if(node.IsLeaf()) {
+            results.insert(std::end(results), std::begin(indices) + node.first, std::begin(indices) + node.first + node.count);
+            continue;
+        }
+        stack[top++] = node.first + 1;
+        stack[top++] = node.first;
+    }
+}
+
+} //End anonymous
+
+bool BVH::Node::IsLeaf() const noexcept {
+    return count != 0;
+}
+
+BVH::BVH(const std::vector<AABB3>& bounds, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Build(bounds, jobSystem);
+}
+
+void BVH::Build(const std::vector<AABB3>& bounds, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Build(bounds.data(), bounds.size(), jobSystem);
+}
+
+void BVH::Build(const AABB3* bounds, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Clear();
+    if(!count) {
+        return;
+    }
+    //Splits partition this array in place so every pass over a node's primitives is sequential.
+    _build_primitives.resize(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        auto& primitive = _build_primitives[i];
+        primitive.bounds = bounds[i];
+        primitive.centroid = Vector3{(bounds[i].mins.x + bounds[i].maxs.x) * 0.5f, (bounds[i].mins.y + bounds[i].maxs.y) * 0.5f, (bounds[i].mins.z + bounds[i].maxs.z) * 0.5f};
+        primitive.index = static_cast<std::uint32_t>(i);
+    }
+
+    //A subtree over n primitives needs at most 2n - 1 nodes. Each subtree gets its own
+    //slot range (root, then the left subtree, then the right) so jobs never share slots.
+    _nodes.assign(2 * count - 1, Node{});
+    const BuildTask root{0, 0, static_cast<std::uint32_t>(count), 0};
+    if(!jobSystem || count < MIN_PARALLEL_BUILD_SIZE) {
+        BuildSubtree(root);
+    } else {
+        //Split the top of the tree here until there is enough independent work for the workers.
+        const auto target_task_count = (jobSystem->GetWorkerCount() + 1) * 4;
+        std::vector<BuildTask> tasks{root};
+        bool split_any = true;
+        while(split_any && tasks.size() < target_task_count) {
+            split_any = false;
+            std::vector<BuildTask> next{};
+            next.reserve(tasks.size() * 2);
+            for(const auto& task : tasks) {
+                BuildTask left{};
+                BuildTask right{};
+                if(task.end - task.begin < MIN_PARALLEL_SUBTREE_SIZE) {
+                    next.push_back(task);
+                } else if(SplitNode(task, left, right)) {
+                    next.push_back(left);
+                    next.push_back(right);
+                    split_any = true;
+                }
+            }
+            tasks = std::move(next);
+        }
+        jobSystem->ParallelFor(tasks.size(), 1, [this, &tasks](std::size_t begin, std::size_t end) {
+            for(auto i = begin; i < end; ++i) {
+                BuildSubtree(tasks[i]);
+            }
+        });
+    }
+    ReorderDepthFirst();
+
+    //Primitive bounds are kept in leaf order so queries read them sequentially.
+    _indices.resize(count);
+    _positions.resize(count);
+    _bounds.resize(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        const auto& primitive = _build_primitives[i];
+        _indices[i] = primitive.index;
+        _positions[primitive.index] = static_cast<std::uint32_t>(i);
+        _bounds[i] = primitive.bounds;
+    }
+    _build_primitives.clear();
+    _build_primitives.shrink_to_fit();
+}
+
+void BVH::Clear() noexcept {
+    _nodes.clear();
+    _indices.clear();
+    _positions.clear();
+    _bounds.clear();
+    _build_primitives.clear();
+}
+
+bool BVH::SplitNode(const BuildTask& task, BuildTask& left, BuildTask& right) noexcept {
+    auto& node = _nodes[task.node];
+    const auto first = std::begin(_build_primitives) + task.begin;
+    const auto last = std::begin(_build_primitives) + task.end;
+    const auto count = task.end - task.begin;
+
+    node.bounds = EmptyAABB3();
+    AABB3 centroid_bounds = EmptyAABB3();
+    for(auto iter = first; iter != last; ++iter) {
+        Expand(node.bounds, iter->bounds);
+        Expand(centroid_bounds, iter->centroid);
+    }
+    const auto make_leaf = [&]() {
+        node.first = task.begin;
+        node.count = count;
+        return false;
+    };
+    //Leaf primitives are stored contiguously, so testing a few of them is cheaper than another level.
+    if(count <= MAX_LEAF_SIZE) {
+        return make_leaf();
+    }
+
+    //Binned SAH: sweep every axis and keep the cheapest split between bins.
+    const float node_area = CalcSurfaceArea(node.bounds);
+    const Vector3 centroid_extents = centroid_bounds.maxs - centroid_bounds.mins;
+    float best_cost = std::numeric_limits<float>::infinity();
+    std::uint32_t best_axis = 0;
+    std::uint32_t best_bin = 0;
+    if(task.depth < MAX_SAH_DEPTH && node_area > 0.0f) {
+        for(std::uint32_t axis = 0; axis < 3; ++axis) {
+            const auto extent = GetAxis(centroid_extents, axis);
+            if(!(extent > 0.0f)) {
+                continue;
+            }
+            const BinMapping to_bin{GetAxis(centroid_bounds.mins, axis), extent};
+            std::array<bin_t, BIN_COUNT> bins{};
+            for(auto iter = first; iter != last; ++iter) {
+                auto& bin = bins[to_bin(GetAxis(iter->centroid, axis))];
+                Expand(bin.bounds, iter->bounds);
+                ++bin.count;
+            }
+            std::array<float, BIN_COUNT> right_areas{};
+            std::array<std::uint32_t, BIN_COUNT> right_counts{};
+            AABB3 right_bounds = EmptyAABB3();
+            std::uint32_t right_count = 0;
+            for(auto i = BIN_COUNT - 1; i > 0; --i) {
+                Expand(right_bounds, bins[i].bounds);
+                right_count += bins[i].count;
+                right_areas[i] = CalcSurfaceArea(right_bounds);
+                right_counts[i] = right_count;
+            }
+            AABB3 left_bounds = EmptyAABB3();
+            std::uint32_t left_count = 0;
+            for(std::uint32_t i = 0; i < BIN_COUNT - 1; ++i) {
+                Expand(left_bounds, bins[i].bounds);
+                left_count += bins[i].count;
+                if(!left_count || !right_counts[i + 1]) {
+                    continue;
+                }
+                const auto cost = TRAVERSAL_COST + (left_count * CalcSurfaceArea(left_bounds) + right_counts[i + 1] * right_areas[i + 1]) / node_area;
+                if(cost < best_cost) {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_bin = i;
+                }
+            }
+        }
+    }
+
+    std::uint32_t mid = 0;
+    if(best_cost < std::numeric_limits<float>::infinity()) {
+        const BinMapping to_bin{GetAxis(centroid_bounds.mins, best_axis), GetAxis(centroid_extents, best_axis)};
+        const auto split = std::partition(first, last, [&](const BuildPrimitive& primitive) { return to_bin(GetAxis(primitive.centroid, best_axis)) <= best_bin; });
+        mid = static_cast<std::uint32_t>(split - std::begin(_build_primitives));
+    } else {
+        //No usable SAH split (coincident centroids or too deep): halve along the widest axis.
+        const std::uint32_t axis = centroid_extents.x >= centroid_extents.y && centroid_extents.x >= centroid_extents.z ? 0 : (centroid_extents.y >= centroid_extents.z ? 1 : 2);
+        mid = task.begin + count / 2;
+        std::nth_element(first, std::begin(_build_primitives) + mid, last, [&](const BuildPrimitive& a, const BuildPrimitive& b) { return GetAxis(a.centroid, axis) < GetAxis(b.centroid, axis); });
+    }
+
+    left = BuildTask{task.node + 1, task.begin, mid, task.depth + 1};
+    right = BuildTask{task.node + 2 * (mid - task.begin), mid, task.end, task.depth + 1};
+    //Until ReorderDepthFirst runs, interior nodes point at their right child.
+    node.first = right.node;
+    node.count = 0;
+    return true;
+}
+
+void BVH::BuildSubtree(const BuildTask& task) noexcept {
+    BuildTask left{};
+    BuildTask right{};
+    if(SplitNode(task, left, right)) {
+        BuildSubtree(left);
+        BuildSubtree(right);
+    }
+}
+
+void BVH::ReorderDepthFirst() noexcept {
+    std::vector<Node> ordered{};
+    ordered.reserve(_nodes.size());
+    ordered.push_back(_nodes[0]);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack{{0u, 0u}};
+    while(!stack.empty()) {
+        const auto old_index = stack.back().first;
+        const auto new_index = stack.back().second;
+        stack.pop_back();
+        const auto& node = _nodes[old_index];
+        if(node.IsLeaf()) {
+            continue;
+        }
+        const auto pair = static_cast<std::uint32_t>(ordered.size());
+        ordered.push_back(_nodes[old_index + 1]);
+        ordered.push_back(_nodes[node.first]);
+        ordered[new_index].first = pair;
+        stack.emplace_back(node.first, pair + 1);
+        stack.emplace_back(old_index + 1, pair);
+    }
+    _nodes = std::move(ordered);
+}
+
+void BVH::SetPrimitiveBounds(std::size_t index, const AABB3& bounds) noexcept {
+    _bounds[_positions[index]] = bounds;
+}
+
+void BVH::Refit(const std::vector<AABB3>& bounds) noexcept {
+    Refit(bounds.data(), bounds.size());
+}
+
+void BVH::Refit(const AABB3* bounds, std::size_t count) noexcept {
+    const auto refit_count = (std::min)(count, _bounds.size());
+    for(std::size_t i = 0; i < refit_count; ++i) {
+        _bounds[_positions[i]] = bounds[i];
+    }
+    Refit();
+}
+
+void BVH::Refit() noexcept {
+    //Children always come after their parent, so a reverse sweep sees them first.
+    for(auto i = _nodes.size(); i-- > 0;) {
+        auto& node = _nodes[i];
+        if(node.IsLeaf()) {
+            node.bounds = _bounds[node.first];
+            for(auto j = node.first + 1; j < node.first + node.count; ++j) {
+                Expand(node.bounds, _bounds[j]);
+            }
+        } else {
+            node.bounds = _nodes[node.first].bounds;
+            Expand(node.bounds, _nodes[node.first + 1].bounds);
+        }
+    }
+}
+
+bool BVH::empty() const noexcept {
+    return _nodes.empty();
+}
+
+std::size_t BVH::size() const noexcept {
+    return _bounds.size();
+}
+
+const AABB3& BVH::GetBounds() const noexcept {
+    static const AABB3 empty_bounds{};
+    if(_nodes.empty()) {
+        return empty_bounds;
+    }
+    return _nodes.front().bounds;
+}
+
+const AABB3& BVH::GetPrimitiveBounds(std::size_t index) const noexcept {
+    return _bounds[_positions[index]];
+}
+
+const std::vector<BVH::Node>& BVH::GetNodes() const noexcept {
+    return _nodes;
+}
+
+const std::vector<std::uint32_t>& BVH::GetPrimitiveIndices() const noexcept {
+    return _indices;
+}
+
+std::size_t BVH::CalcDepth() const noexcept {
+    if(_nodes.empty()) {
+        return 0;
+    }
+    std::size_t depth = 0;
+    std::vector<std::pair<std::uint32_t, std::size_t>> stack{{0u, std::size_t{1}}};
+    while(!stack.empty()) {
+        const auto index = stack.back().first;
+        const auto node_depth = stack.back().second;
+        stack.pop_back();
+        depth = (std::max)(depth, node_depth);
+        if(!_nodes[index].IsLeaf()) {
+            stack.emplace_back(_nodes[index].first, node_depth + 1);
+            stack.emplace_back(_nodes[index].first + 1, node_depth + 1);
+        }
+    }
+    return depth;
+}
+
+std::size_t BVH::QueryOverlap(const AABB3& box, std::vector<std::size_t>& results) const noexcept {
+    return CollectPrimitives(_nodes, _indices, _bounds, [&box](const AABB3& bounds) { return MathUtils::DoAABBsOverlap(box, bounds); }, results);
+}
+
+std::size_t BVH::QueryOverlap(const Sphere3& sphere, std::vector<std::size_t>& results) const noexcept {
+    const auto radius_squared = sphere.radius * sphere.radius;
+    return CollectPrimitives(_nodes, _indices, _bounds, [&sphere, radius_squared](const AABB3& bounds) {
+        return MathUtils::CalcDistanceSquared(sphere.center, MathUtils::CalcClosestPoint(sphere.center, bounds)) <= radius_squared;
+    }, results);
+}
+
+std::size_t BVH::QueryRay(const LineSegment3& segment, std::vector<std::size_t>& results) const noexcept {
+    const SegmentTester tester{segment};
+    return CollectPrimitives(_nodes, _indices, _bounds, [&tester](const AABB3& bounds) {
+        float t = 0.0f;
+        return tester.Intersects(bounds, 1.0f, t);
+    }, results);
+}
+
+std::size_t BVH::QueryVisible(const Frustum& frustum, std::vector<std::size_t>& results) const noexcept {
+    if(_nodes.empty()) {
+        return 0;
+    }
+    const std::array<Plane3, 6> planes{frustum.GetLeft(), frustum.GetRight(), frustum.GetTop(), frustum.GetBottom(), frustum.GetNear(), frustum.GetFar()};
+    //Each entry carries the planes its node may still cross; once a node is in front
+    //of every plane its whole subtree is visible without further tests.
+    constexpr std::uint32_t all_planes = (1u << 6) - 1;
+    const auto classify = [&planes](const AABB3& box, std::uint32_t& mask) {
+        const Vector3 center = (box.mins + box.maxs) * 0.5f;
+        const Vector3 extents = (box.maxs - box.mins) * 0.5f;
+        for(std::uint32_t i = 0; i < planes.size(); ++i) {
+            if(!(mask & (1u << i))) {
+                continue;
+            }
+            bool in_front = false;
+            if(IsBoxBehindPlane(center, extents, planes[i], in_front)) {
+                return false;
+            }
+            if(in_front) {
+                mask &= ~(1u << i);
+            }
+        }
+        return true;
+    };
+
+    const auto old_size = results.size();
+    std::array<std::pair<std::uint32_t, std::uint32_t>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, all_planes);
+    while(top) {
+        const auto entry = stack[--top];
+        const auto& node = _nodes[entry.first];
+        auto mask = entry.second;
+        if(!classify(node.bounds, mask)) {
+            continue;
+        }
+        if(!mask) {
+            AppendSubtree(_nodes, _indices, entry.first, results);
+            continue;
+        }
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                auto primitive_mask = mask;
+                if(classify(_bounds[i], primitive_mask)) {
+                    results.push_back(_indices[i]);
+                }
+            }
+            continue;
+        }
+        stack[top++] = std::make_pair(node.first + 1, mask);
+        stack[top++] = std::make_pair(node.first, mask);
+    }
+    return results.size() - old_size;
+}
+
+bool BVH::Raycast(const LineSegment3& segment, std::size_t& hitIndex, float& hitT) const noexcept {
+    if(_nodes.empty()) {
+        return false;
+    }
+    const SegmentTester tester{segment};
+    float best_t = 1.0f;
+    bool hit = false;
+    float root_t = 0.0f;
+    if(!tester.Intersects(_nodes[0].bounds, best_t, root_t)) {
+        return false;
+    }
+    //Visit the nearer child first and skip anything that starts beyond the closest hit so far.
+    std::array<std::pair<std::uint32_t, float>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, root_t);
+    while(top) {
+        const auto entry = stack[--top];
+        if(hit && best_t < entry.second) {
+            continue;
+        }
+        const auto& node = _nodes[entry.first];
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                float t = 0.0f;
+                if(tester.Intersects(_bounds[i], best_t, t) && (!hit || t < best_t)) {
+                    hit = true;
+                    best_t = t;
+                    hitIndex = _indices[i];
+                }
+            }
+            continue;
+        }
+        float t_left = 0.0f;
+        float t_right = 0.0f;
+        const bool hit_left = tester.Intersects(_nodes[node.first].bounds, best_t, t_left);
+        const bool hit_right = tester.Intersects(_nodes[node.first + 1].bounds, best_t, t_right);
+        if(hit_left && hit_right) {
+            const bool left_first = t_left <= t_right;
+            stack[top++] = left_first ? std::make_pair(node.first + 1, t_right) : std::make_pair(node.first, t_left);
+            stack[top++] = left_first ? std::make_pair(node.first, t_left) : std::make_pair(node.first + 1, t_right);
+        } else if(hit_left) {
+            stack[top++] = std::make_pair(node.first, t_left);
+        } else if(hit_right) {
+            stack[top++] = std::make_pair(node.first + 1, t_right);
+        }
+    }
+    if(hit) {
+        hitT = best_t;
+    }
+    return hit;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Engine/Math/AABB3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Frustum;
+class JobSystem;
+class LineSegment3;
+class Sphere3;
+
+//Bounding volume hierarchy over a set of AABB3 primitives.
+//Built top-down with binned surface area heuristic splits. Nodes live in one flat array
+//in depth-first order with siblings stored next to each other.
+//Queries report primitive indices in the order the bounds were given to Build.
+class BVH {
+public:
+
+    struct Node {
+        AABB3 bounds{};
+        //Interior nodes: index of the left child; the right child follows it.
+        //Leaves: offset of the first primitive in the leaf's run of primitive indices.
+        std::uint32_t first = 0;
+        //Number of primitives in a leaf; zero for interior nodes.
+        std::uint32_t count = 0;
+        bool IsLeaf() const noexcept;
+    };
+
+    BVH() = default;
+    BVH(const BVH& other) = default;
+    BVH(BVH&& other) = default;
+    BVH& operator=(const BVH& other) = default;
+    BVH& operator=(BVH&& other) = default;
+    ~BVH() = default;
+
+    explicit BVH(const std::vector<AABB3>& bounds, JobSystem* jobSystem = nullptr) noexcept;
+
+    //When a JobSystem is given, subtrees of large builds are built on its Generic workers.
+    void Build(const AABB3* bounds, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+    void Build(const std::vector<AABB3>& bounds, JobSystem* jobSystem = nullptr) noexcept;
+    void Clear() noexcept;
+
+    //For moving primitives: update their bounds, then Refit. The tree shape is kept,
+    //so query cost slowly degrades as primitives move far from where they were built.
+    void SetPrimitiveBounds(std::size_t index, const AABB3& bounds) noexcept;
+    void Refit() noexcept;
+    void Refit(const AABB3* bounds, std::size_t count) noexcept;
+    void Refit(const std::vector<AABB3>& bounds) noexcept;
+
+    bool empty() const noexcept;
+    std::size_t size() const noexcept;
+    //Bounds of every primitive; an empty box at the origin when the tree is empty.
+    const AABB3& GetBounds() const noexcept;
+    const AABB3& GetPrimitiveBounds(std::size_t index) const noexcept;
+    const std::vector<Node>& GetNodes() const noexcept;
+    const std::vector<std::uint32_t>& GetPrimitiveIndices() const noexcept;
+    std::size_t CalcDepth() const noexcept;
+
+    //Queries append the indices of primitives whose bounds pass the test to results
+    //and return how many were added.
+    std::size_t QueryOverlap(const AABB3& box, std::vector<std::size_t>& results) const noexcept;
+    std::size_t QueryOverlap(const Sphere3& sphere, std::vector<std::size_t>& results) const noexcept;
+    std::size_t QueryVisible(const Frustum& frustum, std::vector<std::size_t>& results) const noexcept;
+    std::size_t QueryRay(const LineSegment3& segment, std::vector<std::size_t>& results) const noexcept;
+
+    //Finds the primitive whose bounds the segment enters first.
+    //hitT is the fraction along the segment, zero when the segment starts inside the bounds.
+    bool Raycast(const LineSegment3& segment, std::size_t& hitIndex, float& hitT) const noexcept;
+
+protected:
+private:
+    struct BuildTask {
+        std::uint32_t node = 0;
+        std::uint32_t begin = 0;
+        std::uint32_t end = 0;
+        std::uint32_t depth = 0;
+    };
+    struct BuildPrimitive {
+        AABB3 bounds{};
+        Vector3 centroid{};
+        std::uint32_t index = 0;
+    };
+
+    bool SplitNode(const BuildTask& task, BuildTask& left, BuildTask& right) noexcept;
+    void BuildSubtree(const BuildTask& task) noexcept;
+    void ReorderDepthFirst() noexcept;
+
+    std::vector<Node> _nodes{};
+    //Leaves refer to runs of _indices; _bounds is stored in the same order.
+    //_positions maps a primitive index back to its slot.
+    std::vector<std::uint32_t> _indices{};
+    std::vector<std::uint32_t> _positions{};
+    std::vector<AABB3> _bounds{};
+    std::vector<BuildPrimitive> _build_primitives{};
+};
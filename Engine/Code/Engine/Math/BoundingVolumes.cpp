@@ -0,0 +1,900 @@
+#include "Engine/Math/BoundingVolumes.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+//Smaller sets are not worth handing to the JobSystem.
+constexpr std::size_t MIN_PARALLEL_POINT_COUNT = std::size_t{1} << 15;
+constexpr std::size_t MIN_POINTS_PER_CHUNK = std::size_t{1} << 13;
+//CalcMinimalBoundingSphere runs on the hull of sets at least this large.
+constexpr std::size_t MIN_HULL_REDUCTION_COUNT = 1024;
+constexpr float SPHERE_PADDING = 1e-5f;
+constexpr std::uint32_t NO_INDEX = (std::numeric_limits<std::uint32_t>::max)();
+
+std::size_t CalcChunkCount(JobSystem* jobSystem, std::size_t count) noexcept {
+    if(!jobSystem || count < MIN_PARALLEL_POINT_COUNT) {
+        return 1;
+    }
+    return (std::min)(count / MIN_POINTS_PER_CHUNK, 4 * (jobSystem->GetWorkerCount() + 1));
+}
+
+//Runs kernel(chunk, begin, end) for chunkCount even slices of [0, count).
+template<typename F>
+void RunChunks(JobSystem* jobSystem, std::size_t count, std::size_t chunkCount, F&& kernel) noexcept {
+    const auto run = [&](std::size_t first, std::size_t last) {
+        for(auto chunk = first; chunk < last; ++chunk) {
+            kernel(chunk, count * chunk / chunkCount, count * (chunk + 1) / chunkCount);
+        }
+    };
+    if(jobSystem && 1 < chunkCount) {
+        jobSystem->ParallelFor(chunkCount, 1, run);
+    } else {
+        run(0, chunkCount);
+    }
+}
+
+//Distances below this are treated as zero: a few units in the last place of the largest coordinates.
+template<typename T>
+float CalcHullTolerance(const T* points, std::size_t count) noexcept {
+    T max_abs{};
+    for(std::size_t i = 0; i < count; ++i) {
+        max_abs.x = (std::max)(max_abs.x, std::abs(points[i].x));
+        max_abs.y = (std::max)(max_abs.y, std::abs(points[i].y));
+        if constexpr(std::is_same_v<T, Vector3>) {
+            max_abs.z = (std::max)(max_abs.z, std::abs(points[i].z));
+        }
+    }
+    auto sum = max_abs.x + max_abs.y;
+    if constexpr(std::is_same_v<T, Vector3>) {
+        sum += max_abs.z;
+    }
+    return 3.0f * std::numeric_limits<float>::epsilon() * sum;
+}
+
+//extremes holds the indices of the points with the smallest and largest x, then y, then z.
+//Replaces any of them that candidate goes beyond; ties keep the index already there.
+template<typename Index>
+void UpdateExtremes(const Vector3* points, std::array<Index, 6>& extremes, Index candidate) noexcept {
+    const auto& p = points[candidate];
+    if(p.x < points[extremes[0]].x) {
+        extremes[0] = candidate;
+    }
+    if(points[extremes[1]].x < p.x) {
+        extremes[1] = candidate;
+    }
+    if(p.y < points[extremes[2]].y) {
+        extremes[2] = candidate;
+    }
+    if(points[extremes[3]].y < p.y) {
+        extremes[3] = candidate;
+    }
+    if(p.z < points[extremes[4]].z) {
+        extremes[4] = candidate;
+    }
+    if(points[extremes[5]].z < p.z) {
+        extremes[5] = candidate;
+    }
+}
+
+float CalcCross(const Vector2& origin, const Vector2& a, const Vector2& b) noexcept {
+    return (a.x - origin.x) * (b.y - origin.y) - (a.y - origin.y) * (b.x - origin.x);
+}
+
+//Indices of the hull of points, counter-clockwise. Every chain a -> b is split at the point farthest
+//to its right until no point is left outside it; chains are handled in order so their starts come out in order.
+void BuildHull2D(const Vector2* points, std::size_t count, std::vector<std::uint32_t>& hull) noexcept {
+    hull.clear();
+    if(!count) {
+        return;
+    }
+    std::uint32_t left = 0;
+    std::uint32_t right = 0;
+    for(std::uint32_t i = 1; i < count; ++i) {
+        const auto& p = points[i];
+        if(p.x < points[left].x || (p.x == points[left].x && p.y < points[left].y)) {
+            left = i;
+        }
+        if(points[right].x < p.x || (p.x == points[right].x && points[right].y < p.y)) {
+            right = i;
+        }
+    }
+    if(points[left] == points[right]) {
+        hull.push_back(left);
+        return;
+    }
+    const auto tolerance = CalcHullTolerance(points, count);
+    struct Chain {
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        std::vector<std::uint32_t> outside{};
+    };
+    //Left of the line is inside for a counter-clockwise hull; the lower chain runs left to right.
+    std::vector<Chain> stack(2);
+    stack[0].a = right;
+    stack[0].b = left;
+    stack[1].a = left;
+    stack[1].b = right;
+    const auto threshold = tolerance * (points[right] - points[left]).CalcLength();
+    for(std::uint32_t i = 0; i < count; ++i) {
+        const auto cross = CalcCross(points[left], points[right], points[i]);
+        if(cross < -threshold) {
+            stack[1].outside.push_back(i);
+        } else if(threshold < cross) {
+            stack[0].outside.push_back(i);
+        }
+    }
+    while(!stack.empty()) {
+        auto chain = std::move(stack.back());
+        stack.pop_back();
+        if(chain.outside.empty()) {
+            hull.push_back(chain.a);
+            continue;
+        }
+        const auto& a = points[chain.a];
+        const auto& b = points[chain.b];
+        auto farthest = chain.outside[0];
+        auto farthest_cross = 0.0f;
+        for(const auto i : chain.outside) {
+            const auto cross = CalcCross(a, b, points[i]);
+            if(cross < farthest_cross) {
+                farthest_cross = cross;
+                farthest = i;
+            }
+        }
+        const auto& c = points[farthest];
+        Chain before{chain.a, farthest, {}};
+        Chain after{farthest, chain.b, {}};
+        const auto threshold_before = tolerance * (c - a).CalcLength();
+        const auto threshold_after = tolerance * (b - c).CalcLength();
+        for(const auto i : chain.outside) {
+            if(CalcCross(a, c, points[i]) < -threshold_before) {
+                before.outside.push_back(i);
+            } else if(CalcCross(c, b, points[i]) < -threshold_after) {
+                after.outside.push_back(i);
+            }
+        }
+        stack.push_back(std::move(after));
+        stack.push_back(std::move(before));
+    }
+}
+
+struct HullFace {
+    std::array<std::uint32_t, 3> vertices{};
+    //neighbors[i] shares the edge from vertices[i] to vertices[(i + 1) % 3].
+    std::array<std::uint32_t, 3> neighbors{};
+    Vector3 normal{};
+    float offset = 0.0f;
+    //Points above this face and no other that was tried first; furthest is the one farthest above it.
+    std::vector<std::uint32_t> outside{};
+    std::uint32_t furthest = 0;
+    float furthest_distance = 0.0f;
+    bool alive = true;
+    bool visible = false;
+};
+
+//3D quickhull (Barber, Dobkin and Huhdanpaa, 1996): start from a tetrahedron, then repeatedly add the point
+//farthest outside a face, replacing every face it can see with a fan from the horizon to the point.
+class HullBuilder {
+public:
+    HullBuilder(const Vector3* points, std::size_t count) noexcept
+        : _points(points)
+        , _count(count)
+        , _tolerance(CalcHullTolerance(points, count))
+    {
+        /* DO NOTHING */
+    }
+
+    void Build(ConvexHull3& hull) noexcept {
+        hull.vertices.clear();
+        hull.indices.clear();
+        if(!_count || !BuildSimplex(hull)) {
+            return;
+        }
+        while(!_pending.empty()) {
+            const auto face = _pending.back();
+            _pending.pop_back();
+            if(_faces[face].alive && !_faces[face].outside.empty()) {
+                AddPoint(face);
+            }
+        }
+        std::vector<std::uint32_t> remap(_count, NO_INDEX);
+        for(const auto& face : _faces) {
+            if(!face.alive) {
+                continue;
+            }
+            for(const auto vertex : face.vertices) {
+                if(remap[vertex] == NO_INDEX) {
+                    remap[vertex] = static_cast<std::uint32_t>(hull.vertices.size());
+                    hull.vertices.push_back(_points[vertex]);
+                }
+                hull.indices.push_back(remap[vertex]);
+            }
+        }
+    }
+
+private:
+    struct HorizonEdge {
+        std::uint32_t a = 0;
+        std::uint32_t b = 0;
+        std::uint32_t face = 0;
+        std::uint32_t edge = 0;
+    };
+
+    struct SearchFrame {
+        std::uint32_t face = 0;
+        std::uint32_t edge = 0;
+        std::uint32_t remaining = 0;
+    };
+
+    float CalcDistance(const HullFace& face, std::uint32_t point) const noexcept {
+        return MathUtils::DotProduct(face.normal, _points[point]) - face.offset;
+    }
+
+    std::uint32_t AddFace(std::uint32_t a, std::uint32_t b, std::uint32_t c) noexcept {
+        HullFace face{};
+        face.vertices = {a, b, c};
+        face.normal = MathUtils::CrossProduct(_points[b] - _points[a], _points[c] - _points[a]).GetNormalize();
+        face.offset = MathUtils::DotProduct(face.normal, _points[a]);
+        _faces.push_back(std::move(face));
+        return static_cast<std::uint32_t>(_faces.size() - 1);
+    }
+
+    //Gives point to the face in [first, last) it is farthest above, if it is above any.
+    void AssignPoint(std::uint32_t point, std::size_t first, std::size_t last) noexcept {
+        auto best = _tolerance;
+        auto best_face = NO_INDEX;
+        for(auto i = first; i < last; ++i) {
+            const auto distance = CalcDistance(_faces[i], point);
+            if(best < distance) {
+                best = distance;
+                best_face = static_cast<std::uint32_t>(i);
+            }
+        }
+        if(best_face == NO_INDEX) {
+            return;
+        }
+        auto& face = _faces[best_face];
+        if(face.outside.empty() || face.furthest_distance < best) {
+            face.furthest = point;
+            face.furthest_distance = best;
+        }
+        face.outside.push_back(point);
+    }
+
+    //Returns false when the points are flat and hull already holds their outline.
+    bool BuildSimplex(ConvexHull3& hull) noexcept {
+        std::array<std::uint32_t, 6> extremes{};
+        for(std::uint32_t i = 1; i < _count; ++i) {
+            UpdateExtremes(_points, extremes, i);
+        }
+        auto i0 = extremes[0];
+        auto i1 = extremes[0];
+        auto widest = 0.0f;
+        for(std::size_t a = 0; a < extremes.size(); ++a) {
+            for(auto b = a + 1; b < extremes.size(); ++b) {
+                const auto distance = (_points[extremes[b]] - _points[extremes[a]]).CalcLengthSquared();
+                if(widest < distance) {
+                    widest = distance;
+                    i0 = extremes[a];
+                    i1 = extremes[b];
+                }
+            }
+        }
+        if(std::sqrt(widest) <= _tolerance) {
+            hull.vertices.push_back(_points[i0]);
+            return false;
+        }
+        const auto& p0 = _points[i0];
+        const auto direction = (_points[i1] - p0).GetNormalize();
+        auto i2 = i0;
+        auto farthest = 0.0f;
+        for(std::uint32_t i = 0; i < _count; ++i) {
+            const auto distance = MathUtils::CrossProduct(_points[i] - p0, direction).CalcLengthSquared();
+            if(farthest < distance) {
+                farthest = distance;
+                i2 = i;
+            }
+        }
+        if(std::sqrt(farthest) <= _tolerance) {
+            hull.vertices.push_back(_points[i0]);
+            hull.vertices.push_back(_points[i1]);
+            return false;
+        }
+        const auto normal = MathUtils::CrossProduct(_points[i1] - p0, _points[i2] - p0).GetNormalize();
+        auto i3 = i0;
+        farthest = 0.0f;
+        for(std::uint32_t i = 0; i < _count; ++i) {
+            const auto distance = std::abs(MathUtils::DotProduct(_points[i] - p0, normal));
+            if(farthest < distance) {
+                farthest = distance;
+                i3 = i;
+            }
+        }
+        if(farthest <= _tolerance) {
+            BuildFlatHull(normal, hull);
+            return false;
+        }
+        //The base faces away from the apex; the sides wind the same way around it.
+        if(0.0f < MathUtils::DotProduct(_points[i3] - p0, normal)) {
+            std::swap(i1, i2);
+        }
+        AddFace(i0, i1, i2);
+        AddFace(i0, i3, i1);
+        AddFace(i1, i3, i2);
+        AddFace(i2, i3, i0);
+        for(auto& face : _faces) {
+            for(std::size_t edge = 0; edge < 3; ++edge) {
+                const auto a = face.vertices[edge];
+                const auto b = face.vertices[(edge + 1) % 3];
+                for(std::uint32_t other = 0; other < 4; ++other) {
+                    const auto& vertices = _faces[other].vertices;
+                    for(std::size_t other_edge = 0; other_edge < 3; ++other_edge) {
+                        if(vertices[other_edge] == b && vertices[(other_edge + 1) % 3] == a) {
+                            face.neighbors[edge] = other;
+                        }
+                    }
+                }
+            }
+        }
+        for(std::uint32_t i = 0; i < _count; ++i) {
+            AssignPoint(i, 0, 4);
+        }
+        for(std::uint32_t face = 0; face < 4; ++face) {
+            if(!_faces[face].outside.empty()) {
+                _pending.push_back(face);
+            }
+        }
+        return true;
+    }
+
+    void BuildFlatHull(const Vector3& normal, ConvexHull3& hull) const noexcept {
+        const auto& origin = _points[0];
+        const auto u = MathUtils::CrossProduct(normal, std::abs(normal.x) < 0.6f ? Vector3::X_AXIS : Vector3::Y_AXIS).GetNormalize();
+        const auto v = MathUtils::CrossProduct(normal, u);
+        std::vector<Vector2> projected(_count);
+        for(std::size_t i = 0; i < _count; ++i) {
+            const auto displacement = _points[i] - origin;
+            projected[i] = Vector2{MathUtils::DotProduct(displacement, u), MathUtils::DotProduct(displacement, v)};
+        }
+        std::vector<std::uint32_t> outline{};
+        BuildHull2D(projected.data(), projected.size(), outline);
+        for(const auto i : outline) {
+            hull.vertices.push_back(_points[i]);
+        }
+    }
+
+    //Depth-first walk over the faces the eye can see. Each edge to a face it cannot see is on the horizon;
+    //visiting edges in winding order lists the horizon as a loop.
+    bool FindHorizon(std::uint32_t face, std::uint32_t eye) noexcept {
+        _visible.clear();
+        _horizon.clear();
+        _frames.clear();
+        _faces[face].visible = true;
+        _visible.push_back(face);
+        _frames.push_back(SearchFrame{face, 0, 3});
+        while(!_frames.empty()) {
+            auto& frame = _frames.back();
+            if(!frame.remaining) {
+                _frames.pop_back();
+                continue;
+            }
+            const auto current = frame.face;
+            const auto edge = frame.edge;
+            frame.edge = (edge + 1) % 3;
+            --frame.remaining;
+            const auto neighbor = _faces[current].neighbors[edge];
+            if(_faces[neighbor].visible) {
+                continue;
+            }
+            const auto a = _faces[current].vertices[edge];
+            const auto b = _faces[current].vertices[(edge + 1) % 3];
+            std::uint32_t back = 0;
+            while(back < 3 && _faces[neighbor].vertices[back] != b) {
+                ++back;
+            }
+            if(back == 3) {
+                return false;
+            }
+            if(_tolerance < CalcDistance(_faces[neighbor], eye)) {
+                _faces[neighbor].visible = true;
+                _visible.push_back(neighbor);
+                _frames.push_back(SearchFrame{neighbor, (back + 1) % 3, 2});
+            } else {
+                _horizon.push_back(HorizonEdge{a, b, neighbor, back});
+            }
+        }
+        if(_horizon.size() < 3) {
+            return false;
+        }
+        for(std::size_t i = 0; i < _horizon.size(); ++i) {
+            if(_horizon[i].b != _horizon[(i + 1) % _horizon.size()].a) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void AddPoint(std::uint32_t face) noexcept {
+        const auto eye = _faces[face].furthest;
+        if(!FindHorizon(face, eye)) {
+            //Rounding left the visible region with a broken outline. The point is within a hair of
+            //the hull here, so drop it rather than risk a hull with holes.
+            for(const auto visible : _visible) {
+                _faces[visible].visible = false;
+            }
+            auto& outside = _faces[face].outside;
+            outside.erase(std::remove(outside.begin(), outside.end(), eye), outside.end());
+            _faces[face].furthest_distance = 0.0f;
+            for(const auto point : outside) {
+                const auto distance = CalcDistance(_faces[face], point);
+                if(_faces[face].furthest_distance < distance) {
+                    _faces[face].furthest = point;
+                    _faces[face].furthest_distance = distance;
+                }
+            }
+            if(!outside.empty()) {
+                _pending.push_back(face);
+            }
+            return;
+        }
+        const auto first = _faces.size();
+        const auto horizon_size = _horizon.size();
+        for(const auto& edge : _horizon) {
+            const auto added = AddFace(edge.a, edge.b, eye);
+            _faces[added].neighbors[0] = edge.face;
+            _faces[edge.face].neighbors[edge.edge] = added;
+        }
+        for(std::size_t i = 0; i < horizon_size; ++i) {
+            auto& added = _faces[first + i];
+            added.neighbors[1] = static_cast<std::uint32_t>(first + (i + 1) % horizon_size);
+            added.neighbors[2] = static_cast<std::uint32_t>(first + (i + horizon_size - 1) % horizon_size);
+        }
+        for(const auto visible : _visible) {
+            auto orphans = std::move(_faces[visible].outside);
+            _faces[visible].outside.clear();
+            _faces[visible].alive = false;
+            for(const auto point : orphans) {
+                if(point != eye) {
+                    AssignPoint(point, first, _faces.size());
+                }
+            }
+        }
+        for(auto i = first; i < _faces.size(); ++i) {
+            if(!_faces[i].outside.empty()) {
+                _pending.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    const Vector3* _points = nullptr;
+    std::size_t _count = 0;
+    float _tolerance = 0.0f;
+    std::vector<HullFace> _faces{};
+    std::vector<std::uint32_t> _pending{};
+    std::vector<std::uint32_t> _visible{};
+    std::vector<HorizonEdge> _horizon{};
+    std::vector<SearchFrame> _frames{};
+};
+
+Sphere3 MergeSpheres(const Sphere3& a, const Sphere3& b) noexcept {
+    const auto distance = (b.center - a.center).CalcLength();
+    if(distance + b.radius <= a.radius) {
+        return a;
+    }
+    if(distance + a.radius <= b.radius) {
+        return b;
+    }
+    const auto radius = 0.5f * (distance + a.radius + b.radius);
+    return Sphere3{a.center + (b.center - a.center) * ((radius - a.radius) / distance), radius};
+}
+
+Sphere3 CalcSphereThrough(const Vector3& a, const Vector3& b) noexcept {
+    return Sphere3{(a + b) * 0.5f, 0.5f * (b - a).CalcLength()};
+}
+
+//Circumcircle of the triangle; the widest pair when the points are in a line.
+Sphere3 CalcSphereThrough(const Vector3& a, const Vector3& b, const Vector3& c) noexcept {
+    const auto ab = b - a;
+    const auto ac = c - a;
+    const auto normal = MathUtils::CrossProduct(ab, ac);
+    const auto denominator = 2.0f * normal.CalcLengthSquared();
+    if(denominator <= 1e-10f * ab.CalcLengthSquared() * ac.CalcLengthSquared()) {
+        const auto ab_sphere = CalcSphereThrough(a, b);
+        const auto ac_sphere = CalcSphereThrough(a, c);
+        const auto bc_sphere = CalcSphereThrough(b, c);
+        const auto& wider = ac_sphere.radius < ab_sphere.radius ? ab_sphere : ac_sphere;
+        return wider.radius < bc_sphere.radius ? bc_sphere : wider;
+    }
+    const auto offset = (MathUtils::CrossProduct(normal, ab) * ac.CalcLengthSquared() + MathUtils::CrossProduct(ac, normal) * ab.CalcLengthSquared()) / denominator;
+    return Sphere3{a + offset, offset.CalcLength()};
+}
+
+//Circumsphere of the tetrahedron; when the points are flat, the circle through the first three grown to reach d.
+Sphere3 CalcSphereThrough(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d) noexcept {
+    const auto u = b - a;
+    const auto v = c - a;
+    const auto w = d - a;
+    const auto determinant = MathUtils::DotProduct(u, MathUtils::CrossProduct(v, w));
+    if(std::abs(determinant) <= 1e-5f * u.CalcLength() * v.CalcLength() * w.CalcLength()) {
+        auto sphere = CalcSphereThrough(a, b, c);
+        sphere.radius = (std::max)(sphere.radius, (d - sphere.center).CalcLength());
+        return sphere;
+    }
+    const auto offset = (MathUtils::CrossProduct(v, w) * u.CalcLengthSquared() + MathUtils::CrossProduct(w, u) * v.CalcLengthSquared() + MathUtils::CrossProduct(u, v) * w.CalcLengthSquared()) / (2.0f * determinant);
+    return Sphere3{a + offset, offset.CalcLength()};
+}
+
+bool IsOutside(const Sphere3& sphere, const Vector3& point) noexcept {
+    return sphere.radius * sphere.radius * (1.0f + 1e-6f) < (point - sphere.center).CalcLengthSquared();
+}
+
+//Welzl's algorithm unrolled into loops (the move-to-front form without the moves).
+//Each loop finds the smallest sphere of the points so far with the outer loops' points on its surface.
+Sphere3 CalcMinimalSphere(std::vector<Vector3>& points) noexcept {
+    std::mt19937 rng{};
+    std::shuffle(points.begin(), points.end(), rng);
+    Sphere3 sphere{points[0], 0.0f};
+    for(std::size_t i = 1; i < points.size(); ++i) {
+        if(!IsOutside(sphere, points[i])) {
+            continue;
+        }
+        sphere = Sphere3{points[i], 0.0f};
+        for(std::size_t j = 0; j < i; ++j) {
+            if(!IsOutside(sphere, points[j])) {
+                continue;
+            }
+            sphere = CalcSphereThrough(points[i], points[j]);
+            for(std::size_t k = 0; k < j; ++k) {
+                if(!IsOutside(sphere, points[k])) {
+                    continue;
+                }
+                sphere = CalcSphereThrough(points[i], points[j], points[k]);
+                for(std::size_t l = 0; l < k; ++l) {
+                    if(IsOutside(sphere, points[l])) {
+                        sphere = CalcSphereThrough(points[i], points[j], points[k], points[l]);
+                    }
+                }
+            }
+        }
+    }
+    return sphere;
+}
+
+//Grows the radius to the farthest point, then pads it, so every point is inside despite rounding.
+void EncloseAllPoints(const Vector3* points, std::size_t count, JobSystem* jobSystem, Sphere3& sphere) noexcept {
+    const auto chunk_count = CalcChunkCount(jobSystem, count);
+    std::vector<float> farthest(chunk_count, 0.0f);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        auto result = 0.0f;
+        for(auto i = begin; i < end; ++i) {
+            result = (std::max)(result, (points[i] - sphere.center).CalcLengthSquared());
+        }
+        farthest[chunk] = result;
+    });
+    const auto radius = std::sqrt(*std::max_element(farthest.begin(), farthest.end()));
+    sphere.radius = (std::max)(sphere.radius, radius) * (1.0f + SPHERE_PADDING);
+}
+
+using Matrix3d = std::array<std::array<double, 3>, 3>;
+
+//Cyclic Jacobi rotations (Ericson, Real-Time Collision Detection, 4.4.2). On return the columns
+//of eigenvectors are the eigenvectors of the symmetric matrix a.
+void CalcEigenvectors(Matrix3d a, Matrix3d& eigenvectors) noexcept {
+    eigenvectors = Matrix3d{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+    auto previous_off = (std::numeric_limits<double>::max)();
+    for(int iteration = 0; iteration < 50; ++iteration) {
+        std::size_t p = 0;
+        std::size_t q = 1;
+        for(std::size_t i = 0; i < 3; ++i) {
+            for(auto j = i + 1; j < 3; ++j) {
+                if(std::abs(a[p][q]) < std::abs(a[i][j])) {
+                    p = i;
+                    q = j;
+                }
+            }
+        }
+        auto c = 1.0;
+        auto s = 0.0;
+        if(1e-30 < std::abs(a[p][q])) {
+            const auto r = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+            const auto t = 0.0 <= r ? 1.0 / (r + std::sqrt(1.0 + r * r)) : -1.0 / (-r + std::sqrt(1.0 + r * r));
+            c = 1.0 / std::sqrt(1.0 + t * t);
+            s = t * c;
+        }
+        Matrix3d rotation{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+        rotation[p][p] = c;
+        rotation[p][q] = s;
+        rotation[q][p] = -s;
+        rotation[q][q] = c;
+        Matrix3d rotated{};
+        Matrix3d vectors{};
+        for(std::size_t i = 0; i < 3; ++i) {
+            for(std::size_t j = 0; j < 3; ++j) {
+                for(std::size_t k = 0; k < 3; ++k) {
+                    vectors[i][j] += eigenvectors[i][k] * rotation[k][j];
+                    rotated[i][j] += a[i][k] * rotation[k][j];
+                }
+            }
+        }
+        eigenvectors = vectors;
+        for(std::size_t i = 0; i < 3; ++i) {
+            for(std::size_t j = 0; j < 3; ++j) {
+                a[i][j] = 0.0;
+                for(std::size_t k = 0; k < 3; ++k) {
+                    a[i][j] += rotation[k][i] * rotated[k][j];
+                }
+            }
+        }
+        const auto off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        if(off == 0.0 || (2 < iteration && previous_off <= off)) {
+            break;
+        }
+        previous_off = off;
+    }
+}
+
+} //End anonymous
+
+namespace MathUtils {
+
+std::vector<Vector2> CalcConvexHull(const Vector2* points, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    std::vector<Vector2> candidates{};
+    const auto chunk_count = CalcChunkCount(jobSystem, count);
+    if(1 < chunk_count) {
+        std::vector<std::vector<Vector2>> chunk_hulls(chunk_count);
+        RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            std::vector<std::uint32_t> hull{};
+            BuildHull2D(points + begin, end - begin, hull);
+            for(const auto i : hull) {
+                chunk_hulls[chunk].push_back(points[begin + i]);
+            }
+        });
+        for(const auto& hull : chunk_hulls) {
+            candidates.insert(candidates.end(), hull.begin(), hull.end());
+        }
+        points = candidates.data();
+        count = candidates.size();
+    }
+    std::vector<std::uint32_t> hull{};
+    BuildHull2D(points, count, hull);
+    std::vector<Vector2> result{};
+    result.reserve(hull.size());
+    for(const auto i : hull) {
+        result.push_back(points[i]);
+    }
+    return result;
+}
+
+std::vector<Vector2> CalcConvexHull(const std::vector<Vector2>& points, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    return CalcConvexHull(points.data(), points.size(), jobSystem);
+}
+
+ConvexHull3 CalcConvexHull(const Vector3* points, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    ConvexHull3 result{};
+    const auto chunk_count = CalcChunkCount(jobSystem, count);
+    if(chunk_count == 1) {
+        HullBuilder{points, count}.Build(result);
+        return result;
+    }
+    std::vector<ConvexHull3> chunk_hulls(chunk_count);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        HullBuilder{points + begin, end - begin}.Build(chunk_hulls[chunk]);
+    });
+    std::vector<Vector3> candidates{};
+    for(const auto& hull : chunk_hulls) {
+        candidates.insert(candidates.end(), hull.vertices.begin(), hull.vertices.end());
+    }
+    HullBuilder{candidates.data(), candidates.size()}.Build(result);
+    return result;
+}
+
+ConvexHull3 CalcConvexHull(const std::vector<Vector3>& points, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    return CalcConvexHull(points.data(), points.size(), jobSystem);
+}
+
+AABB3 CalcBoundingBox(const Vector3* points, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    if(!count) {
+        return AABB3{};
+    }
+    const auto chunk_count = CalcChunkCount(jobSystem, count);
+    std::vector<AABB3> chunk_bounds(chunk_count);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        AABB3 bounds{points[begin], points[begin]};
+        for(auto i = begin + 1; i < end; ++i) {
+            bounds.StretchToIncludePoint(points[i]);
+        }
+        chunk_bounds[chunk] = bounds;
+    });
+    auto result = chunk_bounds[0];
+    for(const auto& bounds : chunk_bounds) {
+        result.StretchToIncludePoint(bounds.mins);
+        result.StretchToIncludePoint(bounds.maxs);
+    }
+    return result;
+}
+
+AABB3 CalcBoundingBox(const std::vector<Vector3>& points, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    return CalcBoundingBox(points.data(), points.size(), jobSystem);
+}
+
+Sphere3 CalcBoundingSphereRitter(const Vector3* points, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    if(!count) {
+        return Sphere3{};
+    }
+    //First pass: the most distant of the three pairs of axis extremes gives the starting sphere.
+    const auto chunk_count = CalcChunkCount(jobSystem, count);
+    std::vector<std::array<std::size_t, 6>> chunk_extremes(chunk_count);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        auto& extremes = chunk_extremes[chunk];
+        extremes.fill(begin);
+        for(auto i = begin + 1; i < end; ++i) {
+            UpdateExtremes(points, extremes, i);
+        }
+    });
+    //Each chunk's extremes include its winner for every slot, so offering all of them finds the overall ones.
+    auto extremes = chunk_extremes[0];
+    for(const auto& chunk : chunk_extremes) {
+        for(const auto candidate : chunk) {
+            UpdateExtremes(points, extremes, candidate);
+        }
+    }
+    std::size_t axis = 0;
+    auto widest = 0.0f;
+    for(std::size_t i = 0; i < 3; ++i) {
+        const auto distance = (points[extremes[2 * i + 1]] - points[extremes[2 * i]]).CalcLengthSquared();
+        if(widest < distance) {
+            widest = distance;
+            axis = i;
+        }
+    }
+    const auto initial = CalcSphereThrough(points[extremes[2 * axis]], points[extremes[2 * axis + 1]]);
+
+    //Second pass: move the far side of the sphere out to each point left outside. Chunks grow their own
+    //copies, which are then merged; the result still encloses everything, if a little less tightly.
+    std::vector<Sphere3> chunk_spheres(chunk_count, initial);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        auto sphere = initial;
+        auto radius_squared = sphere.radius * sphere.radius;
+        for(auto i = begin; i < end; ++i) {
+            const auto distance_squared = (points[i] - sphere.center).CalcLengthSquared();
+            if(distance_squared <= radius_squared) {
+                continue;
+            }
+            const auto distance = std::sqrt(distance_squared);
+            const auto radius = 0.5f * (sphere.radius + distance);
+            sphere.center += (points[i] - sphere.center) * ((radius - sphere.radius) / distance);
+            sphere.radius = radius;
+            radius_squared = radius * radius;
+        }
+        chunk_spheres[chunk] = sphere;
+    });
+    auto result = chunk_spheres[0];
+    for(std::size_t chunk = 1; chunk < chunk_count; ++chunk) {
+        result = MergeSpheres(result, chunk_spheres[chunk]);
+    }
+    result.radius *= 1.0f + SPHERE_PADDING;
+    return result;
+}
+
+Sphere3 CalcBoundingSphereRitter(const std::vector<Vector3>& points, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    return CalcBoundingSphereRitter(points.data(), points.size(), jobSystem);
+}
+
+Sphere3 CalcMinimalBoundingSphere(const Vector3* points, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    if(!count) {
+        return Sphere3{};
+    }
+    std::vector<Vector3> candidates{};
+    if(MIN_HULL_REDUCTION_COUNT <= count) {
+        candidates = CalcConvexHull(points, count, jobSystem).vertices;
+    } else {
+        candidates.assign(points, points + count);
+    }
+    auto sphere = CalcMinimalSphere(candidates);
+    //Points the hull left out as within tolerance of its surface may be a hair outside.
+    EncloseAllPoints(points, count, jobSystem, sphere);
+    return sphere;
+}
+
+Sphere3 CalcMinimalBoundingSphere(const std::vector<Vector3>& points, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    return CalcMinimalBoundingSphere(points.data(), points.size(), jobSystem);
+}
+
+OBB3 CalcBoundingOBB(const Vector3* points, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    if(!count) {
+        return OBB3{};
+    }
+    //Raw second moments cancel when the mean is far from the origin, so every point is taken
+    //relative to the first one before summing; the covariance does not depend on that shift.
+    const auto reference = points[0];
+    const auto chunk_count = CalcChunkCount(jobSystem, count);
+    std::vector<std::array<double, 9>> chunk_sums(chunk_count);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        std::array<double, 9> sums{};
+        for(auto i = begin; i < end; ++i) {
+            const double x = static_cast<double>(points[i].x) - reference.x;
+            const double y = static_cast<double>(points[i].y) - reference.y;
+            const double z = static_cast<double>(points[i].z) - reference.z;
+            sums[0] += x;
+            sums[1] += y;
+            sums[2] += z;
+            sums[3] += x * x;
+            sums[4] += y * y;
+            sums[5] += z * z;
+            sums[6] += x * y;
+            sums[7] += x * z;
+            sums[8] += y * z;
+        }
+        chunk_sums[chunk] = sums;
+    });
+    std::array<double, 9> sums{};
+    for(const auto& chunk : chunk_sums) {
+        for(std::size_t i = 0; i < sums.size(); ++i) {
+            sums[i] += chunk[i];
+        }
+    }
+    const auto n = static_cast<double>(count);
+    const double mean[3] = {sums[0] / n, sums[1] / n, sums[2] / n};
+    Matrix3d covariance{};
+    covariance[0][0] = sums[3] / n - mean[0] * mean[0];
+    covariance[1][1] = sums[4] / n - mean[1] * mean[1];
+    covariance[2][2] = sums[5] / n - mean[2] * mean[2];
+    covariance[0][1] = covariance[1][0] = sums[6] / n - mean[0] * mean[1];
+    covariance[0][2] = covariance[2][0] = sums[7] / n - mean[0] * mean[2];
+    covariance[1][2] = covariance[2][1] = sums[8] / n - mean[1] * mean[2];
+    Matrix3d eigenvectors{};
+    CalcEigenvectors(covariance, eigenvectors);
+    const auto right = Vector3{static_cast<float>(eigenvectors[0][0]), static_cast<float>(eigenvectors[1][0]), static_cast<float>(eigenvectors[2][0])}.GetNormalize();
+    auto up = Vector3{static_cast<float>(eigenvectors[0][1]), static_cast<float>(eigenvectors[1][1]), static_cast<float>(eigenvectors[2][1])};
+    up = (up - right * MathUtils::DotProduct(up, right)).GetNormalize();
+    const auto forward = MathUtils::CrossProduct(right, up);
+
+    //Extents along the principal axes and along the world axes in one pass.
+    std::vector<std::array<AABB3, 2>> chunk_bounds(chunk_count);
+    RunChunks(jobSystem, count, chunk_count, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        const auto project = [&](const Vector3& p) {
+            const auto local = p - reference;
+            return Vector3{MathUtils::DotProduct(local, right), MathUtils::DotProduct(local, up), MathUtils::DotProduct(local, forward)};
+        };
+        AABB3 oriented{project(points[begin]), project(points[begin])};
+        AABB3 aligned{points[begin], points[begin]};
+        for(auto i = begin + 1; i < end; ++i) {
+            oriented.StretchToIncludePoint(project(points[i]));
+            aligned.StretchToIncludePoint(points[i]);
+        }
+        chunk_bounds[chunk] = {oriented, aligned};
+    });
+    auto oriented = chunk_bounds[0][0];
+    auto aligned = chunk_bounds[0][1];
+    for(const auto& bounds : chunk_bounds) {
+        oriented.StretchToIncludePoint(bounds[0].mins);
+        oriented.StretchToIncludePoint(bounds[0].maxs);
+        aligned.StretchToIncludePoint(bounds[1].mins);
+        aligned.StretchToIncludePoint(bounds[1].maxs);
+    }
+    const auto oriented_size = oriented.CalcDimensions();
+    const auto aligned_size = aligned.CalcDimensions();
+    if(aligned_size.x * aligned_size.y * aligned_size.z <= oriented_size.x * oriented_size.y * oriented_size.z) {
+        return OBB3{aligned};
+    }
+    const auto center = oriented.CalcCenter();
+    return OBB3{reference + right * center.x + up * center.y + forward * center.z, oriented_size * 0.5f, right, up, forward};
+}
+
+OBB3 CalcBoundingOBB(const std::vector<Vector3>& points, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    return CalcBoundingOBB(points.data(), points.size(), jobSystem);
+}
+
+} //End MathUtils
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <cstddef>
+#include <vector>
+
+class JobSystem;
+
+//Closed triangle mesh around a point set. indices holds three per triangle, counter-clockwise
+//seen from outside, like an ibo. Sets that are flat have no triangles: vertices is then the
+//outline, counter-clockwise around the plane's normal, or the two ends of a line, or one point.
+class ConvexHull3 {
+public:
+    std::vector<Vector3> vertices{};
+    std::vector<unsigned int> indices{};
+};
+
+//Tight bounds for point sets such as mesh vertices, computed once when an asset loads.
+//Every function takes an optional JobSystem: sets of at least a few tens of thousands of points
+//are split into chunks that are reduced on its Generic workers, and the results combined.
+namespace MathUtils {
+
+//Quickhull. Points within a small tolerance of a hull edge or face are left out of the hull.
+//Large sets are hulled per chunk first, then the hull of the chunk hulls is taken. That pays off when
+//few points are on the hull; for dense meshes of convex shapes most are, and it gains little.
+std::vector<Vector2> CalcConvexHull(const Vector2* points, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+std::vector<Vector2> CalcConvexHull(const std::vector<Vector2>& points, JobSystem* jobSystem = nullptr) noexcept;
+ConvexHull3 CalcConvexHull(const Vector3* points, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+ConvexHull3 CalcConvexHull(const std::vector<Vector3>& points, JobSystem* jobSystem = nullptr) noexcept;
+
+AABB3 CalcBoundingBox(const Vector3* points, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+AABB3 CalcBoundingBox(const std::vector<Vector3>& points, JobSystem* jobSystem = nullptr) noexcept;
+
+//Ritter, "An Efficient Bounding Sphere", Graphics Gems, 1990: two passes, up to about 20% larger than the minimum.
+Sphere3 CalcBoundingSphereRitter(const Vector3* points, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+Sphere3 CalcBoundingSphereRitter(const std::vector<Vector3>& points, JobSystem* jobSystem = nullptr) noexcept;
+
+//Smallest enclosing sphere by Welzl's randomized incremental algorithm, expected linear time.
+//Large sets are first reduced to their convex hull, which has the same smallest sphere.
+//The radius is padded by a relative 1e-5 so rounding never leaves a point outside.
+Sphere3 CalcMinimalBoundingSphere(const Vector3* points, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+Sphere3 CalcMinimalBoundingSphere(const std::vector<Vector3>& points, JobSystem* jobSystem = nullptr) noexcept;
+
+//Box along the principal axes of the points' covariance. When those axes fit worse than the
+//world axes, the axis-aligned box is returned instead, so the result is never larger than CalcBoundingBox.
+OBB3 CalcBoundingOBB(const Vector3* points, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+OBB3 CalcBoundingOBB(const std::vector<Vector3>& points, JobSystem* jobSystem = nullptr) noexcept;
+
+} //End MathUtils
@@ -0,0 +1,129 @@
+#include "Engine/Math/Broadphase2D.hpp"
+
+#include "Engine/Math/Capsule2.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/LineSegment2.hpp"
+#include "Engine/Math/OBB2.hpp"
+
+#include <algorithm>
+
+Broadphase2D::~Broadphase2D() noexcept {
+    /* DO NOTHING */
+}
+
+std::size_t Broadphase2D::Insert(const AABB2& bounds) noexcept {
+    std::size_t proxy = _bounds.size();
+    if(_free_proxies.empty()) {
+        _bounds.push_back(bounds);
+        _alive.push_back(1);
+    } else {
+        proxy = _free_proxies.back();
+        _free_proxies.pop_back();
+        _bounds[proxy] = bounds;
+        _alive[proxy] = 1;
+    }
+    ++_count;
+    OnInsert(proxy);
+    return proxy;
+}
+
+std::size_t Broadphase2D::Insert(const Disc2& disc) noexcept {
+    return Insert(CalcBounds(disc));
+}
+
+std::size_t Broadphase2D::Insert(const OBB2& obb) noexcept {
+    return Insert(CalcBounds(obb));
+}
+
+std::size_t Broadphase2D::Insert(const Capsule2& capsule) noexcept {
+    return Insert(CalcBounds(capsule));
+}
+
+std::size_t Broadphase2D::Insert(const LineSegment2& line) noexcept {
+    return Insert(CalcBounds(line));
+}
+
+void Broadphase2D::Move(std::size_t proxy, const AABB2& bounds) noexcept {
+    if(!IsValid(proxy)) {
+        return;
+    }
+    const auto old_bounds = _bounds[proxy];
+    _bounds[proxy] = bounds;
+    OnMove(proxy, old_bounds);
+}
+
+void Broadphase2D::Move(std::size_t proxy, const Disc2& disc) noexcept {
+    Move(proxy, CalcBounds(disc));
+}
+
+void Broadphase2D::Move(std::size_t proxy, const OBB2& obb) noexcept {
+    Move(proxy, CalcBounds(obb));
+}
+
+void Broadphase2D::Move(std::size_t proxy, const Capsule2& capsule) noexcept {
+    Move(proxy, CalcBounds(capsule));
+}
+
+void Broadphase2D::Move(std::size_t proxy, const LineSegment2& line) noexcept {
+    Move(proxy, CalcBounds(line));
+}
+
+void Broadphase2D::Remove(std::size_t proxy) noexcept {
+    if(!IsValid(proxy)) {
+        return;
+    }
+    OnRemove(proxy);
+    _alive[proxy] = 0;
+    _free_proxies.push_back(proxy);
+    --_count;
+}
+
+void Broadphase2D::Clear() noexcept {
+    OnClear();
+    _bounds.clear();
+    _alive.clear();
+    _free_proxies.clear();
+    _count = 0;
+}
+
+std::size_t Broadphase2D::size() const noexcept {
+    return _count;
+}
+
+bool Broadphase2D::empty() const noexcept {
+    return _count == 0;
+}
+
+bool Broadphase2D::IsValid(std::size_t proxy) const noexcept {
+    return proxy < _alive.size() && _alive[proxy];
+}
+
+const AABB2& Broadphase2D::GetBounds(std::size_t proxy) const noexcept {
+    return _bounds[proxy];
+}
+
+std::size_t Broadphase2D::GetProxyCapacity() const noexcept {
+    return _bounds.size();
+}
+
+AABB2 Broadphase2D::CalcBounds(const Disc2& disc) noexcept {
+    return AABB2{disc.center, disc.radius, disc.radius};
+}
+
+AABB2 Broadphase2D::CalcBounds(const OBB2& obb) noexcept {
+    AABB2 result{obb.GetTopLeft(), obb.GetTopLeft()};
+    result.StretchToIncludePoint(obb.GetTopRight());
+    result.StretchToIncludePoint(obb.GetBottomLeft());
+    result.StretchToIncludePoint(obb.GetBottomRight());
+    return result;
+}
+
+AABB2 Broadphase2D::CalcBounds(const Capsule2& capsule) noexcept {
+    auto result = CalcBounds(capsule.line);
+    result.AddPaddingToSides(capsule.radius, capsule.radius);
+    return result;
+}
+
+AABB2 Broadphase2D::CalcBounds(const LineSegment2& line) noexcept {
+    return AABB2{(std::min)(line.start.x, line.end.x), (std::min)(line.start.y, line.end.y), (std::max)(line.start.x, line.end.x), (std::max)(line.start.y, line.end.y)};
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class Capsule2;
+class Disc2;
+class LineSegment2;
+class OBB2;
+
+//Common interface for 2D broadphase structures.
+//Shapes are tracked as proxies: Insert returns a proxy id that stays valid until Remove.
+//Ids are handed out from zero and reused after removal, so they can index a parallel array of shapes.
+//Queries report proxies whose bounds overlap; run the narrowphase on them with FilterPairs.
+class Broadphase2D {
+public:
+    using proxy_pair_t = std::pair<std::size_t, std::size_t>;
+
+    Broadphase2D() = default;
+    Broadphase2D(const Broadphase2D& other) = default;
+    Broadphase2D(Broadphase2D&& other) = default;
+    Broadphase2D& operator=(const Broadphase2D& other) = default;
+    Broadphase2D& operator=(Broadphase2D&& other) = default;
+    virtual ~Broadphase2D() noexcept = 0;
+
+    std::size_t Insert(const AABB2& bounds) noexcept;
+    std::size_t Insert(const Disc2& disc) noexcept;
+    std::size_t Insert(const OBB2& obb) noexcept;
+    std::size_t Insert(const Capsule2& capsule) noexcept;
+    std::size_t Insert(const LineSegment2& line) noexcept;
+
+    void Move(std::size_t proxy, const AABB2& bounds) noexcept;
+    void Move(std::size_t proxy, const Disc2& disc) noexcept;
+    void Move(std::size_t proxy, const OBB2& obb) noexcept;
+    void Move(std::size_t proxy, const Capsule2& capsule) noexcept;
+    void Move(std::size_t proxy, const LineSegment2& line) noexcept;
+
+    void Remove(std::size_t proxy) noexcept;
+    void Clear() noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    bool IsValid(std::size_t proxy) const noexcept;
+    const AABB2& GetBounds(std::size_t proxy) const noexcept;
+
+    //Queries append to results. Each proxy or pair is reported once; pairs are ordered (lower id, higher id).
+    virtual void QueryRegion(const AABB2& region, std::vector<std::size_t>& results) const noexcept = 0;
+    virtual void QueryPoint(const Vector2& point, std::vector<std::size_t>& results) const noexcept = 0;
+    virtual void QueryPairs(std::vector<proxy_pair_t>& results) const noexcept = 0;
+
+    static AABB2 CalcBounds(const Disc2& disc) noexcept;
+    static AABB2 CalcBounds(const OBB2& obb) noexcept;
+    static AABB2 CalcBounds(const Capsule2& capsule) noexcept;
+    static AABB2 CalcBounds(const LineSegment2& line) noexcept;
+
+    //Narrowphase over candidate pairs. shapes is indexed by proxy id and overlap is typically
+    //a MathUtils::Do*Overlap function. Appends the pairs that pass to results and returns how many.
+    template<typename Shape, typename Overlap>
+    static std::size_t FilterPairs(const std::vector<proxy_pair_t>& candidates, const Shape* shapes, Overlap&& overlap, std::vector<proxy_pair_t>& results) noexcept;
+
+protected:
+    //Implementations keep their structure in sync through these; the base class owns the bounds.
+    virtual void OnInsert(std::size_t proxy) noexcept = 0;
+    virtual void OnMove(std::size_t proxy, const AABB2& oldBounds) noexcept = 0;
+    virtual void OnRemove(std::size_t proxy) noexcept = 0;
+    virtual void OnClear() noexcept = 0;
+
+    std::size_t GetProxyCapacity() const noexcept;
+
+private:
+    std::vector<AABB2> _bounds{};
+    std::vector<std::uint8_t> _alive{};
+    std::vector<std::size_t> _free_proxies{};
+    std::size_t _count = 0;
+};
+
+template<typename Shape, typename Overlap>
+std::size_t Broadphase2D::FilterPairs(const std::vector<proxy_pair_t>& candidates, const Shape* shapes, Overlap&& overlap, std::vector<proxy_pair_t>& results) noexcept {
+    const auto old_size = results.size();
+    for(const auto& candidate : candidates) {
+        if(overlap(shapes[candidate.first], shapes[candidate.second])) {
+            results.push_back(candidate);
+        }
+    }
+    return results.size() - old_size;
+}
@@ -0,0 +1,329 @@
+#include "Engine/Math/FastMath.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#ifdef MATH_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+//Adding 1.5 * 2^23 rounds a float to the nearest integer and leaves that integer
+//in the low mantissa bits, without a float to int conversion.
+constexpr float ROUND_MAGIC = 12582912.0f;
+constexpr std::int32_t ROUND_MAGIC_BITS = 0x4B400000;
+
+constexpr float TWO_OVER_PI = 0.636619772367581343f;
+//pi/2 split into three parts so the reduction x - n * pi/2 stays exact for moderate n.
+constexpr float PI_OVER_2_HI = 1.5703125f;
+constexpr float PI_OVER_2_MID = 4.837512969970703125e-4f;
+constexpr float PI_OVER_2_LO = 7.54978995489188216e-8f;
+//Minimax coefficients on [-pi/4, pi/4] (Cephes sinf/cosf).
+constexpr float SIN_C1 = -1.6666654611e-1f;
+constexpr float SIN_C2 = 8.3321608736e-3f;
+constexpr float SIN_C3 = -1.9515295891e-4f;
+constexpr float COS_C1 = 4.166664568298827e-2f;
+constexpr float COS_C2 = -1.388731625493765e-3f;
+constexpr float COS_C3 = 2.443315711809948e-5f;
+
+constexpr float PI = 3.14159265358979323846f;
+constexpr float PI_OVER_2 = 1.57079632679489661923f;
+constexpr float PI_OVER_4 = 0.78539816339744830962f;
+constexpr float TAN_PI_OVER_8 = 0.41421356237309504880f;
+//Minimax coefficients on [-tan(pi/8), tan(pi/8)] (Cephes atanf).
+constexpr float ATAN_C1 = -3.33329491539e-1f;
+constexpr float ATAN_C2 = 1.99777106478e-1f;
+constexpr float ATAN_C3 = -1.38776856032e-1f;
+constexpr float ATAN_C4 = 8.05374449538e-2f;
+
+constexpr float EXP_MIN = -87.3f;
+constexpr float EXP_MAX = 88.3f;
+constexpr float LOG2_E = 1.44269504088896341f;
+constexpr float LN2_HI = 0.693359375f;
+constexpr float LN2_LO = -2.12194440e-4f;
+//Minimax coefficients on [-ln2/2, ln2/2] (Cephes expf).
+constexpr float EXP_C0 = 5.0000001201e-1f;
+constexpr float EXP_C1 = 1.6666665459e-1f;
+constexpr float EXP_C2 = 4.1665795894e-2f;
+constexpr float EXP_C3 = 8.3334519073e-3f;
+constexpr float EXP_C4 = 1.3981999507e-3f;
+constexpr float EXP_C5 = 1.9875691500e-4f;
+
+std::int32_t FloatBits(float value) noexcept {
+    std::int32_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsToFloat(std::int32_t bits) noexcept {
+    float value{};
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void SinCosImpl(float radians, float& out_sin, float& out_cos) noexcept {
+    const float shifted = radians * TWO_OVER_PI + ROUND_MAGIC;
+    const float n = shifted - ROUND_MAGIC;
+    const auto quadrant = FloatBits(shifted) & 3;
+    const float r = ((radians - n * PI_OVER_2_HI) - n * PI_OVER_2_MID) - n * PI_OVER_2_LO;
+    const float z = r * r;
+    const float sin_r = ((SIN_C3 * z + SIN_C2) * z + SIN_C1) * z * r + r;
+    const float cos_r = ((COS_C3 * z + COS_C2) * z + COS_C1) * z * z - 0.5f * z + 1.0f;
+    //Quadrant selection with bit masks instead of branches, which mispredict on unordered input.
+    const std::int32_t swap = -(quadrant & 1);
+    const std::int32_t sin_bits = FloatBits(sin_r);
+    const std::int32_t cos_bits = FloatBits(cos_r);
+    const std::int32_t s = (sin_bits & ~swap) | (cos_bits & swap);
+    const std::int32_t c = (cos_bits & ~swap) | (sin_bits & swap);
+    out_sin = BitsToFloat(s ^ static_cast<std::int32_t>(static_cast<std::uint32_t>(quadrant & 2) << 30));
+    out_cos = BitsToFloat(c ^ static_cast<std::int32_t>(static_cast<std::uint32_t>((quadrant + 1) & 2) << 30));
+}
+
+#ifdef MATH_SIMD_SSE
+
+void SinCos4(__m128 radians, __m128& out_sin, __m128& out_cos) noexcept {
+    const __m128 magic = _mm_set1_ps(ROUND_MAGIC);
+    const __m128 shifted = _mm_add_ps(_mm_mul_ps(radians, _mm_set1_ps(TWO_OVER_PI)), magic);
+    const __m128 n = _mm_sub_ps(shifted, magic);
+    const __m128i quadrant = _mm_and_si128(_mm_castps_si128(shifted), _mm_set1_epi32(3));
+    __m128 r = _mm_sub_ps(radians, _mm_mul_ps(n, _mm_set1_ps(PI_OVER_2_HI)));
+    r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(PI_OVER_2_MID)));
+    r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(PI_OVER_2_LO)));
+    const __m128 z = _mm_mul_ps(r, r);
+
+    __m128 sin_r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_C3), z), _mm_set1_ps(SIN_C2));
+    sin_r = _mm_add_ps(_mm_mul_ps(sin_r, z), _mm_set1_ps(SIN_C1));
+    sin_r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sin_r, z), r), r);
+
+    __m128 cos_r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_C3), z), _mm_set1_ps(COS_C2));
+    cos_r = _mm_add_ps(_mm_mul_ps(cos_r, z), _mm_set1_ps(COS_C1));
+    cos_r = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cos_r, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+    cos_r = _mm_add_ps(cos_r, _mm_set1_ps(1.0f));
+
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+    const __m128 s = _mm_or_ps(_mm_and_ps(swap, cos_r), _mm_andnot_ps(swap, sin_r));
+    const __m128 c = _mm_or_ps(_mm_and_ps(swap, sin_r), _mm_andnot_ps(swap, cos_r));
+    //Bit 1 of the quadrant moved to the sign bit.
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128 sin_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+    const __m128 cos_sign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+    out_sin = _mm_xor_ps(s, sin_sign);
+    out_cos = _mm_xor_ps(c, cos_sign);
+}
+
+__m128 Atan24(__m128 y, __m128 x) noexcept {
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 ax = _mm_andnot_ps(sign_mask, x);
+    const __m128 ay = _mm_andnot_ps(sign_mask, y);
+    const __m128 mx = _mm_max_ps(ax, ay);
+    const __m128 mn = _mm_min_ps(ax, ay);
+    const __m128 big = _mm_cmpgt_ps(mn, _mm_mul_ps(_mm_set1_ps(TAN_PI_OVER_8), mx));
+    const __m128 num = _mm_or_ps(_mm_and_ps(big, _mm_sub_ps(mn, mx)), _mm_andnot_ps(big, mn));
+    const __m128 den = _mm_or_ps(_mm_and_ps(big, _mm_add_ps(mn, mx)), _mm_andnot_ps(big, mx));
+    const __m128 t = _mm_and_ps(_mm_cmpgt_ps(den, zero), _mm_div_ps(num, den));
+    const __m128 z = _mm_mul_ps(t, t);
+
+    __m128 a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(ATAN_C4), z), _mm_set1_ps(ATAN_C3));
+    a = _mm_add_ps(_mm_mul_ps(a, z), _mm_set1_ps(ATAN_C2));
+    a = _mm_add_ps(_mm_mul_ps(a, z), _mm_set1_ps(ATAN_C1));
+    a = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(a, z), t), t);
+    a = _mm_add_ps(a, _mm_and_ps(big, _mm_set1_ps(PI_OVER_4)));
+
+    const __m128 steep = _mm_cmpgt_ps(ay, ax);
+    a = _mm_or_ps(_mm_and_ps(steep, _mm_sub_ps(_mm_set1_ps(PI_OVER_2), a)), _mm_andnot_ps(steep, a));
+    const __m128 left = _mm_cmplt_ps(x, zero);
+    a = _mm_or_ps(_mm_and_ps(left, _mm_sub_ps(_mm_set1_ps(PI), a)), _mm_andnot_ps(left, a));
+    return _mm_xor_ps(a, _mm_and_ps(_mm_cmplt_ps(y, zero), sign_mask));
+}
+
+__m128 Exp4(__m128 x) noexcept {
+    x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(EXP_MIN)), _mm_set1_ps(EXP_MAX));
+    const __m128 magic = _mm_set1_ps(ROUND_MAGIC);
+    const __m128 shifted = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(LOG2_E)), magic);
+    const __m128 n = _mm_sub_ps(shifted, magic);
+    __m128 r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(LN2_HI)));
+    r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(LN2_LO)));
+    const __m128 z = _mm_mul_ps(r, r);
+
+    __m128 p = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(EXP_C5), r), _mm_set1_ps(EXP_C4));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(EXP_C3));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(EXP_C2));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(EXP_C1));
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(EXP_C0));
+    p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, z), r), _mm_set1_ps(1.0f));
+
+    const __m128i exponent = _mm_add_epi32(_mm_sub_epi32(_mm_castps_si128(shifted), _mm_set1_epi32(ROUND_MAGIC_BITS)), _mm_set1_epi32(127));
+    return _mm_mul_ps(p, _mm_castsi128_ps(_mm_slli_epi32(exponent, 23)));
+}
+
+__m128 Rsqrt4(__m128 x) noexcept {
+    //One Newton-Raphson step on the 12-bit hardware estimate.
+    const __m128 y = _mm_rsqrt_ps(x);
+    const __m128 half_x_y = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), y);
+    return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half_x_y, y)));
+}
+
+#endif
+
+} //End anonymous
+
+namespace MathUtils {
+namespace FastMath {
+
+float Sin(float radians) noexcept {
+    float s{};
+    float c{};
+    SinCosImpl(radians, s, c);
+    return s;
+}
+
+float Cos(float radians) noexcept {
+    float s{};
+    float c{};
+    SinCosImpl(radians, s, c);
+    return c;
+}
+
+void SinCos(float radians, float& out_sin, float& out_cos) noexcept {
+    SinCosImpl(radians, out_sin, out_cos);
+}
+
+float Atan2(float y, float x) noexcept {
+    const float ax = x < 0.0f ? -x : x;
+    const float ay = y < 0.0f ? -y : y;
+    const float mx = (std::max)(ax, ay);
+    const float mn = (std::min)(ax, ay);
+    //Past tan(pi/8) use atan(t) = pi/4 + atan((t - 1) / (t + 1)) to stay in the polynomial's range.
+    const bool big = mn > TAN_PI_OVER_8 * mx;
+    const float num = big ? mn - mx : mn;
+    const float den = big ? mn + mx : mx;
+    const float t = den > 0.0f ? num / den : 0.0f;
+    const float z = t * t;
+    float a = (((ATAN_C4 * z + ATAN_C3) * z + ATAN_C2) * z + ATAN_C1) * z * t + t;
+    if(big) {
+        a += PI_OVER_4;
+    }
+    if(ay > ax) {
+        a = PI_OVER_2 - a;
+    }
+    if(x < 0.0f) {
+        a = PI - a;
+    }
+    return y < 0.0f ? -a : a;
+}
+
+float Exp(float x) noexcept {
+    x = (std::min)((std::max)(x, EXP_MIN), EXP_MAX);
+    const float shifted = x * LOG2_E + ROUND_MAGIC;
+    const float n = shifted - ROUND_MAGIC;
+    const float r = (x - n * LN2_HI) - n * LN2_LO;
+    const float z = r * r;
+    const float p = (((((EXP_C5 * r + EXP_C4) * r + EXP_C3) * r + EXP_C2) * r + EXP_C1) * r + EXP_C0) * z + r + 1.0f;
+    const auto exponent = FloatBits(shifted) - ROUND_MAGIC_BITS + 127;
+    return p * BitsToFloat(exponent << 23);
+}
+
+float Rsqrt(float x) noexcept {
+#ifdef MATH_SIMD_SSE
+    return _mm_cvtss_f32(Rsqrt4(_mm_set_ss(x)));
+#else
+    //Bit-level initial guess, good to about 3.5%, refined by three Newton-Raphson steps.
+    float y = BitsToFloat(0x5F375A86 - (FloatBits(x) >> 1));
+    const float half_x = 0.5f * x;
+    for(int i = 0; i < 3; ++i) {
+        y = y * (1.5f - half_x * y * y);
+    }
+    return y;
+#endif
+}
+
+void Sin(const float* radians, float* out, std::size_t count) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        __m128 s{};
+        __m128 c{};
+        SinCos4(_mm_loadu_ps(radians + i), s, c);
+        _mm_storeu_ps(out + i, s);
+    }
+#endif
+    for(; i < count; ++i) {
+        out[i] = Sin(radians[i]);
+    }
+}
+
+void Cos(const float* radians, float* out, std::size_t count) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        __m128 s{};
+        __m128 c{};
+        SinCos4(_mm_loadu_ps(radians + i), s, c);
+        _mm_storeu_ps(out + i, c);
+    }
+#endif
+    for(; i < count; ++i) {
+        out[i] = Cos(radians[i]);
+    }
+}
+
+void SinCos(const float* radians, float* out_sin, float* out_cos, std::size_t count) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        __m128 s{};
+        __m128 c{};
+        SinCos4(_mm_loadu_ps(radians + i), s, c);
+        _mm_storeu_ps(out_sin + i, s);
+        _mm_storeu_ps(out_cos + i, c);
+    }
+#endif
+    for(; i < count; ++i) {
+        SinCos(radians[i], out_sin[i], out_cos[i]);
+    }
+}
+
+void Atan2(const float* y, const float* x, float* out, std::size_t count) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, Atan24(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+    }
+#endif
+    for(; i < count; ++i) {
+        out[i] = Atan2(y[i], x[i]);
+    }
+}
+
+void Exp(const float* x, float* out, std::size_t count) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, Exp4(_mm_loadu_ps(x + i)));
+    }
+#endif
+    for(; i < count; ++i) {
+        out[i] = Exp(x[i]);
+    }
+}
+
+void Rsqrt(const float* x, float* out, std::size_t count) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, Rsqrt4(_mm_loadu_ps(x + i)));
+    }
+#endif
+    for(; i < count; ++i) {
+        out[i] = Rsqrt(x[i]);
+    }
+}
+
+} //End FastMath
+} //End MathUtils
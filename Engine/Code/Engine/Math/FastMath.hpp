@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+//Polynomial approximations of common transcendental functions for hot loops
+//where the full precision of the std:: versions is not needed.
+//Every function has a scalar form and a batch form; the batch forms run four lanes
+//at a time with SSE when available and return the same values as the scalar forms.
+//Error bounds are measured against the double precision std:: functions.
+namespace MathUtils {
+namespace FastMath {
+
+//Absolute error below 2e-7 for |radians| <= 8192.
+//Range reduction loses precision beyond that; inputs must stay below 6.5e6 in magnitude.
+float Sin(float radians) noexcept;
+float Cos(float radians) noexcept;
+void SinCos(float radians, float& out_sin, float& out_cos) noexcept;
+
+//Absolute error below 3e-7 radians. Inputs must be finite.
+//Signed zeros are not distinguished: Atan2(0, 0) is 0 and Atan2(-0, x < 0) is pi.
+float Atan2(float y, float x) noexcept;
+
+//Relative error below 3e-7. The input is clamped to [-87.3, 88.3], the range where the result is a finite normal float.
+float Exp(float x) noexcept;
+
+//Reciprocal square root. Relative error below 2e-6. The input must be positive and finite.
+float Rsqrt(float x) noexcept;
+
+void Sin(const float* radians, float* out, std::size_t count) noexcept;
+void Cos(const float* radians, float* out, std::size_t count) noexcept;
+void SinCos(const float* radians, float* out_sin, float* out_cos, std::size_t count) noexcept;
+void Atan2(const float* y, const float* x, float* out, std::size_t count) noexcept;
+void Exp(const float* x, float* out, std::size_t count) noexcept;
+void Rsqrt(const float* x, float* out, std::size_t count) noexcept;
+
+} //End FastMath
+} //End MathUtils
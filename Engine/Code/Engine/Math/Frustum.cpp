@@ -1,11 +1,211 @@
 #include "Engine/Math/Frustum.hpp"
 
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/Matrix4.hpp"
 
 #include "Engine/Renderer/Camera3D.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <type_traits>
 
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+using planes_t = std::array<Plane3, 6>;
+
+//Volumes per job when a cull is split across a JobSystem.
+constexpr std::size_t MIN_CULL_JOB_SIZE = 4096;
+
+//Sphere tests need unit normals; box tests work either way.
+planes_t NormalizePlanes(const planes_t& planes) noexcept {
+    planes_t result{};
+    for(std::size_t i = 0; i < planes.size(); ++i) {
+        result[i] = planes[i].GetNormalize();
+    }
+    return result;
+}
+
+//Distance of the box corner furthest along the normal: n.c + |n|.e
+bool IsBoxBehindPlane(const AABB3& box, const Plane3& plane) noexcept {
+    const Vector3 center = (box.mins + box.maxs) * 0.5f;
+    const Vector3 extents = (box.maxs - box.mins) * 0.5f;
+    const float d = plane.normal.x * center.x + plane.normal.y * center.y + plane.normal.z * center.z;
+    const float r = std::fabs(plane.normal.x) * extents.x + std::fabs(plane.normal.y) * extents.y + std::fabs(plane.normal.z) * extents.z;
+    return d + r < plane.dist;
+}
+
+bool IsSphereBehindPlane(const Sphere3& sphere, const Plane3& plane) noexcept {
+    const float d = plane.normal.x * sphere.center.x + plane.normal.y * sphere.center.y + plane.normal.z * sphere.center.z;
+    return d + sphere.radius < plane.dist;
+}
+
+#ifdef MATH_SIMD_SSE
+struct simd_plane_t {
+    __m128 nx;
+    __m128 ny;
+    __m128 nz;
+    __m128 abs_nx;
+    __m128 abs_ny;
+    __m128 abs_nz;
+    __m128 dist;
+};
+
+std::array<simd_plane_t, 6> BroadcastPlanes(const planes_t& planes) noexcept {
+    std::array<simd_plane_t, 6> result{};
+    for(std::size_t i = 0; i < planes.size(); ++i) {
+        const auto& n = planes[i].normal;
+        result[i].nx = _mm_set1_ps(n.x);
+        result[i].ny = _mm_set1_ps(n.y);
+        result[i].nz = _mm_set1_ps(n.z);
+        result[i].abs_nx = _mm_set1_ps(std::fabs(n.x));
+        result[i].abs_ny = _mm_set1_ps(std::fabs(n.y));
+        result[i].abs_nz = _mm_set1_ps(std::fabs(n.z));
+        result[i].dist = _mm_set1_ps(planes[i].dist);
+    }
+    return result;
+}
+
+//Tests four volumes at a time. Neighbouring volumes tend to be rejected by the same plane,
+//so each group starts with the plane that rejected the previous group and stops as soon as
+//all four lanes are outside.
+template<typename Behind>
+void CullGroups(std::size_t group_count, std::uint8_t* visible, Behind&& behind) noexcept {
+    std::size_t first_plane = 0;
+    for(std::size_t group = 0; group < group_count; ++group) {
+        __m128 outside = _mm_setzero_ps();
+        for(std::size_t k = 0; k < 6; ++k) {
+            const auto plane = (first_plane + k) % 6;
+            outside = _mm_or_ps(outside, behind(group, plane));
+            if(_mm_movemask_ps(outside) == 0xF) {
+                first_plane = plane;
+                break;
+            }
+        }
+        const int mask = _mm_movemask_ps(outside);
+        for(std::size_t lane = 0; lane < 4; ++lane) {
+            visible[4 * group + lane] = (mask & (1 << lane)) ? 0 : 1;
+        }
+    }
+}
+
+void CullMaskRange(const planes_t& planes, const AABB3* boxes, std::uint8_t* visible, std::size_t count) noexcept {
+    const auto simd_planes = BroadcastPlanes(planes);
+    const auto group_count = count / 4;
+    const __m128 half = _mm_set1_ps(0.5f);
+    __m128 cx{}, cy{}, cz{}, ex{}, ey{}, ez{};
+    std::size_t loaded_group = group_count;
+    CullGroups(group_count, visible, [&](std::size_t group, std::size_t plane) {
+        if(loaded_group != group) {
+            const AABB3* b = boxes + 4 * group;
+            const __m128 min_x = _mm_setr_ps(b[0].mins.x, b[1].mins.x, b[2].mins.x, b[3].mins.x);
+            const __m128 min_y = _mm_setr_ps(b[0].mins.y, b[1].mins.y, b[2].mins.y, b[3].mins.y);
+            const __m128 min_z = _mm_setr_ps(b[0].mins.z, b[1].mins.z, b[2].mins.z, b[3].mins.z);
+            const __m128 max_x = _mm_setr_ps(b[0].maxs.x, b[1].maxs.x, b[2].maxs.x, b[3].maxs.x);
+            const __m128 max_y = _mm_setr_ps(b[0].maxs.y, b[1].maxs.y, b[2].maxs.y, b[3].maxs.y);
+            const __m128 max_z = _mm_setr_ps(b[0].maxs.z, b[1].maxs.z, b[2].maxs.z, b[3].maxs.z);
+            cx = _mm_mul_ps(_mm_add_ps(min_x, max_x), half);
+            cy = _mm_mul_ps(_mm_add_ps(min_y, max_y), half);
+            cz = _mm_mul_ps(_mm_add_ps(min_z, max_z), half);
+            ex = _mm_mul_ps(_mm_sub_ps(max_x, min_x), half);
+            ey = _mm_mul_ps(_mm_sub_ps(max_y, min_y), half);
+            ez = _mm_mul_ps(_mm_sub_ps(max_z, min_z), half);
+            loaded_group = group;
+        }
+        const auto& p = simd_planes[plane];
+        const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p.nx, cx), _mm_mul_ps(p.ny, cy)), _mm_mul_ps(p.nz, cz));
+        const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p.abs_nx, ex), _mm_mul_ps(p.abs_ny, ey)), _mm_mul_ps(p.abs_nz, ez));
+        return _mm_cmplt_ps(_mm_add_ps(d, r), p.dist);
+    });
+    for(std::size_t i = 4 * group_count; i < count; ++i) {
+        visible[i] = std::none_of(std::begin(planes), std::end(planes), [&](const Plane3& plane) { return IsBoxBehindPlane(boxes[i], plane); }) ? 1 : 0;
+    }
+}
+
+void CullMaskRange(const planes_t& planes, const Sphere3* spheres, std::uint8_t* visible, std::size_t count) noexcept {
+    const auto simd_planes = BroadcastPlanes(planes);
+    const auto group_count = count / 4;
+    __m128 cx{}, cy{}, cz{}, r{};
+    std::size_t loaded_group = group_count;
+    CullGroups(group_count, visible, [&](std::size_t group, std::size_t plane) {
+        if(loaded_group != group) {
+            const Sphere3* s = spheres + 4 * group;
+            cx = _mm_setr_ps(s[0].center.x, s[1].center.x, s[2].center.x, s[3].center.x);
+            cy = _mm_setr_ps(s[0].center.y, s[1].center.y, s[2].center.y, s[3].center.y);
+            cz = _mm_setr_ps(s[0].center.z, s[1].center.z, s[2].center.z, s[3].center.z);
+            r = _mm_setr_ps(s[0].radius, s[1].radius, s[2].radius, s[3].radius);
+            loaded_group = group;
+        }
+        const auto& p = simd_planes[plane];
+        const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p.nx, cx), _mm_mul_ps(p.ny, cy)), _mm_mul_ps(p.nz, cz));
+        return _mm_cmplt_ps(_mm_add_ps(d, r), p.dist);
+    });
+    for(std::size_t i = 4 * group_count; i < count; ++i) {
+        visible[i] = std::none_of(std::begin(planes), std::end(planes), [&](const Plane3& plane) { return IsSphereBehindPlane(spheres[i], plane); }) ? 1 : 0;
+    }
+}
+#else
+template<typename T, typename Behind>
+void CullMaskRange(const planes_t& planes, const T* volumes, std::uint8_t* visible, std::size_t count, Behind&& behind) noexcept {
+    //Plane coherency: try the plane that rejected the previous volume first.
+    std::size_t first_plane = 0;
+    for(std::size_t i = 0; i < count; ++i) {
+        visible[i] = 1;
+        for(std::size_t k = 0; k < planes.size(); ++k) {
+            const auto plane = (first_plane + k) % planes.size();
+            if(behind(volumes[i], planes[plane])) {
+                visible[i] = 0;
+                first_plane = plane;
+                break;
+            }
+        }
+    }
+}
+
+void CullMaskRange(const planes_t& planes, const AABB3* boxes, std::uint8_t* visible, std::size_t count) noexcept {
+    CullMaskRange(planes, boxes, visible, count, IsBoxBehindPlane);
+}
+
+void CullMaskRange(const planes_t& planes, const Sphere3* spheres, std::uint8_t* visible, std::size_t count) noexcept {
+    CullMaskRange(planes, spheres, visible, count, IsSphereBehindPlane);
+}
+#endif
+
+template<typename T>
+void CullMaskBatched(const planes_t& planes, const T* volumes, std::size_t count, std::vector<std::uint8_t>& visible, JobSystem* jobSystem) noexcept {
+    visible.resize(count);
+    if(!count) {
+        return;
+    }
+    std::uint8_t* out = visible.data();
+    const auto kernel = [&planes, volumes, out](std::size_t begin, std::size_t end) {
+        CullMaskRange(planes, volumes + begin, out + begin, end - begin);
+    };
+    if(jobSystem) {
+        jobSystem->ParallelFor(count, MIN_CULL_JOB_SIZE, kernel);
+    } else {
+        kernel(0, count);
+    }
+}
+
+std::size_t AppendVisibleIndices(const std::vector<std::uint8_t>& visible, std::vector<std::size_t>& visibleIndices) noexcept {
+    const auto old_size = visibleIndices.size();
+    for(std::size_t i = 0; i < visible.size(); ++i) {
+        if(visible[i]) {
+            visibleIndices.push_back(i);
+        }
+    }
+    return visibleIndices.size() - old_size;
+}
+
+} //End anonymous
+
 Frustum Frustum::CreateFromViewProjectionMatrix(const Matrix4& viewProjection, float aspectRatio, float vfovDegrees, const Vector3& forward, float near, float far, bool normalize) noexcept {
     return Frustum(viewProjection, aspectRatio, vfovDegrees, forward, near, far, normalize);
 }
@@ -24,72 +224,26 @@ Frustum::Frustum(const Matrix4& viewProjectionMatrix, float aspectRatio, float v
 
     CalcPoints(vfovDegrees, aspectRatio, forward, near, far);
 
-    auto x = viewProjectionMatrix.GetXComponents();
-    auto y = viewProjectionMatrix.GetYComponents();
-    auto z = viewProjectionMatrix.GetZComponents();
-    auto w = viewProjectionMatrix.GetWComponents();
-    {
-        auto a_l = x.w + x.x;
-        auto b_l = y.w + y.x;
-        auto c_l = z.w + z.x;
-        auto d_l = w.w + w.x;
-        auto result = Plane3{ Vector3{a_l, b_l, c_l}, d_l };
-        if(normalize) {
-            result.Normalize();
-        }
-        SetLeft(result);
-    }
-    {
-        auto a_r = x.w - x.x;
-        auto b_r = y.w - y.x;
-        auto c_r = z.w - z.x;
-        auto d_r = w.w - w.x;
-        auto result = Plane3{ Vector3{a_r, b_r, c_r}, d_r };
+    //Gribb-Hartmann extraction for column vectors and D3D depth (0 <= z <= w).
+    //Each row combination gives (a, b, c, d) with ax + by + cz + d >= 0 inside,
+    //stored as an inward-facing Plane3 with dist = -d.
+    const auto x = viewProjectionMatrix.GetXComponents();
+    const auto y = viewProjectionMatrix.GetYComponents();
+    const auto z = viewProjectionMatrix.GetZComponents();
+    const auto w = viewProjectionMatrix.GetWComponents();
+    const auto make_plane = [normalize](const Vector4& v) {
+        auto result = Plane3{ Vector3{v.x, v.y, v.z}, -v.w };
         if(normalize) {
             result.Normalize();
         }
-        SetRight(result);
-    }
-    {
-        auto a_b = x.w + x.y;
-        auto b_b = y.w + y.y;
-        auto c_b = z.w + z.y;
-        auto d_b = w.w + w.y;
-        auto result = Plane3{ Vector3{a_b, b_b, c_b}, d_b };
-        if(normalize) {
-            result.Normalize();
-        }
-    }
-    {
-        auto a_t = x.w - x.y;
-        auto b_t = y.w - y.y;
-        auto c_t = z.w - z.y;
-        auto d_t = w.w - w.y;
-        auto result = Plane3{ Vector3{a_t, b_t, c_t}, d_t };
-        if(normalize) {
-            result.Normalize();
-        }
-    }
-    {
-        auto a_n = z.x;
-        auto b_n = z.y;
-        auto c_n = z.z;
-        auto d_n = z.w;
-        auto result = Plane3{ Vector3{a_n, b_n, c_n}, d_n };
-        if(normalize) {
-            result.Normalize();
-        }
-    }
-    {
-        auto a_f = w.x - z.x;
-        auto b_f = w.y - z.y;
-        auto c_f = w.z - z.z;
-        auto d_f = w.w - z.w;
-        auto result = Plane3{ Vector3{a_f, b_f, c_f}, d_f };
-        if(normalize) {
-            result.Normalize();
-        }
-    }
+        return result;
+    };
+    SetLeft(make_plane(w + x));
+    SetRight(make_plane(w - x));
+    SetBottom(make_plane(w + y));
+    SetTop(make_plane(w - y));
+    SetNear(make_plane(z));
+    SetFar(make_plane(w - z));
 }
 
 void Frustum::SetLeft(const Plane3& left) noexcept {
@@ -193,3 +347,44 @@ const Vector3& Frustum::GetFarTopRight() const noexcept {
 const Vector3& Frustum::GetFarBottomRight() const noexcept {
     return _points[7];
 }
+
+bool Frustum::IsVisible(const Vector3& point) const noexcept {
+    return std::none_of(std::begin(_planes), std::end(_planes), [&point](const Plane3& plane) { return MathUtils::IsPointBehindOfPlane(point, plane); });
+}
+
+bool Frustum::IsVisible(const AABB3& box) const noexcept {
+    return std::none_of(std::begin(_planes), std::end(_planes), [&box](const Plane3& plane) { return IsBoxBehindPlane(box, plane); });
+}
+
+bool Frustum::IsVisible(const Sphere3& sphere) const noexcept {
+    const auto planes = NormalizePlanes(_planes);
+    return std::none_of(std::begin(planes), std::end(planes), [&sphere](const Plane3& plane) { return IsSphereBehindPlane(sphere, plane); });
+}
+
+std::size_t Frustum::Cull(const AABB3* boxes, std::size_t count, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    std::vector<std::uint8_t> visible{};
+    CullMask(boxes, count, visible, jobSystem);
+    return AppendVisibleIndices(visible, visibleIndices);
+}
+
+std::size_t Frustum::Cull(const Sphere3* spheres, std::size_t count, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    std::vector<std::uint8_t> visible{};
+    CullMask(spheres, count, visible, jobSystem);
+    return AppendVisibleIndices(visible, visibleIndices);
+}
+
+std::size_t Frustum::Cull(const std::vector<AABB3>& boxes, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    return Cull(boxes.data(), boxes.size(), visibleIndices, jobSystem);
+}
+
+std::size_t Frustum::Cull(const std::vector<Sphere3>& spheres, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    return Cull(spheres.data(), spheres.size(), visibleIndices, jobSystem);
+}
+
+void Frustum::CullMask(const AABB3* boxes, std::size_t count, std::vector<std::uint8_t>& visible, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    CullMaskBatched(_planes, boxes, count, visible, jobSystem);
+}
+
+void Frustum::CullMask(const Sphere3* spheres, std::size_t count, std::vector<std::uint8_t>& visible, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    CullMaskBatched(NormalizePlanes(_planes), spheres, count, visible, jobSystem);
+}
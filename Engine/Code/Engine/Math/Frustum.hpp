@@ -2,12 +2,18 @@
 
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Math/Plane3.hpp"
+#include "Engine/Math/Sphere3.hpp"
 #include "Engine/Math/Vector3.hpp"
 
 #include <array>
+#include <cstdint>
+#include <vector>
 
 class Matrix4;
 class Camera3D;
+class JobSystem;
+
+//Planes face inward: a point is inside when it is not behind any of them.
 
 class Frustum {
 public:
@@ -36,6 +42,21 @@ public:
     const Vector3& GetFarTopRight() const noexcept;
     const Vector3& GetFarBottomRight() const noexcept;
 
+    //Conservative: false only when the volume is entirely behind one plane.
+    bool IsVisible(const Vector3& point) const noexcept;
+    bool IsVisible(const AABB3& box) const noexcept;
+    bool IsVisible(const Sphere3& sphere) const noexcept;
+
+    //Batch visibility tests. Cull appends the indices of visible volumes to visibleIndices and
+    //returns how many were added. CullMask sets visible[i] to 1 or 0 for every volume.
+    //When a JobSystem is given, large batches are split across its Generic workers.
+    std::size_t Cull(const AABB3* boxes, std::size_t count, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem = nullptr) const noexcept;
+    std::size_t Cull(const Sphere3* spheres, std::size_t count, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem = nullptr) const noexcept;
+    std::size_t Cull(const std::vector<AABB3>& boxes, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem = nullptr) const noexcept;
+    std::size_t Cull(const std::vector<Sphere3>& spheres, std::vector<std::size_t>& visibleIndices, JobSystem* jobSystem = nullptr) const noexcept;
+    void CullMask(const AABB3* boxes, std::size_t count, std::vector<std::uint8_t>& visible, JobSystem* jobSystem = nullptr) const noexcept;
+    void CullMask(const Sphere3* spheres, std::size_t count, std::vector<std::uint8_t>& visible, JobSystem* jobSystem = nullptr) const noexcept;
+
 protected:
 private:
     explicit Frustum(const Matrix4& viewProjection, float aspectRatio, float vfovDegrees, const Vector3& forward, float near, float far, bool normalize) noexcept;
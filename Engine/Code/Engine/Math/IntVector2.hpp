@@ -22,7 +22,7 @@ public:
     IntVector2(const IntVector2& rhs) = default;
     IntVector2(IntVector2&& rhs) = default;
 
-    explicit IntVector2(int initialX, int initialY) noexcept;
+    explicit constexpr IntVector2(int initialX, int initialY) noexcept;
     explicit IntVector2(const Vector2& v2) noexcept;
     explicit IntVector2(const IntVector3& iv3) noexcept;
     explicit IntVector2(const std::string& value) noexcept;
@@ -30,40 +30,40 @@ public:
     IntVector2& operator=(const IntVector2& rhs) = default;
     IntVector2& operator=(IntVector2&& rhs) = default;
     
-    IntVector2 operator+(const IntVector2& rhs) const noexcept;
-    IntVector2& operator+=(const IntVector2& rhs) noexcept;
-
-    IntVector2 operator-() const noexcept;
-    IntVector2 operator-(const IntVector2& rhs) const noexcept;
-    IntVector2& operator-=(const IntVector2& rhs) noexcept;
-
-    friend IntVector2 operator*(int lhs, const IntVector2& rhs) noexcept;
-    IntVector2 operator*(const IntVector2& rhs) const noexcept;
-    IntVector2& operator*=(const IntVector2& rhs) noexcept;
-    IntVector2 operator*(int scalar) const noexcept;
-    IntVector2& operator*=(int scalar) noexcept;
+    constexpr IntVector2 operator+(const IntVector2& rhs) const noexcept;
+    constexpr IntVector2& operator+=(const IntVector2& rhs) noexcept;
+
+    constexpr IntVector2 operator-() const noexcept;
+    constexpr IntVector2 operator-(const IntVector2& rhs) const noexcept;
+    constexpr IntVector2& operator-=(const IntVector2& rhs) noexcept;
+
+    friend constexpr IntVector2 operator*(int lhs, const IntVector2& rhs) noexcept;
+    constexpr IntVector2 operator*(const IntVector2& rhs) const noexcept;
+    constexpr IntVector2& operator*=(const IntVector2& rhs) noexcept;
+    constexpr IntVector2 operator*(int scalar) const noexcept;
+    constexpr IntVector2& operator*=(int scalar) noexcept;
     IntVector2 operator*(float scalar) const noexcept;
     IntVector2& operator*=(float scalar) noexcept;
 
-    IntVector2 operator/(const IntVector2& rhs) const noexcept;
-    IntVector2& operator/=(const IntVector2& rhs) noexcept;
-    IntVector2 operator/(int scalar) const noexcept;
-    IntVector2& operator/=(int scalar) noexcept;
+    constexpr IntVector2 operator/(const IntVector2& rhs) const noexcept;
+    constexpr IntVector2& operator/=(const IntVector2& rhs) noexcept;
+    constexpr IntVector2 operator/(int scalar) const noexcept;
+    constexpr IntVector2& operator/=(int scalar) noexcept;
     IntVector2 operator/(float scalar) const noexcept;
     IntVector2& operator/=(float scalar) noexcept;
 
-    bool operator==(const IntVector2& rhs) const noexcept;
-    bool operator!=(const IntVector2& rhs) const noexcept;
-    bool operator<(const IntVector2& rhs) const noexcept;
-    bool operator>=(const IntVector2& rhs) const noexcept;
-    bool operator>(const IntVector2& rhs) const noexcept;
-    bool operator<=(const IntVector2& rhs) const noexcept;
+    constexpr bool operator==(const IntVector2& rhs) const noexcept;
+    constexpr bool operator!=(const IntVector2& rhs) const noexcept;
+    constexpr bool operator<(const IntVector2& rhs) const noexcept;
+    constexpr bool operator>=(const IntVector2& rhs) const noexcept;
+    constexpr bool operator>(const IntVector2& rhs) const noexcept;
+    constexpr bool operator<=(const IntVector2& rhs) const noexcept;
 
     friend std::ostream& operator<<(std::ostream& out_stream, const IntVector2& v) noexcept;
     friend std::istream& operator>>(std::istream& in_stream, IntVector2& v) noexcept;
 
-    void SetXY(int newX, int newY) noexcept;
-    std::pair<int, int> GetXY() const noexcept;
+    constexpr void SetXY(int newX, int newY) noexcept;
+    constexpr std::pair<int, int> GetXY() const noexcept;
 
     int x = 0;
     int y = 0;
@@ -71,4 +71,122 @@ public:
 protected:
 private:
 
-};
\ No newline at end of file
+};
+
+constexpr IntVector2::IntVector2(int initialX, int initialY) noexcept
+    : x(initialX)
+    , y(initialY)
+{
+    /* DO NOTHING */
+}
+
+constexpr IntVector2 IntVector2::operator-() const noexcept {
+    return IntVector2(-x, -y);
+}
+
+constexpr IntVector2 IntVector2::operator+(const IntVector2& rhs) const noexcept {
+    return IntVector2(x + rhs.x, y + rhs.y);
+}
+
+constexpr IntVector2& IntVector2::operator+=(const IntVector2& rhs) noexcept {
+    x += rhs.x;
+    y += rhs.y;
+    return *this;
+}
+
+constexpr IntVector2 IntVector2::operator-(const IntVector2& rhs) const noexcept {
+    return IntVector2(x - rhs.x, y - rhs.y);
+}
+
+constexpr IntVector2& IntVector2::operator-=(const IntVector2& rhs) noexcept {
+    x -= rhs.x;
+    y -= rhs.y;
+    return *this;
+}
+
+constexpr IntVector2 operator*(int lhs, const IntVector2& rhs) noexcept {
+    return IntVector2(lhs * rhs.x, lhs * rhs.y);
+}
+
+constexpr IntVector2 IntVector2::operator*(const IntVector2& rhs) const noexcept {
+    return IntVector2(x * rhs.x, y * rhs.y);
+}
+
+constexpr IntVector2& IntVector2::operator*=(const IntVector2& rhs) noexcept {
+    x *= rhs.x;
+    y *= rhs.y;
+    return *this;
+}
+
+constexpr IntVector2 IntVector2::operator*(int scalar) const noexcept {
+    return IntVector2(x * scalar, y * scalar);
+}
+
+constexpr IntVector2& IntVector2::operator*=(int scalar) noexcept {
+    x *= scalar;
+    y *= scalar;
+    return *this;
+}
+
+constexpr IntVector2 IntVector2::operator/(const IntVector2& rhs) const noexcept {
+    return IntVector2(x / rhs.x, y / rhs.y);
+}
+
+constexpr IntVector2& IntVector2::operator/=(const IntVector2& rhs) noexcept {
+    x /= rhs.x;
+    y /= rhs.y;
+    return *this;
+}
+
+constexpr IntVector2 IntVector2::operator/(int scalar) const noexcept {
+    return IntVector2(x / scalar, y / scalar);
+}
+
+constexpr IntVector2& IntVector2::operator/=(int scalar) noexcept {
+    x /= scalar;
+    y /= scalar;
+    return *this;
+}
+
+constexpr void IntVector2::SetXY(int newX, int newY) noexcept {
+    x = newX;
+    y = newY;
+}
+
+constexpr std::pair<int, int> IntVector2::GetXY() const noexcept {
+    return std::make_pair(x, y);
+}
+
+constexpr bool IntVector2::operator!=(const IntVector2& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr bool IntVector2::operator==(const IntVector2& rhs) const noexcept {
+    return x == rhs.x && y == rhs.y;
+}
+
+constexpr bool IntVector2::operator<(const IntVector2& rhs) const noexcept {
+    if(x < rhs.x) return true;
+    if(rhs.x < x) return false;
+    if(y < rhs.y) return true;
+    return false;
+}
+
+constexpr bool IntVector2::operator>=(const IntVector2& rhs) const noexcept {
+    return !(*this < rhs);
+}
+
+constexpr bool IntVector2::operator>(const IntVector2& rhs) const noexcept {
+    return rhs < *this;
+}
+
+constexpr bool IntVector2::operator<=(const IntVector2& rhs) const noexcept {
+    return !(*this > rhs);
+}
+
+inline constexpr IntVector2 IntVector2::ZERO(0, 0);
+inline constexpr IntVector2 IntVector2::ONE(1, 1);
+inline constexpr IntVector2 IntVector2::X_AXIS(1, 0);
+inline constexpr IntVector2 IntVector2::Y_AXIS(0, 1);
+inline constexpr IntVector2 IntVector2::XY_AXIS(1, 1);
+inline constexpr IntVector2 IntVector2::YX_AXIS(1, 1);
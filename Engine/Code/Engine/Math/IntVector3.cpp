@@ -9,32 +9,6 @@
 #include <cmath>
 #include <sstream>
 
-const IntVector3 IntVector3::ZERO(0, 0, 0);
-const IntVector3 IntVector3::ONE(1, 1, 1);
-const IntVector3 IntVector3::X_AXIS(1, 0, 0);
-const IntVector3 IntVector3::Y_AXIS(0, 1, 0);
-const IntVector3 IntVector3::Z_AXIS(0, 0, 1);
-const IntVector3 IntVector3::XY_AXIS(1, 1, 0);
-const IntVector3 IntVector3::XZ_AXIS(1, 0, 1);
-const IntVector3 IntVector3::YX_AXIS(1, 1, 0);
-const IntVector3 IntVector3::YZ_AXIS(0, 1, 1);
-const IntVector3 IntVector3::ZX_AXIS(1, 0, 1);
-const IntVector3 IntVector3::ZY_AXIS(0, 1, 1);
-const IntVector3 IntVector3::XYZ_AXIS(1, 1, 1);
-
-IntVector3::IntVector3(int initialX, int initialY, int initialZ) noexcept
-    : x(initialX)
-    , y(initialY)
-    , z(initialZ) {
-    /* DO NOTHING */
-}
-
-IntVector3::IntVector3(const IntVector2& iv2, int initialZ) noexcept
-    : x(iv2.x)
-    , y(iv2.y)
-    , z(initialZ) {
-    /* DO NOTHING */
-}
 
 IntVector3::IntVector3(const Vector2& v2, int initialZ) noexcept
     : x(static_cast<int>(std::floor(v2.x)))
@@ -70,21 +44,3 @@ IntVector3::IntVector3(const std::string& value) noexcept
         }
     }
 }
-
-void IntVector3::SetXYZ(int newX, int newY, int newZ) noexcept {
-    x = newX;
-    y = newY;
-    z = newZ;
-}
-
-std::tuple<int, int, int> IntVector3::GetXYZ() const noexcept {
-    return std::make_tuple(x, y, z);
-}
-
-bool IntVector3::operator!=(const IntVector3& rhs) const noexcept {
-    return !(*this == rhs);
-}
-
-bool IntVector3::operator==(const IntVector3& rhs) const noexcept {
-    return x == rhs.x && y == rhs.y && z == rhs.z;
-}
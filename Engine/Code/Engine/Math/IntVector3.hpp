@@ -1,9 +1,10 @@
 #pragma once
 
+#include "Engine/Math/IntVector2.hpp"
+
 #include <string>
 #include <tuple>
 
-class IntVector2;
 class Vector2;
 class Vector3;
 
@@ -30,20 +31,20 @@ public:
     IntVector3(const IntVector3& rhs) = default;
     IntVector3(IntVector3&& rhs) = default;
 
-    explicit IntVector3(const IntVector2& iv2, int initialZ) noexcept;
+    explicit constexpr IntVector3(const IntVector2& iv2, int initialZ) noexcept;
     explicit IntVector3(const Vector2& v2, int initialZ) noexcept;
-    explicit IntVector3(int initialX, int initialY, int initialZ) noexcept;
+    explicit constexpr IntVector3(int initialX, int initialY, int initialZ) noexcept;
     explicit IntVector3(const Vector3& v3) noexcept;
     explicit IntVector3(const std::string& value) noexcept;
 
     IntVector3& operator=(const IntVector3& rhs) = default;
     IntVector3& operator=(IntVector3&& rhs) = default;
 
-    bool operator==(const IntVector3& rhs) const noexcept;
-    bool operator!=(const IntVector3& rhs) const noexcept;
+    constexpr bool operator==(const IntVector3& rhs) const noexcept;
+    constexpr bool operator!=(const IntVector3& rhs) const noexcept;
 
-    void SetXYZ(int newX, int newY, int newZ) noexcept;
-    std::tuple<int, int, int> GetXYZ() const noexcept;
+    constexpr void SetXYZ(int newX, int newY, int newZ) noexcept;
+    constexpr std::tuple<int, int, int> GetXYZ() const noexcept;
 
     int x = 0;
     int y = 0;
@@ -52,4 +53,49 @@ public:
 protected:
 private:
 
-};
\ No newline at end of file
+};
+
+constexpr IntVector3::IntVector3(int initialX, int initialY, int initialZ) noexcept
+    : x(initialX)
+    , y(initialY)
+    , z(initialZ) {
+    /* DO NOTHING */
+}
+
+constexpr IntVector3::IntVector3(const IntVector2& iv2, int initialZ) noexcept
+    : x(iv2.x)
+    , y(iv2.y)
+    , z(initialZ) {
+    /* DO NOTHING */
+}
+
+constexpr void IntVector3::SetXYZ(int newX, int newY, int newZ) noexcept {
+    x = newX;
+    y = newY;
+    z = newZ;
+}
+
+constexpr std::tuple<int, int, int> IntVector3::GetXYZ() const noexcept {
+    return std::make_tuple(x, y, z);
+}
+
+constexpr bool IntVector3::operator!=(const IntVector3& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr bool IntVector3::operator==(const IntVector3& rhs) const noexcept {
+    return x == rhs.x && y == rhs.y && z == rhs.z;
+}
+
+inline constexpr IntVector3 IntVector3::ZERO(0, 0, 0);
+inline constexpr IntVector3 IntVector3::ONE(1, 1, 1);
+inline constexpr IntVector3 IntVector3::X_AXIS(1, 0, 0);
+inline constexpr IntVector3 IntVector3::Y_AXIS(0, 1, 0);
+inline constexpr IntVector3 IntVector3::Z_AXIS(0, 0, 1);
+inline constexpr IntVector3 IntVector3::XY_AXIS(1, 1, 0);
+inline constexpr IntVector3 IntVector3::XZ_AXIS(1, 0, 1);
+inline constexpr IntVector3 IntVector3::YX_AXIS(1, 1, 0);
+inline constexpr IntVector3 IntVector3::YZ_AXIS(0, 1, 1);
+inline constexpr IntVector3 IntVector3::ZX_AXIS(1, 0, 1);
+inline constexpr IntVector3 IntVector3::ZY_AXIS(0, 1, 1);
+inline constexpr IntVector3 IntVector3::XYZ_AXIS(1, 1, 1);
@@ -1,10 +1,11 @@
 #pragma once
 
+#include "Engine/Math/IntVector2.hpp"
+#include "Engine/Math/IntVector3.hpp"
+
 #include <string>
 #include <tuple>
 
-class IntVector2;
-class IntVector3;
 class Vector2;
 class Vector3;
 class Vector4;
@@ -45,12 +46,12 @@ public:
     IntVector4(const IntVector4& rhs) = default;
     IntVector4(IntVector4&& rhs) = default;
 
-    explicit IntVector4(const IntVector2& iv2, int initialZ, int initialW) noexcept;
+    explicit constexpr IntVector4(const IntVector2& iv2, int initialZ, int initialW) noexcept;
     explicit IntVector4(const Vector2& v2, int initialZ, int initialW) noexcept;
     explicit IntVector4(const Vector2& xy, const Vector2& zw) noexcept;
-    explicit IntVector4(const IntVector2& xy, const IntVector2& zw) noexcept;
-    explicit IntVector4(int initialX, int initialY, int initialZ, int initialW) noexcept;
-    explicit IntVector4(const IntVector3& iv3, int initialW) noexcept;
+    explicit constexpr IntVector4(const IntVector2& xy, const IntVector2& zw) noexcept;
+    explicit constexpr IntVector4(int initialX, int initialY, int initialZ, int initialW) noexcept;
+    explicit constexpr IntVector4(const IntVector3& iv3, int initialW) noexcept;
     explicit IntVector4(const Vector3& v3, int initialW) noexcept;
     explicit IntVector4(const Vector4& rhs) noexcept;
     explicit IntVector4(const std::string& value) noexcept;
@@ -58,11 +59,11 @@ public:
     IntVector4& operator=(const IntVector4& rhs) = default;
     IntVector4& operator=(IntVector4&& rhs) = default;
 
-    bool operator==(const IntVector4& rhs) noexcept;
-    bool operator!=(const IntVector4& rhs) noexcept;
+    constexpr bool operator==(const IntVector4& rhs) const noexcept;
+    constexpr bool operator!=(const IntVector4& rhs) const noexcept;
 
-    void SetXYZW(int newX, int newY, int newZ, int newW) noexcept;
-    std::tuple<int, int, int, int> GetXYZW() const noexcept;
+    constexpr void SetXYZW(int newX, int newY, int newZ, int newW) noexcept;
+    constexpr std::tuple<int, int, int, int> GetXYZW() const noexcept;
 
     int x = 0;
     int y = 0;
@@ -72,4 +73,82 @@ public:
 protected:
 private:
 
-};
\ No newline at end of file
+};
+
+constexpr IntVector4::IntVector4(int initialX, int initialY, int initialZ, int initialW) noexcept
+    : x(initialX)
+    , y(initialY)
+    , z(initialZ)
+    , w(initialW) {
+    /* DO NOTHING */
+}
+
+constexpr IntVector4::IntVector4(const IntVector2& iv2, int initialZ, int initialW) noexcept
+    : x(iv2.x)
+    , y(iv2.y)
+    , z(initialZ)
+    , w(initialW) {
+    /* DO NOTHING */
+}
+
+constexpr IntVector4::IntVector4(const IntVector2& xy, const IntVector2& zw) noexcept
+    : x(xy.x)
+    , y(xy.y)
+    , z(zw.x)
+    , w(zw.y) {
+    /* DO NOTHING */
+}
+
+constexpr IntVector4::IntVector4(const IntVector3& iv3, int initialW) noexcept
+    : x(iv3.x)
+    , y(iv3.y)
+    , z(iv3.z)
+    , w(initialW) {
+    /* DO NOTHING */
+}
+
+constexpr void IntVector4::SetXYZW(int newX, int newY, int newZ, int newW) noexcept {
+    x = newX;
+    y = newY;
+    z = newZ;
+    w = newW;
+}
+
+constexpr std::tuple<int, int, int, int> IntVector4::GetXYZW() const noexcept {
+    return std::make_tuple(x, y, z, w);
+}
+
+constexpr bool IntVector4::operator!=(const IntVector4& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr bool IntVector4::operator==(const IntVector4& rhs) const noexcept {
+    return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+}
+
+inline constexpr IntVector4 IntVector4::ZERO(0, 0, 0, 0);
+inline constexpr IntVector4 IntVector4::ONE(1, 1, 1, 1);
+inline constexpr IntVector4 IntVector4::X_AXIS(1, 0, 0, 0);
+inline constexpr IntVector4 IntVector4::Y_AXIS(0, 1, 0, 0);
+inline constexpr IntVector4 IntVector4::Z_AXIS(0, 0, 1, 0);
+inline constexpr IntVector4 IntVector4::W_AXIS(0, 0, 0, 1);
+inline constexpr IntVector4 IntVector4::XY_AXIS(1, 1, 0, 0);
+inline constexpr IntVector4 IntVector4::XZ_AXIS(1, 0, 1, 0);
+inline constexpr IntVector4 IntVector4::XW_AXIS(1, 0, 0, 1);
+inline constexpr IntVector4 IntVector4::YX_AXIS(1, 1, 0, 0);
+inline constexpr IntVector4 IntVector4::YZ_AXIS(0, 1, 1, 0);
+inline constexpr IntVector4 IntVector4::YW_AXIS(0, 1, 0, 1);
+inline constexpr IntVector4 IntVector4::ZX_AXIS(1, 0, 1, 0);
+inline constexpr IntVector4 IntVector4::ZY_AXIS(0, 1, 1, 0);
+inline constexpr IntVector4 IntVector4::ZW_AXIS(0, 0, 1, 1);
+inline constexpr IntVector4 IntVector4::WX_AXIS(1, 0, 0, 1);
+inline constexpr IntVector4 IntVector4::WY_AXIS(0, 1, 0, 1);
+inline constexpr IntVector4 IntVector4::WZ_AXIS(0, 0, 1, 1);
+inline constexpr IntVector4 IntVector4::XYZ_AXIS(1, 1, 1, 0);
+inline constexpr IntVector4 IntVector4::XYW_AXIS(1, 1, 0, 1);
+inline constexpr IntVector4 IntVector4::YXZ_AXIS(1, 1, 1, 0);
+inline constexpr IntVector4 IntVector4::YZW_AXIS(0, 1, 1, 1);
+inline constexpr IntVector4 IntVector4::WXY_AXIS(1, 1, 0, 1);
+inline constexpr IntVector4 IntVector4::WXZ_AXIS(1, 0, 1, 1);
+inline constexpr IntVector4 IntVector4::WYZ_AXIS(0, 1, 1, 1);
+inline constexpr IntVector4 IntVector4::XYZW_AXIS(1, 1, 1, 1);
@@ -0,0 +1,532 @@
+#include "Engine/Math/LooseOctree3D.hpp"
+
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace {
+
+//Deepest tree times seven siblings left waiting per level, plus the root.
+constexpr std::size_t MAX_STACK_SIZE = 8 * 17;
+
+std::size_t CalcOctant(const Vector3& center, const Vector3& point) noexcept {
+    return (center.x <= point.x ? 1 : 0) | (center.y <= point.y ? 2 : 0) | (center.z <= point.z ? 4 : 0);
+}
+
+//Computed from the parent, so queries only touch the children they enter.
+AABB3 CalcChildLooseBounds(const Vector3& parentCenter, float parentHalfSize, std::size_t octant) noexcept {
+    const auto offset = parentHalfSize * 0.5f;
+    const Vector3 center{parentCenter.x + ((octant & 1) ? offset : -offset)
+                        ,parentCenter.y + ((octant & 2) ? offset : -offset)
+                        ,parentCenter.z + ((octant & 4) ? offset : -offset)};
+    return AABB3{center, parentHalfSize, parentHalfSize, parentHalfSize};
+}
+
+float CalcSize(const AABB3& bounds) noexcept {
+    const auto dimensions = bounds.CalcDimensions();
+    return (std::max)(dimensions.x, (std::max)(dimensions.y, dimensions.z));
+}
+
+//Without early outs: query boxes hit and miss unpredictably, so branches cost more than the compares.
+bool DoBoxesOverlap(const AABB3& a, const AABB3& b) noexcept {
+    return (a.mins.x <= b.maxs.x) & (b.mins.x <= a.maxs.x) & (a.mins.y <= b.maxs.y) & (b.mins.y <= a.maxs.y) & (a.mins.z <= b.maxs.z) & (b.mins.z <= a.maxs.z);
+}
+
+float CalcDistanceSquared(const Vector3& point, const AABB3& box) noexcept {
+    return MathUtils::CalcDistanceSquared(point, MathUtils::CalcClosestPoint(point, box));
+}
+
+//Box behind or entirely in front of a plane, using the center/extent form.
+bool IsBoxBehindPlane(const Vector3& center, const Vector3& extents, const Plane3& plane, bool& isInFront) noexcept {
+    const float d = plane.normal.x * center.x + plane.normal.y * center.y + plane.normal.z * center.z;
+    const float r = std::fabs(plane.normal.x) * extents.x + std::fabs(plane.normal.y) * extents.y + std::fabs(plane.normal.z) * extents.z;
+    isInFront = plane.dist <= d - r;
+    return d + r < plane.dist;
+}
+
+//Slab test of a segment against boxes, clipped to the segment.
+class SegmentTester {
+public:
+    explicit SegmentTester(const LineSegment3& segment) noexcept
+        : _origin{segment.start.x, segment.start.y, segment.start.z}
+    {
+        const Vector3 d = segment.CalcDisplacement();
+        _direction = {d.x, d.y, d.z};
+        for(std::size_t axis = 0; axis < 3; ++axis) {
+            _inv_direction[axis] = _direction[axis] != 0.0f ? 1.0f / _direction[axis] : 0.0f;
+        }
+    }
+    bool Intersects(const AABB3& box) const noexcept {
+        const float mins[3] = {box.mins.x, box.mins.y, box.mins.z};
+        const float maxs[3] = {box.maxs.x, box.maxs.y, box.maxs.z};
+        float t0 = 0.0f;
+        float t1 = 1.0f;
+        for(std::size_t axis = 0; axis < 3; ++axis) {
+            if(_direction[axis] == 0.0f) {
+                if(_origin[axis] < mins[axis] || maxs[axis] < _origin[axis]) {
+                    return false;
+                }
+                continue;
+            }
+            float t_near = (mins[axis] - _origin[axis]) * _inv_direction[axis];
+            float t_far = (maxs[axis] - _origin[axis]) * _inv_direction[axis];
+            if(t_far < t_near) {
+                std::swap(t_near, t_far);
+            }
+            t0 = (std::max)(t0, t_near);
+            t1 = (std::min)(t1, t_far);
+            if(t1 < t0) {
+                return false;
+            }
+        }
+        return true;
+    }
+private:
+    std::array<float, 3> _origin{};
+    std::array<float, 3> _direction{};
+    std::array<float, 3> _inv_direction{};
+};
+
+//Depth-first walk of the nodes whose loose bounds pass test, appending the proxies whose bounds pass it.
+template<typename Nodes, typename Test>
+std::size_t CollectProxies(const Nodes& nodes, Test&& test, std::vector<std::size_t>& results) noexcept {
+    const auto old_size = results.size();
+    if(!nodes[0].subtree_count) {
+        return 0;
+    }
+    std::array<std::uint32_t, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = 0u;
+    while(top) {
+        const auto& node = nodes[stack[--top]];
+        for(std::size_t i = 0; i < node.proxies.size(); ++i) {
+            if(test(node.bounds[i])) {
+                results.push_back(node.proxies[i]);
+            }
+        }
+        for(std::size_t octant = 0; octant < 8; ++octant) {
+            const auto child = node.children[octant];
+            if(child != 0xFFFFFFFFu && test(CalcChildLooseBounds(node.center, node.half_size, octant))) {
+                stack[top++] = child;
+            }
+        }
+    }
+    return results.size() - old_size;
+}
+
+} //End anonymous
+
+LooseOctree3D::LooseOctree3D(const AABB3& worldBounds, std::size_t maxDepth /*= 8*/) noexcept
+    : _world_bounds(worldBounds)
+    , _max_depth((std::min)(maxDepth, MAX_DEPTH))
+{
+    ResetRoot();
+}
+
+std::size_t LooseOctree3D::Insert(const AABB3& bounds) noexcept {
+    std::size_t proxy = _bounds.size();
+    if(_free_proxies.empty()) {
+        _bounds.push_back(bounds);
+        _proxy_nodes.push_back(NO_NODE);
+        _proxy_slots.push_back(0);
+    } else {
+        proxy = _free_proxies.back();
+        _free_proxies.pop_back();
+        _bounds[proxy] = bounds;
+    }
+    ++_count;
+    AddToNode(proxy, Descend(0, bounds.CalcCenter(), CalcSize(bounds)), NO_NODE);
+    return proxy;
+}
+
+std::size_t LooseOctree3D::Insert(const Sphere3& sphere) noexcept {
+    return Insert(AABB3{sphere.center, sphere.radius, sphere.radius, sphere.radius});
+}
+
+void LooseOctree3D::Move(std::size_t proxy, const AABB3& bounds) noexcept {
+    if(!IsValid(proxy)) {
+        return;
+    }
+    _bounds[proxy] = bounds;
+    const auto center = bounds.CalcCenter();
+    const auto size = CalcSize(bounds);
+    const auto old_node = _proxy_nodes[proxy];
+    _nodes[old_node].bounds[_proxy_slots[proxy]] = bounds;
+    //Climb to the nearest node that can still hold the object. Usually that is the node it is in.
+    auto ancestor = old_node;
+    while(ancestor != 0 && !(size <= 2.0f * _nodes[ancestor].half_size && IsInCell(ancestor, center))) {
+        ancestor = _nodes[ancestor].parent;
+    }
+    const bool goes_deeper = _nodes[ancestor].split && FitsChild(ancestor, center, size);
+    if(ancestor == old_node && !goes_deeper) {
+        return;
+    }
+    //Remove before descending so nodes emptied on the way up are back in the pool for the way down.
+    RemoveFromNode(proxy, ancestor);
+    AddToNode(proxy, Descend(ancestor, center, size), ancestor);
+}
+
+void LooseOctree3D::Move(std::size_t proxy, const Sphere3& sphere) noexcept {
+    Move(proxy, AABB3{sphere.center, sphere.radius, sphere.radius, sphere.radius});
+}
+
+void LooseOctree3D::Remove(std::size_t proxy) noexcept {
+    if(!IsValid(proxy)) {
+        return;
+    }
+    RemoveFromNode(proxy, NO_NODE);
+    _free_proxies.push_back(proxy);
+    --_count;
+}
+
+void LooseOctree3D::Clear() noexcept {
+    ResetRoot();
+    _bounds.clear();
+    _proxy_nodes.clear();
+    _proxy_slots.clear();
+    _free_proxies.clear();
+    _count = 0;
+}
+
+std::size_t LooseOctree3D::size() const noexcept {
+    return _count;
+}
+
+bool LooseOctree3D::empty() const noexcept {
+    return _count == 0;
+}
+
+bool LooseOctree3D::IsValid(std::size_t proxy) const noexcept {
+    return proxy < _proxy_nodes.size() && _proxy_nodes[proxy] != NO_NODE;
+}
+
+const AABB3& LooseOctree3D::GetBounds(std::size_t proxy) const noexcept {
+    return _bounds[proxy];
+}
+
+const AABB3& LooseOctree3D::GetWorldBounds() const noexcept {
+    return _world_bounds;
+}
+
+std::size_t LooseOctree3D::GetMaxDepth() const noexcept {
+    return _max_depth;
+}
+
+std::size_t LooseOctree3D::GetNodeCount() const noexcept {
+    return _nodes.size() - _free_nodes.size();
+}
+
+std::size_t LooseOctree3D::GetNodeCapacity() const noexcept {
+    return _nodes.size();
+}
+
+void LooseOctree3D::ResetRoot() noexcept {
+    _nodes.clear();
+    _free_nodes.clear();
+    Node root{};
+    const auto dimensions = _world_bounds.CalcDimensions();
+    root.center = _world_bounds.CalcCenter();
+    root.half_size = (std::max)(dimensions.x, (std::max)(dimensions.y, dimensions.z)) * 0.5f;
+    _nodes.push_back(root);
+}
+
+std::uint32_t LooseOctree3D::AllocateNode() noexcept {
+    if(_free_nodes.empty()) {
+        _nodes.emplace_back();
+        return static_cast<std::uint32_t>(_nodes.size() - 1);
+    }
+    const auto index = _free_nodes.back();
+    _free_nodes.pop_back();
+    return index;
+}
+
+void LooseOctree3D::ReleaseNode(std::uint32_t node) noexcept {
+    //Every node but the root holds at least one proxy, so an emptied node has no children left.
+    auto& parent = _nodes[_nodes[node].parent];
+    parent.children[CalcOctant(parent.center, _nodes[node].center)] = NO_NODE;
+    _nodes[node].parent = NO_NODE;
+    _free_nodes.push_back(node);
+}
+
+std::uint32_t LooseOctree3D::GetOrCreateChild(std::uint32_t node, std::size_t octant) noexcept {
+    if(_nodes[node].children[octant] != NO_NODE) {
+        return _nodes[node].children[octant];
+    }
+    const auto index = AllocateNode();
+    auto& child = _nodes[index];
+    const auto& parent = _nodes[node];
+    child.half_size = parent.half_size * 0.5f;
+    child.center = Vector3{parent.center.x + ((octant & 1) ? child.half_size : -child.half_size)
+                          ,parent.center.y + ((octant & 2) ? child.half_size : -child.half_size)
+                          ,parent.center.z + ((octant & 4) ? child.half_size : -child.half_size)};
+    child.parent = node;
+    child.depth = parent.depth + 1;
+    child.children.fill(NO_NODE);
+    child.proxies.clear();
+    child.bounds.clear();
+    child.subtree_count = 0;
+    child.split = false;
+    _nodes[node].children[octant] = index;
+    return index;
+}
+
+bool LooseOctree3D::IsInCell(std::uint32_t node, const Vector3& point) const noexcept {
+    const auto& n = _nodes[node];
+    return std::fabs(point.x - n.center.x) <= n.half_size && std::fabs(point.y - n.center.y) <= n.half_size && std::fabs(point.z - n.center.z) <= n.half_size;
+}
+
+bool LooseOctree3D::FitsChild(std::uint32_t node, const Vector3& center, float size) const noexcept {
+    //An object no larger than a cell and centered in it stays inside that cell's doubled bounds.
+    return _nodes[node].depth < _max_depth && size <= _nodes[node].half_size && IsInCell(node, center);
+}
+
+std::uint32_t LooseOctree3D::Descend(std::uint32_t node, const Vector3& center, float size) noexcept {
+    while(_nodes[node].split && FitsChild(node, center, size)) {
+        node = GetOrCreateChild(node, CalcOctant(_nodes[node].center, center));
+    }
+    return node;
+}
+
+void LooseOctree3D::AddToNode(std::size_t proxy, std::uint32_t node, std::uint32_t stop) noexcept {
+    _proxy_nodes[proxy] = node;
+    _proxy_slots[proxy] = static_cast<std::uint32_t>(_nodes[node].proxies.size());
+    _nodes[node].proxies.push_back(static_cast<std::uint32_t>(proxy));
+    _nodes[node].bounds.push_back(_bounds[proxy]);
+    for(auto n = node; n != stop; n = _nodes[n].parent) {
+        ++_nodes[n].subtree_count;
+    }
+    if(!_nodes[node].split && _nodes[node].proxies.size() > SPLIT_THRESHOLD) {
+        Split(node);
+    }
+}
+
+void LooseOctree3D::RemoveFromNode(std::size_t proxy, std::uint32_t stop) noexcept {
+    const auto node = _proxy_nodes[proxy];
+    auto& proxies = _nodes[node].proxies;
+    auto& bounds = _nodes[node].bounds;
+    const auto slot = _proxy_slots[proxy];
+    proxies[slot] = proxies.back();
+    bounds[slot] = bounds.back();
+    _proxy_slots[proxies[slot]] = slot;
+    proxies.pop_back();
+    bounds.pop_back();
+    auto merge = NO_NODE;
+    for(auto n = node; n != stop;) {
+        const auto parent = _nodes[n].parent;
+        if(!--_nodes[n].subtree_count && n != 0) {
+            ReleaseNode(n);
+        } else if(_nodes[n].split && _nodes[n].subtree_count <= MERGE_THRESHOLD) {
+            merge = n;
+        }
+        n = parent;
+    }
+    _proxy_nodes[proxy] = NO_NODE;
+    //Merging the highest small subtree also takes care of any small subtrees below it.
+    if(merge != NO_NODE) {
+        Merge(merge);
+    }
+}
+
+void LooseOctree3D::Split(std::uint32_t node) noexcept {
+    _nodes[node].split = true;
+    //Walk backwards so the proxy swapped into a freed slot has already been visited.
+    for(auto slot = _nodes[node].proxies.size(); slot-- > 0;) {
+        const auto box = _nodes[node].bounds[slot];
+        const auto center = box.CalcCenter();
+        if(!FitsChild(node, center, CalcSize(box))) {
+            continue;
+        }
+        const auto child = GetOrCreateChild(node, CalcOctant(_nodes[node].center, center));
+        auto& proxies = _nodes[node].proxies;
+        auto& bounds = _nodes[node].bounds;
+        const auto proxy = proxies[slot];
+        proxies[slot] = proxies.back();
+        bounds[slot] = bounds.back();
+        _proxy_slots[proxies[slot]] = static_cast<std::uint32_t>(slot);
+        proxies.pop_back();
+        bounds.pop_back();
+        _proxy_nodes[proxy] = child;
+        _proxy_slots[proxy] = static_cast<std::uint32_t>(_nodes[child].proxies.size());
+        _nodes[child].proxies.push_back(proxy);
+        _nodes[child].bounds.push_back(box);
+        ++_nodes[child].subtree_count;
+    }
+    //Splitting a child can grow _nodes, so iterate over a copy rather than a reference into it.
+    const auto children = _nodes[node].children;
+    for(const auto child : children) {
+        if(child != NO_NODE && _nodes[child].proxies.size() > SPLIT_THRESHOLD) {
+            Split(child);
+        }
+    }
+}
+
+void LooseOctree3D::Merge(std::uint32_t node) noexcept {
+    std::array<std::uint32_t, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    for(auto& child : _nodes[node].children) {
+        if(child != NO_NODE) {
+            stack[top++] = child;
+            child = NO_NODE;
+        }
+    }
+    auto& target = _nodes[node];
+    while(top) {
+        const auto index = stack[--top];
+        auto& descendant = _nodes[index];
+        for(std::size_t i = 0; i < descendant.proxies.size(); ++i) {
+            const auto proxy = descendant.proxies[i];
+            _proxy_nodes[proxy] = node;
+            _proxy_slots[proxy] = static_cast<std::uint32_t>(target.proxies.size());
+            target.proxies.push_back(proxy);
+            target.bounds.push_back(descendant.bounds[i]);
+        }
+        for(auto& child : descendant.children) {
+            if(child != NO_NODE) {
+                stack[top++] = child;
+                child = NO_NODE;
+            }
+        }
+        _free_nodes.push_back(index);
+        descendant.proxies.clear();
+        descendant.bounds.clear();
+        descendant.parent = NO_NODE;
+        descendant.subtree_count = 0;
+        descendant.split = false;
+    }
+    target.split = false;
+}
+
+void LooseOctree3D::AppendSubtree(std::uint32_t node, std::vector<std::size_t>& results) const noexcept {
+    std::array<std::uint32_t, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = node;
+    while(top) {
+        const auto& n = _nodes[stack[--top]];
+        results.insert(results.end(), n.proxies.begin(), n.proxies.end());
+        for(const auto child : n.children) {
+            if(child != NO_NODE) {
+                stack[top++] = child;
+            }
+        }
+    }
+}
+
+std::size_t LooseOctree3D::QueryOverlap(const AABB3& box, std::vector<std::size_t>& results) const noexcept {
+    return CollectProxies(_nodes, [&box](const AABB3& bounds) { return DoBoxesOverlap(box, bounds); }, results);
+}
+
+std::size_t LooseOctree3D::QueryOverlap(const Sphere3& sphere, std::vector<std::size_t>& results) const noexcept {
+    const auto radius_squared = sphere.radius * sphere.radius;
+    return CollectProxies(_nodes, [&sphere, radius_squared](const AABB3& bounds) { return CalcDistanceSquared(sphere.center, bounds) <= radius_squared; }, results);
+}
+
+std::size_t LooseOctree3D::QueryRay(const LineSegment3& segment, std::vector<std::size_t>& results) const noexcept {
+    const SegmentTester tester{segment};
+    return CollectProxies(_nodes, [&tester](const AABB3& bounds) { return tester.Intersects(bounds); }, results);
+}
+
+std::size_t LooseOctree3D::QueryVisible(const Frustum& frustum, std::vector<std::size_t>& results) const noexcept {
+    if(!_nodes[0].subtree_count) {
+        return 0;
+    }
+    const std::array<Plane3, 6> planes{frustum.GetLeft(), frustum.GetRight(), frustum.GetTop(), frustum.GetBottom(), frustum.GetNear(), frustum.GetFar()};
+    //Each entry carries the planes its node may still cross; once a node is in front
+    //of every plane its whole subtree is visible without further tests.
+    constexpr std::uint32_t all_planes = (1u << 6) - 1;
+    const auto classify = [&planes](const AABB3& box, std::uint32_t& mask) {
+        const Vector3 center = (box.mins + box.maxs) * 0.5f;
+        const Vector3 extents = (box.maxs - box.mins) * 0.5f;
+        for(std::uint32_t i = 0; i < planes.size(); ++i) {
+            if(!(mask & (1u << i))) {
+                continue;
+            }
+            bool in_front = false;
+            if(IsBoxBehindPlane(center, extents, planes[i], in_front)) {
+                return false;
+            }
+            if(in_front) {
+                mask &= ~(1u << i);
+            }
+        }
+        return true;
+    };
+
+    const auto old_size = results.size();
+    std::array<std::pair<std::uint32_t, std::uint32_t>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    //The root also holds objects outside the world bounds, so it is always visited.
+    stack[top++] = std::make_pair(0u, all_planes);
+    while(top) {
+        const auto entry = stack[--top];
+        const auto& node = _nodes[entry.first];
+        const auto mask = entry.second;
+        if(!mask) {
+            AppendSubtree(entry.first, results);
+            continue;
+        }
+        for(std::size_t i = 0; i < node.proxies.size(); ++i) {
+            auto proxy_mask = mask;
+            if(classify(node.bounds[i], proxy_mask)) {
+                results.push_back(node.proxies[i]);
+            }
+        }
+        for(std::size_t octant = 0; octant < 8; ++octant) {
+            const auto child = node.children[octant];
+            auto child_mask = mask;
+            if(child != NO_NODE && classify(CalcChildLooseBounds(node.center, node.half_size, octant), child_mask)) {
+                stack[top++] = std::make_pair(child, child_mask);
+            }
+        }
+    }
+    return results.size() - old_size;
+}
+
+std::size_t LooseOctree3D::QueryNearest(const Vector3& point, std::size_t k, std::vector<std::size_t>& results, float maxDistance /*= infinity*/) const noexcept {
+    if(!k || !_nodes[0].subtree_count || maxDistance < 0.0f) {
+        return 0;
+    }
+    using node_entry_t = std::pair<float, std::uint32_t>;
+    using proxy_entry_t = std::pair<float, std::size_t>;
+    //Nodes nearest first; the k best proxies so far with the worst on top.
+    std::priority_queue<node_entry_t, std::vector<node_entry_t>, std::greater<node_entry_t>> nodes{};
+    std::priority_queue<proxy_entry_t> best{};
+    const auto max_distance_squared = maxDistance * maxDistance;
+    const auto bound = [&]() { return best.size() < k ? max_distance_squared : best.top().first; };
+    //The root also holds objects outside the world bounds, so it is always visited.
+    nodes.emplace(0.0f, 0u);
+    while(!nodes.empty() && nodes.top().first <= bound()) {
+        const auto& node = _nodes[nodes.top().second];
+        nodes.pop();
+        for(std::size_t i = 0; i < node.proxies.size(); ++i) {
+            const proxy_entry_t entry{CalcDistanceSquared(point, node.bounds[i]), node.proxies[i]};
+            if(best.size() < k ? entry.first <= max_distance_squared : entry < best.top()) {
+                if(best.size() == k) {
+                    best.pop();
+                }
+                best.push(entry);
+            }
+        }
+        for(std::size_t octant = 0; octant < 8; ++octant) {
+            const auto child = node.children[octant];
+            if(child != NO_NODE) {
+                const auto distance_squared = CalcDistanceSquared(point, CalcChildLooseBounds(node.center, node.half_size, octant));
+                if(distance_squared <= bound()) {
+                    nodes.emplace(distance_squared, child);
+                }
+            }
+        }
+    }
+    const auto old_size = results.size();
+    results.resize(old_size + best.size());
+    for(auto i = results.size(); i-- > old_size; best.pop()) {
+        results[i] = best.top().second;
+    }
+    return results.size() - old_size;
+}
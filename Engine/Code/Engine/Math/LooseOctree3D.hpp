@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class Frustum;
+class LineSegment3;
+class Sphere3;
+
+//Loose octree for many moving 3D objects, where rebuilding a BVH every frame is too slow.
+//Node bounds are doubled so an object can be stored in any node whose cell contains its center
+//and is at least as large as the object. Objects centered outside the world bounds are kept at the root.
+//Nodes are buckets: a node splits once it holds more than SPLIT_THRESHOLD proxies, pushing down
+//the ones small enough for a child, and pulls its subtree back up when that drops to MERGE_THRESHOLD.
+//Objects are tracked as proxies: Insert returns a proxy id that stays valid until Remove.
+//Ids are handed out from zero and reused after removal, so they can index a parallel array of objects.
+//Move first checks the node the object is already in and climbs only as far as it must,
+//so small moves cost amortized O(1). Nodes come from a pool: emptied subtrees go back to it and
+//keep their storage for the next node created.
+class LooseOctree3D {
+public:
+    explicit LooseOctree3D(const AABB3& worldBounds, std::size_t maxDepth = 8) noexcept;
+    LooseOctree3D(const LooseOctree3D& other) = default;
+    LooseOctree3D(LooseOctree3D&& other) = default;
+    LooseOctree3D& operator=(const LooseOctree3D& other) = default;
+    LooseOctree3D& operator=(LooseOctree3D&& other) = default;
+    ~LooseOctree3D() = default;
+
+    std::size_t Insert(const AABB3& bounds) noexcept;
+    std::size_t Insert(const Sphere3& sphere) noexcept;
+    void Move(std::size_t proxy, const AABB3& bounds) noexcept;
+    void Move(std::size_t proxy, const Sphere3& sphere) noexcept;
+    void Remove(std::size_t proxy) noexcept;
+    void Clear() noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    bool IsValid(std::size_t proxy) const noexcept;
+    const AABB3& GetBounds(std::size_t proxy) const noexcept;
+
+    const AABB3& GetWorldBounds() const noexcept;
+    std::size_t GetMaxDepth() const noexcept;
+    //Nodes in the tree, and nodes allocated including those waiting in the pool.
+    std::size_t GetNodeCount() const noexcept;
+    std::size_t GetNodeCapacity() const noexcept;
+
+    //Queries append the proxies whose bounds pass the test to results and return how many were added.
+    std::size_t QueryOverlap(const AABB3& box, std::vector<std::size_t>& results) const noexcept;
+    std::size_t QueryOverlap(const Sphere3& sphere, std::vector<std::size_t>& results) const noexcept;
+    std::size_t QueryVisible(const Frustum& frustum, std::vector<std::size_t>& results) const noexcept;
+    std::size_t QueryRay(const LineSegment3& segment, std::vector<std::size_t>& results) const noexcept;
+
+    //Appends up to k proxies nearest to point, nearest first, and returns how many were added.
+    //Distance is measured to the proxy bounds and is zero inside them; ties go to the lower id.
+    std::size_t QueryNearest(const Vector3& point, std::size_t k, std::vector<std::size_t>& results, float maxDistance = (std::numeric_limits<float>::infinity)()) const noexcept;
+
+protected:
+private:
+    static constexpr std::uint32_t NO_NODE = 0xFFFFFFFFu;
+    static constexpr std::size_t MAX_DEPTH = 16;
+    static constexpr std::size_t SPLIT_THRESHOLD = 8;
+    static constexpr std::uint32_t MERGE_THRESHOLD = 4;
+    //What a query reads to visit a node comes first.
+    struct Node {
+        Vector3 center{};
+        float half_size = 0.0f;
+        std::array<std::uint32_t, 8> children{NO_NODE, NO_NODE, NO_NODE, NO_NODE, NO_NODE, NO_NODE, NO_NODE, NO_NODE};
+        std::vector<std::uint32_t> proxies{};
+        //Copies of the proxies' bounds, so queries read them next to the ids.
+        std::vector<AABB3> bounds{};
+        std::uint32_t parent = NO_NODE;
+        std::uint32_t depth = 0;
+        //Proxies stored in this node and all of its descendants. Only the root is ever empty.
+        std::uint32_t subtree_count = 0;
+        //Split nodes pass proxies that fit a child down to it. Only split nodes have children.
+        bool split = false;
+    };
+
+    void ResetRoot() noexcept;
+    std::uint32_t AllocateNode() noexcept;
+    void ReleaseNode(std::uint32_t node) noexcept;
+    std::uint32_t GetOrCreateChild(std::uint32_t node, std::size_t octant) noexcept;
+    bool IsInCell(std::uint32_t node, const Vector3& point) const noexcept;
+    bool FitsChild(std::uint32_t node, const Vector3& center, float size) const noexcept;
+    std::uint32_t Descend(std::uint32_t node, const Vector3& center, float size) noexcept;
+    //Counts change on the path from the proxy's node up to, but not including, stop.
+    void AddToNode(std::size_t proxy, std::uint32_t node, std::uint32_t stop) noexcept;
+    void RemoveFromNode(std::size_t proxy, std::uint32_t stop) noexcept;
+    void Split(std::uint32_t node) noexcept;
+    void Merge(std::uint32_t node) noexcept;
+    void AppendSubtree(std::uint32_t node, std::vector<std::size_t>& results) const noexcept;
+
+    AABB3 _world_bounds{};
+    std::size_t _max_depth = 8;
+    std::vector<Node> _nodes{};
+    std::vector<std::uint32_t> _free_nodes{};
+    std::vector<AABB3> _bounds{};
+    std::vector<std::uint32_t> _proxy_nodes{};
+    std::vector<std::uint32_t> _proxy_slots{};
+    std::vector<std::size_t> _free_proxies{};
+    std::size_t _count = 0;
+};
@@ -0,0 +1,196 @@
+#include "Engine/Math/LooseQuadtree2D.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <algorithm>
+
+namespace {
+
+bool IsPointInside(const AABB2& bounds, const Vector2& point) noexcept {
+    return bounds.mins.x <= point.x && point.x <= bounds.maxs.x && bounds.mins.y <= point.y && point.y <= bounds.maxs.y;
+}
+
+std::size_t CalcQuadrant(const Vector2& center, const Vector2& point) noexcept {
+    return (center.x <= point.x ? 1 : 0) | (center.y <= point.y ? 2 : 0);
+}
+
+} //End anonymous
+
+LooseQuadtree2D::LooseQuadtree2D(const AABB2& worldBounds, std::size_t maxDepth /*= 8*/) noexcept
+    : Broadphase2D()
+    , _world_bounds(worldBounds)
+    , _max_depth(maxDepth)
+{
+    ResetRoot();
+}
+
+LooseQuadtree2D::~LooseQuadtree2D() noexcept {
+    /* DO NOTHING */
+}
+
+const AABB2& LooseQuadtree2D::GetWorldBounds() const noexcept {
+    return _world_bounds;
+}
+
+std::size_t LooseQuadtree2D::GetMaxDepth() const noexcept {
+    return _max_depth;
+}
+
+std::size_t LooseQuadtree2D::GetNodeCount() const noexcept {
+    return _nodes.size();
+}
+
+void LooseQuadtree2D::ResetRoot() noexcept {
+    _nodes.clear();
+    Node root{};
+    const auto dimensions = _world_bounds.CalcDimensions();
+    root.center = _world_bounds.CalcCenter();
+    root.half_size = (std::max)(dimensions.x, dimensions.y) * 0.5f;
+    root.loose_bounds = AABB2{root.center, 2.0f * root.half_size, 2.0f * root.half_size};
+    _nodes.push_back(root);
+}
+
+std::uint32_t LooseQuadtree2D::GetOrCreateChild(std::uint32_t node, std::size_t quadrant) noexcept {
+    if(_nodes[node].children[quadrant] != NO_NODE) {
+        return _nodes[node].children[quadrant];
+    }
+    Node child{};
+    const auto& parent = _nodes[node];
+    child.half_size = parent.half_size * 0.5f;
+    child.center = Vector2{parent.center.x + ((quadrant & 1) ? child.half_size : -child.half_size), parent.center.y + ((quadrant & 2) ? child.half_size : -child.half_size)};
+    child.loose_bounds = AABB2{child.center, 2.0f * child.half_size, 2.0f * child.half_size};
+    child.parent = node;
+    child.depth = parent.depth + 1;
+    const auto index = static_cast<std::uint32_t>(_nodes.size());
+    _nodes.push_back(child);
+    _nodes[node].children[quadrant] = index;
+    return index;
+}
+
+std::uint32_t LooseQuadtree2D::FindNode(const AABB2& bounds) noexcept {
+    const auto center = bounds.CalcCenter();
+    const auto dimensions = bounds.CalcDimensions();
+    const auto size = (std::max)(dimensions.x, dimensions.y);
+    const AABB2 root_cell{_nodes[0].center, _nodes[0].half_size, _nodes[0].half_size};
+    std::uint32_t node = 0;
+    if(!IsPointInside(root_cell, center)) {
+        return node;
+    }
+    //A shape no larger than a cell and centered in it stays inside that cell's doubled bounds.
+    while(_nodes[node].depth < _max_depth && size <= _nodes[node].half_size) {
+        node = GetOrCreateChild(node, CalcQuadrant(_nodes[node].center, center));
+    }
+    return node;
+}
+
+void LooseQuadtree2D::AddToNode(std::size_t proxy, std::uint32_t node) noexcept {
+    _proxy_nodes[proxy] = node;
+    _proxy_slots[proxy] = static_cast<std::uint32_t>(_nodes[node].proxies.size());
+    _nodes[node].proxies.push_back(static_cast<std::uint32_t>(proxy));
+    for(auto n = node; n != NO_NODE; n = _nodes[n].parent) {
+        ++_nodes[n].subtree_count;
+    }
+}
+
+void LooseQuadtree2D::RemoveFromNode(std::size_t proxy) noexcept {
+    const auto node = _proxy_nodes[proxy];
+    auto& proxies = _nodes[node].proxies;
+    const auto slot = _proxy_slots[proxy];
+    proxies[slot] = proxies.back();
+    _proxy_slots[proxies[slot]] = slot;
+    proxies.pop_back();
+    for(auto n = node; n != NO_NODE; n = _nodes[n].parent) {
+        --_nodes[n].subtree_count;
+    }
+    _proxy_nodes[proxy] = NO_NODE;
+}
+
+void LooseQuadtree2D::OnInsert(std::size_t proxy) noexcept {
+    if(_proxy_nodes.size() <= proxy) {
+        _proxy_nodes.resize(proxy + 1, NO_NODE);
+        _proxy_slots.resize(proxy + 1, 0);
+    }
+    AddToNode(proxy, FindNode(GetBounds(proxy)));
+}
+
+void LooseQuadtree2D::OnMove(std::size_t proxy, const AABB2& /*oldBounds*/) noexcept {
+    const auto node = FindNode(GetBounds(proxy));
+    if(node == _proxy_nodes[proxy]) {
+        return;
+    }
+    RemoveFromNode(proxy);
+    AddToNode(proxy, node);
+}
+
+void LooseQuadtree2D::OnRemove(std::size_t proxy) noexcept {
+    RemoveFromNode(proxy);
+}
+
+void LooseQuadtree2D::OnClear() noexcept {
+    ResetRoot();
+    _proxy_nodes.clear();
+    _proxy_slots.clear();
+}
+
+void LooseQuadtree2D::QueryRegion(const AABB2& region, std::vector<std::size_t>& results) const noexcept {
+    std::vector<std::uint32_t> stack{0u};
+    while(!stack.empty()) {
+        const auto& node = _nodes[stack.back()];
+        stack.pop_back();
+        for(const auto proxy : node.proxies) {
+            if(MathUtils::DoAABBsOverlap(region, GetBounds(proxy))) {
+                results.push_back(proxy);
+            }
+        }
+        for(const auto child : node.children) {
+            if(child != NO_NODE && _nodes[child].subtree_count && MathUtils::DoAABBsOverlap(region, _nodes[child].loose_bounds)) {
+                stack.push_back(child);
+            }
+        }
+    }
+}
+
+void LooseQuadtree2D::QueryPoint(const Vector2& point, std::vector<std::size_t>& results) const noexcept {
+    std::vector<std::uint32_t> stack{0u};
+    while(!stack.empty()) {
+        const auto& node = _nodes[stack.back()];
+        stack.pop_back();
+        for(const auto proxy : node.proxies) {
+            if(IsPointInside(GetBounds(proxy), point)) {
+                results.push_back(proxy);
+            }
+        }
+        for(const auto child : node.children) {
+            if(child != NO_NODE && _nodes[child].subtree_count && IsPointInside(_nodes[child].loose_bounds, point)) {
+                stack.push_back(child);
+            }
+        }
+    }
+}
+
+void LooseQuadtree2D::QueryPairs(std::vector<proxy_pair_t>& results) const noexcept {
+    //Loose cells of neighbouring nodes overlap, so a shape can touch shapes stored anywhere
+    //its bounds reach, not only in its ancestors. Each shape queries its own bounds and keeps
+    //the partners with a higher id, so every pair is found once.
+    std::vector<std::uint32_t> stack{};
+    for(const auto& owner : _nodes) {
+        for(const auto proxy : owner.proxies) {
+            const auto& bounds = GetBounds(proxy);
+            stack.assign(1, 0u);
+            while(!stack.empty()) {
+                const auto& node = _nodes[stack.back()];
+                stack.pop_back();
+                for(const auto other : node.proxies) {
+                    if(proxy < other && MathUtils::DoAABBsOverlap(bounds, GetBounds(other))) {
+                        results.emplace_back(proxy, other);
+                    }
+                }
+                for(const auto child : node.children) {
+                    if(child != NO_NODE && _nodes[child].subtree_count && MathUtils::DoAABBsOverlap(bounds, _nodes[child].loose_bounds)) {
+                        stack.push_back(child);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Engine/Math/Broadphase2D.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+//Loose quadtree broadphase. Node bounds are doubled so a shape is stored in exactly one node:
+//the deepest one whose cell contains its center and is at least as large as the shape.
+//Handles mixed shape sizes better than a uniform grid. Shapes centered outside
+//the world bounds are kept at the root. Nodes are created on demand and kept in one
+//array for reuse; empty subtrees are skipped by queries.
+class LooseQuadtree2D : public Broadphase2D {
+public:
+    explicit LooseQuadtree2D(const AABB2& worldBounds, std::size_t maxDepth = 8) noexcept;
+    LooseQuadtree2D(const LooseQuadtree2D& other) = default;
+    LooseQuadtree2D(LooseQuadtree2D&& other) = default;
+    LooseQuadtree2D& operator=(const LooseQuadtree2D& other) = default;
+    LooseQuadtree2D& operator=(LooseQuadtree2D&& other) = default;
+    virtual ~LooseQuadtree2D() noexcept;
+
+    const AABB2& GetWorldBounds() const noexcept;
+    std::size_t GetMaxDepth() const noexcept;
+    std::size_t GetNodeCount() const noexcept;
+
+    virtual void QueryRegion(const AABB2& region, std::vector<std::size_t>& results) const noexcept override;
+    virtual void QueryPoint(const Vector2& point, std::vector<std::size_t>& results) const noexcept override;
+    virtual void QueryPairs(std::vector<proxy_pair_t>& results) const noexcept override;
+
+protected:
+    virtual void OnInsert(std::size_t proxy) noexcept override;
+    virtual void OnMove(std::size_t proxy, const AABB2& oldBounds) noexcept override;
+    virtual void OnRemove(std::size_t proxy) noexcept override;
+    virtual void OnClear() noexcept override;
+
+private:
+    static constexpr std::uint32_t NO_NODE = 0xFFFFFFFFu;
+    struct Node {
+        AABB2 loose_bounds{};
+        Vector2 center{};
+        float half_size = 0.0f;
+        std::uint32_t parent = NO_NODE;
+        std::uint32_t depth = 0;
+        std::array<std::uint32_t, 4> children{NO_NODE, NO_NODE, NO_NODE, NO_NODE};
+        std::vector<std::uint32_t> proxies{};
+        //Proxies stored in this node and all of its descendants.
+        std::uint32_t subtree_count = 0;
+    };
+
+    void ResetRoot() noexcept;
+    std::uint32_t FindNode(const AABB2& bounds) noexcept;
+    std::uint32_t GetOrCreateChild(std::uint32_t node, std::size_t quadrant) noexcept;
+    void AddToNode(std::size_t proxy, std::uint32_t node) noexcept;
+    void RemoveFromNode(std::size_t proxy) noexcept;
+
+    AABB2 _world_bounds{};
+    std::size_t _max_depth = 8;
+    std::vector<Node> _nodes{};
+    std::vector<std::uint32_t> _proxy_nodes{};
+    std::vector<std::uint32_t> _proxy_slots{};
+};
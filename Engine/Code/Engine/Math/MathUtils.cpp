@@ -1,15 +1,22 @@
 #include "Engine/Math/MathUtils.hpp"
 
 #include <cmath>
+#include <limits>
+#include <vector>
 
+#include "Engine/Core/BuildConfig.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
 #include "Engine/Core/Rgba.hpp"
 
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Math/OBB2.hpp"
+#include "Engine/Math/OBB3.hpp"
 #include "Engine/Math/Capsule2.hpp"
 #include "Engine/Math/Capsule3.hpp"
 #include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/FastMath.hpp"
 #include "Engine/Math/Sphere3.hpp"
 #include "Engine/Math/LineSegment2.hpp"
 #include "Engine/Math/LineSegment3.hpp"
@@ -17,11 +24,57 @@
 #include "Engine/Math/Plane2.hpp"
 #include "Engine/Math/Plane3.hpp"
 #include "Engine/Math/Quaternion.hpp"
+#include "Engine/Math/Random.hpp"
+
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
 
 namespace MathUtils {
 
 namespace {
 static thread_local unsigned int MT_RANDOM_SEED = 0u;
+
+//Points per pass of a batch point fill; one pass of random values and angles stays on the stack.
+constexpr std::size_t RANDOM_POINT_CHUNK_SIZE = 256;
+//Points per job when a batch point fill is split across a JobSystem.
+constexpr std::size_t MIN_RANDOM_POINT_JOB_SIZE = 4096;
+
+//Point i is made from the values at positions [i * ValuesPerPoint, (i + 1) * ValuesPerPoint) past the
+//thread's RandomStream position, so a split fill makes the same points as a serial one.
+//makePoints(values, first, n) turns n * ValuesPerPoint values in [0, 1) into out[first, first + n).
+template<std::size_t ValuesPerPoint, typename MakePoints>
+void FillRandomPoints(std::size_t count, JobSystem* jobSystem, MakePoints&& makePoints) noexcept {
+    auto& stream = GetRandomStream(MT_RANDOM_SEED);
+    const RandomStream base = stream;
+    const auto start = base.GetPosition();
+    const auto kernel = [&](std::size_t first, std::size_t last) {
+        RandomStream local = base;
+        float values[RANDOM_POINT_CHUNK_SIZE * ValuesPerPoint];
+        for(auto i = first; i < last; i += RANDOM_POINT_CHUNK_SIZE) {
+            const auto n = (std::min)(RANDOM_POINT_CHUNK_SIZE, last - i);
+            local.SetPosition(start + i * ValuesPerPoint);
+            local.FillFloats(values, n * ValuesPerPoint, 0.0f, 1.0f);
+            makePoints(values, i, n);
+        }
+    };
+    if(jobSystem) {
+        jobSystem->ParallelFor(count, MIN_RANDOM_POINT_JOB_SIZE, kernel);
+    } else {
+        kernel(0, count);
+    }
+    stream.SetPosition(start + count * ValuesPerPoint);
+}
+
+//Unit vectors at angles values[i * stride] * 2pi, for i in [0, n).
+void CalcRandomDirections(const float* values, std::size_t stride, std::size_t n, float* cosines, float* sines) noexcept {
+    float angles[RANDOM_POINT_CHUNK_SIZE];
+    for(std::size_t i = 0; i < n; ++i) {
+        angles[i] = values[i * stride] * MathUtils::M_2PI;
+    }
+    FastMath::SinCos(angles, sines, cosines, n);
+}
+
 }
 
 void SetRandomEngineSeed(unsigned int seed) noexcept {
@@ -72,6 +125,19 @@ std::mt19937_64& GetMT64RandomEngine(unsigned int seed /*= 0*/) noexcept {
     return e;
 }
 
+RandomStream& GetRandomStream(unsigned int seed /*= 0*/) noexcept {
+    static thread_local RandomStream e = RandomStream(!seed ? GetRandomDevice()() : seed);
+    return e;
+}
+
+void FillRandomFloats(float* out, std::size_t count, float minInclusive, float maxInclusive, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    GetRandomStream(MT_RANDOM_SEED).FillFloats(out, count, minInclusive, maxInclusive, jobSystem);
+}
+
+void FillRandomInts(int* out, std::size_t count, int minInclusive, int maxInclusive, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    GetRandomStream(MT_RANDOM_SEED).FillInts(out, count, minInclusive, maxInclusive, jobSystem);
+}
+
 bool GetRandomBool() noexcept {
     return MathUtils::GetRandomIntLessThan(2) == 0;
 }
@@ -290,18 +356,6 @@ float CalcDistance3D(const Vector4& a, const Vector4& b) noexcept {
     return (b - a).CalcLength3D();
 }
 
-float CalcDistanceSquared(const Vector2& a, const Vector2& b) noexcept {
-    return (b - a).CalcLengthSquared();
-}
-
-float CalcDistanceSquared(const Vector3& a, const Vector3& b) noexcept {
-    return (b - a).CalcLengthSquared();
-}
-
-float CalcDistanceSquared(const Vector4& a, const Vector4& b) noexcept {
-    return (b - a).CalcLength4DSquared();
-}
-
 float CalcDistanceSquared(const Vector2& p, const LineSegment2& line) noexcept {
     return CalcDistanceSquared(p, CalcClosestPoint(p, line));
 }
@@ -318,34 +372,10 @@ float CalcDistanceSquared3D(const Vector4& a, const Vector4& b) noexcept {
     return (b - a).CalcLength3DSquared();
 }
 
-float DotProduct(const Vector2& a, const Vector2& b) noexcept {
-    return a.x * b.x + a.y * b.y;
-}
-
-float DotProduct(const Vector3& a, const Vector3& b) noexcept {
-    return a.x * b.x + a.y * b.y + a.z * b.z;
-}
-
-float DotProduct(const Vector4& a, const Vector4& b) noexcept {
-    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
-}
-
 float DotProduct(const Quaternion& a, const Quaternion& b) noexcept {
     return (a.w * b.w) + DotProduct(a.axis, b.axis);
 }
 
-Vector3 CrossProduct(const Vector3& a, const Vector3& b) noexcept {
-    float a1 = a.x;
-    float a2 = a.y;
-    float a3 = a.z;
-
-    float b1 = b.x;
-    float b2 = b.y;
-    float b3 = b.z;
-
-    return Vector3(a2 * b3 - a3 * b2, a3 * b1 - a1 * b3, a1 * b2 - a2 * b1);
-}
-
 Vector2 Project(const Vector2& a, const Vector2& b) noexcept {
     return (DotProduct(a, b) / DotProduct(b, b)) * b;
 }
@@ -489,6 +519,142 @@ Vector3 GetRandomPointInside(const Sphere3& sphere) noexcept {
     return sphere.center + Vector3{ x,y,z };
 }
 
+void FillRandomPointsOn(const AABB2& aabb, Vector2* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto width = aabb.maxs.x - aabb.mins.x;
+    const auto height = aabb.maxs.y - aabb.mins.y;
+    const auto perimeter = 2.0f * (width + height);
+    FillRandomPoints<1>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            //Walk the distance counter-clockwise from mins.
+            auto t = values[i] * perimeter;
+            Vector2 point{};
+            if(t < width) {
+                point = Vector2{aabb.mins.x + t, aabb.mins.y};
+            } else if((t -= width) < height) {
+                point = Vector2{aabb.maxs.x, aabb.mins.y + t};
+            } else if((t -= height) < width) {
+                point = Vector2{aabb.maxs.x - t, aabb.maxs.y};
+            } else {
+                point = Vector2{aabb.mins.x, (std::max)(aabb.mins.y, aabb.maxs.y - (t - width))};
+            }
+            out[first + i] = point;
+        }
+    });
+}
+
+void FillRandomPointsOn(const Disc2& disc, Vector2* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    FillRandomPoints<1>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        float cosines[RANDOM_POINT_CHUNK_SIZE];
+        float sines[RANDOM_POINT_CHUNK_SIZE];
+        CalcRandomDirections(values, 1, n, cosines, sines);
+        for(std::size_t i = 0; i < n; ++i) {
+            out[first + i] = Vector2{disc.center.x + disc.radius * cosines[i], disc.center.y + disc.radius * sines[i]};
+        }
+    });
+}
+
+void FillRandomPointsOn(const LineSegment2& line, Vector2* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto displacement = line.end - line.start;
+    FillRandomPoints<1>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            out[first + i] = Vector2{line.start.x + displacement.x * values[i], line.start.y + displacement.y * values[i]};
+        }
+    });
+}
+
+void FillRandomPointsOn(const AABB3& aabb, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto dimensions = aabb.maxs - aabb.mins;
+    //Faces facing x, y and z, weighted by area. Each axis has a face at mins and one at maxs.
+    const float areas[3]{dimensions.y * dimensions.z, dimensions.x * dimensions.z, dimensions.x * dimensions.y};
+    const auto total_area = 2.0f * (areas[0] + areas[1] + areas[2]);
+    FillRandomPoints<3>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            const auto* v = values + i * 3;
+            auto t = v[0] * total_area;
+            int axis = 0;
+            for(; axis < 2 && t >= 2.0f * areas[axis]; ++axis) {
+                t -= 2.0f * areas[axis];
+            }
+            const auto on_maxs = t >= areas[axis];
+            float unit[3]{};
+            unit[axis] = on_maxs ? 1.0f : 0.0f;
+            unit[(axis + 1) % 3] = v[1];
+            unit[(axis + 2) % 3] = v[2];
+            out[first + i] = Vector3{aabb.mins.x + dimensions.x * unit[0], aabb.mins.y + dimensions.y * unit[1], aabb.mins.z + dimensions.z * unit[2]};
+        }
+    });
+}
+
+void FillRandomPointsOn(const Sphere3& sphere, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    FillRandomPoints<2>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        float cosines[RANDOM_POINT_CHUNK_SIZE];
+        float sines[RANDOM_POINT_CHUNK_SIZE];
+        CalcRandomDirections(values, 2, n, cosines, sines);
+        for(std::size_t i = 0; i < n; ++i) {
+            //Height along the axis is uniform on a sphere (Archimedes' hat-box theorem), so no acos.
+            const auto z = 1.0f - 2.0f * values[i * 2 + 1];
+            const auto ring = std::sqrt((std::max)(0.0f, 1.0f - z * z));
+            out[first + i] = sphere.center + sphere.radius * Vector3{ring * cosines[i], ring * sines[i], z};
+        }
+    });
+}
+
+void FillRandomPointsOn(const LineSegment3& line, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto displacement = line.end - line.start;
+    FillRandomPoints<1>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            out[first + i] = line.start + displacement * values[i];
+        }
+    });
+}
+
+void FillRandomPointsInside(const AABB2& aabb, Vector2* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto dimensions = aabb.maxs - aabb.mins;
+    FillRandomPoints<2>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            out[first + i] = Vector2{aabb.mins.x + dimensions.x * values[i * 2], aabb.mins.y + dimensions.y * values[i * 2 + 1]};
+        }
+    });
+}
+
+void FillRandomPointsInside(const Disc2& disc, Vector2* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    FillRandomPoints<2>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        float cosines[RANDOM_POINT_CHUNK_SIZE];
+        float sines[RANDOM_POINT_CHUNK_SIZE];
+        CalcRandomDirections(values, 2, n, cosines, sines);
+        for(std::size_t i = 0; i < n; ++i) {
+            const auto r = disc.radius * std::sqrt(values[i * 2 + 1]);
+            out[first + i] = Vector2{disc.center.x + r * cosines[i], disc.center.y + r * sines[i]};
+        }
+    });
+}
+
+void FillRandomPointsInside(const AABB3& aabb, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto dimensions = aabb.maxs - aabb.mins;
+    FillRandomPoints<3>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        for(std::size_t i = 0; i < n; ++i) {
+            const auto* v = values + i * 3;
+            out[first + i] = Vector3{aabb.mins.x + dimensions.x * v[0], aabb.mins.y + dimensions.y * v[1], aabb.mins.z + dimensions.z * v[2]};
+        }
+    });
+}
+
+void FillRandomPointsInside(const Sphere3& sphere, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    FillRandomPoints<5>(count, jobSystem, [&](const float* values, std::size_t first, std::size_t n) {
+        float cosines[RANDOM_POINT_CHUNK_SIZE];
+        float sines[RANDOM_POINT_CHUNK_SIZE];
+        CalcRandomDirections(values, 5, n, cosines, sines);
+        for(std::size_t i = 0; i < n; ++i) {
+            const auto* v = values + i * 5;
+            const auto z = 1.0f - 2.0f * v[1];
+            const auto ring = std::sqrt((std::max)(0.0f, 1.0f - z * z));
+            //The largest of three uniform values is distributed as the cube root of one, without calling cbrt.
+            const auto r = sphere.radius * (std::max)(v[2], (std::max)(v[3], v[4]));
+            out[first + i] = sphere.center + r * Vector3{ring * cosines[i], ring * sines[i], z};
+        }
+    });
+}
+
 bool IsPointInside(const AABB2& aabb, const Vector2& point) noexcept {
     if(aabb.maxs.x < point.x) return false;
     if(point.x < aabb.mins.x) return false;
@@ -511,6 +677,14 @@ bool IsPointInside(const OBB2& obb, const Vector2& point) noexcept {
     return DoOBBsOverlap(obb, { point, 0.0f });
 }
 
+bool IsPointInside(const OBB3& obb, const Vector3& point) noexcept {
+    const auto displacement = point - obb.position;
+    if(obb.half_extents.x < std::abs(DotProduct(displacement, obb.right))) return false;
+    if(obb.half_extents.y < std::abs(DotProduct(displacement, obb.up))) return false;
+    if(obb.half_extents.z < std::abs(DotProduct(displacement, obb.forward))) return false;
+    return true;
+}
+
 bool IsPointInside(const Disc2& disc, const Vector2& point) noexcept {
     return CalcDistanceSquared(disc.center, point) < (disc.radius * disc.radius);
 }
@@ -665,6 +839,44 @@ Vector3 CalcClosestPoint(const Vector3& p, const Capsule3& capsule) noexcept {
     return closestP + (dir_to_p * capsule.radius);
 }
 
+Vector3 CalcClosestPoint(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c) noexcept {
+    //Voronoi regions of the vertices, then the edges, else the face (Ericson, Real-Time Collision Detection, 5.1.5).
+    const auto ab = b - a;
+    const auto ac = c - a;
+    const auto ap = p - a;
+    const auto d1 = DotProduct(ab, ap);
+    const auto d2 = DotProduct(ac, ap);
+    if(d1 <= 0.0f && d2 <= 0.0f) {
+        return a;
+    }
+    const auto bp = p - b;
+    const auto d3 = DotProduct(ab, bp);
+    const auto d4 = DotProduct(ac, bp);
+    if(d3 >= 0.0f && d4 <= d3) {
+        return b;
+    }
+    const auto vc = d1 * d4 - d3 * d2;
+    if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+    const auto cp = p - c;
+    const auto d5 = DotProduct(ab, cp);
+    const auto d6 = DotProduct(ac, cp);
+    if(d6 >= 0.0f && d5 <= d6) {
+        return c;
+    }
+    const auto vb = d5 * d2 - d1 * d6;
+    if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+    const auto va = d3 * d6 - d5 * d4;
+    if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+    const auto denominator = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
 Vector2 CalcNormalizedPointFromPoint(const Vector2& pos, const AABB2& bounds) noexcept {
     float x_norm = RangeMap(pos.x, bounds.mins.x, bounds.maxs.x, 0.0f, 1.0f);
     float y_norm = RangeMap(pos.y, bounds.mins.y, bounds.maxs.y, 0.0f, 1.0f);
@@ -689,6 +901,272 @@ Vector2 CalcPointFromNormalizedHalfExtents(const Vector2& uv, const AABB2& bound
     return Vector2(x, y);
 }
 
+namespace {
+
+//Corners and face normals of an OBB2 as used by the separating axis test.
+struct OBBSATData {
+    Vector2 corners[4]{};
+    Vector2 normals[2]{};
+};
+
+//Shapes per chunk when the a[i]/b[i] OBB batch computes corner data on the stack.
+constexpr std::size_t OBB_BATCH_CHUNK_SIZE = 64;
+
+OBBSATData CalcOBBSATData(const OBB2& obb) noexcept {
+    const auto R = Matrix4::Create2DRotationDegreesMatrix(obb.orientationDegrees);
+    const auto T = Matrix4::CreateTranslationMatrix(obb.position);
+    const auto M = T * R;
+    const auto hex = obb.half_extents.x;
+    const auto hey = obb.half_extents.y;
+    OBBSATData result{};
+    result.corners[0] = M.TransformPosition(Vector2(-hex, +hey));
+    result.corners[1] = M.TransformPosition(Vector2(-hex, -hey));
+    result.corners[2] = M.TransformPosition(Vector2(+hex, -hey));
+    result.corners[3] = M.TransformPosition(Vector2(+hex, +hey));
+    result.normals[0] = R.TransformDirection(Vector2(hex, 0.0f).GetNormalize());
+    result.normals[1] = R.TransformDirection(Vector2(0.0f, hey).GetNormalize());
+    return result;
+}
+
+void ProjectCorners(const OBBSATData& obb, const Vector2& axis, float& min, float& max) noexcept {
+    min = std::numeric_limits<float>::infinity();
+    max = std::numeric_limits<float>::lowest();
+    for(const auto& corner : obb.corners) {
+        const auto proj_dp = DotProduct(corner, axis);
+        min = (std::min)(min, proj_dp);
+        max = (std::max)(max, proj_dp);
+    }
+}
+
+bool IsSeparatingAxis(const OBBSATData& a, const OBBSATData& b, const Vector2& axis) noexcept {
+    float min_a{};
+    float max_a{};
+    float min_b{};
+    float max_b{};
+    ProjectCorners(a, axis, min_a, max_a);
+    ProjectCorners(b, axis, min_b, max_b);
+    return max_a < min_b || max_b < min_a;
+}
+
+bool DoOBBsOverlap(const OBBSATData& a, const OBBSATData& b) noexcept {
+    for(const auto& an : a.normals) {
+        if(IsSeparatingAxis(a, b, an)) return false;
+    }
+    for(const auto& bn : b.normals) {
+        if(IsSeparatingAxis(a, b, bn)) return false;
+    }
+    return true;
+}
+
+//Batch kernels shared by the a[i]/b[i] and candidate pair overloads.
+//get_a(i) and get_b(i) return the two shapes of pair i.
+//The SSE paths gather four pairs per step and repeat the scalar arithmetic
+//operation for operation, so every lane gives the same answer as the single-pair test.
+
+#ifdef MATH_SIMD_SSE
+template<typename Get, typename Field>
+__m128 GatherLanes(Get& get, std::size_t i, Field&& field) noexcept {
+    return _mm_setr_ps(field(get(i)), field(get(i + 1)), field(get(i + 2)), field(get(i + 3)));
+}
+
+void StoreLaneMask(int bits, std::uint8_t* result) noexcept {
+    result[0] = static_cast<std::uint8_t>(bits & 1);
+    result[1] = static_cast<std::uint8_t>((bits >> 1) & 1);
+    result[2] = static_cast<std::uint8_t>((bits >> 2) & 1);
+    result[3] = static_cast<std::uint8_t>((bits >> 3) & 1);
+}
+#endif
+
+template<typename GetA, typename GetB>
+void DiscsOverlapBatch(std::size_t count, GetA&& get_a, GetB&& get_b, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const auto dx = _mm_sub_ps(GatherLanes(get_b, i, [](const Disc2& d) { return d.center.x; }), GatherLanes(get_a, i, [](const Disc2& d) { return d.center.x; }));
+        const auto dy = _mm_sub_ps(GatherLanes(get_b, i, [](const Disc2& d) { return d.center.y; }), GatherLanes(get_a, i, [](const Disc2& d) { return d.center.y; }));
+        const auto r = _mm_add_ps(GatherLanes(get_a, i, [](const Disc2& d) { return d.radius; }), GatherLanes(get_b, i, [](const Disc2& d) { return d.radius; }));
+        const auto distance_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        StoreLaneMask(_mm_movemask_ps(_mm_cmplt_ps(distance_sq, _mm_mul_ps(r, r))), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoDiscsOverlap(get_a(i), get_b(i)) ? 1 : 0;
+    }
+}
+
+//Separate coordinate and radius arrays need no gather: lanes are loaded straight from memory.
+void DiscsOverlapBatch(std::size_t count, const float* aX, const float* aY, const float* aRadius, const float* bX, const float* bY, const float* bRadius, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const auto dx = _mm_sub_ps(_mm_loadu_ps(bX + i), _mm_loadu_ps(aX + i));
+        const auto dy = _mm_sub_ps(_mm_loadu_ps(bY + i), _mm_loadu_ps(aY + i));
+        const auto r = _mm_add_ps(_mm_loadu_ps(aRadius + i), _mm_loadu_ps(bRadius + i));
+        const auto distance_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        StoreLaneMask(_mm_movemask_ps(_mm_cmplt_ps(distance_sq, _mm_mul_ps(r, r))), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoDiscsOverlap(Vector2(aX[i], aY[i]), aRadius[i], Vector2(bX[i], bY[i]), bRadius[i]) ? 1 : 0;
+    }
+}
+
+void SpheresOverlapBatch(std::size_t count, const float* aX, const float* aY, const float* aZ, const float* aRadius, const float* bX, const float* bY, const float* bZ, const float* bRadius, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const auto dx = _mm_sub_ps(_mm_loadu_ps(bX + i), _mm_loadu_ps(aX + i));
+        const auto dy = _mm_sub_ps(_mm_loadu_ps(bY + i), _mm_loadu_ps(aY + i));
+        const auto dz = _mm_sub_ps(_mm_loadu_ps(bZ + i), _mm_loadu_ps(aZ + i));
+        const auto r = _mm_add_ps(_mm_loadu_ps(aRadius + i), _mm_loadu_ps(bRadius + i));
+        const auto distance_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        StoreLaneMask(_mm_movemask_ps(_mm_cmplt_ps(distance_sq, _mm_mul_ps(r, r))), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoSpheresOverlap(Vector3(aX[i], aY[i], aZ[i]), aRadius[i], Vector3(bX[i], bY[i], bZ[i]), bRadius[i]) ? 1 : 0;
+    }
+}
+
+template<typename GetA, typename GetB>
+void SpheresOverlapBatch(std::size_t count, GetA&& get_a, GetB&& get_b, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const auto dx = _mm_sub_ps(GatherLanes(get_b, i, [](const Sphere3& s) { return s.center.x; }), GatherLanes(get_a, i, [](const Sphere3& s) { return s.center.x; }));
+        const auto dy = _mm_sub_ps(GatherLanes(get_b, i, [](const Sphere3& s) { return s.center.y; }), GatherLanes(get_a, i, [](const Sphere3& s) { return s.center.y; }));
+        const auto dz = _mm_sub_ps(GatherLanes(get_b, i, [](const Sphere3& s) { return s.center.z; }), GatherLanes(get_a, i, [](const Sphere3& s) { return s.center.z; }));
+        const auto r = _mm_add_ps(GatherLanes(get_a, i, [](const Sphere3& s) { return s.radius; }), GatherLanes(get_b, i, [](const Sphere3& s) { return s.radius; }));
+        const auto distance_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        StoreLaneMask(_mm_movemask_ps(_mm_cmplt_ps(distance_sq, _mm_mul_ps(r, r))), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoSpheresOverlap(get_a(i), get_b(i)) ? 1 : 0;
+    }
+}
+
+template<typename GetA, typename GetB>
+void AABB2sOverlapBatch(std::size_t count, GetA&& get_a, GetB&& get_b, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const auto a_mins_x = GatherLanes(get_a, i, [](const AABB2& b) { return b.mins.x; });
+        const auto a_mins_y = GatherLanes(get_a, i, [](const AABB2& b) { return b.mins.y; });
+        const auto a_maxs_x = GatherLanes(get_a, i, [](const AABB2& b) { return b.maxs.x; });
+        const auto a_maxs_y = GatherLanes(get_a, i, [](const AABB2& b) { return b.maxs.y; });
+        const auto b_mins_x = GatherLanes(get_b, i, [](const AABB2& b) { return b.mins.x; });
+        const auto b_mins_y = GatherLanes(get_b, i, [](const AABB2& b) { return b.mins.y; });
+        const auto b_maxs_x = GatherLanes(get_b, i, [](const AABB2& b) { return b.maxs.x; });
+        const auto b_maxs_y = GatherLanes(get_b, i, [](const AABB2& b) { return b.maxs.y; });
+        const auto separated_x = _mm_or_ps(_mm_cmplt_ps(a_maxs_x, b_mins_x), _mm_cmplt_ps(b_maxs_x, a_mins_x));
+        const auto separated_y = _mm_or_ps(_mm_cmplt_ps(a_maxs_y, b_mins_y), _mm_cmplt_ps(b_maxs_y, a_mins_y));
+        StoreLaneMask(~_mm_movemask_ps(_mm_or_ps(separated_x, separated_y)), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoAABBsOverlap(get_a(i), get_b(i)) ? 1 : 0;
+    }
+}
+
+template<typename GetA, typename GetB>
+void AABB3sOverlapBatch(std::size_t count, GetA&& get_a, GetB&& get_b, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const auto a_mins_x = GatherLanes(get_a, i, [](const AABB3& b) { return b.mins.x; });
+        const auto a_mins_y = GatherLanes(get_a, i, [](const AABB3& b) { return b.mins.y; });
+        const auto a_mins_z = GatherLanes(get_a, i, [](const AABB3& b) { return b.mins.z; });
+        const auto a_maxs_x = GatherLanes(get_a, i, [](const AABB3& b) { return b.maxs.x; });
+        const auto a_maxs_y = GatherLanes(get_a, i, [](const AABB3& b) { return b.maxs.y; });
+        const auto a_maxs_z = GatherLanes(get_a, i, [](const AABB3& b) { return b.maxs.z; });
+        const auto b_mins_x = GatherLanes(get_b, i, [](const AABB3& b) { return b.mins.x; });
+        const auto b_mins_y = GatherLanes(get_b, i, [](const AABB3& b) { return b.mins.y; });
+        const auto b_mins_z = GatherLanes(get_b, i, [](const AABB3& b) { return b.mins.z; });
+        const auto b_maxs_x = GatherLanes(get_b, i, [](const AABB3& b) { return b.maxs.x; });
+        const auto b_maxs_y = GatherLanes(get_b, i, [](const AABB3& b) { return b.maxs.y; });
+        const auto b_maxs_z = GatherLanes(get_b, i, [](const AABB3& b) { return b.maxs.z; });
+        const auto separated_x = _mm_or_ps(_mm_cmplt_ps(a_maxs_x, b_mins_x), _mm_cmplt_ps(b_maxs_x, a_mins_x));
+        const auto separated_y = _mm_or_ps(_mm_cmplt_ps(a_maxs_y, b_mins_y), _mm_cmplt_ps(b_maxs_y, a_mins_y));
+        const auto separated_z = _mm_or_ps(_mm_cmplt_ps(a_maxs_z, b_mins_z), _mm_cmplt_ps(b_maxs_z, a_mins_z));
+        StoreLaneMask(~_mm_movemask_ps(_mm_or_ps(_mm_or_ps(separated_x, separated_y), separated_z)), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoAABBsOverlap(get_a(i), get_b(i)) ? 1 : 0;
+    }
+}
+
+#ifdef MATH_SIMD_SSE
+//Lane-wise ProjectCorners: _mm_min_ps/_mm_max_ps with the new value first pick
+//the same operand as std::min/std::max with the running value first.
+template<typename Get>
+void ProjectCornersLanes(Get& get, std::size_t i, const __m128& axis_x, const __m128& axis_y, __m128& min, __m128& max) noexcept {
+    min = _mm_set1_ps(std::numeric_limits<float>::infinity());
+    max = _mm_set1_ps(std::numeric_limits<float>::lowest());
+    for(std::size_t c = 0; c < 4; ++c) {
+        const auto x = GatherLanes(get, i, [c](const OBBSATData& d) { return d.corners[c].x; });
+        const auto y = GatherLanes(get, i, [c](const OBBSATData& d) { return d.corners[c].y; });
+        const auto proj_dp = _mm_add_ps(_mm_mul_ps(x, axis_x), _mm_mul_ps(y, axis_y));
+        min = _mm_min_ps(proj_dp, min);
+        max = _mm_max_ps(proj_dp, max);
+    }
+}
+
+template<typename GetA, typename GetB, typename GetAxis>
+__m128 IsSeparatingAxisLanes(GetA& get_a, GetB& get_b, GetAxis& get_axis, std::size_t i, std::size_t n) noexcept {
+    const auto axis_x = GatherLanes(get_axis, i, [n](const OBBSATData& d) { return d.normals[n].x; });
+    const auto axis_y = GatherLanes(get_axis, i, [n](const OBBSATData& d) { return d.normals[n].y; });
+    __m128 min_a{};
+    __m128 max_a{};
+    __m128 min_b{};
+    __m128 max_b{};
+    ProjectCornersLanes(get_a, i, axis_x, axis_y, min_a, max_a);
+    ProjectCornersLanes(get_b, i, axis_x, axis_y, min_b, max_b);
+    return _mm_or_ps(_mm_cmplt_ps(max_a, min_b), _mm_cmplt_ps(max_b, min_a));
+}
+#endif
+
+template<typename GetA, typename GetB>
+void OBBsOverlapBatch(std::size_t count, GetA&& get_a, GetB&& get_b, std::uint8_t* result) noexcept {
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        auto separated = IsSeparatingAxisLanes(get_a, get_b, get_a, i, 0);
+        separated = _mm_or_ps(separated, IsSeparatingAxisLanes(get_a, get_b, get_a, i, 1));
+        separated = _mm_or_ps(separated, IsSeparatingAxisLanes(get_a, get_b, get_b, i, 0));
+        separated = _mm_or_ps(separated, IsSeparatingAxisLanes(get_a, get_b, get_b, i, 1));
+        StoreLaneMask(~_mm_movemask_ps(separated), result + i);
+    }
+#endif
+    for(; i < count; ++i) {
+        result[i] = DoOBBsOverlap(get_a(i), get_b(i)) ? 1 : 0;
+    }
+}
+
+//Corner and normal data for every shape referenced by the candidate pairs.
+//Shapes usually appear in many pairs, so each one is transformed only once.
+std::vector<OBBSATData> CalcOBBSATData(const OBB2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs) noexcept {
+    std::size_t shape_count = 0;
+    for(const auto& pair : pairs) {
+        shape_count = (std::max)(shape_count, (std::max)(pair.first, pair.second) + 1);
+    }
+    std::vector<OBBSATData> result(shape_count);
+    std::vector<std::uint8_t> used(shape_count, 0);
+    for(const auto& pair : pairs) {
+        used[pair.first] = 1;
+        used[pair.second] = 1;
+    }
+    for(std::size_t i = 0; i < shape_count; ++i) {
+        if(used[i]) {
+            result[i] = CalcOBBSATData(shapes[i]);
+        }
+    }
+    return result;
+}
+
+} //End anonymous
+
 bool DoDiscsOverlap(const Disc2& a, const Disc2& b) noexcept {
     return DoDiscsOverlap(a.center, a.radius, b.center, b.radius);
 }
@@ -733,84 +1211,83 @@ bool DoAABBsOverlap(const AABB3& a, const AABB3& b) noexcept {
 
 bool DoOBBsOverlap(const OBB2& a, const OBB2& b) noexcept {
     //Separating Axis Theorem
-    const auto Pa = a.position;
-    const auto Oa = a.orientationDegrees;
-    const auto Ra = Matrix4::Create2DRotationDegreesMatrix(Oa);
-    const auto Ta = Matrix4::CreateTranslationMatrix(Pa);
-    const auto Ma = Ta * Ra;
-    const auto a_hex = a.half_extents.x;
-    const auto a_hey = a.half_extents.y;
-    const auto a_topright = Ma.TransformPosition(Vector2(+a_hex,-a_hey));
-    const auto a_bottomright = Ma.TransformPosition(Vector2(+a_hex,+a_hey));
-    const auto a_topleft = Ma.TransformPosition(Vector2(-a_hex,-a_hey));
-    const auto a_bottomleft = Ma.TransformPosition(Vector2(-a_hex,+a_hey));
-    const auto a_right_normal = Ra.TransformDirection(Vector2(a_hex, 0.0f).GetNormalize());
-    const auto a_down_normal = Ra.TransformDirection(Vector2(0.0f, a_hey).GetNormalize());
-    const auto a_left_normal = -a_right_normal;
-    const auto a_up_normal = -a_down_normal;
-
-    const auto Pb = b.position;
-    const auto Ob = b.orientationDegrees;
-    const auto Rb = Matrix4::Create2DRotationDegreesMatrix(Ob);
-    const auto Tb = Matrix4::CreateTranslationMatrix(Pb);
-    const auto Mb = Tb * Rb;
-    const auto b_hex = b.half_extents.x;
-    const auto b_hey = b.half_extents.y;
-    const auto b_topright = Mb.TransformPosition(Vector2(+b_hex, -b_hey));
-    const auto b_bottomright = Mb.TransformPosition(Vector2(+b_hex, +b_hey));
-    const auto b_topleft = Mb.TransformPosition(Vector2(-b_hex, -b_hey));
-    const auto b_bottomleft = Mb.TransformPosition(Vector2(-b_hex, +b_hey));
-    const auto b_right_normal = Rb.TransformDirection(Vector2(b_hex, 0.0f).GetNormalize());
-    const auto b_down_normal = Rb.TransformDirection(Vector2(0.0f, b_hey).GetNormalize());
-    const auto b_left_normal = -b_right_normal;
-    const auto b_up_normal = -b_down_normal;
-
-    const std::vector<Vector2> a_normals{ a_right_normal, a_down_normal};
-    const std::vector<Vector2> a_corners{ a_bottomleft, a_topleft, a_topright, a_bottomright};
-    const std::vector<Vector2> b_normals{ b_right_normal, b_down_normal};
-    const std::vector<Vector2> b_corners{ b_bottomleft, b_topleft, b_topright, b_bottomright};
-
-    for(const auto& an : a_normals) {
-        auto min_a = std::numeric_limits<float>::infinity();
-        auto max_a = std::numeric_limits<float>::lowest();
-        for(const auto& ac : a_corners) {
-            const auto proj_dp = DotProduct(ac, an);
-            min_a = (std::min)(min_a, proj_dp);
-            max_a = (std::max)(max_a, proj_dp);
-        }
+    return DoOBBsOverlap(CalcOBBSATData(a), CalcOBBSATData(b));
+}
 
-        auto min_b = std::numeric_limits<float>::infinity();
-        auto max_b = std::numeric_limits<float>::lowest();
-        for(const auto& bc : b_corners) {
-            const auto proj_dp = DotProduct(bc, an);
-            min_b = (std::min)(min_b, proj_dp);
-            max_b = (std::max)(max_b, proj_dp);
-        }
+void DoDiscsOverlap(const Disc2* a, const Disc2* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    DiscsOverlapBatch(count, [a](std::size_t i) -> const Disc2& { return a[i]; }, [b](std::size_t i) -> const Disc2& { return b[i]; }, result.data());
+}
 
-        if(max_a < min_b) return false;
-        if(max_b < min_a) return false;
-    }
-    for(const auto& bn : b_normals) {
-        auto min_b = std::numeric_limits<float>::infinity();
-        auto max_b = std::numeric_limits<float>::lowest();
-        for(const auto& bc : b_corners) {
-            const auto proj_dp = DotProduct(bc, bn);
-            min_b = (std::min)(min_b, proj_dp);
-            max_b = (std::max)(max_b, proj_dp);
-        }
+void DoDiscsOverlap(const Disc2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(pairs.size());
+    const auto* p = pairs.data();
+    DiscsOverlapBatch(pairs.size(), [shapes, p](std::size_t i) -> const Disc2& { return shapes[p[i].first]; }, [shapes, p](std::size_t i) -> const Disc2& { return shapes[p[i].second]; }, result.data());
+}
 
-        auto min_a = std::numeric_limits<float>::infinity();
-        auto max_a = std::numeric_limits<float>::lowest();
-        for(const auto& ac : a_corners) {
-            const auto proj_dp = DotProduct(ac, bn);
-            min_a = (std::min)(min_a, proj_dp);
-            max_a = (std::max)(max_a, proj_dp);
-        }
+void DoDiscsOverlap(const float* aX, const float* aY, const float* aRadius, const float* bX, const float* bY, const float* bRadius, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    DiscsOverlapBatch(count, aX, aY, aRadius, bX, bY, bRadius, result.data());
+}
 
-        if(max_b < min_a) return false;
-        if(max_a < min_b) return false;
+void DoSpheresOverlap(const Sphere3* a, const Sphere3* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    SpheresOverlapBatch(count, [a](std::size_t i) -> const Sphere3& { return a[i]; }, [b](std::size_t i) -> const Sphere3& { return b[i]; }, result.data());
+}
+
+void DoSpheresOverlap(const Sphere3* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(pairs.size());
+    const auto* p = pairs.data();
+    SpheresOverlapBatch(pairs.size(), [shapes, p](std::size_t i) -> const Sphere3& { return shapes[p[i].first]; }, [shapes, p](std::size_t i) -> const Sphere3& { return shapes[p[i].second]; }, result.data());
+}
+
+void DoSpheresOverlap(const float* aX, const float* aY, const float* aZ, const float* aRadius, const float* bX, const float* bY, const float* bZ, const float* bRadius, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    SpheresOverlapBatch(count, aX, aY, aZ, aRadius, bX, bY, bZ, bRadius, result.data());
+}
+
+void DoAABBsOverlap(const AABB2* a, const AABB2* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    AABB2sOverlapBatch(count, [a](std::size_t i) -> const AABB2& { return a[i]; }, [b](std::size_t i) -> const AABB2& { return b[i]; }, result.data());
+}
+
+void DoAABBsOverlap(const AABB2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(pairs.size());
+    const auto* p = pairs.data();
+    AABB2sOverlapBatch(pairs.size(), [shapes, p](std::size_t i) -> const AABB2& { return shapes[p[i].first]; }, [shapes, p](std::size_t i) -> const AABB2& { return shapes[p[i].second]; }, result.data());
+}
+
+void DoAABBsOverlap(const AABB3* a, const AABB3* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    AABB3sOverlapBatch(count, [a](std::size_t i) -> const AABB3& { return a[i]; }, [b](std::size_t i) -> const AABB3& { return b[i]; }, result.data());
+}
+
+void DoAABBsOverlap(const AABB3* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(pairs.size());
+    const auto* p = pairs.data();
+    AABB3sOverlapBatch(pairs.size(), [shapes, p](std::size_t i) -> const AABB3& { return shapes[p[i].first]; }, [shapes, p](std::size_t i) -> const AABB3& { return shapes[p[i].second]; }, result.data());
+}
+
+void DoOBBsOverlap(const OBB2* a, const OBB2* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(count);
+    OBBSATData a_data[OBB_BATCH_CHUNK_SIZE];
+    OBBSATData b_data[OBB_BATCH_CHUNK_SIZE];
+    for(std::size_t first = 0; first < count; first += OBB_BATCH_CHUNK_SIZE) {
+        const auto chunk_size = (std::min)(OBB_BATCH_CHUNK_SIZE, count - first);
+        for(std::size_t i = 0; i < chunk_size; ++i) {
+            a_data[i] = CalcOBBSATData(a[first + i]);
+            b_data[i] = CalcOBBSATData(b[first + i]);
+        }
+        OBBsOverlapBatch(chunk_size, [&a_data](std::size_t i) -> const OBBSATData& { return a_data[i]; }, [&b_data](std::size_t i) -> const OBBSATData& { return b_data[i]; }, result.data() + first);
     }
-    return true;
+}
+
+void DoOBBsOverlap(const OBB2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept {
+    result.resize(pairs.size());
+    const auto data = CalcOBBSATData(shapes, pairs);
+    const auto* d = data.data();
+    const auto* p = pairs.data();
+    OBBsOverlapBatch(pairs.size(), [d, p](std::size_t i) -> const OBBSATData& { return d[p[i].first]; }, [d, p](std::size_t i) -> const OBBSATData& { return d[p[i].second]; }, result.data());
 }
 
 bool DoLineSegmentOverlap(const Disc2& a, const LineSegment2& b) noexcept {
@@ -931,7 +1408,10 @@ Quaternion SLERP(const Quaternion& a, const Quaternion& b, float t) noexcept {
     float scale0 = std::cos(theta) - dp * std::sin(theta) / std::sin(theta_0);
     float scale1 = std::sin(theta) / std::sin(theta_0);
 
-    return (scale0 * start) + (scale1 * end);
+    //Combined per component: the Quaternion constructors normalize, so scaled quaternions cannot be summed.
+    float w = scale0 * start.w + scale1 * end.w;
+    Vector3 axis = scale0 * start.axis + scale1 * end.axis;
+    return Quaternion(w, axis);
 }
 
 template<>
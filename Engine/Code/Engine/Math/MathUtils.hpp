@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "Engine/Math/IntVector2.hpp"
 #include "Engine/Math/IntVector3.hpp"
@@ -19,11 +21,14 @@ class Disc2;
 class LineSegment2;
 class LineSegment3;
 class OBB2;
+class OBB3;
 class Sphere3;
 class Capsule3;
 class Plane2;
 class Plane3;
+class JobSystem;
 class Quaternion;
+class RandomStream;
 class Rgba;
 
 namespace MathUtils {
@@ -108,6 +113,15 @@ long double GetRandomLongDoubleZeroUpToOne() noexcept;
 long double GetRandomLongDoubleNegOneToOne() noexcept;
 bool IsPercentChance(long double probability) noexcept;
 
+//Thread-local counter-based generator behind the bulk fills, seeded like GetMTRandomEngine.
+RandomStream& GetRandomStream(unsigned int seed = 0) noexcept;
+
+//Bulk forms of GetRandomFloatInRange and GetRandomIntInRange for spawning many values at once.
+//Four values per step with SSE; with a JobSystem the fill is split across its workers
+//and produces the same values as without.
+void FillRandomFloats(float* out, std::size_t count, float minInclusive, float maxInclusive, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomInts(int* out, std::size_t count, int minInclusive, int maxInclusive, JobSystem* jobSystem = nullptr) noexcept;
+
 
 float CosDegrees(float degrees) noexcept;
 float SinDegrees(float degrees) noexcept;
@@ -139,17 +153,45 @@ float CalcDistance(const Vector4& a, const Vector4& b) noexcept;
 float CalcDistance(const Vector2& p, const LineSegment2& line) noexcept;
 float CalcDistance(const Vector3& p, const LineSegment3& line) noexcept;
 
-float CalcDistanceSquared(const Vector2& a, const Vector2& b) noexcept;
-float CalcDistanceSquared(const Vector3& a, const Vector3& b) noexcept;
-float CalcDistanceSquared(const Vector4& a, const Vector4& b) noexcept;
+constexpr float CalcDistanceSquared(const Vector2& a, const Vector2& b) noexcept {
+    return (b - a).CalcLengthSquared();
+}
+
+constexpr float CalcDistanceSquared(const Vector3& a, const Vector3& b) noexcept {
+    return (b - a).CalcLengthSquared();
+}
+
+constexpr float CalcDistanceSquared(const Vector4& a, const Vector4& b) noexcept {
+    return (b - a).CalcLength4DSquared();
+}
+
 float CalcDistanceSquared(const Vector2& p, const LineSegment2& line) noexcept;
 float CalcDistanceSquared(const Vector3& p, const LineSegment3& line) noexcept;
 
-Vector3 CrossProduct(const Vector3& a, const Vector3& b) noexcept;
+constexpr Vector3 CrossProduct(const Vector3& a, const Vector3& b) noexcept {
+    float a1 = a.x;
+    float a2 = a.y;
+    float a3 = a.z;
+
+    float b1 = b.x;
+    float b2 = b.y;
+    float b3 = b.z;
+
+    return Vector3(a2 * b3 - a3 * b2, a3 * b1 - a1 * b3, a1 * b2 - a2 * b1);
+}
+
+constexpr float DotProduct(const Vector2& a, const Vector2& b) noexcept {
+    return a.x * b.x + a.y * b.y;
+}
+
+constexpr float DotProduct(const Vector3& a, const Vector3& b) noexcept {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+constexpr float DotProduct(const Vector4& a, const Vector4& b) noexcept {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
 
-float DotProduct(const Vector2& a, const Vector2& b) noexcept;
-float DotProduct(const Vector3& a, const Vector3& b) noexcept;
-float DotProduct(const Vector4& a, const Vector4& b) noexcept;
 float DotProduct(const Quaternion& a, const Quaternion& b) noexcept;
 
 Vector2 Project(const Vector2& a, const Vector2& b) noexcept;
@@ -185,10 +227,30 @@ Vector2 GetRandomPointInside(const Disc2& disc) noexcept;
 Vector3 GetRandomPointInside(const AABB3& aabb) noexcept;
 Vector3 GetRandomPointInside(const Sphere3& sphere) noexcept;
 
+//Bulk forms of GetRandomPointOn and GetRandomPointInside for particle emitters and scattering.
+//Random values come from GetRandomStream in SSE fills and angles from the FastMath batch functions.
+//Points are uniform by length, area or volume: FillRandomPointsOn(AABB2) covers the whole perimeter
+//and FillRandomPointsOn(AABB3) the whole surface. With a JobSystem the fill is split across its
+//workers and produces the same points as without.
+void FillRandomPointsOn(const AABB2& aabb, Vector2* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomPointsOn(const Disc2& disc, Vector2* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomPointsOn(const LineSegment2& line, Vector2* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+
+void FillRandomPointsOn(const AABB3& aabb, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomPointsOn(const Sphere3& sphere, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomPointsOn(const LineSegment3& line, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+
+void FillRandomPointsInside(const AABB2& aabb, Vector2* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomPointsInside(const Disc2& disc, Vector2* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+
+void FillRandomPointsInside(const AABB3& aabb, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+void FillRandomPointsInside(const Sphere3& sphere, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+
 
 bool IsPointInside(const AABB2& aabb, const Vector2& point) noexcept;
 bool IsPointInside(const AABB3& aabb, const Vector3& point) noexcept;
 bool IsPointInside(const OBB2& obb, const Vector2& point) noexcept;
+bool IsPointInside(const OBB3& obb, const Vector3& point) noexcept;
 bool IsPointInside(const Disc2& disc, const Vector2& point) noexcept;
 bool IsPointInside(const Capsule2& capsule, const Vector2& point) noexcept;
 bool IsPointInside(const Sphere3& sphere, const Vector3& point) noexcept;
@@ -209,6 +271,8 @@ Vector2 CalcClosestPoint(const Vector2& p, const Capsule2& capsule) noexcept;
 Vector3 CalcClosestPoint(const Vector3& p, const LineSegment3& line) noexcept;
 Vector3 CalcClosestPoint(const Vector3& p, const Sphere3& sphere) noexcept;
 Vector3 CalcClosestPoint(const Vector3& p, const Capsule3& capsule) noexcept;
+//Closest point on the solid triangle abc.
+Vector3 CalcClosestPoint(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c) noexcept;
 
 Vector2 CalcNormalizedPointFromPoint(const Vector2& pos, const AABB2& bounds) noexcept;
 Vector2 CalcPointFromNormalizedPoint(const Vector2& uv, const AABB2& bounds) noexcept;
@@ -227,6 +291,27 @@ bool DoAABBsOverlap(const AABB2& a, const AABB2& b) noexcept;
 bool DoAABBsOverlap(const AABB3& a, const AABB3& b) noexcept;
 bool DoOBBsOverlap(const OBB2& a, const OBB2& b) noexcept;
 
+//Batch narrowphase. The pointer and count forms test a[i] against b[i]; the pair forms test
+//shapes[first] against shapes[second] for each candidate pair, e.g. from Broadphase2D::QueryPairs.
+//result is resized and result[i] set to 1 or 0, always matching the single-pair test.
+//Four pairs are tested per step when SSE is available.
+void DoDiscsOverlap(const Disc2* a, const Disc2* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoDiscsOverlap(const Disc2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept;
+//Structure-of-arrays forms: centers and radii in separate arrays of count elements, e.g. from Vector3SoA::GetXs.
+//Lanes are loaded directly instead of gathered, which is the fastest form when shapes are already stored this way.
+void DoDiscsOverlap(const float* aX, const float* aY, const float* aRadius, const float* bX, const float* bY, const float* bRadius, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoSpheresOverlap(const Sphere3* a, const Sphere3* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoSpheresOverlap(const Sphere3* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept;
+void DoSpheresOverlap(const float* aX, const float* aY, const float* aZ, const float* aRadius, const float* bX, const float* bY, const float* bZ, const float* bRadius, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoAABBsOverlap(const AABB2* a, const AABB2* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoAABBsOverlap(const AABB2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept;
+void DoAABBsOverlap(const AABB3* a, const AABB3* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoAABBsOverlap(const AABB3* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept;
+//OBB corners and normals are computed once per shape, in fixed-size chunks on the stack for the a[i]/b[i] form,
+//then the projections run four pairs at a time.
+void DoOBBsOverlap(const OBB2* a, const OBB2* b, std::size_t count, std::vector<std::uint8_t>& result) noexcept;
+void DoOBBsOverlap(const OBB2* shapes, const std::vector<std::pair<std::size_t, std::size_t>>& pairs, std::vector<std::uint8_t>& result) noexcept;
+
 bool DoLineSegmentOverlap(const Disc2& a, const LineSegment2& b) noexcept;
 bool DoLineSegmentOverlap(const Sphere3& a, const LineSegment3& b) noexcept;
 
@@ -1,11 +1,309 @@
 #include "Engine/Math/Matrix4.hpp"
 
+#include <algorithm>
 #include <sstream>
 
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/Vertex3D.hpp"
+
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Math/MathUtils.hpp"
 
-const Matrix4 Matrix4::I{};
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+#ifdef MATH_SIMD_SSE
+namespace {
+
+//All helpers take the 16-byte aligned, row-major storage of a Matrix4.
+
+//Dot product of each row with v: (row0.v, row1.v, row2.v, row3.v)
+__m128 TransformRows(const float* m, const __m128& v) noexcept {
+    __m128 r0 = _mm_mul_ps(_mm_load_ps(m + 0), v);
+    __m128 r1 = _mm_mul_ps(_mm_load_ps(m + 4), v);
+    __m128 r2 = _mm_mul_ps(_mm_load_ps(m + 8), v);
+    __m128 r3 = _mm_mul_ps(_mm_load_ps(m + 12), v);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    return _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3));
+}
+
+//Each result row is a linear combination of the rows of rhs.
+//Safe when result aliases lhs or rhs.
+void Multiply4x4(const float* lhs, const float* rhs, float* result) noexcept {
+    const __m128 b0 = _mm_load_ps(rhs + 0);
+    const __m128 b1 = _mm_load_ps(rhs + 4);
+    const __m128 b2 = _mm_load_ps(rhs + 8);
+    const __m128 b3 = _mm_load_ps(rhs + 12);
+    for(int row = 0; row < 4; ++row) {
+        const __m128 a = _mm_load_ps(lhs + 4 * row);
+        __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+        _mm_store_ps(result + 4 * row, r);
+    }
+}
+
+void Transpose4x4(const float* m, float* result) noexcept {
+    __m128 r0 = _mm_load_ps(m + 0);
+    __m128 r1 = _mm_load_ps(m + 4);
+    __m128 r2 = _mm_load_ps(m + 8);
+    __m128 r3 = _mm_load_ps(m + 12);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_store_ps(result + 0, r0);
+    _mm_store_ps(result + 4, r1);
+    _mm_store_ps(result + 8, r2);
+    _mm_store_ps(result + 12, r3);
+}
+
+//Each register holds a row-major 2x2 matrix [a b; c d] as (a, b, c, d).
+//A * B
+__m128 Mat2Mul(const __m128& a, const __m128& b) noexcept {
+    return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+//adj(A) * B
+__m128 Mat2AdjMul(const __m128& a, const __m128& b) noexcept {
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+//A * adj(B)
+__m128 Mat2MulAdj(const __m128& a, const __m128& b) noexcept {
+    return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+//Blockwise inverse of [A B; C D] using 2x2 adjugates.
+//Same result as the cofactor expansion without the sixteen 3x3 determinants.
+void Inverse4x4(const float* m, float* result) noexcept {
+    const __m128 r0 = _mm_load_ps(m + 0);
+    const __m128 r1 = _mm_load_ps(m + 4);
+    const __m128 r2 = _mm_load_ps(m + 8);
+    const __m128 r3 = _mm_load_ps(m + 12);
+
+    const __m128 A = _mm_movelh_ps(r0, r1);
+    const __m128 B = _mm_movehl_ps(r1, r0);
+    const __m128 C = _mm_movelh_ps(r2, r3);
+    const __m128 D = _mm_movehl_ps(r3, r2);
+
+    //(|A|, |B|, |C|, |D|)
+    const __m128 det_sub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+    const __m128 det_A = _mm_shuffle_ps(det_sub, det_sub, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 det_B = _mm_shuffle_ps(det_sub, det_sub, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 det_C = _mm_shuffle_ps(det_sub, det_sub, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 det_D = _mm_shuffle_ps(det_sub, det_sub, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 D_C = Mat2AdjMul(D, C);
+    const __m128 A_B = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(det_D, A), Mat2Mul(B, D_C));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(det_A, D), Mat2Mul(C, A_B));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(det_B, C), Mat2MulAdj(D, A_B));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(det_C, B), Mat2MulAdj(A, D_C));
+
+    //|M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+    __m128 tr = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2)));
+    tr = _mm_add_ps(tr, _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(2, 3, 0, 1)));
+    const __m128 det_M = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_A, det_D), _mm_mul_ps(det_B, det_C)), tr);
+
+    const __m128 r_det_M = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det_M);
+    X = _mm_mul_ps(X, r_det_M);
+    Y = _mm_mul_ps(Y, r_det_M);
+    Z = _mm_mul_ps(Z, r_det_M);
+    W = _mm_mul_ps(W, r_det_M);
+
+    //Adjugate and transpose of each block folded into the store order.
+    _mm_store_ps(result + 0, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_store_ps(result + 4, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_store_ps(result + 8, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_store_ps(result + 12, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+}
+
+Vector4 ToVector4(const __m128& v) noexcept {
+    alignas(16) float result[4];
+    _mm_store_ps(result, v);
+    return Vector4(result[0], result[1], result[2], result[3]);
+}
+
+} //End anonymous
+#endif
+
+namespace {
+
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Batch transforms treat Vector3 arrays as packed floats.");
+
+//Elements per job when a batch transform is split across a JobSystem.
+constexpr std::size_t MIN_TRANSFORM_JOB_SIZE = 16384;
+
+//Inverse-transpose of the upper 3x3 of m, in the same layout with no translation, so normals stay
+//perpendicular to surfaces under non-uniform scale. Its rows are the cross products of m's rows over
+//the determinant; only the determinant's sign is kept since transformed normals are renormalized,
+//which also leaves degenerate matrices with a usable result.
+std::array<float, 16> CalcNormalMatrix(const float* m) noexcept {
+    const Vector3 r0(m[0], m[1], m[2]);
+    const Vector3 r1(m[4], m[5], m[6]);
+    const Vector3 r2(m[8], m[9], m[10]);
+    const auto sign = MathUtils::DotProduct(r0, MathUtils::CrossProduct(r1, r2)) < 0.0f ? -1.0f : 1.0f;
+    const auto c0 = MathUtils::CrossProduct(r1, r2) * sign;
+    const auto c1 = MathUtils::CrossProduct(r2, r0) * sign;
+    const auto c2 = MathUtils::CrossProduct(r0, r1) * sign;
+    return {c0.x, c0.y, c0.z, 0.0f
+          , c1.x, c1.y, c1.z, 0.0f
+          , c2.x, c2.y, c2.z, 0.0f
+          , 0.0f, 0.0f, 0.0f, 1.0f};
+}
+
+#ifdef MATH_SIMD_SSE
+//The top three rows of a matrix broadcast once per batch, with w folded into the translation.
+class BatchMatrix {
+public:
+    BatchMatrix(const float* m, float w) noexcept {
+        for(std::size_t row = 0; row < 3; ++row) {
+            _e[4 * row + 0] = _mm_set1_ps(m[4 * row + 0]);
+            _e[4 * row + 1] = _mm_set1_ps(m[4 * row + 1]);
+            _e[4 * row + 2] = _mm_set1_ps(m[4 * row + 2]);
+            _e[4 * row + 3] = _mm_set1_ps(m[4 * row + 3] * w);
+        }
+    }
+    //Transforms four vectors held as (x0 x1 x2 x3), (y0 y1 y2 y3), (z0 z1 z2 z3).
+    void Transform(__m128& x, __m128& y, __m128& z) const noexcept {
+        const __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_e[0], x), _mm_mul_ps(_e[1], y)), _mm_add_ps(_mm_mul_ps(_e[2], z), _e[3]));
+        const __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_e[4], x), _mm_mul_ps(_e[5], y)), _mm_add_ps(_mm_mul_ps(_e[6], z), _e[7]));
+        const __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_e[8], x), _mm_mul_ps(_e[9], y)), _mm_add_ps(_mm_mul_ps(_e[10], z), _e[11]));
+        x = rx;
+        y = ry;
+        z = rz;
+    }
+private:
+    __m128 _e[12];
+};
+
+void TransformVector3s(const float* m, float w, const Vector3* in, Vector3* out, std::size_t count) noexcept {
+    const BatchMatrix bm(m, w);
+    const float* src = &in->x;
+    float* dst = &out->x;
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4, src += 12, dst += 12) {
+        //(x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) -> (x0 x1 x2 x3) (y0 y1 y2 y3) (z0 z1 z2 z3)
+        const __m128 a = _mm_loadu_ps(src + 0);
+        const __m128 b = _mm_loadu_ps(src + 4);
+        const __m128 c = _mm_loadu_ps(src + 8);
+        __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        bm.Transform(x, y, z);
+        //And back again.
+        _mm_storeu_ps(dst + 0, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    for(; i < count; ++i, src += 3, dst += 3) {
+        __m128 x = _mm_set_ss(src[0]);
+        __m128 y = _mm_set_ss(src[1]);
+        __m128 z = _mm_set_ss(src[2]);
+        bm.Transform(x, y, z);
+        dst[0] = _mm_cvtss_f32(x);
+        dst[1] = _mm_cvtss_f32(y);
+        dst[2] = _mm_cvtss_f32(z);
+    }
+}
+
+//Scales four vectors to unit length; zero vectors stay zero.
+void NormalizeLanes(__m128& x, __m128& y, __m128& z) noexcept {
+    const __m128 length_sq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+    const __m128 nonzero = _mm_cmpgt_ps(length_sq, _mm_setzero_ps());
+    const __m128 inv_length = _mm_and_ps(nonzero, _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(length_sq)));
+    x = _mm_mul_ps(x, inv_length);
+    y = _mm_mul_ps(y, inv_length);
+    z = _mm_mul_ps(z, inv_length);
+}
+
+//Vertex3D is too wide to shuffle in registers, so each attribute is gathered four vertices at a time.
+void TransformVertexAttribute(const BatchMatrix& bm, const Vertex3D* in, Vertex3D* out, std::size_t count, Vector3 Vertex3D::* attribute, bool normalize = false) noexcept {
+    alignas(16) float xs[4]{};
+    alignas(16) float ys[4]{};
+    alignas(16) float zs[4]{};
+    for(std::size_t i = 0; i < count; ++i) {
+        const Vector3& v = in[i].*attribute;
+        xs[i] = v.x;
+        ys[i] = v.y;
+        zs[i] = v.z;
+    }
+    __m128 x = _mm_load_ps(xs);
+    __m128 y = _mm_load_ps(ys);
+    __m128 z = _mm_load_ps(zs);
+    bm.Transform(x, y, z);
+    if(normalize) {
+        NormalizeLanes(x, y, z);
+    }
+    _mm_store_ps(xs, x);
+    _mm_store_ps(ys, y);
+    _mm_store_ps(zs, z);
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i].*attribute = Vector3(xs[i], ys[i], zs[i]);
+    }
+}
+
+void TransformVertex3Ds(const float* m, const float* normalMatrix, const Vertex3D* in, Vertex3D* out, std::size_t count) noexcept {
+    const BatchMatrix positions(m, 1.0f);
+    const BatchMatrix directions(m, 0.0f);
+    const BatchMatrix normals(normalMatrix, 0.0f);
+    for(std::size_t i = 0; i < count; i += 4) {
+        const auto group_size = (std::min)(count - i, std::size_t{4});
+        if(in != out) {
+            std::copy(in + i, in + i + group_size, out + i);
+        }
+        TransformVertexAttribute(positions, in + i, out + i, group_size, &Vertex3D::position);
+        TransformVertexAttribute(normals, in + i, out + i, group_size, &Vertex3D::normal, true);
+        TransformVertexAttribute(directions, in + i, out + i, group_size, &Vertex3D::tangent);
+        TransformVertexAttribute(directions, in + i, out + i, group_size, &Vertex3D::bitangent);
+    }
+}
+#else
+Vector3 TransformVector3(const float* m, float w, const Vector3& v) noexcept {
+    return Vector3(m[0] * v.x + m[1] * v.y + m[2] * v.z + m[3] * w
+                 , m[4] * v.x + m[5] * v.y + m[6] * v.z + m[7] * w
+                 , m[8] * v.x + m[9] * v.y + m[10] * v.z + m[11] * w);
+}
+
+void TransformVector3s(const float* m, float w, const Vector3* in, Vector3* out, std::size_t count) noexcept {
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i] = TransformVector3(m, w, in[i]);
+    }
+}
+
+void TransformVertex3Ds(const float* m, const float* normalMatrix, const Vertex3D* in, Vertex3D* out, std::size_t count) noexcept {
+    for(std::size_t i = 0; i < count; ++i) {
+        Vertex3D v = in[i];
+        v.position = TransformVector3(m, 1.0f, v.position);
+        v.normal = TransformVector3(normalMatrix, 0.0f, v.normal).GetNormalize();
+        v.tangent = TransformVector3(m, 0.0f, v.tangent);
+        v.bitangent = TransformVector3(m, 0.0f, v.bitangent);
+        out[i] = v;
+    }
+}
+#endif
+
+template<typename F>
+void RunTransformBatches(JobSystem* jobSystem, std::size_t count, F&& kernel) noexcept {
+    if(!count) {
+        return;
+    }
+    if(jobSystem) {
+        jobSystem->ParallelFor(count, MIN_TRANSFORM_JOB_SIZE, kernel);
+    } else {
+        kernel(0, count);
+    }
+}
+
+} //End anonymous
+
 
 Matrix4::Matrix4(const std::string& value) noexcept {
     if(value[0] == '[') {
@@ -19,30 +317,6 @@ Matrix4::Matrix4(const std::string& value) noexcept {
     }
 }
 
-Matrix4::Matrix4(float m00, float m01, float m02, float m03,
-    float m10, float m11, float m12, float m13,
-    float m20, float m21, float m22, float m23,
-    float m30, float m31, float m32, float m33) noexcept {
-    m_indicies[0] = m00; m_indicies[1] = m01; m_indicies[2] = m02; m_indicies[3] = m03;
-    m_indicies[4] = m10; m_indicies[5] = m11; m_indicies[6] = m12; m_indicies[7] = m13;
-    m_indicies[8] = m20; m_indicies[9] = m21; m_indicies[10] = m22; m_indicies[11] = m23;
-    m_indicies[12] = m30; m_indicies[13] = m31; m_indicies[14] = m32; m_indicies[15] = m33;
-}
-
-Matrix4::Matrix4(const Vector4& iBasis, const Vector4& jBasis, const Vector4& kBasis, const Vector4& translation /*= Vector4::ZERO_XYZ_ONE_W*/) noexcept {
-    m_indicies[0] = iBasis.x; m_indicies[1] = jBasis.x; m_indicies[2] = kBasis.x; m_indicies[3] = translation.x;
-    m_indicies[4] = iBasis.y; m_indicies[5] = jBasis.y; m_indicies[6] = kBasis.y; m_indicies[7] = translation.y;
-    m_indicies[8] = iBasis.z; m_indicies[9] = jBasis.z; m_indicies[10] = kBasis.z; m_indicies[11] = translation.z;
-    m_indicies[12] = iBasis.w; m_indicies[13] = jBasis.w; m_indicies[14] = kBasis.w; m_indicies[15] = translation.w;
-}
-
-Matrix4::Matrix4(const float* arrayOfFloats) noexcept {
-    m_indicies[0] = arrayOfFloats[0];   m_indicies[1] = arrayOfFloats[1];   m_indicies[2] = arrayOfFloats[2];   m_indicies[3] = arrayOfFloats[3];
-    m_indicies[4] = arrayOfFloats[4];   m_indicies[5] = arrayOfFloats[5];   m_indicies[6] = arrayOfFloats[6];   m_indicies[7] = arrayOfFloats[7];
-    m_indicies[8] = arrayOfFloats[8];   m_indicies[9] = arrayOfFloats[9];   m_indicies[10] = arrayOfFloats[10];  m_indicies[11] = arrayOfFloats[11];
-    m_indicies[12] = arrayOfFloats[12];  m_indicies[13] = arrayOfFloats[13];  m_indicies[14] = arrayOfFloats[14];  m_indicies[15] = arrayOfFloats[15];
-}
-
 Matrix4::Matrix4(const Quaternion& q) noexcept {
 
     auto q_norm = q.GetNormalize();
@@ -67,43 +341,6 @@ Matrix4::Matrix4(const Quaternion& q) noexcept {
     m_indicies = (left * right).m_indicies;
 
 }
-Matrix4::Matrix4(const Vector2& iBasis, const Vector2& jBasis, const Vector2& translation /*= Vector2::ZERO*/) noexcept
-    : m_indicies{ iBasis.x, jBasis.x, 0.0f, translation.x,
-    iBasis.y, jBasis.y, 0.0f, translation.y,
-    0.0f,     0.0f, 1.0f,          0.0f,
-    0.0f,     0.0f, 0.0f,          1.0f } {
-    /* DO NOTHING */
-}
-Matrix4::Matrix4(const Vector3& iBasis, const Vector3& jBasis, const Vector3& kBasis, const Vector3& translation /*= Vector3::ZERO*/) noexcept
-    : m_indicies{ iBasis.x, jBasis.x, kBasis.x, translation.x,
-    iBasis.y, jBasis.y, kBasis.y, translation.y,
-    iBasis.z, jBasis.z, kBasis.z, translation.z,
-    0.0f,     0.0f,     0.0f,          1.0f } {
-    /* DO NOTHING */
-}
-
-Matrix4 Matrix4::GetIdentity() noexcept {
-    return Matrix4(1.0f, 0.0f, 0.0f, 0.0f,
-        0.0f, 1.0f, 0.0f, 0.0f,
-        0.0f, 0.0f, 1.0f, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f);
-}
-
-Matrix4 Matrix4::CreateTranslationMatrix(float x, float y, float z) noexcept {
-    return Matrix4(1.0f, 0.0f, 0.0f, x,
-        0.0f, 1.0f, 0.0f, y,
-        0.0f, 0.0f, 1.0f, z,
-        0.0f, 0.0f, 0.0f, 1.0f);
-}
-
-Matrix4 Matrix4::CreateTranslationMatrix(const Vector3& position) noexcept {
-    return CreateTranslationMatrix(position.x, position.y, position.z);
-}
-
-Matrix4 Matrix4::CreateTranslationMatrix(const Vector2& position) noexcept {
-    return CreateTranslationMatrix(position.x, position.y, 0.0f);
-}
-
 Matrix4 Matrix4::Create2DRotationDegreesMatrix(float angleDegrees) noexcept {
     return Create2DRotationMatrix(MathUtils::ConvertDegreesToRadians(angleDegrees));
 }
@@ -142,172 +379,10 @@ Matrix4 Matrix4::Create3DZRotationMatrix(float angle) noexcept {
         0.0f, 0.0f, 0.0f, 1.0f);
 }
 
-Matrix4 Matrix4::CreateScaleMatrix(float scale_x, float scale_y, float scale_z) noexcept {
-    return Matrix4(scale_x, 0.0f, 0.0f, 0.0f,
-        0.0f, scale_y, 0.0f, 0.0f,
-        0.0f, 0.0f, scale_z, 0.0f,
-        0.0f, 0.0f, 0.0f, 1.0f);
-}
-
-Matrix4 Matrix4::CreateScaleMatrix(const Vector3& scale) noexcept {
-    return CreateScaleMatrix(scale.x, scale.y, scale.z);
-}
-
-Matrix4 Matrix4::CreateScaleMatrix(const Vector2& scale) noexcept {
-    return CreateScaleMatrix(Vector3(scale, 1.0f));
-}
-Matrix4 Matrix4::CreateScaleMatrix(float scale) noexcept {
-    return CreateScaleMatrix(Vector3(scale, scale, scale));
-}
-
 Matrix4 Matrix4::CalculateChangeOfBasisMatrix(const Matrix4& output_basis, const Matrix4& input_basis /*= Matrix4::GetIdentity()*/) noexcept {
     return Matrix4::CalculateInverse(output_basis) * input_basis;
 }
 
-void Matrix4::SetIBasis(const Vector4& iBasis) noexcept {
-    m_indicies[0] = iBasis.x;
-    m_indicies[4] = iBasis.y;
-    m_indicies[8] = iBasis.z;
-    m_indicies[12] = iBasis.w;
-}
-
-void Matrix4::SetJBasis(const Vector4& jBasis) noexcept {
-    m_indicies[1] = jBasis.x;
-    m_indicies[5] = jBasis.y;
-    m_indicies[9] = jBasis.z;
-    m_indicies[13] = jBasis.w;
-}
-
-void Matrix4::SetKBasis(const Vector4& kBasis) noexcept {
-    m_indicies[2] = kBasis.x;
-    m_indicies[6] = kBasis.y;
-    m_indicies[10] = kBasis.z;
-    m_indicies[14] = kBasis.w;
-}
-
-void Matrix4::SetTBasis(const Vector4& tBasis) noexcept {
-    m_indicies[3] = tBasis.x;
-    m_indicies[7] = tBasis.y;
-    m_indicies[11] = tBasis.z;
-    m_indicies[15] = tBasis.w;
-}
-
-void Matrix4::SetXComponents(const Vector4& components) noexcept {
-    m_indicies[0] = components.x;
-    m_indicies[1] = components.y;
-    m_indicies[2] = components.z;
-    m_indicies[3] = components.w;
-}
-
-void Matrix4::SetYComponents(const Vector4& components) noexcept {
-    m_indicies[4] = components.x;
-    m_indicies[5] = components.y;
-    m_indicies[6] = components.z;
-    m_indicies[7] = components.w;
-}
-
-void Matrix4::SetZComponents(const Vector4& components) noexcept {
-    m_indicies[8] = components.x;
-    m_indicies[9] = components.y;
-    m_indicies[10] = components.z;
-    m_indicies[11] = components.w;
-}
-
-void Matrix4::SetWComponents(const Vector4& components) noexcept {
-    m_indicies[12] = components.x;
-    m_indicies[13] = components.y;
-    m_indicies[14] = components.z;
-    m_indicies[15] = components.w;
-}
-
-Vector4 Matrix4::GetIBasis() const noexcept {
-    return Vector4(m_indicies[0], m_indicies[4], m_indicies[8], m_indicies[12]);
-}
-
-Vector4 Matrix4::GetIBasis() noexcept {
-    return static_cast<const Matrix4&>(*this).GetIBasis();
-}
-
-Vector4 Matrix4::GetJBasis() const noexcept {
-    return Vector4(m_indicies[1], m_indicies[5], m_indicies[9], m_indicies[13]);
-}
-
-Vector4 Matrix4::GetJBasis() noexcept {
-    return static_cast<const Matrix4&>(*this).GetJBasis();
-}
-
-Vector4 Matrix4::GetKBasis() const noexcept {
-    return Vector4(m_indicies[2], m_indicies[6], m_indicies[10], m_indicies[14]);
-}
-
-Vector4 Matrix4::GetKBasis() noexcept {
-    return static_cast<const Matrix4&>(*this).GetKBasis();
-}
-
-Vector4 Matrix4::GetTBasis() const noexcept {
-    return Vector4(m_indicies[3], m_indicies[7], m_indicies[11], m_indicies[15]);
-}
-
-Vector4 Matrix4::GetTBasis() noexcept {
-    return static_cast<const Matrix4&>(*this).GetTBasis();
-}
-
-Vector4 Matrix4::GetXComponents() const noexcept {
-    return Vector4(m_indicies[0], m_indicies[1], m_indicies[2], m_indicies[3]);
-}
-
-Vector4 Matrix4::GetXComponents() noexcept {
-    return static_cast<const Matrix4&>(*this).GetXComponents();
-}
-
-Vector4 Matrix4::GetYComponents() const noexcept {
-    return Vector4(m_indicies[4], m_indicies[5], m_indicies[6], m_indicies[7]);
-}
-
-Vector4 Matrix4::GetYComponents() noexcept {
-    return static_cast<const Matrix4&>(*this).GetYComponents();
-}
-
-Vector4 Matrix4::GetZComponents() const noexcept {
-    return Vector4(m_indicies[8], m_indicies[9], m_indicies[10], m_indicies[11]);
-}
-
-Vector4 Matrix4::GetZComponents() noexcept {
-    return static_cast<const Matrix4&>(*this).GetZComponents();
-}
-
-Vector4 Matrix4::GetWComponents() const noexcept {
-    return Vector4(m_indicies[12], m_indicies[13], m_indicies[14], m_indicies[15]);
-}
-
-Vector4 Matrix4::GetWComponents() noexcept {
-    return static_cast<const Matrix4&>(*this).GetWComponents();
-}
-
-void Matrix4::SetIndex(unsigned int index, float value) noexcept {
-    m_indicies[index] = value;
-}
-
-float Matrix4::GetIndex(unsigned int index) const noexcept {
-    return m_indicies[index];
-}
-
-float Matrix4::GetIndex(unsigned int index) noexcept {
-    return static_cast<const Matrix4&>(*this).GetIndex(index);
-}
-
-float Matrix4::GetIndex(unsigned int col, unsigned int row) const noexcept {
-    return GetIndex(4 * col + row);
-}
-
-void Matrix4::Identity() noexcept {
-
-    m_indicies[0] = 1.0f;  m_indicies[1] = 0.0f;  m_indicies[2] = 0.0f;  m_indicies[3] = 0.0f;
-    m_indicies[4] = 0.0f;  m_indicies[5] = 1.0f;  m_indicies[6] = 0.0f;  m_indicies[7] = 0.0f;
-    m_indicies[8] = 0.0f;  m_indicies[9] = 0.0f;  m_indicies[10] = 1.0f;  m_indicies[11] = 0.0f;
-    m_indicies[12] = 0.0f;  m_indicies[13] = 0.0f;  m_indicies[14] = 0.0f;  m_indicies[15] = 1.0f;
-
-}
 void Matrix4::Transpose() noexcept {
 
     //[00 01 02 03] [0   1  2  3]
@@ -320,6 +395,9 @@ void Matrix4::Transpose() noexcept {
     //[02 12 22 32] [2 6 10 14]
     //[03 13 23 33] [3 7 11 15]
 
+#ifdef MATH_SIMD_SSE
+    Transpose4x4(m_indicies.data(), m_indicies.data());
+#else
     std::swap(m_indicies[1], m_indicies[4]);
     std::swap(m_indicies[2], m_indicies[8]);
     std::swap(m_indicies[3], m_indicies[12]);
@@ -327,14 +405,21 @@ void Matrix4::Transpose() noexcept {
     std::swap(m_indicies[6], m_indicies[9]);
     std::swap(m_indicies[7], m_indicies[13]);
     std::swap(m_indicies[11], m_indicies[14]);
+#endif
 
 }
 
 Matrix4 Matrix4::CreateTransposeMatrix(const Matrix4& mat) noexcept {
+#ifdef MATH_SIMD_SSE
+    Matrix4 result;
+    Transpose4x4(mat.m_indicies.data(), result.m_indicies.data());
+    return result;
+#else
     return Matrix4(mat.m_indicies[0], mat.m_indicies[4], mat.m_indicies[8], mat.m_indicies[12],
         mat.m_indicies[1], mat.m_indicies[5], mat.m_indicies[9], mat.m_indicies[13],
         mat.m_indicies[2], mat.m_indicies[6], mat.m_indicies[10], mat.m_indicies[14],
         mat.m_indicies[3], mat.m_indicies[7], mat.m_indicies[11], mat.m_indicies[15]);
+#endif
 }
 
 Matrix4 Matrix4::CreatePerspectiveProjectionMatrix(float top, float bottom, float right, float left, float nearZ, float farZ) noexcept {
@@ -437,6 +522,11 @@ void Matrix4::CalculateInverse() noexcept {
 
 Matrix4 Matrix4::CalculateInverse(const Matrix4& mat) noexcept {
 
+#ifdef MATH_SIMD_SSE
+    Matrix4 result;
+    Inverse4x4(mat.m_indicies.data(), result.m_indicies.data());
+    return result;
+#else
     //Minors, Cofactors, Adjugates method.
     //See http://www.mathsisfun.com/algebra/matrix-inverse-minors-cofactors-adjugate.html
 
@@ -477,6 +567,7 @@ Matrix4 Matrix4::CalculateInverse(const Matrix4& mat) noexcept {
     float inv_det = 1.0f / det_mat;
 
     return inv_det * adjugate;
+#endif
 }
 
 void Matrix4::OrthoNormalizeIKJ() noexcept {
@@ -554,14 +645,6 @@ float Matrix4::CalculateDeterminant() noexcept {
     return static_cast<const Matrix4&>(*this).CalculateDeterminant();
 }
 
-float Matrix4::CalculateTrace() const noexcept {
-    return (m_indicies[0] + m_indicies[5] + m_indicies[10] + m_indicies[15]);
-}
-
-float Matrix4::CalculateTrace() noexcept {
-    return static_cast<const Matrix4&>(*this).CalculateTrace();
-}
-
 bool Matrix4::IsInvertable() const noexcept {
     return IsSingular() == false;
 }
@@ -665,14 +748,22 @@ Matrix4 Matrix4::GetTransformed(const Matrix4& other) const noexcept {
     return operator*(other);
 }
 Vector2 Matrix4::TransformPosition(const Vector2& position) const noexcept {
+#ifdef MATH_SIMD_SSE
+    const auto result = ToVector4(TransformRows(m_indicies.data(), _mm_setr_ps(position.x, position.y, 0.0f, 1.0f)));
+    return Vector2(result.x, result.y);
+#else
     Vector4 v(position.x, position.y, 0.0f, 1.0f);
 
     float x = MathUtils::DotProduct(GetXComponents(), v);
     float y = MathUtils::DotProduct(GetYComponents(), v);
 
     return Vector2(x, y);
+#endif
 }
 Vector3 Matrix4::TransformPosition(const Vector3& position) const noexcept {
+#ifdef MATH_SIMD_SSE
+    return Vector3(ToVector4(TransformRows(m_indicies.data(), _mm_setr_ps(position.x, position.y, position.z, 1.0f))));
+#else
     Vector4 v(position.x, position.y, position.z, 1.0f);
 
     float x = MathUtils::DotProduct(GetXComponents(), v);
@@ -680,16 +771,25 @@ Vector3 Matrix4::TransformPosition(const Vector3& position) const noexcept {
     float z = MathUtils::DotProduct(GetZComponents(), v);
 
     return Vector3(x, y, z);
+#endif
 }
 Vector2 Matrix4::TransformDirection(const Vector2& direction) const noexcept {
+#ifdef MATH_SIMD_SSE
+    const auto result = ToVector4(TransformRows(m_indicies.data(), _mm_setr_ps(direction.x, direction.y, 0.0f, 0.0f)));
+    return Vector2(result.x, result.y);
+#else
     Vector4 v(direction.x, direction.y, 0.0f, 0.0f);
 
     float x = MathUtils::DotProduct(GetXComponents(), v);
     float y = MathUtils::DotProduct(GetYComponents(), v);
 
     return Vector2(x, y);
+#endif
 }
 Vector3 Matrix4::TransformDirection(const Vector3& direction) const noexcept {
+#ifdef MATH_SIMD_SSE
+    return Vector3(ToVector4(TransformRows(m_indicies.data(), _mm_setr_ps(direction.x, direction.y, direction.z, 0.0f))));
+#else
     Vector4 v(direction.x, direction.y, direction.z, 0.0f);
 
     float x = MathUtils::DotProduct(GetXComponents(), v);
@@ -697,6 +797,39 @@ Vector3 Matrix4::TransformDirection(const Vector3& direction) const noexcept {
     float z = MathUtils::DotProduct(GetZComponents(), v);
 
     return Vector3(x, y, z);
+#endif
+}
+void Matrix4::TransformPositions(const Vector3* positions, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    const float* m = m_indicies.data();
+    RunTransformBatches(jobSystem, count, [=](std::size_t begin, std::size_t end) {
+        TransformVector3s(m, 1.0f, positions + begin, out + begin, end - begin);
+    });
+}
+void Matrix4::TransformDirections(const Vector3* directions, Vector3* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    const float* m = m_indicies.data();
+    RunTransformBatches(jobSystem, count, [=](std::size_t begin, std::size_t end) {
+        TransformVector3s(m, 0.0f, directions + begin, out + begin, end - begin);
+    });
+}
+void Matrix4::TransformPositions(const std::vector<Vector3>& positions, std::vector<Vector3>& out, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    out.resize(positions.size());
+    TransformPositions(positions.data(), out.data(), positions.size(), jobSystem);
+}
+void Matrix4::TransformDirections(const std::vector<Vector3>& directions, std::vector<Vector3>& out, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    out.resize(directions.size());
+    TransformDirections(directions.data(), out.data(), directions.size(), jobSystem);
+}
+void Matrix4::TransformVertices(const Vertex3D* vertices, Vertex3D* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    const float* m = m_indicies.data();
+    const auto normal_matrix = CalcNormalMatrix(m);
+    const float* n = normal_matrix.data();
+    RunTransformBatches(jobSystem, count, [=](std::size_t begin, std::size_t end) {
+        TransformVertex3Ds(m, n, vertices + begin, out + begin, end - begin);
+    });
+}
+void Matrix4::TransformVertices(const std::vector<Vertex3D>& vertices, std::vector<Vertex3D>& out, JobSystem* jobSystem /*= nullptr*/) const noexcept {
+    out.resize(vertices.size());
+    TransformVertices(vertices.data(), out.data(), vertices.size(), jobSystem);
 }
 Vector4 Matrix4::TransformVector(const Vector4& homogeneousVector) const noexcept {
     return operator*(homogeneousVector);
@@ -710,12 +843,6 @@ Vector2 Matrix4::TransformVector(const Vector2& homogeneousVector) const noexcep
     return operator*(homogeneousVector);
 }
 
-Vector4 Matrix4::GetDiagonal() const noexcept {
-    return Matrix4::GetDiagonal(*this);
-}
-Vector4 Matrix4::GetDiagonal(const Matrix4& mat) noexcept {
-    return Vector4(mat.m_indicies[0], mat.m_indicies[5], mat.m_indicies[10], mat.m_indicies[15]);
-}
 bool Matrix4::operator==(const Matrix4& rhs) const noexcept {
     return (MathUtils::IsEquivalent(m_indicies[0], rhs.m_indicies[0]) && MathUtils::IsEquivalent(m_indicies[1], rhs.m_indicies[1]) && MathUtils::IsEquivalent(m_indicies[2], rhs.m_indicies[2]) && MathUtils::IsEquivalent(m_indicies[3], rhs.m_indicies[3]) &&
         MathUtils::IsEquivalent(m_indicies[4], rhs.m_indicies[4]) && MathUtils::IsEquivalent(m_indicies[5], rhs.m_indicies[5]) && MathUtils::IsEquivalent(m_indicies[6], rhs.m_indicies[6]) && MathUtils::IsEquivalent(m_indicies[7], rhs.m_indicies[7]) &&
@@ -817,6 +944,11 @@ Vector3 Matrix4::CalcEulerAngles() const noexcept {
 
 Matrix4 Matrix4::operator*(const Matrix4& rhs) const noexcept {
 
+#ifdef MATH_SIMD_SSE
+    Matrix4 result;
+    Multiply4x4(m_indicies.data(), rhs.m_indicies.data(), result.m_indicies.data());
+    return result;
+#else
     using namespace MathUtils;
 
     Vector4 myI = GetIBasis();
@@ -848,16 +980,13 @@ Matrix4 Matrix4::operator*(const Matrix4& rhs) const noexcept {
         , m12, m13, m14, m15
     );
     return result;
-}
-
-Matrix4 Matrix4::operator*(float scalar) const noexcept {
-    return Matrix4(scalar * m_indicies[0], scalar * m_indicies[1], scalar * m_indicies[2], scalar * m_indicies[3],
-        scalar * m_indicies[4], scalar * m_indicies[5], scalar * m_indicies[6], scalar * m_indicies[7],
-        scalar * m_indicies[8], scalar * m_indicies[9], scalar * m_indicies[10], scalar * m_indicies[11],
-        scalar * m_indicies[12], scalar * m_indicies[13], scalar * m_indicies[14], scalar * m_indicies[15]);
+#endif
 }
 
 Vector4 Matrix4::operator*(const Vector4& rhs) const noexcept {
+#ifdef MATH_SIMD_SSE
+    return ToVector4(TransformRows(m_indicies.data(), _mm_setr_ps(rhs.x, rhs.y, rhs.z, rhs.w)));
+#else
     const Vector4 my_x{ GetXComponents() };
     const Vector4 my_y{ GetYComponents() };
     const Vector4 my_z{ GetZComponents() };
@@ -867,6 +996,7 @@ Vector4 Matrix4::operator*(const Vector4& rhs) const noexcept {
     const float z = MathUtils::DotProduct(rhs, my_z);
     const float w = MathUtils::DotProduct(rhs, my_w);
     return Vector4(x, y, z, w);
+#endif
 }
 
 Vector4 operator*(const Vector4& lhs, const Matrix4& rhs) noexcept {
@@ -919,6 +1049,9 @@ Vector2 operator*(const Vector2& lhs, const Matrix4& rhs) noexcept {
 
 Matrix4& Matrix4::operator*=(const Matrix4& rhs) noexcept {
 
+#ifdef MATH_SIMD_SSE
+    Multiply4x4(m_indicies.data(), rhs.m_indicies.data(), m_indicies.data());
+#else
     using namespace MathUtils;
 
     Vector4 myI = GetIBasis();
@@ -944,31 +1077,7 @@ Matrix4& Matrix4::operator*=(const Matrix4& rhs) noexcept {
     m_indicies[4] = DotProduct(myY, rhsI);  m_indicies[5] = DotProduct(myY, rhsJ); m_indicies[6] = DotProduct(myY, rhsK); m_indicies[7] = DotProduct(myY, rhsT);
     m_indicies[8] = DotProduct(myZ, rhsI);  m_indicies[9] = DotProduct(myZ, rhsJ); m_indicies[10] = DotProduct(myZ, rhsK);  m_indicies[11] = DotProduct(myZ, rhsT);
     m_indicies[12] = DotProduct(myW, rhsI);  m_indicies[13] = DotProduct(myW, rhsJ); m_indicies[14] = DotProduct(myW, rhsK);  m_indicies[15] = DotProduct(myW, rhsT);
-
-    return *this;
-}
-
-Matrix4& Matrix4::operator*=(float scalar) noexcept {
-
-    m_indicies[0] *= scalar;
-    m_indicies[1] *= scalar;
-    m_indicies[2] *= scalar;
-    m_indicies[3] *= scalar;
-
-    m_indicies[4] *= scalar;
-    m_indicies[5] *= scalar;
-    m_indicies[6] *= scalar;
-    m_indicies[7] *= scalar;
-
-    m_indicies[8] *= scalar;
-    m_indicies[9] *= scalar;
-    m_indicies[10] *= scalar;
-    m_indicies[11] *= scalar;
-
-    m_indicies[12] *= scalar;
-    m_indicies[13] *= scalar;
-    m_indicies[14] *= scalar;
-    m_indicies[15] *= scalar;
+#endif
 
     return *this;
 }
@@ -980,70 +1089,6 @@ float* Matrix4::operator*() noexcept {
     return &m_indicies[0];
 }
 
-Matrix4 Matrix4::operator+(const Matrix4& rhs) const noexcept {
-    return Matrix4(m_indicies[0] + rhs.m_indicies[0], m_indicies[1] + rhs.m_indicies[1], m_indicies[2] + rhs.m_indicies[2], m_indicies[3] + rhs.m_indicies[3],
-        m_indicies[4] + rhs.m_indicies[4], m_indicies[5] + rhs.m_indicies[5], m_indicies[6] + rhs.m_indicies[6], m_indicies[7] + rhs.m_indicies[7],
-        m_indicies[8] + rhs.m_indicies[8], m_indicies[9] + rhs.m_indicies[9], m_indicies[10] + rhs.m_indicies[10], m_indicies[11] + rhs.m_indicies[11],
-        m_indicies[12] + rhs.m_indicies[12], m_indicies[13] + rhs.m_indicies[13], m_indicies[14] + rhs.m_indicies[14], m_indicies[15] + rhs.m_indicies[15]);
-}
-
-Matrix4& Matrix4::operator+=(const Matrix4& rhs) noexcept {
-
-    m_indicies[0] += rhs.m_indicies[0];
-    m_indicies[1] += rhs.m_indicies[1];
-    m_indicies[2] += rhs.m_indicies[2];
-    m_indicies[3] += rhs.m_indicies[3];
-
-    m_indicies[4] += rhs.m_indicies[4];
-    m_indicies[5] += rhs.m_indicies[5];
-    m_indicies[6] += rhs.m_indicies[6];
-    m_indicies[7] += rhs.m_indicies[7];
-
-    m_indicies[8] += rhs.m_indicies[8];
-    m_indicies[9] += rhs.m_indicies[9];
-    m_indicies[10] += rhs.m_indicies[10];
-    m_indicies[11] += rhs.m_indicies[11];
-
-    m_indicies[12] += rhs.m_indicies[12];
-    m_indicies[13] += rhs.m_indicies[13];
-    m_indicies[14] += rhs.m_indicies[14];
-    m_indicies[15] += rhs.m_indicies[15];
-
-    return *this;
-}
-
-Matrix4 Matrix4::operator-(const Matrix4& rhs) const noexcept {
-    return Matrix4(m_indicies[0] - rhs.m_indicies[0], m_indicies[1] - rhs.m_indicies[1], m_indicies[2] - rhs.m_indicies[2], m_indicies[3] - rhs.m_indicies[3],
-        m_indicies[4] - rhs.m_indicies[4], m_indicies[5] - rhs.m_indicies[5], m_indicies[6] - rhs.m_indicies[6], m_indicies[7] - rhs.m_indicies[7],
-        m_indicies[8] - rhs.m_indicies[8], m_indicies[9] - rhs.m_indicies[9], m_indicies[10] - rhs.m_indicies[10], m_indicies[11] - rhs.m_indicies[11],
-        m_indicies[12] - rhs.m_indicies[12], m_indicies[13] - rhs.m_indicies[13], m_indicies[14] - rhs.m_indicies[14], m_indicies[15] - rhs.m_indicies[15]);
-}
-
-Matrix4& Matrix4::operator-=(const Matrix4& rhs) noexcept {
-
-    m_indicies[0] -= rhs.m_indicies[0];
-    m_indicies[1] -= rhs.m_indicies[1];
-    m_indicies[2] -= rhs.m_indicies[2];
-    m_indicies[3] -= rhs.m_indicies[3];
-
-    m_indicies[4] -= rhs.m_indicies[4];
-    m_indicies[5] -= rhs.m_indicies[5];
-    m_indicies[6] -= rhs.m_indicies[6];
-    m_indicies[7] -= rhs.m_indicies[7];
-
-    m_indicies[8] -= rhs.m_indicies[8];
-    m_indicies[9] -= rhs.m_indicies[9];
-    m_indicies[10] -= rhs.m_indicies[10];
-    m_indicies[11] -= rhs.m_indicies[11];
-
-    m_indicies[12] -= rhs.m_indicies[12];
-    m_indicies[13] -= rhs.m_indicies[13];
-    m_indicies[14] -= rhs.m_indicies[14];
-    m_indicies[15] -= rhs.m_indicies[15];
-
-    return *this;
-}
-
 Matrix4 Matrix4::operator/(const Matrix4& rhs) noexcept {
     return Matrix4((*this) * Matrix4::CalculateInverse(rhs));
 }
@@ -1058,10 +1103,6 @@ Matrix4& Matrix4::operator/=(const Matrix4& rhs) noexcept {
     return *this;
 }
 
-Matrix4 Matrix4::operator-() const noexcept {
-    return Matrix4(-GetIBasis(), -GetJBasis(), -GetKBasis(), -GetTBasis());
-}
-
 float& Matrix4::operator[](std::size_t index) {
     return m_indicies[index];
 }
@@ -1070,13 +1111,6 @@ const float& Matrix4::operator[](std::size_t index) const {
     return m_indicies[index];
 }
 
-Matrix4 operator*(float lhs, const Matrix4& rhs) noexcept {
-    return Matrix4(lhs * rhs.m_indicies[0], lhs * rhs.m_indicies[1], lhs * rhs.m_indicies[2], lhs * rhs.m_indicies[3],
-        lhs * rhs.m_indicies[4], lhs * rhs.m_indicies[5], lhs * rhs.m_indicies[6], lhs * rhs.m_indicies[7],
-        lhs * rhs.m_indicies[8], lhs * rhs.m_indicies[9], lhs * rhs.m_indicies[10], lhs * rhs.m_indicies[11],
-        lhs * rhs.m_indicies[12], lhs * rhs.m_indicies[13], lhs * rhs.m_indicies[14], lhs * rhs.m_indicies[15]);
-}
-
 std::ostream& operator<<(std::ostream& out_stream, const Matrix4& m) noexcept {
     out_stream << '[' << m.m_indicies[0] << ',' << m.m_indicies[1] << ',' << m.m_indicies[2] << ',' << m.m_indicies[3] << ','
         << m.m_indicies[4] << ',' << m.m_indicies[5] << ',' << m.m_indicies[6] << ',' << m.m_indicies[7] << ','
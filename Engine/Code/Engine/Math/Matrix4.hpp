@@ -2,6 +2,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 #include "Engine/Math/Vector2.hpp"
 #include "Engine/Math/Vector3.hpp"
@@ -10,14 +11,17 @@
 
 class AABB3;
 class Camera3D;
+class JobSystem;
+class Vertex3D;
 
-class Matrix4 {
+//Rows are 16-byte aligned so the SSE paths can load them directly.
+class alignas(16) Matrix4 {
 public:
     static const Matrix4 I;
 
-    static Matrix4 GetIdentity() noexcept;
-    static Matrix4 CreateTranslationMatrix(const Vector2& position) noexcept;
-    static Matrix4 CreateTranslationMatrix(const Vector3& position) noexcept;
+    static constexpr Matrix4 GetIdentity() noexcept;
+    static constexpr Matrix4 CreateTranslationMatrix(const Vector2& position) noexcept;
+    static constexpr Matrix4 CreateTranslationMatrix(const Vector3& position) noexcept;
 
     static Matrix4 Create2DRotationDegreesMatrix(float angleDegrees) noexcept;
     static Matrix4 Create3DXRotationDegreesMatrix(float angleDegrees) noexcept;
@@ -28,9 +32,9 @@ public:
     static Matrix4 Create3DXRotationMatrix(float angleRadians) noexcept;
     static Matrix4 Create3DYRotationMatrix(float angleRadians) noexcept;
     static Matrix4 Create3DZRotationMatrix(float angleRadians) noexcept;
-    static Matrix4 CreateScaleMatrix(float scale) noexcept;
-    static Matrix4 CreateScaleMatrix(const Vector2& scale) noexcept;
-    static Matrix4 CreateScaleMatrix(const Vector3& scale) noexcept;
+    static constexpr Matrix4 CreateScaleMatrix(float scale) noexcept;
+    static constexpr Matrix4 CreateScaleMatrix(const Vector2& scale) noexcept;
+    static constexpr Matrix4 CreateScaleMatrix(const Vector3& scale) noexcept;
     static Matrix4 CreateTransposeMatrix(const Matrix4& mat) noexcept;
     static Matrix4 CreatePerspectiveProjectionMatrix(float top, float bottom, float right, float left, float nearZ, float farZ) noexcept;
     static Matrix4 CreateHPerspectiveProjectionMatrix(float fov, float aspect_ratio, float nearZ, float farZ) noexcept;
@@ -51,17 +55,17 @@ public:
     ~Matrix4() = default;
 
     explicit Matrix4(const Quaternion& q) noexcept;
-    explicit Matrix4(const Vector2& iBasis, const Vector2& jBasis, const Vector2& translation = Vector2::ZERO) noexcept;
-    explicit Matrix4(const Vector3& iBasis, const Vector3& jBasis, const Vector3& kBasis, const Vector3& translation = Vector3::ZERO) noexcept;
-    explicit Matrix4(const Vector4& iBasis, const Vector4& jBasis, const Vector4& kBasis, const Vector4& translation = Vector4::ZERO_XYZ_ONE_W) noexcept;
-    explicit Matrix4(const float* arrayOfFloats) noexcept;
+    explicit constexpr Matrix4(const Vector2& iBasis, const Vector2& jBasis, const Vector2& translation = Vector2::ZERO) noexcept;
+    explicit constexpr Matrix4(const Vector3& iBasis, const Vector3& jBasis, const Vector3& kBasis, const Vector3& translation = Vector3::ZERO) noexcept;
+    explicit constexpr Matrix4(const Vector4& iBasis, const Vector4& jBasis, const Vector4& kBasis, const Vector4& translation = Vector4::ZERO_XYZ_ONE_W) noexcept;
+    explicit constexpr Matrix4(const float* arrayOfFloats) noexcept;
 
-    void Identity() noexcept;
+    constexpr void Identity() noexcept;
     void Transpose() noexcept;
-    float CalculateTrace() const noexcept;
-    float CalculateTrace() noexcept;
-    Vector4 GetDiagonal() const noexcept;
-    static Vector4 GetDiagonal(const Matrix4& mat) noexcept;
+    constexpr float CalculateTrace() const noexcept;
+    constexpr float CalculateTrace() noexcept;
+    constexpr Vector4 GetDiagonal() const noexcept;
+    static constexpr Vector4 GetDiagonal(const Matrix4& mat) noexcept;
 
     bool IsInvertable() const noexcept;
     bool IsSingular() const noexcept;
@@ -102,6 +106,18 @@ public:
     Vector3 TransformPosition(const Vector3& position) const noexcept;
     Vector3 TransformDirection(const Vector3& direction) const noexcept;
 
+    //Batch transforms. out must hold count elements and may be the same array as the input.
+    //When a JobSystem is given, large batches are split across its Generic workers.
+    void TransformPositions(const Vector3* positions, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) const noexcept;
+    void TransformDirections(const Vector3* directions, Vector3* out, std::size_t count, JobSystem* jobSystem = nullptr) const noexcept;
+    void TransformPositions(const std::vector<Vector3>& positions, std::vector<Vector3>& out, JobSystem* jobSystem = nullptr) const noexcept;
+    void TransformDirections(const std::vector<Vector3>& directions, std::vector<Vector3>& out, JobSystem* jobSystem = nullptr) const noexcept;
+
+    //Transforms position as a point and tangent and bitangent as directions; other attributes are copied.
+    //Normals go through the inverse-transpose so they stay perpendicular under non-uniform scale, and are renormalized.
+    void TransformVertices(const Vertex3D* vertices, Vertex3D* out, std::size_t count, JobSystem* jobSystem = nullptr) const noexcept;
+    void TransformVertices(const std::vector<Vertex3D>& vertices, std::vector<Vertex3D>& out, JobSystem* jobSystem = nullptr) const noexcept;
+
     Vector4 TransformVector(const Vector4& homogeneousVector) const noexcept;
     Vector3 TransformVector(const Vector3& homogeneousVector) const noexcept;
     Vector2 TransformVector(const Vector2& homogeneousVector) const noexcept;
@@ -128,7 +144,7 @@ public:
     Vector2 operator*(const Vector2& rhs) const noexcept;
     friend Vector2 operator*(const Vector2& lhs, const Matrix4& rhs) noexcept;
     Matrix4& operator*=(const Matrix4& rhs) noexcept;
-    friend Matrix4 operator*(float lhs, const Matrix4& rhs) noexcept;
+    friend constexpr Matrix4 operator*(float lhs, const Matrix4& rhs) noexcept;
     const float * operator*() const noexcept;
     float* operator*() noexcept;
 
@@ -136,52 +152,52 @@ public:
     bool operator==(const Matrix4& rhs) noexcept;
     bool operator!=(const Matrix4& rhs) const noexcept;
     bool operator!=(const Matrix4& rhs) noexcept;
-    Matrix4 operator*(float scalar) const noexcept;
-    Matrix4& operator*=(float scalar) noexcept;
-    Matrix4 operator+(const Matrix4& rhs) const noexcept;
-    Matrix4& operator+=(const Matrix4& rhs) noexcept;
-    Matrix4 operator-(const Matrix4& rhs) const noexcept;
-    Matrix4& operator-=(const Matrix4& rhs) noexcept;
-    Matrix4 operator-() const noexcept;
+    constexpr Matrix4 operator*(float scalar) const noexcept;
+    constexpr Matrix4& operator*=(float scalar) noexcept;
+    constexpr Matrix4 operator+(const Matrix4& rhs) const noexcept;
+    constexpr Matrix4& operator+=(const Matrix4& rhs) noexcept;
+    constexpr Matrix4 operator-(const Matrix4& rhs) const noexcept;
+    constexpr Matrix4& operator-=(const Matrix4& rhs) noexcept;
+    constexpr Matrix4 operator-() const noexcept;
     Matrix4 operator/(const Matrix4& rhs) noexcept;
     Matrix4& operator/=(const Matrix4& rhs) noexcept;
 
     friend std::ostream& operator<<(std::ostream& out_stream, const Matrix4& m) noexcept;
     friend std::istream& operator>>(std::istream& in_stream, Matrix4& m) noexcept;
 
-    Vector4 GetIBasis() const noexcept;
-    Vector4 GetIBasis() noexcept;
+    constexpr Vector4 GetIBasis() const noexcept;
+    constexpr Vector4 GetIBasis() noexcept;
 
-    Vector4 GetJBasis() const noexcept;
-    Vector4 GetJBasis() noexcept;
+    constexpr Vector4 GetJBasis() const noexcept;
+    constexpr Vector4 GetJBasis() noexcept;
 
-    Vector4 GetKBasis() const noexcept;
-    Vector4 GetKBasis() noexcept;
+    constexpr Vector4 GetKBasis() const noexcept;
+    constexpr Vector4 GetKBasis() noexcept;
 
-    Vector4 GetTBasis() const noexcept;
-    Vector4 GetTBasis() noexcept;
+    constexpr Vector4 GetTBasis() const noexcept;
+    constexpr Vector4 GetTBasis() noexcept;
 
-    Vector4 GetXComponents() const noexcept;
-    Vector4 GetXComponents() noexcept;
+    constexpr Vector4 GetXComponents() const noexcept;
+    constexpr Vector4 GetXComponents() noexcept;
 
-    Vector4 GetYComponents() const noexcept;
-    Vector4 GetYComponents() noexcept;
+    constexpr Vector4 GetYComponents() const noexcept;
+    constexpr Vector4 GetYComponents() noexcept;
 
-    Vector4 GetZComponents() const noexcept;
-    Vector4 GetZComponents() noexcept;
+    constexpr Vector4 GetZComponents() const noexcept;
+    constexpr Vector4 GetZComponents() noexcept;
 
-    Vector4 GetWComponents() const noexcept;
-    Vector4 GetWComponents() noexcept;
+    constexpr Vector4 GetWComponents() const noexcept;
+    constexpr Vector4 GetWComponents() noexcept;
 
-    void SetIBasis(const Vector4& basis) noexcept;
-    void SetJBasis(const Vector4& basis) noexcept;
-    void SetKBasis(const Vector4& basis) noexcept;
-    void SetTBasis(const Vector4& basis) noexcept;
+    constexpr void SetIBasis(const Vector4& iBasis) noexcept;
+    constexpr void SetJBasis(const Vector4& jBasis) noexcept;
+    constexpr void SetKBasis(const Vector4& kBasis) noexcept;
+    constexpr void SetTBasis(const Vector4& tBasis) noexcept;
 
-    void SetXComponents(const Vector4& components) noexcept;
-    void SetYComponents(const Vector4& components) noexcept;
-    void SetZComponents(const Vector4& components) noexcept;
-    void SetWComponents(const Vector4& components) noexcept;
+    constexpr void SetXComponents(const Vector4& components) noexcept;
+    constexpr void SetYComponents(const Vector4& components) noexcept;
+    constexpr void SetZComponents(const Vector4& components) noexcept;
+    constexpr void SetWComponents(const Vector4& components) noexcept;
 
 
 protected:
@@ -189,15 +205,15 @@ protected:
     const float& operator[](std::size_t index) const;
     float& operator[](std::size_t index);
 
-    void SetIndex(unsigned int index, float value) noexcept;
-    float GetIndex(unsigned int index) const noexcept;
-    float GetIndex(unsigned int index) noexcept;
-    float GetIndex(unsigned int col, unsigned int row) const noexcept;
+    constexpr void SetIndex(unsigned int index, float value) noexcept;
+    constexpr float GetIndex(unsigned int index) const noexcept;
+    constexpr float GetIndex(unsigned int index) noexcept;
+    constexpr float GetIndex(unsigned int col, unsigned int row) const noexcept;
 
-    static Matrix4 CreateTranslationMatrix(float x, float y, float z) noexcept;
-    static Matrix4 CreateScaleMatrix(float scale_x, float scale_y, float scale_z) noexcept;
+    static constexpr Matrix4 CreateTranslationMatrix(float x, float y, float z) noexcept;
+    static constexpr Matrix4 CreateScaleMatrix(float scale_x, float scale_y, float scale_z) noexcept;
 
-    explicit Matrix4(float m00, float m01, float m02, float m03,
+    explicit constexpr Matrix4(float m00, float m01, float m02, float m03,
                      float m10, float m11, float m12, float m13,
                      float m20, float m21, float m22, float m23,
                      float m30, float m31, float m32, float m33) noexcept;
@@ -209,7 +225,7 @@ private:
     //[20 21 22 23] [8   9 10 11]
     //[30 31 32 33] [12 13 14 15]
 
-    std::array<float, 16> m_indicies{ 1.0f, 0.0f, 0.0f, 0.0f,
+    alignas(16) std::array<float, 16> m_indicies{ 1.0f, 0.0f, 0.0f, 0.0f,
                                       0.0f, 1.0f, 0.0f, 0.0f,
                                       0.0f, 0.0f, 1.0f, 0.0f,
                                       0.0f, 0.0f, 0.0f, 1.0f };
@@ -217,3 +233,354 @@ private:
     friend class Quaternion;
 
 };
+
+constexpr Matrix4::Matrix4(float m00, float m01, float m02, float m03,
+    float m10, float m11, float m12, float m13,
+    float m20, float m21, float m22, float m23,
+    float m30, float m31, float m32, float m33) noexcept {
+    m_indicies[0] = m00; m_indicies[1] = m01; m_indicies[2] = m02; m_indicies[3] = m03;
+    m_indicies[4] = m10; m_indicies[5] = m11; m_indicies[6] = m12; m_indicies[7] = m13;
+    m_indicies[8] = m20; m_indicies[9] = m21; m_indicies[10] = m22; m_indicies[11] = m23;
+    m_indicies[12] = m30; m_indicies[13] = m31; m_indicies[14] = m32; m_indicies[15] = m33;
+}
+
+constexpr Matrix4::Matrix4(const Vector4& iBasis, const Vector4& jBasis, const Vector4& kBasis, const Vector4& translation /*= Vector4::ZERO_XYZ_ONE_W*/) noexcept {
+    m_indicies[0] = iBasis.x; m_indicies[1] = jBasis.x; m_indicies[2] = kBasis.x; m_indicies[3] = translation.x;
+    m_indicies[4] = iBasis.y; m_indicies[5] = jBasis.y; m_indicies[6] = kBasis.y; m_indicies[7] = translation.y;
+    m_indicies[8] = iBasis.z; m_indicies[9] = jBasis.z; m_indicies[10] = kBasis.z; m_indicies[11] = translation.z;
+    m_indicies[12] = iBasis.w; m_indicies[13] = jBasis.w; m_indicies[14] = kBasis.w; m_indicies[15] = translation.w;
+}
+
+constexpr Matrix4::Matrix4(const float* arrayOfFloats) noexcept {
+    m_indicies[0] = arrayOfFloats[0];   m_indicies[1] = arrayOfFloats[1];   m_indicies[2] = arrayOfFloats[2];   m_indicies[3] = arrayOfFloats[3];
+    m_indicies[4] = arrayOfFloats[4];   m_indicies[5] = arrayOfFloats[5];   m_indicies[6] = arrayOfFloats[6];   m_indicies[7] = arrayOfFloats[7];
+    m_indicies[8] = arrayOfFloats[8];   m_indicies[9] = arrayOfFloats[9];   m_indicies[10] = arrayOfFloats[10];  m_indicies[11] = arrayOfFloats[11];
+    m_indicies[12] = arrayOfFloats[12];  m_indicies[13] = arrayOfFloats[13];  m_indicies[14] = arrayOfFloats[14];  m_indicies[15] = arrayOfFloats[15];
+}
+
+constexpr Matrix4::Matrix4(const Vector2& iBasis, const Vector2& jBasis, const Vector2& translation /*= Vector2::ZERO*/) noexcept
+    : m_indicies{ iBasis.x, jBasis.x, 0.0f, translation.x,
+    iBasis.y, jBasis.y, 0.0f, translation.y,
+    0.0f,     0.0f, 1.0f,          0.0f,
+    0.0f,     0.0f, 0.0f,          1.0f } {
+    /* DO NOTHING */
+}
+
+constexpr Matrix4::Matrix4(const Vector3& iBasis, const Vector3& jBasis, const Vector3& kBasis, const Vector3& translation /*= Vector3::ZERO*/) noexcept
+    : m_indicies{ iBasis.x, jBasis.x, kBasis.x, translation.x,
+    iBasis.y, jBasis.y, kBasis.y, translation.y,
+    iBasis.z, jBasis.z, kBasis.z, translation.z,
+    0.0f,     0.0f,     0.0f,          1.0f } {
+    /* DO NOTHING */
+}
+
+constexpr Matrix4 Matrix4::GetIdentity() noexcept {
+    return Matrix4(1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+constexpr Matrix4 Matrix4::CreateTranslationMatrix(float x, float y, float z) noexcept {
+    return Matrix4(1.0f, 0.0f, 0.0f, x,
+        0.0f, 1.0f, 0.0f, y,
+        0.0f, 0.0f, 1.0f, z,
+        0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+constexpr Matrix4 Matrix4::CreateTranslationMatrix(const Vector3& position) noexcept {
+    return CreateTranslationMatrix(position.x, position.y, position.z);
+}
+
+constexpr Matrix4 Matrix4::CreateTranslationMatrix(const Vector2& position) noexcept {
+    return CreateTranslationMatrix(position.x, position.y, 0.0f);
+}
+
+constexpr Matrix4 Matrix4::CreateScaleMatrix(float scale_x, float scale_y, float scale_z) noexcept {
+    return Matrix4(scale_x, 0.0f, 0.0f, 0.0f,
+        0.0f, scale_y, 0.0f, 0.0f,
+        0.0f, 0.0f, scale_z, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+constexpr Matrix4 Matrix4::CreateScaleMatrix(const Vector3& scale) noexcept {
+    return CreateScaleMatrix(scale.x, scale.y, scale.z);
+}
+
+constexpr Matrix4 Matrix4::CreateScaleMatrix(const Vector2& scale) noexcept {
+    return CreateScaleMatrix(Vector3(scale, 1.0f));
+}
+
+constexpr Matrix4 Matrix4::CreateScaleMatrix(float scale) noexcept {
+    return CreateScaleMatrix(Vector3(scale, scale, scale));
+}
+
+constexpr void Matrix4::SetIBasis(const Vector4& iBasis) noexcept {
+    m_indicies[0] = iBasis.x;
+    m_indicies[4] = iBasis.y;
+    m_indicies[8] = iBasis.z;
+    m_indicies[12] = iBasis.w;
+}
+
+constexpr void Matrix4::SetJBasis(const Vector4& jBasis) noexcept {
+    m_indicies[1] = jBasis.x;
+    m_indicies[5] = jBasis.y;
+    m_indicies[9] = jBasis.z;
+    m_indicies[13] = jBasis.w;
+}
+
+constexpr void Matrix4::SetKBasis(const Vector4& kBasis) noexcept {
+    m_indicies[2] = kBasis.x;
+    m_indicies[6] = kBasis.y;
+    m_indicies[10] = kBasis.z;
+    m_indicies[14] = kBasis.w;
+}
+
+constexpr void Matrix4::SetTBasis(const Vector4& tBasis) noexcept {
+    m_indicies[3] = tBasis.x;
+    m_indicies[7] = tBasis.y;
+    m_indicies[11] = tBasis.z;
+    m_indicies[15] = tBasis.w;
+}
+
+constexpr void Matrix4::SetXComponents(const Vector4& components) noexcept {
+    m_indicies[0] = components.x;
+    m_indicies[1] = components.y;
+    m_indicies[2] = components.z;
+    m_indicies[3] = components.w;
+}
+
+constexpr void Matrix4::SetYComponents(const Vector4& components) noexcept {
+    m_indicies[4] = components.x;
+    m_indicies[5] = components.y;
+    m_indicies[6] = components.z;
+    m_indicies[7] = components.w;
+}
+
+constexpr void Matrix4::SetZComponents(const Vector4& components) noexcept {
+    m_indicies[8] = components.x;
+    m_indicies[9] = components.y;
+    m_indicies[10] = components.z;
+    m_indicies[11] = components.w;
+}
+
+constexpr void Matrix4::SetWComponents(const Vector4& components) noexcept {
+    m_indicies[12] = components.x;
+    m_indicies[13] = components.y;
+    m_indicies[14] = components.z;
+    m_indicies[15] = components.w;
+}
+
+constexpr Vector4 Matrix4::GetIBasis() const noexcept {
+    return Vector4(m_indicies[0], m_indicies[4], m_indicies[8], m_indicies[12]);
+}
+
+constexpr Vector4 Matrix4::GetIBasis() noexcept {
+    return static_cast<const Matrix4&>(*this).GetIBasis();
+}
+
+constexpr Vector4 Matrix4::GetJBasis() const noexcept {
+    return Vector4(m_indicies[1], m_indicies[5], m_indicies[9], m_indicies[13]);
+}
+
+constexpr Vector4 Matrix4::GetJBasis() noexcept {
+    return static_cast<const Matrix4&>(*this).GetJBasis();
+}
+
+constexpr Vector4 Matrix4::GetKBasis() const noexcept {
+    return Vector4(m_indicies[2], m_indicies[6], m_indicies[10], m_indicies[14]);
+}
+
+constexpr Vector4 Matrix4::GetKBasis() noexcept {
+    return static_cast<const Matrix4&>(*this).GetKBasis();
+}
+
+constexpr Vector4 Matrix4::GetTBasis() const noexcept {
+    return Vector4(m_indicies[3], m_indicies[7], m_indicies[11], m_indicies[15]);
+}
+
+constexpr Vector4 Matrix4::GetTBasis() noexcept {
+    return static_cast<const Matrix4&>(*this).GetTBasis();
+}
+
+constexpr Vector4 Matrix4::GetXComponents() const noexcept {
+    return Vector4(m_indicies[0], m_indicies[1], m_indicies[2], m_indicies[3]);
+}
+
+constexpr Vector4 Matrix4::GetXComponents() noexcept {
+    return static_cast<const Matrix4&>(*this).GetXComponents();
+}
+
+constexpr Vector4 Matrix4::GetYComponents() const noexcept {
+    return Vector4(m_indicies[4], m_indicies[5], m_indicies[6], m_indicies[7]);
+}
+
+constexpr Vector4 Matrix4::GetYComponents() noexcept {
+    return static_cast<const Matrix4&>(*this).GetYComponents();
+}
+
+constexpr Vector4 Matrix4::GetZComponents() const noexcept {
+    return Vector4(m_indicies[8], m_indicies[9], m_indicies[10], m_indicies[11]);
+}
+
+constexpr Vector4 Matrix4::GetZComponents() noexcept {
+    return static_cast<const Matrix4&>(*this).GetZComponents();
+}
+
+constexpr Vector4 Matrix4::GetWComponents() const noexcept {
+    return Vector4(m_indicies[12], m_indicies[13], m_indicies[14], m_indicies[15]);
+}
+
+constexpr Vector4 Matrix4::GetWComponents() noexcept {
+    return static_cast<const Matrix4&>(*this).GetWComponents();
+}
+
+constexpr void Matrix4::SetIndex(unsigned int index, float value) noexcept {
+    m_indicies[index] = value;
+}
+
+constexpr float Matrix4::GetIndex(unsigned int index) const noexcept {
+    return m_indicies[index];
+}
+
+constexpr float Matrix4::GetIndex(unsigned int index) noexcept {
+    return static_cast<const Matrix4&>(*this).GetIndex(index);
+}
+
+constexpr float Matrix4::GetIndex(unsigned int col, unsigned int row) const noexcept {
+    return GetIndex(4 * col + row);
+}
+
+constexpr void Matrix4::Identity() noexcept {
+
+    m_indicies[0] = 1.0f;  m_indicies[1] = 0.0f;  m_indicies[2] = 0.0f;  m_indicies[3] = 0.0f;
+    m_indicies[4] = 0.0f;  m_indicies[5] = 1.0f;  m_indicies[6] = 0.0f;  m_indicies[7] = 0.0f;
+    m_indicies[8] = 0.0f;  m_indicies[9] = 0.0f;  m_indicies[10] = 1.0f;  m_indicies[11] = 0.0f;
+    m_indicies[12] = 0.0f;  m_indicies[13] = 0.0f;  m_indicies[14] = 0.0f;  m_indicies[15] = 1.0f;
+
+}
+
+constexpr float Matrix4::CalculateTrace() const noexcept {
+    return (m_indicies[0] + m_indicies[5] + m_indicies[10] + m_indicies[15]);
+}
+
+constexpr float Matrix4::CalculateTrace() noexcept {
+    return static_cast<const Matrix4&>(*this).CalculateTrace();
+}
+
+constexpr Vector4 Matrix4::GetDiagonal() const noexcept {
+    return Matrix4::GetDiagonal(*this);
+}
+
+constexpr Vector4 Matrix4::GetDiagonal(const Matrix4& mat) noexcept {
+    return Vector4(mat.m_indicies[0], mat.m_indicies[5], mat.m_indicies[10], mat.m_indicies[15]);
+}
+
+constexpr Matrix4 Matrix4::operator*(float scalar) const noexcept {
+    return Matrix4(scalar * m_indicies[0], scalar * m_indicies[1], scalar * m_indicies[2], scalar * m_indicies[3],
+        scalar * m_indicies[4], scalar * m_indicies[5], scalar * m_indicies[6], scalar * m_indicies[7],
+        scalar * m_indicies[8], scalar * m_indicies[9], scalar * m_indicies[10], scalar * m_indicies[11],
+        scalar * m_indicies[12], scalar * m_indicies[13], scalar * m_indicies[14], scalar * m_indicies[15]);
+}
+
+constexpr Matrix4& Matrix4::operator*=(float scalar) noexcept {
+
+    m_indicies[0] *= scalar;
+    m_indicies[1] *= scalar;
+    m_indicies[2] *= scalar;
+    m_indicies[3] *= scalar;
+
+    m_indicies[4] *= scalar;
+    m_indicies[5] *= scalar;
+    m_indicies[6] *= scalar;
+    m_indicies[7] *= scalar;
+
+    m_indicies[8] *= scalar;
+    m_indicies[9] *= scalar;
+    m_indicies[10] *= scalar;
+    m_indicies[11] *= scalar;
+
+    m_indicies[12] *= scalar;
+    m_indicies[13] *= scalar;
+    m_indicies[14] *= scalar;
+    m_indicies[15] *= scalar;
+
+    return *this;
+}
+
+constexpr Matrix4 Matrix4::operator+(const Matrix4& rhs) const noexcept {
+    return Matrix4(m_indicies[0] + rhs.m_indicies[0], m_indicies[1] + rhs.m_indicies[1], m_indicies[2] + rhs.m_indicies[2], m_indicies[3] + rhs.m_indicies[3],
+        m_indicies[4] + rhs.m_indicies[4], m_indicies[5] + rhs.m_indicies[5], m_indicies[6] + rhs.m_indicies[6], m_indicies[7] + rhs.m_indicies[7],
+        m_indicies[8] + rhs.m_indicies[8], m_indicies[9] + rhs.m_indicies[9], m_indicies[10] + rhs.m_indicies[10], m_indicies[11] + rhs.m_indicies[11],
+        m_indicies[12] + rhs.m_indicies[12], m_indicies[13] + rhs.m_indicies[13], m_indicies[14] + rhs.m_indicies[14], m_indicies[15] + rhs.m_indicies[15]);
+}
+
+constexpr Matrix4& Matrix4::operator+=(const Matrix4& rhs) noexcept {
+
+    m_indicies[0] += rhs.m_indicies[0];
+    m_indicies[1] += rhs.m_indicies[1];
+    m_indicies[2] += rhs.m_indicies[2];
+    m_indicies[3] += rhs.m_indicies[3];
+
+    m_indicies[4] += rhs.m_indicies[4];
+    m_indicies[5] += rhs.m_indicies[5];
+    m_indicies[6] += rhs.m_indicies[6];
+    m_indicies[7] += rhs.m_indicies[7];
+
+    m_indicies[8] += rhs.m_indicies[8];
+    m_indicies[9] += rhs.m_indicies[9];
+    m_indicies[10] += rhs.m_indicies[10];
+    m_indicies[11] += rhs.m_indicies[11];
+
+    m_indicies[12] += rhs.m_indicies[12];
+    m_indicies[13] += rhs.m_indicies[13];
+    m_indicies[14] += rhs.m_indicies[14];
+    m_indicies[15] += rhs.m_indicies[15];
+
+    return *this;
+}
+
+constexpr Matrix4 Matrix4::operator-(const Matrix4& rhs) const noexcept {
+    return Matrix4(m_indicies[0] - rhs.m_indicies[0], m_indicies[1] - rhs.m_indicies[1], m_indicies[2] - rhs.m_indicies[2], m_indicies[3] - rhs.m_indicies[3],
+        m_indicies[4] - rhs.m_indicies[4], m_indicies[5] - rhs.m_indicies[5], m_indicies[6] - rhs.m_indicies[6], m_indicies[7] - rhs.m_indicies[7],
+        m_indicies[8] - rhs.m_indicies[8], m_indicies[9] - rhs.m_indicies[9], m_indicies[10] - rhs.m_indicies[10], m_indicies[11] - rhs.m_indicies[11],
+        m_indicies[12] - rhs.m_indicies[12], m_indicies[13] - rhs.m_indicies[13], m_indicies[14] - rhs.m_indicies[14], m_indicies[15] - rhs.m_indicies[15]);
+}
+
+constexpr Matrix4& Matrix4::operator-=(const Matrix4& rhs) noexcept {
+
+    m_indicies[0] -= rhs.m_indicies[0];
+    m_indicies[1] -= rhs.m_indicies[1];
+    m_indicies[2] -= rhs.m_indicies[2];
+    m_indicies[3] -= rhs.m_indicies[3];
+
+    m_indicies[4] -= rhs.m_indicies[4];
+    m_indicies[5] -= rhs.m_indicies[5];
+    m_indicies[6] -= rhs.m_indicies[6];
+    m_indicies[7] -= rhs.m_indicies[7];
+
+    m_indicies[8] -= rhs.m_indicies[8];
+    m_indicies[9] -= rhs.m_indicies[9];
+    m_indicies[10] -= rhs.m_indicies[10];
+    m_indicies[11] -= rhs.m_indicies[11];
+
+    m_indicies[12] -= rhs.m_indicies[12];
+    m_indicies[13] -= rhs.m_indicies[13];
+    m_indicies[14] -= rhs.m_indicies[14];
+    m_indicies[15] -= rhs.m_indicies[15];
+
+    return *this;
+}
+
+constexpr Matrix4 Matrix4::operator-() const noexcept {
+    return Matrix4(-GetIBasis(), -GetJBasis(), -GetKBasis(), -GetTBasis());
+}
+
+constexpr Matrix4 operator*(float lhs, const Matrix4& rhs) noexcept {
+    return Matrix4(lhs * rhs.m_indicies[0], lhs * rhs.m_indicies[1], lhs * rhs.m_indicies[2], lhs * rhs.m_indicies[3],
+        lhs * rhs.m_indicies[4], lhs * rhs.m_indicies[5], lhs * rhs.m_indicies[6], lhs * rhs.m_indicies[7],
+        lhs * rhs.m_indicies[8], lhs * rhs.m_indicies[9], lhs * rhs.m_indicies[10], lhs * rhs.m_indicies[11],
+        lhs * rhs.m_indicies[12], lhs * rhs.m_indicies[13], lhs * rhs.m_indicies[14], lhs * rhs.m_indicies[15]);
+}
+
+inline constexpr Matrix4 Matrix4::I{};
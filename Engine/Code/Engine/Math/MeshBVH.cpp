@@ -0,0 +1,431 @@
+#include "Engine/Math/MeshBVH.hpp"
+
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/Obj.hpp"
+#include "Engine/Core/Vertex3D.hpp"
+
+#include "Engine/Math/BVH.hpp"
+#include "Engine/Math/Capsule3.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Raycast.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace {
+
+constexpr std::size_t MAX_STACK_SIZE = 128;
+constexpr float INF = std::numeric_limits<float>::infinity();
+
+struct CacheHeader {
+    std::array<char, 4> magic{};
+    std::uint32_t version = 0;
+    std::uint32_t node_count = 0;
+    std::uint32_t triangle_count = 0;
+};
+constexpr std::array<char, 4> CACHE_MAGIC{'M', 'B', 'V', 'H'};
+constexpr std::uint32_t CACHE_VERSION = 1;
+
+static_assert(sizeof(MeshBVH::Node) == 32, "MeshBVH nodes are written to the cache as raw bytes.");
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "MeshBVH vertices are written to the cache as raw bytes.");
+
+//Slab test clipped to [0, tMax]; tEntry is where the segment enters the box grown by padding on every side.
+bool EnterNode(const Vector3& origin, const Vector3& displacement, const MeshBVH::Node& node, float padding, float tMax, float& tEntry) noexcept {
+    const float origins[3] = {origin.x, origin.y, origin.z};
+    const float displacements[3] = {displacement.x, displacement.y, displacement.z};
+    const float mins[3] = {node.mins.x - padding, node.mins.y - padding, node.mins.z - padding};
+    const float maxs[3] = {node.maxs.x + padding, node.maxs.y + padding, node.maxs.z + padding};
+    float t0 = 0.0f;
+    float t1 = tMax;
+    for(std::size_t axis = 0; axis < 3; ++axis) {
+        if(displacements[axis] == 0.0f) {
+            if(origins[axis] < mins[axis] || maxs[axis] < origins[axis]) {
+                return false;
+            }
+            continue;
+        }
+        const auto inv_displacement = 1.0f / displacements[axis];
+        const auto a = (mins[axis] - origins[axis]) * inv_displacement;
+        const auto b = (maxs[axis] - origins[axis]) * inv_displacement;
+        t0 = (std::max)(t0, (std::min)(a, b));
+        t1 = (std::min)(t1, (std::max)(a, b));
+        if(t1 < t0) {
+            return false;
+        }
+    }
+    tEntry = t0;
+    return true;
+}
+
+float CalcDistanceSquared(const Vector3& point, const MeshBVH::Node& node) noexcept {
+    const auto dx = (std::max)((std::max)(node.mins.x - point.x, point.x - node.maxs.x), 0.0f);
+    const auto dy = (std::max)((std::max)(node.mins.y - point.y, point.y - node.maxs.y), 0.0f);
+    const auto dz = (std::max)((std::max)(node.mins.z - point.z, point.z - node.maxs.z), 0.0f);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+//The swept sphere first touches the triangle when its center reaches the triangle grown by radius:
+//one of the two faces offset along the normal, or one of the capsules around the edges.
+bool SweepTriangle(const LineSegment3& path, float radius, const Vector3* corners, float tMax, float& t, Vector3& contact) noexcept {
+    const auto& a = corners[0];
+    const auto& b = corners[1];
+    const auto& c = corners[2];
+    const auto closest = MathUtils::CalcClosestPoint(path.start, a, b, c);
+    if((path.start - closest).CalcLengthSquared() <= radius * radius) {
+        t = 0.0f;
+        contact = closest;
+        return true;
+    }
+    float best = INF;
+    RaycastHit3 hit{};
+    const auto offset = MathUtils::CrossProduct(b - a, c - a).GetNormalize() * radius;
+    if(0.0f < offset.CalcLengthSquared()) {
+        for(const auto& side : {offset, -offset}) {
+            if(MathUtils::Raycast(path, a + side, b + side, c + side, hit) && hit.t < best) {
+                best = hit.t;
+                contact = hit.point - side;
+            }
+        }
+    }
+    for(std::size_t i = 0; i < 3; ++i) {
+        const LineSegment3 edge{corners[i], corners[(i + 1) % 3]};
+        if(MathUtils::Raycast(path, Capsule3{edge, radius}, hit) && hit.t < best) {
+            best = hit.t;
+            contact = MathUtils::CalcClosestPoint(hit.point, edge);
+        }
+    }
+    if(tMax < best) {
+        return false;
+    }
+    t = best;
+    return true;
+}
+
+template<typename T>
+void AppendBytes(std::vector<unsigned char>& buffer, const T* data, std::size_t count) noexcept {
+    const auto offset = buffer.size();
+    buffer.resize(offset + sizeof(T) * count);
+    if(count) {
+        std::memcpy(buffer.data() + offset, data, sizeof(T) * count);
+    }
+}
+
+template<typename T>
+void ReadBytes(const std::vector<unsigned char>& buffer, std::size_t& offset, T* data, std::size_t count) noexcept {
+    if(count) {
+        std::memcpy(data, buffer.data() + offset, sizeof(T) * count);
+    }
+    offset += sizeof(T) * count;
+}
+
+} //End anonymous
+
+bool MeshBVH::Node::IsLeaf() const noexcept {
+    return count != 0;
+}
+
+MeshBVH::MeshBVH(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Build(vbo, ibo, jobSystem);
+}
+
+MeshBVH::MeshBVH(const FileUtils::Obj& obj, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Build(obj, jobSystem);
+}
+
+void MeshBVH::Build(const FileUtils::Obj& obj, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Build(obj.GetVbo(), obj.GetIbo(), jobSystem);
+}
+
+void MeshBVH::Build(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Clear();
+    const auto bounds = MathUtils::CalcTriangleBounds(vbo, ibo);
+    if(bounds.empty()) {
+        return;
+    }
+    const BVH bvh{bounds, jobSystem};
+    _nodes.reserve(bvh.GetNodes().size());
+    _vertices.reserve(3 * bounds.size());
+    _triangles.reserve(bounds.size());
+    FlattenNode(bvh, vbo, ibo, 0);
+}
+
+std::uint32_t MeshBVH::FlattenNode(const BVH& bvh, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, std::uint32_t node) noexcept {
+    const auto source = bvh.GetNodes()[node];
+    const auto index = static_cast<std::uint32_t>(_nodes.size());
+    _nodes.push_back(Node{source.bounds.mins, 0, source.bounds.maxs, source.count});
+    if(source.IsLeaf()) {
+        _nodes[index].first = static_cast<std::uint32_t>(_triangles.size());
+        const auto& indices = bvh.GetPrimitiveIndices();
+        for(auto i = source.first; i < source.first + source.count; ++i) {
+            const auto triangle = indices[i];
+            _vertices.push_back(vbo[ibo[3 * triangle + 0]].position);
+            _vertices.push_back(vbo[ibo[3 * triangle + 1]].position);
+            _vertices.push_back(vbo[ibo[3 * triangle + 2]].position);
+            _triangles.push_back(triangle);
+        }
+        return index;
+    }
+    FlattenNode(bvh, vbo, ibo, source.first);
+    const auto right = FlattenNode(bvh, vbo, ibo, source.first + 1);
+    _nodes[index].first = right;
+    return index;
+}
+
+void MeshBVH::Clear() noexcept {
+    _nodes.clear();
+    _vertices.clear();
+    _triangles.clear();
+}
+
+bool MeshBVH::empty() const noexcept {
+    return _nodes.empty();
+}
+
+std::size_t MeshBVH::GetTriangleCount() const noexcept {
+    return _triangles.size();
+}
+
+AABB3 MeshBVH::GetBounds() const noexcept {
+    if(_nodes.empty()) {
+        return AABB3{};
+    }
+    return AABB3{_nodes[0].mins, _nodes[0].maxs};
+}
+
+const std::vector<MeshBVH::Node>& MeshBVH::GetNodes() const noexcept {
+    return _nodes;
+}
+
+bool MeshBVH::Raycast(const LineSegment3& segment, RaycastHit3& hit) const noexcept {
+    if(_nodes.empty()) {
+        return false;
+    }
+    const auto origin = segment.start;
+    const auto displacement = segment.CalcDisplacement();
+    float root_t = 0.0f;
+    if(!EnterNode(origin, displacement, _nodes[0], 0.0f, 1.0f, root_t)) {
+        return false;
+    }
+    //Nearer child first; anything entered beyond the closest hit so far is skipped.
+    RaycastHit3 candidate{};
+    bool found = false;
+    std::array<std::pair<std::uint32_t, float>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, root_t);
+    while(top) {
+        const auto entry = stack[--top];
+        if(found && hit.t < entry.second) {
+            continue;
+        }
+        const auto& node = _nodes[entry.first];
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                const auto* corners = &_vertices[3 * i];
+                if(MathUtils::Raycast(segment, corners[0], corners[1], corners[2], candidate) && (!found || candidate.t < hit.t)) {
+                    found = true;
+                    hit = candidate;
+                    hit.index = _triangles[i];
+                }
+            }
+            continue;
+        }
+        const auto t_max = found ? hit.t : 1.0f;
+        const auto left = entry.first + 1;
+        const auto right = node.first;
+        float t_left = 0.0f;
+        float t_right = 0.0f;
+        const bool hit_left = EnterNode(origin, displacement, _nodes[left], 0.0f, t_max, t_left);
+        const bool hit_right = EnterNode(origin, displacement, _nodes[right], 0.0f, t_max, t_right);
+        if(hit_left && hit_right) {
+            const bool left_first = t_left <= t_right;
+            stack[top++] = left_first ? std::make_pair(right, t_right) : std::make_pair(left, t_left);
+            stack[top++] = left_first ? std::make_pair(left, t_left) : std::make_pair(right, t_right);
+        } else if(hit_left) {
+            stack[top++] = std::make_pair(left, t_left);
+        } else if(hit_right) {
+            stack[top++] = std::make_pair(right, t_right);
+        }
+    }
+    return found;
+}
+
+bool MeshBVH::CalcClosestPoint(const Vector3& point, Vector3& closest, std::size_t& triangle, float maxDistance /*= infinity*/) const noexcept {
+    //Squaring would turn a negative limit into a positive one.
+    if(_nodes.empty() || maxDistance < 0.0f) {
+        return false;
+    }
+    //Nearer child first; anything farther than the closest point so far is skipped.
+    auto best = maxDistance * maxDistance;
+    bool found = false;
+    std::array<std::pair<std::uint32_t, float>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, CalcDistanceSquared(point, _nodes[0]));
+    while(top) {
+        const auto entry = stack[--top];
+        if(best < entry.second) {
+            continue;
+        }
+        const auto& node = _nodes[entry.first];
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                const auto* corners = &_vertices[3 * i];
+                const auto candidate = MathUtils::CalcClosestPoint(point, corners[0], corners[1], corners[2]);
+                const auto distance = (point - candidate).CalcLengthSquared();
+                if(distance < best || (!found && distance <= best)) {
+                    found = true;
+                    best = distance;
+                    closest = candidate;
+                    triangle = _triangles[i];
+                }
+            }
+            continue;
+        }
+        const auto left = entry.first + 1;
+        const auto right = node.first;
+        const auto d_left = CalcDistanceSquared(point, _nodes[left]);
+        const auto d_right = CalcDistanceSquared(point, _nodes[right]);
+        const bool left_first = d_left <= d_right;
+        stack[top++] = left_first ? std::make_pair(right, d_right) : std::make_pair(left, d_left);
+        stack[top++] = left_first ? std::make_pair(left, d_left) : std::make_pair(right, d_right);
+    }
+    return found;
+}
+
+bool MeshBVH::SweepSphere(const Sphere3& sphere, const Vector3& displacement, RaycastHit3& hit) const noexcept {
+    if(_nodes.empty()) {
+        return false;
+    }
+    const LineSegment3 path{sphere.center, sphere.center + displacement};
+    float root_t = 0.0f;
+    if(!EnterNode(sphere.center, displacement, _nodes[0], sphere.radius, 1.0f, root_t)) {
+        return false;
+    }
+    //The center path is tested against node bounds grown by the radius.
+    float best_t = 1.0f;
+    Vector3 contact{};
+    std::size_t best = 0;
+    bool found = false;
+    std::array<std::pair<std::uint32_t, float>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, root_t);
+    while(top) {
+        const auto entry = stack[--top];
+        if(found && best_t < entry.second) {
+            continue;
+        }
+        const auto& node = _nodes[entry.first];
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                float t = 0.0f;
+                Vector3 candidate{};
+                if(SweepTriangle(path, sphere.radius, &_vertices[3 * i], best_t, t, candidate) && (!found || t < best_t)) {
+                    found = true;
+                    best_t = t;
+                    contact = candidate;
+                    best = i;
+                }
+            }
+            continue;
+        }
+        const auto left = entry.first + 1;
+        const auto right = node.first;
+        float t_left = 0.0f;
+        float t_right = 0.0f;
+        const bool hit_left = EnterNode(sphere.center, displacement, _nodes[left], sphere.radius, best_t, t_left);
+        const bool hit_right = EnterNode(sphere.center, displacement, _nodes[right], sphere.radius, best_t, t_right);
+        if(hit_left && hit_right) {
+            const bool left_first = t_left <= t_right;
+            stack[top++] = left_first ? std::make_pair(right, t_right) : std::make_pair(left, t_left);
+            stack[top++] = left_first ? std::make_pair(left, t_left) : std::make_pair(right, t_right);
+        } else if(hit_left) {
+            stack[top++] = std::make_pair(left, t_left);
+        } else if(hit_right) {
+            stack[top++] = std::make_pair(right, t_right);
+        }
+    }
+    if(!found) {
+        return false;
+    }
+    const auto center = sphere.center + displacement * best_t;
+    auto normal = (center - contact).GetNormalize();
+    if(normal.CalcLengthSquared() == 0.0f) {
+        //The center is on the triangle: fall back to the face normal against the motion.
+        const auto* corners = &_vertices[3 * best];
+        normal = MathUtils::CrossProduct(corners[1] - corners[0], corners[2] - corners[0]).GetNormalize();
+        if(0.0f < MathUtils::DotProduct(normal, displacement)) {
+            normal = -normal;
+        }
+    }
+    hit.t = best_t;
+    hit.point = contact;
+    hit.normal = normal;
+    hit.index = _triangles[best];
+    return true;
+}
+
+bool MeshBVH::Save(std::filesystem::path filepath) const noexcept {
+    CacheHeader header{};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.node_count = static_cast<std::uint32_t>(_nodes.size());
+    header.triangle_count = static_cast<std::uint32_t>(_triangles.size());
+    std::vector<unsigned char> buffer{};
+    buffer.reserve(sizeof(header) + sizeof(Node) * _nodes.size() + sizeof(Vector3) * _vertices.size() + sizeof(std::uint32_t) * _triangles.size());
+    AppendBytes(buffer, &header, 1);
+    AppendBytes(buffer, _nodes.data(), _nodes.size());
+    AppendBytes(buffer, _vertices.data(), _vertices.size());
+    AppendBytes(buffer, _triangles.data(), _triangles.size());
+    return FileUtils::WriteBufferToFile(buffer.data(), buffer.size(), filepath);
+}
+
+bool MeshBVH::Load(std::filesystem::path filepath) noexcept {
+    namespace FS = std::filesystem;
+    Clear();
+    std::error_code error{};
+    if(!FS::is_regular_file(filepath, error)) {
+        return false;
+    }
+    std::vector<unsigned char> buffer{};
+    if(!FileUtils::ReadBufferFromFile(buffer, filepath) || buffer.size() < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header{};
+    std::size_t offset = 0;
+    ReadBytes(buffer, offset, &header, 1);
+    const auto expected_size = sizeof(CacheHeader) + sizeof(Node) * std::size_t{header.node_count} + (3 * sizeof(Vector3) + sizeof(std::uint32_t)) * std::size_t{header.triangle_count};
+    if(header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || buffer.size() != expected_size) {
+        return false;
+    }
+    _nodes.resize(header.node_count);
+    _vertices.resize(3 * std::size_t{header.triangle_count});
+    _triangles.resize(header.triangle_count);
+    ReadBytes(buffer, offset, _nodes.data(), _nodes.size());
+    ReadBytes(buffer, offset, _vertices.data(), _vertices.size());
+    ReadBytes(buffer, offset, _triangles.data(), _triangles.size());
+    //Reject links that would send a query outside the arrays, or trees too deep for the query stacks.
+    //Children always come after their parent, so depths are known by the time a node is reached.
+    std::vector<std::uint32_t> depths(_nodes.size(), 0);
+    for(std::size_t i = 0; i < _nodes.size(); ++i) {
+        const auto& node = _nodes[i];
+        bool valid = depths[i] < MAX_STACK_SIZE - 1;
+        if(node.IsLeaf()) {
+            valid = valid && std::size_t{node.first} + node.count <= _triangles.size();
+        } else {
+            valid = valid && i + 1 < _nodes.size() && i < node.first && node.first < _nodes.size();
+            if(valid) {
+                depths[i + 1] = depths[i] + 1;
+                depths[node.first] = depths[i] + 1;
+            }
+        }
+        if(!valid) {
+            Clear();
+            return false;
+        }
+    }
+    return true;
+}
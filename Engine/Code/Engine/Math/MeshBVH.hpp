@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <vector>
+
+class BVH;
+class JobSystem;
+class LineSegment3;
+class RaycastHit3;
+class Sphere3;
+class Vertex3D;
+
+namespace FileUtils {
+class Obj;
+}
+
+//Triangle BVH over a static mesh for picking, collision against level geometry and nearest-point queries.
+//Built with the same binned SAH builder as BVH, then flattened: nodes are 32 bytes in depth-first order,
+//so a left child always follows its parent, and each leaf's triangles are copied next to each other.
+//Queries never go back to the vbo or ibo. Triangles are reported in ibo order, as in MathUtils::Raycast.
+//Save and Load keep a built index in a binary cache file so it is not rebuilt on every run.
+class MeshBVH {
+public:
+
+    struct Node {
+        Vector3 mins{};
+        //Interior nodes: index of the right child; the left child is the next node.
+        //Leaves: index of the first triangle in the leaf.
+        std::uint32_t first = 0;
+        Vector3 maxs{};
+        //Number of triangles in a leaf; zero for interior nodes.
+        std::uint32_t count = 0;
+        bool IsLeaf() const noexcept;
+    };
+
+    MeshBVH() = default;
+    MeshBVH(const MeshBVH& other) = default;
+    MeshBVH(MeshBVH&& other) = default;
+    MeshBVH& operator=(const MeshBVH& other) = default;
+    MeshBVH& operator=(MeshBVH&& other) = default;
+    ~MeshBVH() = default;
+
+    explicit MeshBVH(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, JobSystem* jobSystem = nullptr) noexcept;
+    explicit MeshBVH(const FileUtils::Obj& obj, JobSystem* jobSystem = nullptr) noexcept;
+
+    //The ibo holds three indices per triangle. When a JobSystem is given, large builds use its Generic workers.
+    void Build(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, JobSystem* jobSystem = nullptr) noexcept;
+    void Build(const FileUtils::Obj& obj, JobSystem* jobSystem = nullptr) noexcept;
+    void Clear() noexcept;
+
+    bool empty() const noexcept;
+    std::size_t GetTriangleCount() const noexcept;
+    AABB3 GetBounds() const noexcept;
+    const std::vector<Node>& GetNodes() const noexcept;
+
+    //First triangle along the segment, as MathUtils::Raycast reports it.
+    bool Raycast(const LineSegment3& segment, RaycastHit3& hit) const noexcept;
+
+    //Closest point on the mesh surface no farther than maxDistance from point. A negative maxDistance finds nothing.
+    bool CalcClosestPoint(const Vector3& point, Vector3& closest, std::size_t& triangle, float maxDistance = (std::numeric_limits<float>::infinity)()) const noexcept;
+
+    //Moves sphere by displacement and finds its first contact with the mesh. hit.t is the fraction of
+    //the displacement, hit.point the contact on the mesh and hit.normal points from it to the sphere center.
+    //A sphere already touching the mesh hits at t zero.
+    bool SweepSphere(const Sphere3& sphere, const Vector3& displacement, RaycastHit3& hit) const noexcept;
+
+    //The cache stores raw floats in the machine's byte order. Load rejects files of another version
+    //or with inconsistent sizes and leaves the index empty.
+    bool Save(std::filesystem::path filepath) const noexcept;
+    bool Load(std::filesystem::path filepath) noexcept;
+
+protected:
+private:
+    //Copies the subtree under node of bvh, depth first, and returns the index of its copy.
+    std::uint32_t FlattenNode(const BVH& bvh, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, std::uint32_t node) noexcept;
+
+    std::vector<Node> _nodes{};
+    //Three corners per triangle, in leaf order.
+    std::vector<Vector3> _vertices{};
+    //The ibo triangle number of each triangle in leaf order.
+    std::vector<std::uint32_t> _triangles{};
+};
@@ -767,4 +767,311 @@ namespace MathUtils {
         return totalNoise;
     }
 
+
+    namespace
+    {
+        //-----------------------------------------------------------------------------------------------
+        // A simplex corner contributes its gradient's dot product with the displacement, faded by
+        //	(r^2 - d^2)^4.  With r^2 = 0.5 each corner's influence reaches zero before the far side of
+        //	every simplex that shares the corner, so the noise stays continuous.
+        //	Clamped rather than branched on, since about half the corners are out of range.
+        //
+        template<typename VectorType>
+        float ComputeSimplexCornerContribution(const VectorType& gradient, const VectorType& displacement) noexcept
+        {
+            const float RADIUS_SQUARED = 0.5f;
+            float falloff = RADIUS_SQUARED - MathUtils::DotProduct(displacement, displacement);
+            falloff = (falloff > 0.f) ? falloff : 0.f;
+            falloff *= falloff;
+            return falloff * falloff * MathUtils::DotProduct(gradient, displacement);
+        }
+    }
+
+
+    //-----------------------------------------------------------------------------------------------
+    // Simplex noise skews space so the simplex grid lines up with the integer grid, finds the unit
+    //	cell containing the point, picks the simplex within it by ranking the offset's components,
+    //	and sums the fading gradient contributions of that simplex's corners.
+    //
+    // In 2D, the cell is split into two triangles and gradients are the 8 used by 2D Perlin noise.
+    //
+    float Compute2dSimplexNoise(float posX, float posY, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed) noexcept
+    {
+        const float OCTAVE_OFFSET = 0.636764989593174f; // Translation/bias to add to each octave
+        const float SKEW = 0.366025403784438647f; // (sqrt(3)-1)/2
+        const float UNSKEW = 0.211324865405187118f; // (3-sqrt(3))/6
+
+        static constexpr Vector2 gradients[8] = // Normalized unit vectors in 8 quarter-cardinal directions
+        {
+            Vector2(+0.923879533f, +0.382683432f), //  22.5 degrees (ENE)
+            Vector2(+0.382683432f, +0.923879533f), //  67.5 degrees (NNE)
+            Vector2(-0.382683432f, +0.923879533f), // 112.5 degrees (NNW)
+            Vector2(-0.923879533f, +0.382683432f), // 157.5 degrees (WNW)
+            Vector2(-0.923879533f, -0.382683432f), // 202.5 degrees (WSW)
+            Vector2(-0.382683432f, -0.923879533f), // 247.5 degrees (SSW)
+            Vector2(+0.382683432f, -0.923879533f), // 292.5 degrees (SSE)
+            Vector2(+0.923879533f, -0.382683432f)  // 337.5 degrees (ESE)
+        };
+
+        float totalNoise = 0.f;
+        float totalAmplitude = 0.f;
+        float currentAmplitude = 1.f;
+        float invScale = (1.f / scale);
+        Vector2 currentPos(posX * invScale, posY * invScale);
+
+        for(unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+        {
+            // Find the skewed cell containing the point and the (unskewed) displacement from its first corner
+            float skew = (currentPos.x + currentPos.y) * SKEW;
+            float cellX = floorf(currentPos.x + skew);
+            float cellY = floorf(currentPos.y + skew);
+            int indexX = (int)cellX;
+            int indexY = (int)cellY;
+            float unskew = (cellX + cellY) * UNSKEW;
+            Vector2 displacement0(currentPos.x - (cellX - unskew), currentPos.y - (cellY - unskew));
+
+            // The middle corner is one step along whichever axis the point is further along
+            int stepX = (displacement0.x > displacement0.y) ? 1 : 0;
+            int stepY = 1 - stepX;
+            Vector2 displacement1((displacement0.x - (float)stepX) + UNSKEW, (displacement0.y - (float)stepY) + UNSKEW);
+            Vector2 displacement2((displacement0.x - 1.f) + 2.f * UNSKEW, (displacement0.y - 1.f) + 2.f * UNSKEW);
+
+            unsigned int noise0 = Get2dNoiseUint(indexX, indexY, seed);
+            unsigned int noise1 = Get2dNoiseUint(indexX + stepX, indexY + stepY, seed);
+            unsigned int noise2 = Get2dNoiseUint(indexX + 1, indexY + 1, seed);
+
+            float contribution0 = ComputeSimplexCornerContribution(gradients[noise0 & 0x00000007], displacement0);
+            float contribution1 = ComputeSimplexCornerContribution(gradients[noise1 & 0x00000007], displacement1);
+            float contribution2 = ComputeSimplexCornerContribution(gradients[noise2 & 0x00000007], displacement2);
+            float noiseThisOctave = 100.f * (contribution0 + contribution1 + contribution2); // 2D simplex is in ~[-.01,.01]; map to ~[-1,1]
+
+            // Accumulate results and prepare for next octave (if any)
+            totalNoise += noiseThisOctave * currentAmplitude;
+            totalAmplitude += currentAmplitude;
+            currentAmplitude *= octavePersistence;
+            currentPos *= octaveScale;
+            currentPos.x += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            currentPos.y += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            ++seed; // Eliminates octaves "echoing" each other (since each octave is uniquely seeded)
+        }
+
+        // Re-normalize total noise to within [-1,1] and fix octaves pulling us far away from limits
+        if(renormalize && totalAmplitude > 0.f)
+        {
+            totalNoise /= totalAmplitude;				// Amplitude exceeds 1.0 if octaves are used
+            totalNoise = (totalNoise * 0.5f) + 0.5f;	// Map to [0,1]
+            totalNoise = MathUtils::EasingFunctions::SmoothStep<3>(totalNoise);		// Push towards extents (octaves pull us away)
+            totalNoise = (totalNoise * 2.0f) - 1.f;		// Map back to [-1,1]
+        }
+
+        return totalNoise;
+    }
+
+
+    //-----------------------------------------------------------------------------------------------
+    // In 3D, the cell is split into six tetrahedra and gradients are the 8 cube-corner vectors
+    //	used by 3D Perlin noise.
+    //
+    float Compute3dSimplexNoise(float posX, float posY, float posZ, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed) noexcept
+    {
+        const float OCTAVE_OFFSET = 0.636764989593174f; // Translation/bias to add to each octave
+        const float SKEW = 1.f / 3.f;
+        const float UNSKEW = 1.f / 6.f;
+
+        static constexpr Vector3 gradients[8] = // Normalized unit 3D vectors pointing toward cube corners
+        {
+            Vector3(+MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3),
+            Vector3(-MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3),
+            Vector3(+MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3),
+            Vector3(-MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3),
+            Vector3(+MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3),
+            Vector3(-MathUtils::M_SQRT3_3, +MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3),
+            Vector3(+MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3),
+            Vector3(-MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3, -MathUtils::M_SQRT3_3)
+        };
+
+        float totalNoise = 0.f;
+        float totalAmplitude = 0.f;
+        float currentAmplitude = 1.f;
+        float invScale = (1.f / scale);
+        Vector3 currentPos(posX * invScale, posY * invScale, posZ * invScale);
+
+        for(unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+        {
+            // Find the skewed cell containing the point and the (unskewed) displacement from its first corner
+            float skew = (currentPos.x + currentPos.y + currentPos.z) * SKEW;
+            float cellX = floorf(currentPos.x + skew);
+            float cellY = floorf(currentPos.y + skew);
+            float cellZ = floorf(currentPos.z + skew);
+            int indexX = (int)cellX;
+            int indexY = (int)cellY;
+            int indexZ = (int)cellZ;
+            float unskew = (cellX + cellY + cellZ) * UNSKEW;
+            Vector3 displacement0(currentPos.x - (cellX - unskew), currentPos.y - (cellY - unskew), currentPos.z - (cellZ - unskew));
+
+            // Rank the displacement's components; the path through the cell steps along the largest first
+            bool xBeatsY = displacement0.x >= displacement0.y;
+            bool xBeatsZ = displacement0.x >= displacement0.z;
+            bool yBeatsZ = displacement0.y >= displacement0.z;
+            int step1X = (xBeatsY && xBeatsZ) ? 1 : 0;
+            int step1Y = (!xBeatsY && yBeatsZ) ? 1 : 0;
+            int step1Z = (!xBeatsZ && !yBeatsZ) ? 1 : 0;
+            int step2X = (xBeatsY || xBeatsZ) ? 1 : 0;
+            int step2Y = (!xBeatsY || yBeatsZ) ? 1 : 0;
+            int step2Z = (xBeatsZ && yBeatsZ) ? 0 : 1;
+            Vector3 displacement1((displacement0.x - (float)step1X) + UNSKEW, (displacement0.y - (float)step1Y) + UNSKEW, (displacement0.z - (float)step1Z) + UNSKEW);
+            Vector3 displacement2((displacement0.x - (float)step2X) + 2.f * UNSKEW, (displacement0.y - (float)step2Y) + 2.f * UNSKEW, (displacement0.z - (float)step2Z) + 2.f * UNSKEW);
+            Vector3 displacement3((displacement0.x - 1.f) + 3.f * UNSKEW, (displacement0.y - 1.f) + 3.f * UNSKEW, (displacement0.z - 1.f) + 3.f * UNSKEW);
+
+            unsigned int noise0 = Get3dNoiseUint(indexX, indexY, indexZ, seed);
+            unsigned int noise1 = Get3dNoiseUint(indexX + step1X, indexY + step1Y, indexZ + step1Z, seed);
+            unsigned int noise2 = Get3dNoiseUint(indexX + step2X, indexY + step2Y, indexZ + step2Z, seed);
+            unsigned int noise3 = Get3dNoiseUint(indexX + 1, indexY + 1, indexZ + 1, seed);
+
+            float contribution0 = ComputeSimplexCornerContribution(gradients[noise0 & 0x00000007], displacement0);
+            float contribution1 = ComputeSimplexCornerContribution(gradients[noise1 & 0x00000007], displacement1);
+            float contribution2 = ComputeSimplexCornerContribution(gradients[noise2 & 0x00000007], displacement2);
+            float contribution3 = ComputeSimplexCornerContribution(gradients[noise3 & 0x00000007], displacement3);
+            float noiseThisOctave = 108.f * (contribution0 + contribution1 + contribution2 + contribution3); // 3D simplex is in ~[-.0093,.0093]; map to ~[-1,1]
+
+            // Accumulate results and prepare for next octave (if any)
+            totalNoise += noiseThisOctave * currentAmplitude;
+            totalAmplitude += currentAmplitude;
+            currentAmplitude *= octavePersistence;
+            currentPos *= octaveScale;
+            currentPos.x += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            currentPos.y += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            currentPos.z += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            ++seed; // Eliminates octaves "echoing" each other (since each octave is uniquely seeded)
+        }
+
+        // Re-normalize total noise to within [-1,1] and fix octaves pulling us far away from limits
+        if(renormalize && totalAmplitude > 0.f)
+        {
+            totalNoise /= totalAmplitude;				// Amplitude exceeds 1.0 if octaves are used
+            totalNoise = (totalNoise * 0.5f) + 0.5f;	// Map to [0,1]
+            totalNoise = MathUtils::EasingFunctions::SmoothStep<3>(totalNoise);		// Push towards extents (octaves pull us away)
+            totalNoise = (totalNoise * 2.0f) - 1.f;		// Map back to [-1,1]
+        }
+
+        return totalNoise;
+    }
+
+
+    //-----------------------------------------------------------------------------------------------
+    // In 4D, the cell is split into 24 5-cells and gradients are the 16 hypercube-corner vectors
+    //	used by 4D Perlin noise.  Only 5 corners are visited per octave, against Perlin's 16.
+    //
+    float Compute4dSimplexNoise(float posX, float posY, float posZ, float posT, float scale, unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed) noexcept
+    {
+        const float OCTAVE_OFFSET = 0.636764989593174f; // Translation/bias to add to each octave
+        const float SKEW = 0.309016994374947424f; // (sqrt(5)-1)/4
+        const float UNSKEW = 0.138196601125010515f; // (5-sqrt(5))/20
+
+        static constexpr Vector4 gradients[16] = // Normalized unit 4D vectors pointing toward hypercube corners
+        {
+            Vector4(+0.5f, +0.5f, +0.5f, +0.5f),
+            Vector4(-0.5f, +0.5f, +0.5f, +0.5f),
+            Vector4(+0.5f, -0.5f, +0.5f, +0.5f),
+            Vector4(-0.5f, -0.5f, +0.5f, +0.5f),
+            Vector4(+0.5f, +0.5f, -0.5f, +0.5f),
+            Vector4(-0.5f, +0.5f, -0.5f, +0.5f),
+            Vector4(+0.5f, -0.5f, -0.5f, +0.5f),
+            Vector4(-0.5f, -0.5f, -0.5f, +0.5f),
+            Vector4(+0.5f, +0.5f, +0.5f, -0.5f),
+            Vector4(-0.5f, +0.5f, +0.5f, -0.5f),
+            Vector4(+0.5f, -0.5f, +0.5f, -0.5f),
+            Vector4(-0.5f, -0.5f, +0.5f, -0.5f),
+            Vector4(+0.5f, +0.5f, -0.5f, -0.5f),
+            Vector4(-0.5f, +0.5f, -0.5f, -0.5f),
+            Vector4(+0.5f, -0.5f, -0.5f, -0.5f),
+            Vector4(-0.5f, -0.5f, -0.5f, -0.5f)
+        };
+
+        float totalNoise = 0.f;
+        float totalAmplitude = 0.f;
+        float currentAmplitude = 1.f;
+        float invScale = (1.f / scale);
+        Vector4 currentPos(posX * invScale, posY * invScale, posZ * invScale, posT * invScale);
+
+        for(unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+        {
+            // Find the skewed cell containing the point and the (unskewed) displacement from its first corner
+            float skew = (currentPos.x + currentPos.y + currentPos.z + currentPos.w) * SKEW;
+            float cellX = floorf(currentPos.x + skew);
+            float cellY = floorf(currentPos.y + skew);
+            float cellZ = floorf(currentPos.z + skew);
+            float cellT = floorf(currentPos.w + skew);
+            int indexX = (int)cellX;
+            int indexY = (int)cellY;
+            int indexZ = (int)cellZ;
+            int indexT = (int)cellT;
+            float unskew = (cellX + cellY + cellZ + cellT) * UNSKEW;
+            Vector4 displacement0(currentPos.x - (cellX - unskew), currentPos.y - (cellY - unskew), currentPos.z - (cellZ - unskew), currentPos.w - (cellT - unskew));
+
+            // Rank the displacement's components (0-3); the path through the cell steps along the largest first
+            int xBeatsY = (displacement0.x > displacement0.y) ? 1 : 0;
+            int xBeatsZ = (displacement0.x > displacement0.z) ? 1 : 0;
+            int xBeatsT = (displacement0.x > displacement0.w) ? 1 : 0;
+            int yBeatsZ = (displacement0.y > displacement0.z) ? 1 : 0;
+            int yBeatsT = (displacement0.y > displacement0.w) ? 1 : 0;
+            int zBeatsT = (displacement0.z > displacement0.w) ? 1 : 0;
+            int rankX = xBeatsY + xBeatsZ + xBeatsT;
+            int rankY = (1 - xBeatsY) + yBeatsZ + yBeatsT;
+            int rankZ = (1 - xBeatsZ) + (1 - yBeatsZ) + zBeatsT;
+            int rankT = (1 - xBeatsT) + (1 - yBeatsT) + (1 - zBeatsT);
+            int step1X = (rankX >= 3) ? 1 : 0;
+            int step1Y = (rankY >= 3) ? 1 : 0;
+            int step1Z = (rankZ >= 3) ? 1 : 0;
+            int step1T = (rankT >= 3) ? 1 : 0;
+            int step2X = (rankX >= 2) ? 1 : 0;
+            int step2Y = (rankY >= 2) ? 1 : 0;
+            int step2Z = (rankZ >= 2) ? 1 : 0;
+            int step2T = (rankT >= 2) ? 1 : 0;
+            int step3X = (rankX >= 1) ? 1 : 0;
+            int step3Y = (rankY >= 1) ? 1 : 0;
+            int step3Z = (rankZ >= 1) ? 1 : 0;
+            int step3T = (rankT >= 1) ? 1 : 0;
+            Vector4 displacement1((displacement0.x - (float)step1X) + UNSKEW, (displacement0.y - (float)step1Y) + UNSKEW, (displacement0.z - (float)step1Z) + UNSKEW, (displacement0.w - (float)step1T) + UNSKEW);
+            Vector4 displacement2((displacement0.x - (float)step2X) + 2.f * UNSKEW, (displacement0.y - (float)step2Y) + 2.f * UNSKEW, (displacement0.z - (float)step2Z) + 2.f * UNSKEW, (displacement0.w - (float)step2T) + 2.f * UNSKEW);
+            Vector4 displacement3((displacement0.x - (float)step3X) + 3.f * UNSKEW, (displacement0.y - (float)step3Y) + 3.f * UNSKEW, (displacement0.z - (float)step3Z) + 3.f * UNSKEW, (displacement0.w - (float)step3T) + 3.f * UNSKEW);
+            Vector4 displacement4((displacement0.x - 1.f) + 4.f * UNSKEW, (displacement0.y - 1.f) + 4.f * UNSKEW, (displacement0.z - 1.f) + 4.f * UNSKEW, (displacement0.w - 1.f) + 4.f * UNSKEW);
+
+            unsigned int noise0 = Get4dNoiseUint(indexX, indexY, indexZ, indexT, seed);
+            unsigned int noise1 = Get4dNoiseUint(indexX + step1X, indexY + step1Y, indexZ + step1Z, indexT + step1T, seed);
+            unsigned int noise2 = Get4dNoiseUint(indexX + step2X, indexY + step2Y, indexZ + step2Z, indexT + step2T, seed);
+            unsigned int noise3 = Get4dNoiseUint(indexX + step3X, indexY + step3Y, indexZ + step3Z, indexT + step3T, seed);
+            unsigned int noise4 = Get4dNoiseUint(indexX + 1, indexY + 1, indexZ + 1, indexT + 1, seed);
+
+            float contribution0 = ComputeSimplexCornerContribution(gradients[noise0 & 0x0000000F], displacement0);
+            float contribution1 = ComputeSimplexCornerContribution(gradients[noise1 & 0x0000000F], displacement1);
+            float contribution2 = ComputeSimplexCornerContribution(gradients[noise2 & 0x0000000F], displacement2);
+            float contribution3 = ComputeSimplexCornerContribution(gradients[noise3 & 0x0000000F], displacement3);
+            float contribution4 = ComputeSimplexCornerContribution(gradients[noise4 & 0x0000000F], displacement4);
+            float noiseThisOctave = 109.f * (contribution0 + contribution1 + contribution2 + contribution3 + contribution4); // 4D simplex is in ~[-.0092,.0092]; map to ~[-1,1]
+
+            // Accumulate results and prepare for next octave (if any)
+            totalNoise += noiseThisOctave * currentAmplitude;
+            totalAmplitude += currentAmplitude;
+            currentAmplitude *= octavePersistence;
+            currentPos *= octaveScale;
+            currentPos.x += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            currentPos.y += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            currentPos.z += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            currentPos.w += OCTAVE_OFFSET; // Add "irrational" offset to de-align octave grids
+            ++seed; // Eliminates octaves "echoing" each other (since each octave is uniquely seeded)
+        }
+
+        // Re-normalize total noise to within [-1,1] and fix octaves pulling us far away from limits
+        if(renormalize && totalAmplitude > 0.f)
+        {
+            totalNoise /= totalAmplitude;				// Amplitude exceeds 1.0 if octaves are used
+            totalNoise = (totalNoise * 0.5f) + 0.5f;	// Map to [0,1]
+            totalNoise = MathUtils::EasingFunctions::SmoothStep<3>(totalNoise);		// Push towards extents (octaves pull us away)
+            totalNoise = (totalNoise * 2.0f) - 1.f;		// Map back to [-1,1]
+        }
+
+        return totalNoise;
+    }
+
 } //END MathUtils
\ No newline at end of file
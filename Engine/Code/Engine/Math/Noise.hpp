@@ -108,10 +108,19 @@ namespace MathUtils {
     //	though, and examples of cross-sectional 4D simplex noise look worse to me than 4D Perlin.
     //
     // Simplex noise is based on a regular simplex (2D triangle, 3D tetrahedron, 4-simplex/5-cell)
-    //	grid, which is a bit more fiddly, so I haven't written my own yet.
+    //	grid, which is a bit more fiddly.  Each sample only visits the N+1 corners of its simplex
+    //	instead of the 2^N corners of its hypercube, so it pulls further ahead of Perlin as N grows.
+    //	Gradients are the same as the Perlin functions' and corners are hashed the same way.
+    //	(1D simplex is identical to 1D Perlin, so there isn't one.)
     //
-    //TODO: Implement simplex noise in 2D, 3D, 4D (1D simplex is identical to 1D Perlin, I think?)
-    //TODO: Test actual simplex noise implementation in 2D/3D to compare speeds (branches vs. math!)
+    // <numOctaves>			Number of layers of noise added together
+    // <octavePersistence>	Amplitude multiplier for each subsequent octave (each octave is quieter)
+    // <octaveScale>		Frequency multiplier for each subsequent octave (each octave is busier)
+    // <renormalize>		If true, uses nonlinear (SmoothStep) renormalization to within [-1,1]
+    //
+    float Compute2dSimplexNoise(float posX, float posY, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0) noexcept;
+    float Compute3dSimplexNoise(float posX, float posY, float posZ, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0) noexcept;
+    float Compute4dSimplexNoise(float posX, float posY, float posZ, float posT, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0) noexcept;
 
 
     //-----------------------------------------------------------------------------------------------
@@ -0,0 +1,770 @@
+#include "Engine/Math/NoiseField.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Noise.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <algorithm>
+
+#ifdef MATH_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+//Points per job when a batch or grid is split across a JobSystem.
+constexpr std::size_t MIN_NOISE_JOB_SIZE = 2048;
+
+enum class NoiseType {
+    Fractal
+    ,Perlin
+    ,Simplex
+};
+
+struct OctaveSet {
+    float scale;
+    unsigned int numOctaves;
+    float octavePersistence;
+    float octaveScale;
+    bool renormalize;
+    unsigned int seed;
+};
+
+template<NoiseType Type>
+float Sample2d(float x, float y, const OctaveSet& octaves) noexcept {
+    if constexpr(Type == NoiseType::Fractal) {
+        return MathUtils::Compute2dFractalNoise(x, y, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+    } else if constexpr(Type == NoiseType::Perlin) {
+        return MathUtils::Compute2dPerlinNoise(x, y, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+    } else {
+        return MathUtils::Compute2dSimplexNoise(x, y, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+    }
+}
+
+template<NoiseType Type>
+float Sample3d(float x, float y, float z, const OctaveSet& octaves) noexcept {
+    if constexpr(Type == NoiseType::Fractal) {
+        return MathUtils::Compute3dFractalNoise(x, y, z, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+    } else if constexpr(Type == NoiseType::Perlin) {
+        return MathUtils::Compute3dPerlinNoise(x, y, z, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+    } else {
+        return MathUtils::Compute3dSimplexNoise(x, y, z, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+    }
+}
+
+//Only simplex noise has a 4D batch form.
+float Sample4d(float x, float y, float z, float t, const OctaveSet& octaves) noexcept {
+    return MathUtils::Compute4dSimplexNoise(x, y, z, t, octaves.scale, octaves.numOctaves, octaves.octavePersistence, octaves.octaveScale, octaves.renormalize, octaves.seed);
+}
+
+#ifdef MATH_SIMD_SSE
+
+//Everything below repeats the operations of Noise.cpp in the same order
+//so that each lane rounds exactly like the scalar functions.
+constexpr float OCTAVE_OFFSET = 0.636764989593174f;
+constexpr unsigned int BIT_NOISE1 = 0x68E31DA4;
+constexpr unsigned int BIT_NOISE2 = 0xB5297A4D;
+constexpr unsigned int BIT_NOISE3 = 0x1B56C4E9;
+constexpr int PRIME1 = 198491317;
+constexpr int PRIME2 = 6542989;
+constexpr int PRIME3 = 357239;
+constexpr float PERLIN_2D_MAJOR = 0.923879533f;
+constexpr float PERLIN_2D_MINOR = 0.382683432f;
+constexpr float PERLIN_2D_RANGE = 1.5f;
+constexpr float PERLIN_3D_RANGE = 1.66666666f;
+constexpr float SIMPLEX_RADIUS_SQUARED = 0.5f;
+constexpr float SIMPLEX_2D_SKEW = 0.366025403784438647f;
+constexpr float SIMPLEX_2D_UNSKEW = 0.211324865405187118f;
+constexpr float SIMPLEX_2D_RANGE = 100.f;
+constexpr float SIMPLEX_3D_SKEW = 1.f / 3.f;
+constexpr float SIMPLEX_3D_UNSKEW = 1.f / 6.f;
+constexpr float SIMPLEX_3D_RANGE = 108.f;
+constexpr float SIMPLEX_4D_SKEW = 0.309016994374947424f;
+constexpr float SIMPLEX_4D_UNSKEW = 0.138196601125010515f;
+constexpr float SIMPLEX_4D_RANGE = 109.f;
+
+//SSE2 has no 32 bit low multiply; build it from the even and odd 32x32->64 bit products.
+__m128i MulLo32(__m128i a, __m128i b) noexcept {
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+//Get1dNoiseUint on four indices.
+__m128i NoiseUint(__m128i index, __m128i seed) noexcept {
+    __m128i bits = MulLo32(index, _mm_set1_epi32(static_cast<int>(BIT_NOISE1)));
+    bits = _mm_add_epi32(bits, seed);
+    bits = _mm_xor_si128(bits, _mm_srli_epi32(bits, 8));
+    bits = _mm_add_epi32(bits, _mm_set1_epi32(static_cast<int>(BIT_NOISE2)));
+    bits = _mm_xor_si128(bits, _mm_slli_epi32(bits, 8));
+    bits = MulLo32(bits, _mm_set1_epi32(static_cast<int>(BIT_NOISE3)));
+    return _mm_xor_si128(bits, _mm_srli_epi32(bits, 8));
+}
+
+__m128i NoiseUint(__m128i x, __m128i y, __m128i seed) noexcept {
+    return NoiseUint(_mm_add_epi32(x, MulLo32(_mm_set1_epi32(PRIME1), y)), seed);
+}
+
+__m128i NoiseUint(__m128i x, __m128i y, __m128i z, __m128i seed) noexcept {
+    const __m128i index = _mm_add_epi32(_mm_add_epi32(x, MulLo32(_mm_set1_epi32(PRIME1), y)), MulLo32(_mm_set1_epi32(PRIME2), z));
+    return NoiseUint(index, seed);
+}
+
+__m128i NoiseUint(__m128i x, __m128i y, __m128i z, __m128i t, __m128i seed) noexcept {
+    const __m128i xy = _mm_add_epi32(x, MulLo32(_mm_set1_epi32(PRIME1), y));
+    const __m128i index = _mm_add_epi32(_mm_add_epi32(xy, MulLo32(_mm_set1_epi32(PRIME2), z)), MulLo32(_mm_set1_epi32(PRIME3), t));
+    return NoiseUint(index, seed);
+}
+
+//Get*dNoiseZeroToOne maps through a double; doing the same keeps the rounding identical.
+__m128 ZeroToOne(__m128i noise) noexcept {
+    const __m128d one_over_max_uint = _mm_set1_pd(1.0 / static_cast<double>(0xFFFFFFFF));
+    const __m128d bias = _mm_set1_pd(2147483648.0);
+    const __m128i biased = _mm_xor_si128(noise, _mm_set1_epi32(static_cast<int>(0x80000000u)));
+    const __m128d low = _mm_add_pd(_mm_cvtepi32_pd(biased), bias);
+    const __m128d high = _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(biased, _MM_SHUFFLE(3, 2, 3, 2))), bias);
+    return _mm_movelh_ps(_mm_cvtpd_ps(_mm_mul_pd(one_over_max_uint, low)), _mm_cvtpd_ps(_mm_mul_pd(one_over_max_uint, high)));
+}
+
+//floorf, also returning the floor as an integer cell index. Valid for |x| < 2^31.
+__m128 Floor(__m128 x, __m128i& index) noexcept {
+    const __m128i truncated = _mm_cvttps_epi32(x);
+    const __m128 rounded = _mm_cvtepi32_ps(truncated);
+    const __m128 above = _mm_cmpgt_ps(rounded, x);
+    index = _mm_add_epi32(truncated, _mm_castps_si128(above));
+    return _mm_sub_ps(rounded, _mm_and_ps(above, _mm_set1_ps(1.0f)));
+}
+
+//EasingFunctions::SmoothStep<3>.
+__m128 SmoothStep3(__m128 t) noexcept {
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 s = _mm_sub_ps(_mm_set1_ps(1.0f), t);
+    const __m128 start = _mm_mul_ps(t, _mm_mul_ps(t, t));
+    const __m128 stop = _mm_mul_ps(s, _mm_mul_ps(s, s));
+    return _mm_add_ps(_mm_mul_ps(half, start), _mm_mul_ps(half, stop));
+}
+
+__m128 Blend(__m128 weightHigh, __m128 high, __m128 weightLow, __m128 low) noexcept {
+    return _mm_add_ps(_mm_mul_ps(weightHigh, high), _mm_mul_ps(weightLow, low));
+}
+
+//The 2D Perlin gradient table, selected with bit tricks instead of a gather:
+//odd 45 degree steps swap the components, and the sign bits follow the quadrant.
+__m128 DotGradient(__m128i noise, __m128 dx, __m128 dy) noexcept {
+    const __m128i index = _mm_and_si128(noise, _mm_set1_epi32(7));
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_xor_si128(index, _mm_srli_epi32(index, 1)), one), one));
+    const __m128 major = _mm_set1_ps(PERLIN_2D_MAJOR);
+    const __m128 minor = _mm_set1_ps(PERLIN_2D_MINOR);
+    const __m128i four = _mm_set1_epi32(4);
+    const __m128 sign_x = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(index, _mm_set1_epi32(2)), four), 29));
+    const __m128 sign_y = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(index, four), 29));
+    const __m128 gx = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, minor), _mm_andnot_ps(swap, major)), sign_x);
+    const __m128 gy = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, major), _mm_andnot_ps(swap, minor)), sign_y);
+    return _mm_add_ps(_mm_mul_ps(gx, dx), _mm_mul_ps(gy, dy));
+}
+
+//The 3D Perlin gradients point at cube corners; the low three bits are the sign bits.
+__m128 DotGradient(__m128i noise, __m128 dx, __m128 dy, __m128 dz) noexcept {
+    const __m128 component = _mm_set1_ps(MathUtils::M_SQRT3_3);
+    const __m128 gx = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(1)), 31)));
+    const __m128 gy = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(2)), 30)));
+    const __m128 gz = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(4)), 29)));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, dx), _mm_mul_ps(gy, dy)), _mm_mul_ps(gz, dz));
+}
+
+//The 4D Perlin and simplex gradients point at hypercube corners; the low four bits are the sign bits.
+__m128 DotGradient(__m128i noise, __m128 dx, __m128 dy, __m128 dz, __m128 dt) noexcept {
+    const __m128 component = _mm_set1_ps(0.5f);
+    const __m128 gx = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(1)), 31)));
+    const __m128 gy = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(2)), 30)));
+    const __m128 gz = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(4)), 29)));
+    const __m128 gt = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(noise, _mm_set1_epi32(8)), 28)));
+    return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(gx, dx), _mm_mul_ps(gy, dy)), _mm_mul_ps(gz, dz)), _mm_mul_ps(gt, dt));
+}
+
+//A simplex corner's faded contribution; zero outside the falloff radius.
+__m128 SimplexCorner(__m128 distanceSquared, __m128 dot) noexcept {
+    __m128 falloff = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(SIMPLEX_RADIUS_SQUARED), distanceSquared), _mm_setzero_ps());
+    falloff = _mm_mul_ps(falloff, falloff);
+    return _mm_mul_ps(_mm_mul_ps(falloff, falloff), dot);
+}
+
+__m128 SimplexCorner(__m128i noise, __m128 dx, __m128 dy) noexcept {
+    const __m128 distance_squared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+    return SimplexCorner(distance_squared, DotGradient(noise, dx, dy));
+}
+
+__m128 SimplexCorner(__m128i noise, __m128 dx, __m128 dy, __m128 dz) noexcept {
+    const __m128 distance_squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+    return SimplexCorner(distance_squared, DotGradient(noise, dx, dy, dz));
+}
+
+__m128 SimplexCorner(__m128i noise, __m128 dx, __m128 dy, __m128 dz, __m128 dt) noexcept {
+    const __m128 distance_squared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)), _mm_mul_ps(dt, dt));
+    return SimplexCorner(distance_squared, DotGradient(noise, dx, dy, dz, dt));
+}
+
+//Corner steps are kept as all-ones masks: as floats they subtract 1.0, as integers they add one to an index.
+__m128 MaskToOne(__m128 mask) noexcept {
+    return _mm_and_ps(mask, _mm_set1_ps(1.0f));
+}
+
+__m128i StepIndex(__m128i index, __m128 mask) noexcept {
+    return _mm_sub_epi32(index, _mm_castps_si128(mask));
+}
+
+__m128 SimplexOctave2d(__m128 x, __m128 y, __m128i seed) noexcept {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 all = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    const __m128 unskew1 = _mm_set1_ps(SIMPLEX_2D_UNSKEW);
+    const __m128 unskew2 = _mm_set1_ps(2.f * SIMPLEX_2D_UNSKEW);
+    const __m128 skew = _mm_mul_ps(_mm_add_ps(x, y), _mm_set1_ps(SIMPLEX_2D_SKEW));
+    __m128i index_x{};
+    __m128i index_y{};
+    const __m128 cell_x = Floor(_mm_add_ps(x, skew), index_x);
+    const __m128 cell_y = Floor(_mm_add_ps(y, skew), index_y);
+    const __m128 unskew = _mm_mul_ps(_mm_add_ps(cell_x, cell_y), unskew1);
+    const __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(cell_x, unskew));
+    const __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(cell_y, unskew));
+    const __m128 step_x = _mm_cmpgt_ps(x0, y0);
+    const __m128 step_y = _mm_andnot_ps(step_x, all);
+    const __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, MaskToOne(step_x)), unskew1);
+    const __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, MaskToOne(step_y)), unskew1);
+    const __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, one), unskew2);
+    const __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, one), unskew2);
+    const __m128i one_i = _mm_set1_epi32(1);
+    const __m128 c0 = SimplexCorner(NoiseUint(index_x, index_y, seed), x0, y0);
+    const __m128 c1 = SimplexCorner(NoiseUint(StepIndex(index_x, step_x), StepIndex(index_y, step_y), seed), x1, y1);
+    const __m128 c2 = SimplexCorner(NoiseUint(_mm_add_epi32(index_x, one_i), _mm_add_epi32(index_y, one_i), seed), x2, y2);
+    return _mm_mul_ps(_mm_set1_ps(SIMPLEX_2D_RANGE), _mm_add_ps(_mm_add_ps(c0, c1), c2));
+}
+
+__m128 SimplexOctave3d(__m128 x, __m128 y, __m128 z, __m128i seed) noexcept {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 all = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    const __m128 unskew1 = _mm_set1_ps(SIMPLEX_3D_UNSKEW);
+    const __m128 unskew2 = _mm_set1_ps(2.f * SIMPLEX_3D_UNSKEW);
+    const __m128 unskew3 = _mm_set1_ps(3.f * SIMPLEX_3D_UNSKEW);
+    const __m128 skew = _mm_mul_ps(_mm_add_ps(_mm_add_ps(x, y), z), _mm_set1_ps(SIMPLEX_3D_SKEW));
+    __m128i index_x{};
+    __m128i index_y{};
+    __m128i index_z{};
+    const __m128 cell_x = Floor(_mm_add_ps(x, skew), index_x);
+    const __m128 cell_y = Floor(_mm_add_ps(y, skew), index_y);
+    const __m128 cell_z = Floor(_mm_add_ps(z, skew), index_z);
+    const __m128 unskew = _mm_mul_ps(_mm_add_ps(_mm_add_ps(cell_x, cell_y), cell_z), unskew1);
+    const __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(cell_x, unskew));
+    const __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(cell_y, unskew));
+    const __m128 z0 = _mm_sub_ps(z, _mm_sub_ps(cell_z, unskew));
+    const __m128 x_beats_y = _mm_cmpge_ps(x0, y0);
+    const __m128 x_beats_z = _mm_cmpge_ps(x0, z0);
+    const __m128 y_beats_z = _mm_cmpge_ps(y0, z0);
+    const __m128 step1_x = _mm_and_ps(x_beats_y, x_beats_z);
+    const __m128 step1_y = _mm_andnot_ps(x_beats_y, y_beats_z);
+    const __m128 step1_z = _mm_andnot_ps(_mm_or_ps(x_beats_z, y_beats_z), all);
+    const __m128 step2_x = _mm_or_ps(x_beats_y, x_beats_z);
+    const __m128 step2_y = _mm_or_ps(_mm_andnot_ps(x_beats_y, all), y_beats_z);
+    const __m128 step2_z = _mm_andnot_ps(_mm_and_ps(x_beats_z, y_beats_z), all);
+    const __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, MaskToOne(step1_x)), unskew1);
+    const __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, MaskToOne(step1_y)), unskew1);
+    const __m128 z1 = _mm_add_ps(_mm_sub_ps(z0, MaskToOne(step1_z)), unskew1);
+    const __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, MaskToOne(step2_x)), unskew2);
+    const __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, MaskToOne(step2_y)), unskew2);
+    const __m128 z2 = _mm_add_ps(_mm_sub_ps(z0, MaskToOne(step2_z)), unskew2);
+    const __m128 x3 = _mm_add_ps(_mm_sub_ps(x0, one), unskew3);
+    const __m128 y3 = _mm_add_ps(_mm_sub_ps(y0, one), unskew3);
+    const __m128 z3 = _mm_add_ps(_mm_sub_ps(z0, one), unskew3);
+    const __m128i one_i = _mm_set1_epi32(1);
+    const __m128 c0 = SimplexCorner(NoiseUint(index_x, index_y, index_z, seed), x0, y0, z0);
+    const __m128 c1 = SimplexCorner(NoiseUint(StepIndex(index_x, step1_x), StepIndex(index_y, step1_y), StepIndex(index_z, step1_z), seed), x1, y1, z1);
+    const __m128 c2 = SimplexCorner(NoiseUint(StepIndex(index_x, step2_x), StepIndex(index_y, step2_y), StepIndex(index_z, step2_z), seed), x2, y2, z2);
+    const __m128 c3 = SimplexCorner(NoiseUint(_mm_add_epi32(index_x, one_i), _mm_add_epi32(index_y, one_i), _mm_add_epi32(index_z, one_i), seed), x3, y3, z3);
+    return _mm_mul_ps(_mm_set1_ps(SIMPLEX_3D_RANGE), _mm_add_ps(_mm_add_ps(_mm_add_ps(c0, c1), c2), c3));
+}
+
+__m128 SimplexOctave4d(__m128 x, __m128 y, __m128 z, __m128 t, __m128i seed) noexcept {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 unskew1 = _mm_set1_ps(SIMPLEX_4D_UNSKEW);
+    const __m128 unskew2 = _mm_set1_ps(2.f * SIMPLEX_4D_UNSKEW);
+    const __m128 unskew3 = _mm_set1_ps(3.f * SIMPLEX_4D_UNSKEW);
+    const __m128 unskew4 = _mm_set1_ps(4.f * SIMPLEX_4D_UNSKEW);
+    const __m128 skew = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(x, y), z), t), _mm_set1_ps(SIMPLEX_4D_SKEW));
+    __m128i index_x{};
+    __m128i index_y{};
+    __m128i index_z{};
+    __m128i index_t{};
+    const __m128 cell_x = Floor(_mm_add_ps(x, skew), index_x);
+    const __m128 cell_y = Floor(_mm_add_ps(y, skew), index_y);
+    const __m128 cell_z = Floor(_mm_add_ps(z, skew), index_z);
+    const __m128 cell_t = Floor(_mm_add_ps(t, skew), index_t);
+    const __m128 unskew = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(cell_x, cell_y), cell_z), cell_t), unskew1);
+    const __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(cell_x, unskew));
+    const __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(cell_y, unskew));
+    const __m128 z0 = _mm_sub_ps(z, _mm_sub_ps(cell_z, unskew));
+    const __m128 t0 = _mm_sub_ps(t, _mm_sub_ps(cell_t, unskew));
+    //Each comparison adds one to the rank of the larger component.
+    const __m128i one_i = _mm_set1_epi32(1);
+    __m128i rank_x = _mm_setzero_si128();
+    __m128i rank_y = _mm_setzero_si128();
+    __m128i rank_z = _mm_setzero_si128();
+    __m128i rank_t = _mm_setzero_si128();
+    const auto compare = [&one_i](__m128 a, __m128 b, __m128i& rank_a, __m128i& rank_b) {
+        const __m128i a_wins = _mm_castps_si128(_mm_cmpgt_ps(a, b));
+        rank_a = _mm_sub_epi32(rank_a, a_wins);
+        rank_b = _mm_add_epi32(rank_b, _mm_add_epi32(a_wins, one_i));
+    };
+    compare(x0, y0, rank_x, rank_y);
+    compare(x0, z0, rank_x, rank_z);
+    compare(x0, t0, rank_x, rank_t);
+    compare(y0, z0, rank_y, rank_z);
+    compare(y0, t0, rank_y, rank_t);
+    compare(z0, t0, rank_z, rank_t);
+    const auto step = [](__m128i rank, int threshold) {
+        return _mm_castsi128_ps(_mm_cmpgt_epi32(rank, _mm_set1_epi32(threshold)));
+    };
+    const __m128 step1_x = step(rank_x, 2);
+    const __m128 step1_y = step(rank_y, 2);
+    const __m128 step1_z = step(rank_z, 2);
+    const __m128 step1_t = step(rank_t, 2);
+    const __m128 step2_x = step(rank_x, 1);
+    const __m128 step2_y = step(rank_y, 1);
+    const __m128 step2_z = step(rank_z, 1);
+    const __m128 step2_t = step(rank_t, 1);
+    const __m128 step3_x = step(rank_x, 0);
+    const __m128 step3_y = step(rank_y, 0);
+    const __m128 step3_z = step(rank_z, 0);
+    const __m128 step3_t = step(rank_t, 0);
+    const __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, MaskToOne(step1_x)), unskew1);
+    const __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, MaskToOne(step1_y)), unskew1);
+    const __m128 z1 = _mm_add_ps(_mm_sub_ps(z0, MaskToOne(step1_z)), unskew1);
+    const __m128 t1 = _mm_add_ps(_mm_sub_ps(t0, MaskToOne(step1_t)), unskew1);
+    const __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, MaskToOne(step2_x)), unskew2);
+    const __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, MaskToOne(step2_y)), unskew2);
+    const __m128 z2 = _mm_add_ps(_mm_sub_ps(z0, MaskToOne(step2_z)), unskew2);
+    const __m128 t2 = _mm_add_ps(_mm_sub_ps(t0, MaskToOne(step2_t)), unskew2);
+    const __m128 x3 = _mm_add_ps(_mm_sub_ps(x0, MaskToOne(step3_x)), unskew3);
+    const __m128 y3 = _mm_add_ps(_mm_sub_ps(y0, MaskToOne(step3_y)), unskew3);
+    const __m128 z3 = _mm_add_ps(_mm_sub_ps(z0, MaskToOne(step3_z)), unskew3);
+    const __m128 t3 = _mm_add_ps(_mm_sub_ps(t0, MaskToOne(step3_t)), unskew3);
+    const __m128 x4 = _mm_add_ps(_mm_sub_ps(x0, one), unskew4);
+    const __m128 y4 = _mm_add_ps(_mm_sub_ps(y0, one), unskew4);
+    const __m128 z4 = _mm_add_ps(_mm_sub_ps(z0, one), unskew4);
+    const __m128 t4 = _mm_add_ps(_mm_sub_ps(t0, one), unskew4);
+    const __m128 c0 = SimplexCorner(NoiseUint(index_x, index_y, index_z, index_t, seed), x0, y0, z0, t0);
+    const __m128 c1 = SimplexCorner(NoiseUint(StepIndex(index_x, step1_x), StepIndex(index_y, step1_y), StepIndex(index_z, step1_z), StepIndex(index_t, step1_t), seed), x1, y1, z1, t1);
+    const __m128 c2 = SimplexCorner(NoiseUint(StepIndex(index_x, step2_x), StepIndex(index_y, step2_y), StepIndex(index_z, step2_z), StepIndex(index_t, step2_t), seed), x2, y2, z2, t2);
+    const __m128 c3 = SimplexCorner(NoiseUint(StepIndex(index_x, step3_x), StepIndex(index_y, step3_y), StepIndex(index_z, step3_z), StepIndex(index_t, step3_t), seed), x3, y3, z3, t3);
+    const __m128 c4 = SimplexCorner(NoiseUint(_mm_add_epi32(index_x, one_i), _mm_add_epi32(index_y, one_i), _mm_add_epi32(index_z, one_i), _mm_add_epi32(index_t, one_i), seed), x4, y4, z4, t4);
+    return _mm_mul_ps(_mm_set1_ps(SIMPLEX_4D_RANGE), _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(c0, c1), c2), c3), c4));
+}
+
+template<NoiseType Type>
+__m128 CellOctave2d(__m128 x, __m128 y, __m128i seed) noexcept {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i one_i = _mm_set1_epi32(1);
+    __m128i west{};
+    __m128i south{};
+    const __m128 min_x = Floor(x, west);
+    const __m128 min_y = Floor(y, south);
+    const __m128i east = _mm_add_epi32(west, one_i);
+    const __m128i north = _mm_add_epi32(south, one_i);
+    const __m128 from_west = _mm_sub_ps(x, min_x);
+    const __m128 from_south = _mm_sub_ps(y, min_y);
+    const __m128 weight_east = SmoothStep3(from_west);
+    const __m128 weight_north = SmoothStep3(from_south);
+    const __m128 weight_west = _mm_sub_ps(one, weight_east);
+    const __m128 weight_south = _mm_sub_ps(one, weight_north);
+    if constexpr(Type == NoiseType::Fractal) {
+        const __m128 sw = ZeroToOne(NoiseUint(west, south, seed));
+        const __m128 se = ZeroToOne(NoiseUint(east, south, seed));
+        const __m128 nw = ZeroToOne(NoiseUint(west, north, seed));
+        const __m128 ne = ZeroToOne(NoiseUint(east, north, seed));
+        const __m128 blend_south = Blend(weight_east, se, weight_west, sw);
+        const __m128 blend_north = Blend(weight_east, ne, weight_west, nw);
+        const __m128 total = Blend(weight_south, blend_south, weight_north, blend_north);
+        return _mm_mul_ps(_mm_set1_ps(2.0f), _mm_sub_ps(total, _mm_set1_ps(0.5f)));
+    } else {
+        const __m128 from_east = _mm_sub_ps(x, _mm_add_ps(min_x, one));
+        const __m128 from_north = _mm_sub_ps(y, _mm_add_ps(min_y, one));
+        const __m128 sw = DotGradient(NoiseUint(west, south, seed), from_west, from_south);
+        const __m128 se = DotGradient(NoiseUint(east, south, seed), from_east, from_south);
+        const __m128 nw = DotGradient(NoiseUint(west, north, seed), from_west, from_north);
+        const __m128 ne = DotGradient(NoiseUint(east, north, seed), from_east, from_north);
+        const __m128 blend_south = Blend(weight_east, se, weight_west, sw);
+        const __m128 blend_north = Blend(weight_east, ne, weight_west, nw);
+        const __m128 total = Blend(weight_south, blend_south, weight_north, blend_north);
+        return _mm_mul_ps(_mm_set1_ps(PERLIN_2D_RANGE), total);
+    }
+}
+
+template<NoiseType Type>
+__m128 CellOctave3d(__m128 x, __m128 y, __m128 z, __m128i seed) noexcept {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i one_i = _mm_set1_epi32(1);
+    __m128i west{};
+    __m128i south{};
+    __m128i below{};
+    const __m128 min_x = Floor(x, west);
+    const __m128 min_y = Floor(y, south);
+    const __m128 min_z = Floor(z, below);
+    const __m128i east = _mm_add_epi32(west, one_i);
+    const __m128i north = _mm_add_epi32(south, one_i);
+    const __m128i above = _mm_add_epi32(below, one_i);
+    const __m128 from_west = _mm_sub_ps(x, min_x);
+    const __m128 from_south = _mm_sub_ps(y, min_y);
+    const __m128 from_below = _mm_sub_ps(z, min_z);
+    const __m128 weight_east = SmoothStep3(from_west);
+    const __m128 weight_north = SmoothStep3(from_south);
+    const __m128 weight_above = SmoothStep3(from_below);
+    const __m128 weight_west = _mm_sub_ps(one, weight_east);
+    const __m128 weight_south = _mm_sub_ps(one, weight_north);
+    const __m128 weight_below = _mm_sub_ps(one, weight_above);
+    __m128 below_sw{};
+    __m128 below_se{};
+    __m128 below_nw{};
+    __m128 below_ne{};
+    __m128 above_sw{};
+    __m128 above_se{};
+    __m128 above_nw{};
+    __m128 above_ne{};
+    if constexpr(Type == NoiseType::Fractal) {
+        below_sw = ZeroToOne(NoiseUint(west, south, below, seed));
+        below_se = ZeroToOne(NoiseUint(east, south, below, seed));
+        below_nw = ZeroToOne(NoiseUint(west, north, below, seed));
+        below_ne = ZeroToOne(NoiseUint(east, north, below, seed));
+        above_sw = ZeroToOne(NoiseUint(west, south, above, seed));
+        above_se = ZeroToOne(NoiseUint(east, south, above, seed));
+        above_nw = ZeroToOne(NoiseUint(west, north, above, seed));
+        above_ne = ZeroToOne(NoiseUint(east, north, above, seed));
+    } else {
+        const __m128 from_east = _mm_sub_ps(x, _mm_add_ps(min_x, one));
+        const __m128 from_north = _mm_sub_ps(y, _mm_add_ps(min_y, one));
+        const __m128 from_above = _mm_sub_ps(z, _mm_add_ps(min_z, one));
+        below_sw = DotGradient(NoiseUint(west, south, below, seed), from_west, from_south, from_below);
+        below_se = DotGradient(NoiseUint(east, south, below, seed), from_east, from_south, from_below);
+        below_nw = DotGradient(NoiseUint(west, north, below, seed), from_west, from_north, from_below);
+        below_ne = DotGradient(NoiseUint(east, north, below, seed), from_east, from_north, from_below);
+        above_sw = DotGradient(NoiseUint(west, south, above, seed), from_west, from_south, from_above);
+        above_se = DotGradient(NoiseUint(east, south, above, seed), from_east, from_south, from_above);
+        above_nw = DotGradient(NoiseUint(west, north, above, seed), from_west, from_north, from_above);
+        above_ne = DotGradient(NoiseUint(east, north, above, seed), from_east, from_north, from_above);
+    }
+    const __m128 blend_below_south = Blend(weight_east, below_se, weight_west, below_sw);
+    const __m128 blend_below_north = Blend(weight_east, below_ne, weight_west, below_nw);
+    const __m128 blend_above_south = Blend(weight_east, above_se, weight_west, above_sw);
+    const __m128 blend_above_north = Blend(weight_east, above_ne, weight_west, above_nw);
+    const __m128 blend_below = Blend(weight_south, blend_below_south, weight_north, blend_below_north);
+    const __m128 blend_above = Blend(weight_south, blend_above_south, weight_north, blend_above_north);
+    const __m128 total = Blend(weight_below, blend_below, weight_above, blend_above);
+    if constexpr(Type == NoiseType::Fractal) {
+        return _mm_mul_ps(_mm_set1_ps(2.0f), _mm_sub_ps(total, _mm_set1_ps(0.5f)));
+    } else {
+        return _mm_mul_ps(_mm_set1_ps(PERLIN_3D_RANGE), total);
+    }
+}
+
+template<NoiseType Type>
+__m128 Octave2d(__m128 x, __m128 y, __m128i seed) noexcept {
+    if constexpr(Type == NoiseType::Simplex) {
+        return SimplexOctave2d(x, y, seed);
+    } else {
+        return CellOctave2d<Type>(x, y, seed);
+    }
+}
+
+template<NoiseType Type>
+__m128 Octave3d(__m128 x, __m128 y, __m128 z, __m128i seed) noexcept {
+    if constexpr(Type == NoiseType::Simplex) {
+        return SimplexOctave3d(x, y, z, seed);
+    } else {
+        return CellOctave3d<Type>(x, y, z, seed);
+    }
+}
+
+__m128 Renormalize(__m128 totalNoise, float totalAmplitude, bool renormalize) noexcept {
+    if(!renormalize || !(totalAmplitude > 0.f)) {
+        return totalNoise;
+    }
+    const __m128 half = _mm_set1_ps(0.5f);
+    totalNoise = _mm_div_ps(totalNoise, _mm_set1_ps(totalAmplitude));
+    totalNoise = _mm_add_ps(_mm_mul_ps(totalNoise, half), half);
+    totalNoise = SmoothStep3(totalNoise);
+    return _mm_sub_ps(_mm_mul_ps(totalNoise, _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f));
+}
+
+template<NoiseType Type>
+__m128 Sample2d(__m128 x, __m128 y, const OctaveSet& octaves) noexcept {
+    const float invScale = 1.f / octaves.scale;
+    const __m128 octave_scale = _mm_set1_ps(octaves.octaveScale);
+    const __m128 offset = _mm_set1_ps(OCTAVE_OFFSET);
+    x = _mm_mul_ps(x, _mm_set1_ps(invScale));
+    y = _mm_mul_ps(y, _mm_set1_ps(invScale));
+    __m128 totalNoise = _mm_setzero_ps();
+    float totalAmplitude = 0.f;
+    float currentAmplitude = 1.f;
+    auto seed = octaves.seed;
+    for(unsigned int octave = 0; octave < octaves.numOctaves; ++octave) {
+        const __m128 noise = Octave2d<Type>(x, y, _mm_set1_epi32(static_cast<int>(seed)));
+        totalNoise = _mm_add_ps(totalNoise, _mm_mul_ps(noise, _mm_set1_ps(currentAmplitude)));
+        totalAmplitude += currentAmplitude;
+        currentAmplitude *= octaves.octavePersistence;
+        x = _mm_add_ps(_mm_mul_ps(x, octave_scale), offset);
+        y = _mm_add_ps(_mm_mul_ps(y, octave_scale), offset);
+        ++seed;
+    }
+    return Renormalize(totalNoise, totalAmplitude, octaves.renormalize);
+}
+
+template<NoiseType Type>
+__m128 Sample3d(__m128 x, __m128 y, __m128 z, const OctaveSet& octaves) noexcept {
+    const float invScale = 1.f / octaves.scale;
+    const __m128 octave_scale = _mm_set1_ps(octaves.octaveScale);
+    const __m128 offset = _mm_set1_ps(OCTAVE_OFFSET);
+    x = _mm_mul_ps(x, _mm_set1_ps(invScale));
+    y = _mm_mul_ps(y, _mm_set1_ps(invScale));
+    z = _mm_mul_ps(z, _mm_set1_ps(invScale));
+    __m128 totalNoise = _mm_setzero_ps();
+    float totalAmplitude = 0.f;
+    float currentAmplitude = 1.f;
+    auto seed = octaves.seed;
+    for(unsigned int octave = 0; octave < octaves.numOctaves; ++octave) {
+        const __m128 noise = Octave3d<Type>(x, y, z, _mm_set1_epi32(static_cast<int>(seed)));
+        totalNoise = _mm_add_ps(totalNoise, _mm_mul_ps(noise, _mm_set1_ps(currentAmplitude)));
+        totalAmplitude += currentAmplitude;
+        currentAmplitude *= octaves.octavePersistence;
+        x = _mm_add_ps(_mm_mul_ps(x, octave_scale), offset);
+        y = _mm_add_ps(_mm_mul_ps(y, octave_scale), offset);
+        z = _mm_add_ps(_mm_mul_ps(z, octave_scale), offset);
+        ++seed;
+    }
+    return Renormalize(totalNoise, totalAmplitude, octaves.renormalize);
+}
+
+__m128 Sample4d(__m128 x, __m128 y, __m128 z, __m128 t, const OctaveSet& octaves) noexcept {
+    const float invScale = 1.f / octaves.scale;
+    const __m128 octave_scale = _mm_set1_ps(octaves.octaveScale);
+    const __m128 offset = _mm_set1_ps(OCTAVE_OFFSET);
+    x = _mm_mul_ps(x, _mm_set1_ps(invScale));
+    y = _mm_mul_ps(y, _mm_set1_ps(invScale));
+    z = _mm_mul_ps(z, _mm_set1_ps(invScale));
+    t = _mm_mul_ps(t, _mm_set1_ps(invScale));
+    __m128 totalNoise = _mm_setzero_ps();
+    float totalAmplitude = 0.f;
+    float currentAmplitude = 1.f;
+    auto seed = octaves.seed;
+    for(unsigned int octave = 0; octave < octaves.numOctaves; ++octave) {
+        const __m128 noise = SimplexOctave4d(x, y, z, t, _mm_set1_epi32(static_cast<int>(seed)));
+        totalNoise = _mm_add_ps(totalNoise, _mm_mul_ps(noise, _mm_set1_ps(currentAmplitude)));
+        totalAmplitude += currentAmplitude;
+        currentAmplitude *= octaves.octavePersistence;
+        x = _mm_add_ps(_mm_mul_ps(x, octave_scale), offset);
+        y = _mm_add_ps(_mm_mul_ps(y, octave_scale), offset);
+        z = _mm_add_ps(_mm_mul_ps(z, octave_scale), offset);
+        t = _mm_add_ps(_mm_mul_ps(t, octave_scale), offset);
+        ++seed;
+    }
+    return Renormalize(totalNoise, totalAmplitude, octaves.renormalize);
+}
+
+#endif
+
+template<NoiseType Type>
+void Batch2d(const float* xs, const float* ys, float* out, std::size_t first, std::size_t last, const OctaveSet& octaves) noexcept {
+    auto i = first;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= last; i += 4) {
+        _mm_storeu_ps(out + i, Sample2d<Type>(_mm_loadu_ps(xs + i), _mm_loadu_ps(ys + i), octaves));
+    }
+#endif
+    for(; i < last; ++i) {
+        out[i] = Sample2d<Type>(xs[i], ys[i], octaves);
+    }
+}
+
+template<NoiseType Type>
+void Batch3d(const float* xs, const float* ys, const float* zs, float* out, std::size_t first, std::size_t last, const OctaveSet& octaves) noexcept {
+    auto i = first;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= last; i += 4) {
+        _mm_storeu_ps(out + i, Sample3d<Type>(_mm_loadu_ps(xs + i), _mm_loadu_ps(ys + i), _mm_loadu_ps(zs + i), octaves));
+    }
+#endif
+    for(; i < last; ++i) {
+        out[i] = Sample3d<Type>(xs[i], ys[i], zs[i], octaves);
+    }
+}
+
+void Batch4d(const float* xs, const float* ys, const float* zs, const float* ts, float* out, std::size_t first, std::size_t last, const OctaveSet& octaves) noexcept {
+    auto i = first;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= last; i += 4) {
+        _mm_storeu_ps(out + i, Sample4d(_mm_loadu_ps(xs + i), _mm_loadu_ps(ys + i), _mm_loadu_ps(zs + i), _mm_loadu_ps(ts + i), octaves));
+    }
+#endif
+    for(; i < last; ++i) {
+        out[i] = Sample4d(xs[i], ys[i], zs[i], ts[i], octaves);
+    }
+}
+
+//One grid row at a fixed y (and z). Column positions are generated in registers.
+template<NoiseType Type>
+void Row2d(float* out, std::size_t width, float originX, float spacingX, float y, const OctaveSet& octaves) noexcept {
+    std::size_t x = 0;
+#ifdef MATH_SIMD_SSE
+    const __m128 origin = _mm_set1_ps(originX);
+    const __m128 spacing = _mm_set1_ps(spacingX);
+    const __m128 row_y = _mm_set1_ps(y);
+    __m128 column = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    for(; x + 4 <= width; x += 4) {
+        _mm_storeu_ps(out + x, Sample2d<Type>(_mm_add_ps(origin, _mm_mul_ps(spacing, column)), row_y, octaves));
+        column = _mm_add_ps(column, _mm_set1_ps(4.0f));
+    }
+#endif
+    for(; x < width; ++x) {
+        out[x] = Sample2d<Type>(originX + spacingX * static_cast<float>(x), y, octaves);
+    }
+}
+
+template<NoiseType Type>
+void Row3d(float* out, std::size_t width, float originX, float spacingX, float y, float z, const OctaveSet& octaves) noexcept {
+    std::size_t x = 0;
+#ifdef MATH_SIMD_SSE
+    const __m128 origin = _mm_set1_ps(originX);
+    const __m128 spacing = _mm_set1_ps(spacingX);
+    const __m128 row_y = _mm_set1_ps(y);
+    const __m128 row_z = _mm_set1_ps(z);
+    __m128 column = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    for(; x + 4 <= width; x += 4) {
+        _mm_storeu_ps(out + x, Sample3d<Type>(_mm_add_ps(origin, _mm_mul_ps(spacing, column)), row_y, row_z, octaves));
+        column = _mm_add_ps(column, _mm_set1_ps(4.0f));
+    }
+#endif
+    for(; x < width; ++x) {
+        out[x] = Sample3d<Type>(originX + spacingX * static_cast<float>(x), y, z, octaves);
+    }
+}
+
+template<typename Kernel>
+void Run(std::size_t count, std::size_t minJobSize, JobSystem* jobSystem, const Kernel& kernel) noexcept {
+    if(!count) {
+        return;
+    }
+    if(jobSystem) {
+        jobSystem->ParallelFor(count, minJobSize, kernel);
+    } else {
+        kernel(0, count);
+    }
+}
+
+template<NoiseType Type>
+void Compute2d(const float* xs, const float* ys, float* out, std::size_t count, const OctaveSet& octaves, JobSystem* jobSystem) noexcept {
+    Run(count, MIN_NOISE_JOB_SIZE, jobSystem, [&](std::size_t first, std::size_t last) {
+        Batch2d<Type>(xs, ys, out, first, last, octaves);
+    });
+}
+
+template<NoiseType Type>
+void Compute3d(const float* xs, const float* ys, const float* zs, float* out, std::size_t count, const OctaveSet& octaves, JobSystem* jobSystem) noexcept {
+    Run(count, MIN_NOISE_JOB_SIZE, jobSystem, [&](std::size_t first, std::size_t last) {
+        Batch3d<Type>(xs, ys, zs, out, first, last, octaves);
+    });
+}
+
+void Compute4d(const float* xs, const float* ys, const float* zs, const float* ts, float* out, std::size_t count, const OctaveSet& octaves, JobSystem* jobSystem) noexcept {
+    Run(count, MIN_NOISE_JOB_SIZE, jobSystem, [&](std::size_t first, std::size_t last) {
+        Batch4d(xs, ys, zs, ts, out, first, last, octaves);
+    });
+}
+
+template<NoiseType Type>
+void Fill2d(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, const OctaveSet& octaves, JobSystem* jobSystem) noexcept {
+    if(!width) {
+        return;
+    }
+    const auto min_rows = (std::max)(std::size_t{1}, MIN_NOISE_JOB_SIZE / width);
+    Run(height, min_rows, jobSystem, [&](std::size_t first, std::size_t last) {
+        for(auto row = first; row < last; ++row) {
+            const float y = origin.y + spacing.y * static_cast<float>(row);
+            Row2d<Type>(out + row * width, width, origin.x, spacing.x, y, octaves);
+        }
+    });
+}
+
+template<NoiseType Type>
+void Fill3d(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, const OctaveSet& octaves, JobSystem* jobSystem) noexcept {
+    if(!width || !height) {
+        return;
+    }
+    const auto min_rows = (std::max)(std::size_t{1}, MIN_NOISE_JOB_SIZE / width);
+    Run(height * depth, min_rows, jobSystem, [&](std::size_t first, std::size_t last) {
+        for(auto row = first; row < last; ++row) {
+            const float y = origin.y + spacing.y * static_cast<float>(row % height);
+            const float z = origin.z + spacing.z * static_cast<float>(row / height);
+            Row3d<Type>(out + row * width, width, origin.x, spacing.x, y, z, octaves);
+        }
+    });
+}
+
+} //End anonymous
+
+namespace MathUtils {
+
+void Compute2dFractalNoise(const float* posXs, const float* posYs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute2d<NoiseType::Fractal>(posXs, posYs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Compute2dPerlinNoise(const float* posXs, const float* posYs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute2d<NoiseType::Perlin>(posXs, posYs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Compute3dFractalNoise(const float* posXs, const float* posYs, const float* posZs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute3d<NoiseType::Fractal>(posXs, posYs, posZs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Compute3dPerlinNoise(const float* posXs, const float* posYs, const float* posZs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute3d<NoiseType::Perlin>(posXs, posYs, posZs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Compute2dSimplexNoise(const float* posXs, const float* posYs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute2d<NoiseType::Simplex>(posXs, posYs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Compute3dSimplexNoise(const float* posXs, const float* posYs, const float* posZs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute3d<NoiseType::Simplex>(posXs, posYs, posZs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Compute4dSimplexNoise(const float* posXs, const float* posYs, const float* posZs, const float* posTs, float* out, std::size_t count, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Compute4d(posXs, posYs, posZs, posTs, out, count, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Fill2dFractalNoise(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Fill2d<NoiseType::Fractal>(out, width, height, origin, spacing, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Fill2dPerlinNoise(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Fill2d<NoiseType::Perlin>(out, width, height, origin, spacing, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Fill3dFractalNoise(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Fill3d<NoiseType::Fractal>(out, width, height, depth, origin, spacing, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Fill3dPerlinNoise(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Fill3d<NoiseType::Perlin>(out, width, height, depth, origin, spacing, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Fill2dSimplexNoise(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Fill2d<NoiseType::Simplex>(out, width, height, origin, spacing, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+void Fill3dSimplexNoise(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, float scale /*= 1.f*/, unsigned int numOctaves /*= 1*/, float octavePersistence /*= 0.5f*/, float octaveScale /*= 2.f*/, bool renormalize /*= true*/, unsigned int seed /*= 0*/, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    Fill3d<NoiseType::Simplex>(out, width, height, depth, origin, spacing, OctaveSet{scale, numOctaves, octavePersistence, octaveScale, renormalize, seed}, jobSystem);
+}
+
+
+} //End MathUtils
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+class JobSystem;
+class Vector2;
+class Vector3;
+
+//Batch and grid forms of the smooth ("fractal"), Perlin and simplex noise functions in Noise.hpp.
+//The parameters mean the same as in the single point versions and every result is bit-identical
+//to calling them point by point. Points are evaluated four at a time with SSE when available.
+//With a JobSystem the points (or grid rows) are split across its workers.
+namespace MathUtils {
+
+//Samples the points (posXs[i], posYs[i]) into out[i].
+void Compute2dFractalNoise(const float* posXs, const float* posYs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Compute2dPerlinNoise(const float* posXs, const float* posYs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Compute2dSimplexNoise(const float* posXs, const float* posYs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+
+//Samples the points (posXs[i], posYs[i], posZs[i]) into out[i].
+void Compute3dFractalNoise(const float* posXs, const float* posYs, const float* posZs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Compute3dPerlinNoise(const float* posXs, const float* posYs, const float* posZs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Compute3dSimplexNoise(const float* posXs, const float* posYs, const float* posZs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+
+//Samples the points (posXs[i], posYs[i], posZs[i], posTs[i]) into out[i].
+void Compute4dSimplexNoise(const float* posXs, const float* posYs, const float* posZs, const float* posTs, float* out, std::size_t count, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+
+//Fills a width x height buffer, x fastest. out[y * width + x] is the noise at
+//(origin.x + spacing.x * x, origin.y + spacing.y * y).
+void Fill2dFractalNoise(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Fill2dPerlinNoise(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Fill2dSimplexNoise(float* out, std::size_t width, std::size_t height, const Vector2& origin, const Vector2& spacing, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+
+//Fills a width x height x depth buffer, x fastest then y. out[(z * height + y) * width + x] is the noise at
+//(origin.x + spacing.x * x, origin.y + spacing.y * y, origin.z + spacing.z * z).
+void Fill3dFractalNoise(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Fill3dPerlinNoise(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+void Fill3dSimplexNoise(float* out, std::size_t width, std::size_t height, std::size_t depth, const Vector3& origin, const Vector3& spacing, float scale = 1.f, unsigned int numOctaves = 1, float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, JobSystem* jobSystem = nullptr) noexcept;
+
+} //End MathUtils
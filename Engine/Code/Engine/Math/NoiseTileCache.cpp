@@ -0,0 +1,250 @@
+#include "Engine/Math/NoiseTileCache.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/NoiseField.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+namespace {
+
+void HashCombine(std::size_t& seed, std::size_t value) noexcept {
+    seed ^= value + 0x9E3779B9u + (seed << 6) + (seed >> 2);
+}
+
+} //End anonymous
+
+bool NoiseTileCache::noise_settings_t::operator==(const noise_settings_t& rhs) const noexcept {
+    return type == rhs.type
+        && scale == rhs.scale
+        && numOctaves == rhs.numOctaves
+        && octavePersistence == rhs.octavePersistence
+        && octaveScale == rhs.octaveScale
+        && renormalize == rhs.renormalize
+        && seed == rhs.seed;
+}
+
+bool NoiseTileCache::noise_settings_t::operator!=(const noise_settings_t& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+float NoiseTileCache::stats_t::GetHitRate() const noexcept {
+    return lookups ? static_cast<float>(static_cast<double>(hits) / static_cast<double>(lookups)) : 0.0f;
+}
+
+bool NoiseTileCache::tile_key_t::operator==(const tile_key_t& rhs) const noexcept {
+    return coords == rhs.coords && settings == rhs.settings;
+}
+
+std::size_t NoiseTileCache::tile_key_hash_t::operator()(const tile_key_t& key) const noexcept {
+    std::size_t seed = std::hash<int>{}(key.coords.x);
+    HashCombine(seed, std::hash<int>{}(key.coords.y));
+    HashCombine(seed, std::hash<int>{}(static_cast<int>(key.settings.type)));
+    HashCombine(seed, std::hash<float>{}(key.settings.scale));
+    HashCombine(seed, std::hash<unsigned int>{}(key.settings.numOctaves));
+    HashCombine(seed, std::hash<float>{}(key.settings.octavePersistence));
+    HashCombine(seed, std::hash<float>{}(key.settings.octaveScale));
+    HashCombine(seed, std::hash<bool>{}(key.settings.renormalize));
+    HashCombine(seed, std::hash<unsigned int>{}(key.settings.seed));
+    return seed;
+}
+
+NoiseTileCache::NoiseTileCache(float tileSize, std::size_t samplesPerEdge, std::size_t memoryBudgetBytes, JobSystem* jobSystem /*= nullptr*/) noexcept
+    : _tile_size((std::max)(tileSize, 0.0001f))
+    , _inv_tile_size(1.0f / _tile_size)
+    , _samples_per_edge((std::max)(samplesPerEdge, std::size_t{2}))
+    , _tile_capacity((std::max)(memoryBudgetBytes / (_samples_per_edge * _samples_per_edge * sizeof(float)), std::size_t{1}))
+    , _job_system(jobSystem)
+    , _counters(std::make_shared<compute_counters_t>())
+{
+    /* DO NOTHING */
+}
+
+float NoiseTileCache::Sample(const noise_settings_t& settings, const Vector2& position) noexcept {
+    const tile_key_t key{settings, CalcTileCoords(position)};
+    const auto& tile = AcquireTile(key);
+    return Interpolate(tile, key.coords, position);
+}
+
+void NoiseTileCache::Sample(const noise_settings_t& settings, const Vector2* positions, float* out, std::size_t count) noexcept {
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i] = Sample(settings, positions[i]);
+    }
+}
+
+void NoiseTileCache::Prefetch(const noise_settings_t& settings, const AABB2& region) noexcept {
+    const auto mins = CalcTileCoords(region.mins);
+    const auto maxs = CalcTileCoords(region.maxs);
+    for(int y = mins.y; y <= maxs.y; ++y) {
+        for(int x = mins.x; x <= maxs.x; ++x) {
+            const tile_key_t key{settings, IntVector2{x, y}};
+            const auto found = _tiles.find(key);
+            if(found != std::end(_tiles)) {
+                _lru.splice(std::begin(_lru), _lru, found->second);
+                continue;
+            }
+            const auto entry = RequestTile(key);
+            auto tile = entry->tile;
+            if(!_job_system) {
+                TryClaim(*tile);
+                ComputeTile(*tile, key, _tile_size, _samples_per_edge, *_counters);
+                continue;
+            }
+            _job_system->Run(JobType::Generic, [tile, key, tile_size = _tile_size, samples_per_edge = _samples_per_edge, counters = _counters](void*) {
+                if(TryClaim(*tile)) {
+                    ComputeTile(*tile, key, tile_size, samples_per_edge, *counters);
+                }
+            }, nullptr);
+        }
+    }
+}
+
+bool NoiseTileCache::IsResident(const noise_settings_t& settings, const Vector2& position) const noexcept {
+    const auto found = _tiles.find(tile_key_t{settings, CalcTileCoords(position)});
+    return found != std::end(_tiles) && found->second->tile->state.load(std::memory_order_acquire) == TileState::Ready;
+}
+
+void NoiseTileCache::Clear() noexcept {
+    _last_tile = nullptr;
+    _tiles.clear();
+    _lru.clear();
+}
+
+float NoiseTileCache::GetTileSize() const noexcept {
+    return _tile_size;
+}
+
+std::size_t NoiseTileCache::GetSamplesPerEdge() const noexcept {
+    return _samples_per_edge;
+}
+
+std::size_t NoiseTileCache::GetTileBytes() const noexcept {
+    return _samples_per_edge * _samples_per_edge * sizeof(float);
+}
+
+std::size_t NoiseTileCache::GetTileCapacity() const noexcept {
+    return _tile_capacity;
+}
+
+NoiseTileCache::stats_t NoiseTileCache::GetStats() const noexcept {
+    auto stats = _stats;
+    stats.tiles_computed = _counters->tiles_computed.load();
+    stats.total_compute_time = std::chrono::nanoseconds{_counters->compute_nanoseconds.load()};
+    stats.resident_tiles = _lru.size();
+    stats.resident_bytes = _lru.size() * GetTileBytes();
+    return stats;
+}
+
+void NoiseTileCache::ResetStats() noexcept {
+    _stats = stats_t{};
+    _counters->tiles_computed = 0;
+    _counters->compute_nanoseconds = 0;
+}
+
+IntVector2 NoiseTileCache::CalcTileCoords(const Vector2& position) const noexcept {
+    return IntVector2{static_cast<int>(std::floor(position.x * _inv_tile_size)), static_cast<int>(std::floor(position.y * _inv_tile_size))};
+}
+
+NoiseTileCache::tile_t& NoiseTileCache::AcquireTile(const tile_key_t& key) noexcept {
+    ++_stats.lookups;
+    //Neighbouring lookups usually land in the same tile, which is already ready and most recently used.
+    if(_last_tile && key == _last_key) {
+        ++_stats.hits;
+        return *_last_tile;
+    }
+    const auto found = _tiles.find(key);
+    auto entry = found != std::end(_tiles) ? found->second : RequestTile(key);
+    _lru.splice(std::begin(_lru), _lru, entry);
+    auto& tile = *entry->tile;
+    if(tile.state.load(std::memory_order_acquire) == TileState::Ready) {
+        ++_stats.hits;
+    } else {
+        ++_stats.misses;
+        const auto start = TimeUtils::Now();
+        if(TryClaim(tile)) {
+            ComputeTile(tile, key, _tile_size, _samples_per_edge, *_counters);
+        } else {
+            WaitForTile(tile);
+        }
+        const auto latency = TimeUtils::FPMicroseconds{TimeUtils::Now() - start};
+        _stats.total_miss_latency += latency;
+        _stats.max_miss_latency = (std::max)(_stats.max_miss_latency, latency);
+    }
+    _last_key = key;
+    _last_tile = &tile;
+    return tile;
+}
+
+NoiseTileCache::lru_t::iterator NoiseTileCache::RequestTile(const tile_key_t& key) noexcept {
+    ++_stats.tiles_requested;
+    _lru.push_front(entry_t{key, std::make_shared<tile_t>()});
+    _tiles[key] = std::begin(_lru);
+    EvictOverBudget();
+    return std::begin(_lru);
+}
+
+void NoiseTileCache::EvictOverBudget() noexcept {
+    while(_lru.size() > _tile_capacity) {
+        const auto& oldest = _lru.back();
+        if(_last_tile == oldest.tile.get()) {
+            _last_tile = nullptr;
+        }
+        _tiles.erase(oldest.key);
+        _lru.pop_back();
+        ++_stats.evictions;
+    }
+}
+
+void NoiseTileCache::WaitForTile(tile_t& tile) noexcept {
+    while(tile.state.load(std::memory_order_acquire) != TileState::Ready) {
+        std::this_thread::yield();
+    }
+}
+
+float NoiseTileCache::Interpolate(const tile_t& tile, const IntVector2& coords, const Vector2& position) const noexcept {
+    const auto last = static_cast<float>(_samples_per_edge - 1);
+    const auto u = std::clamp((position.x * _inv_tile_size - static_cast<float>(coords.x)) * last, 0.0f, last);
+    const auto v = std::clamp((position.y * _inv_tile_size - static_cast<float>(coords.y)) * last, 0.0f, last);
+    const auto x = (std::min)(static_cast<std::size_t>(u), _samples_per_edge - 2);
+    const auto y = (std::min)(static_cast<std::size_t>(v), _samples_per_edge - 2);
+    const auto tx = u - static_cast<float>(x);
+    const auto ty = v - static_cast<float>(y);
+    const auto* row = tile.values.data() + y * _samples_per_edge + x;
+    const auto bottom = MathUtils::Interpolate(row[0], row[1], tx);
+    const auto top = MathUtils::Interpolate(row[_samples_per_edge], row[_samples_per_edge + 1], tx);
+    return MathUtils::Interpolate(bottom, top, ty);
+}
+
+bool NoiseTileCache::TryClaim(tile_t& tile) noexcept {
+    auto expected = TileState::Queued;
+    return tile.state.compare_exchange_strong(expected, TileState::Computing, std::memory_order_acq_rel);
+}
+
+void NoiseTileCache::ComputeTile(tile_t& tile, const tile_key_t& key, float tileSize, std::size_t samplesPerEdge, compute_counters_t& counters) noexcept {
+    const auto start = TimeUtils::Now();
+    tile.values.resize(samplesPerEdge * samplesPerEdge);
+    const Vector2 origin{static_cast<float>(key.coords.x) * tileSize, static_cast<float>(key.coords.y) * tileSize};
+    const auto step = tileSize / static_cast<float>(samplesPerEdge - 1);
+    const Vector2 spacing{step, step};
+    const auto& s = key.settings;
+    switch(s.type) {
+    case NoiseType::Fractal:
+        MathUtils::Fill2dFractalNoise(tile.values.data(), samplesPerEdge, samplesPerEdge, origin, spacing, s.scale, s.numOctaves, s.octavePersistence, s.octaveScale, s.renormalize, s.seed);
+        break;
+    case NoiseType::Perlin:
+        MathUtils::Fill2dPerlinNoise(tile.values.data(), samplesPerEdge, samplesPerEdge, origin, spacing, s.scale, s.numOctaves, s.octavePersistence, s.octaveScale, s.renormalize, s.seed);
+        break;
+    case NoiseType::Simplex:
+        MathUtils::Fill2dSimplexNoise(tile.values.data(), samplesPerEdge, samplesPerEdge, origin, spacing, s.scale, s.numOctaves, s.octavePersistence, s.octaveScale, s.renormalize, s.seed);
+        break;
+    }
+    counters.compute_nanoseconds += static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(TimeUtils::Now() - start).count());
+    ++counters.tiles_computed;
+    tile.state.store(TileState::Ready, std::memory_order_release);
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Math/IntVector2.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class AABB2;
+class JobSystem;
+
+//Caches 2D noise in square tiles for streaming worlds that sample overlapping regions every frame.
+//Tiles are keyed by noise settings and tile coordinate, filled with the NoiseField grid functions
+//on JobSystem workers, and evicted least recently used once the memory budget is reached.
+//Each tile stores samplesPerEdge x samplesPerEdge samples including both edges, so lookups
+//interpolate bilinearly within one tile. The stored samples are exactly the Compute2d*Noise values.
+//Prefetch queues tiles ahead of use. A lookup on a tile that is still queued computes it on the
+//calling thread; one on a tile a worker is computing waits for it. Without a JobSystem, Prefetch
+//computes the tiles immediately. Lookups and prefetches must come from one thread at a time.
+class NoiseTileCache {
+public:
+    enum class NoiseType {
+        Fractal
+        ,Perlin
+        ,Simplex
+    };
+
+    //The parameters of the matching Compute2d*Noise function.
+    struct noise_settings_t {
+        NoiseType type = NoiseType::Perlin;
+        float scale = 1.0f;
+        unsigned int numOctaves = 1;
+        float octavePersistence = 0.5f;
+        float octaveScale = 2.0f;
+        bool renormalize = true;
+        unsigned int seed = 0;
+        bool operator==(const noise_settings_t& rhs) const noexcept;
+        bool operator!=(const noise_settings_t& rhs) const noexcept;
+    };
+
+    struct stats_t {
+        std::uint64_t lookups = 0;
+        //Lookups that found their tile ready. Misses computed the tile or waited for a worker.
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t tiles_requested = 0;
+        std::uint64_t tiles_computed = 0;
+        std::uint64_t evictions = 0;
+        std::size_t resident_tiles = 0;
+        std::size_t resident_bytes = 0;
+        TimeUtils::FPMicroseconds total_miss_latency{};
+        TimeUtils::FPMicroseconds max_miss_latency{};
+        TimeUtils::FPMicroseconds total_compute_time{};
+        float GetHitRate() const noexcept;
+    };
+
+    NoiseTileCache(float tileSize, std::size_t samplesPerEdge, std::size_t memoryBudgetBytes, JobSystem* jobSystem = nullptr) noexcept;
+    ~NoiseTileCache() = default;
+
+    NoiseTileCache() = delete;
+    NoiseTileCache(const NoiseTileCache&) = delete;
+    NoiseTileCache(NoiseTileCache&&) = delete;
+    NoiseTileCache& operator=(const NoiseTileCache&) = delete;
+    NoiseTileCache& operator=(NoiseTileCache&&) = delete;
+
+    float Sample(const noise_settings_t& settings, const Vector2& position) noexcept;
+    void Sample(const noise_settings_t& settings, const Vector2* positions, float* out, std::size_t count) noexcept;
+
+    //Requests every tile that overlaps region.
+    void Prefetch(const noise_settings_t& settings, const AABB2& region) noexcept;
+    bool IsResident(const noise_settings_t& settings, const Vector2& position) const noexcept;
+    void Clear() noexcept;
+
+    float GetTileSize() const noexcept;
+    std::size_t GetSamplesPerEdge() const noexcept;
+    std::size_t GetTileBytes() const noexcept;
+    std::size_t GetTileCapacity() const noexcept;
+
+    stats_t GetStats() const noexcept;
+    void ResetStats() noexcept;
+
+private:
+    enum class TileState : int {
+        Queued
+        ,Computing
+        ,Ready
+    };
+
+    struct tile_key_t {
+        noise_settings_t settings{};
+        IntVector2 coords{};
+        bool operator==(const tile_key_t& rhs) const noexcept;
+    };
+
+    struct tile_key_hash_t {
+        std::size_t operator()(const tile_key_t& key) const noexcept;
+    };
+
+    struct tile_t {
+        std::vector<float> values{};
+        std::atomic<TileState> state{TileState::Queued};
+    };
+
+    //Shared with queued jobs, which may finish after the cache is gone.
+    struct compute_counters_t {
+        std::atomic_uint64_t tiles_computed{0};
+        std::atomic_uint64_t compute_nanoseconds{0};
+    };
+
+    struct entry_t {
+        tile_key_t key{};
+        std::shared_ptr<tile_t> tile{};
+    };
+
+    using lru_t = std::list<entry_t>;
+
+    IntVector2 CalcTileCoords(const Vector2& position) const noexcept;
+    tile_t& AcquireTile(const tile_key_t& key) noexcept;
+    lru_t::iterator RequestTile(const tile_key_t& key) noexcept;
+    void EvictOverBudget() noexcept;
+    void WaitForTile(tile_t& tile) noexcept;
+    float Interpolate(const tile_t& tile, const IntVector2& coords, const Vector2& position) const noexcept;
+
+    static bool TryClaim(tile_t& tile) noexcept;
+    static void ComputeTile(tile_t& tile, const tile_key_t& key, float tileSize, std::size_t samplesPerEdge, compute_counters_t& counters) noexcept;
+
+    float _tile_size = 1.0f;
+    float _inv_tile_size = 1.0f;
+    std::size_t _samples_per_edge = 2;
+    std::size_t _tile_capacity = 1;
+    JobSystem* _job_system = nullptr;
+    lru_t _lru{};
+    std::unordered_map<tile_key_t, lru_t::iterator, tile_key_hash_t> _tiles{};
+    tile_key_t _last_key{};
+    tile_t* _last_tile = nullptr;
+    std::shared_ptr<compute_counters_t> _counters{};
+    stats_t _stats{};
+};
@@ -0,0 +1,81 @@
+#include "Engine/Math/OBB3.hpp"
+
+#include "Engine/Math/AABB3.hpp"
+
+OBB3::OBB3(const Vector3& center, const Vector3& halfExtents) noexcept
+    : half_extents(halfExtents)
+    , position(center)
+{
+    /* DO NOTHING */
+}
+
+OBB3::OBB3(const Vector3& center, const Vector3& halfExtents, const Vector3& right, const Vector3& up, const Vector3& forward) noexcept
+    : half_extents(halfExtents)
+    , position(center)
+    , right(right)
+    , up(up)
+    , forward(forward)
+{
+    /* DO NOTHING */
+}
+
+OBB3::OBB3(const AABB3& aabb) noexcept
+    : half_extents(aabb.CalcDimensions() * 0.5f)
+    , position(aabb.CalcCenter())
+{
+    /* DO NOTHING */
+}
+
+void OBB3::AddPaddingToSides(float paddingX, float paddingY, float paddingZ) noexcept {
+    AddPaddingToSides(Vector3{paddingX, paddingY, paddingZ});
+}
+
+void OBB3::AddPaddingToSides(const Vector3& padding) noexcept {
+    half_extents += padding;
+}
+
+void OBB3::Translate(const Vector3& translation) noexcept {
+    position += translation;
+}
+
+Vector3 OBB3::GetRight() const noexcept {
+    return right;
+}
+
+Vector3 OBB3::GetUp() const noexcept {
+    return up;
+}
+
+Vector3 OBB3::GetForward() const noexcept {
+    return forward;
+}
+
+Vector3 OBB3::CalcDimensions() const noexcept {
+    return half_extents * 2.0f;
+}
+
+Vector3 OBB3::CalcCenter() const noexcept {
+    return position;
+}
+
+float OBB3::CalcVolume() const noexcept {
+    return 8.0f * half_extents.x * half_extents.y * half_extents.z;
+}
+
+OBB3 OBB3::operator+(const Vector3& translation) const noexcept {
+    return OBB3(position + translation, half_extents, right, up, forward);
+}
+
+OBB3 OBB3::operator-(const Vector3& antiTranslation) const noexcept {
+    return OBB3(position - antiTranslation, half_extents, right, up, forward);
+}
+
+OBB3& OBB3::operator+=(const Vector3& translation) noexcept {
+    position += translation;
+    return *this;
+}
+
+OBB3& OBB3::operator-=(const Vector3& antiTranslation) noexcept {
+    position -= antiTranslation;
+    return *this;
+}
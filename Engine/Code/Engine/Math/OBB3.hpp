@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Engine/Math/Vector3.hpp"
+
+class AABB3;
+
+//Box with arbitrary orientation. right, up and forward are unit length and perpendicular;
+//half_extents are measured along them.
+class OBB3 {
+public:
+
+    Vector3 half_extents{};
+    Vector3 position{};
+    Vector3 right = Vector3::X_AXIS;
+    Vector3 up = Vector3::Y_AXIS;
+    Vector3 forward = Vector3::Z_AXIS;
+
+    OBB3() = default;
+    OBB3(const OBB3& other) = default;
+    OBB3(OBB3&& other) = default;
+    OBB3& operator=(const OBB3& other) = default;
+    OBB3& operator=(OBB3&& other) = default;
+    OBB3(const Vector3& center, const Vector3& halfExtents) noexcept;
+    OBB3(const Vector3& center, const Vector3& halfExtents, const Vector3& right, const Vector3& up, const Vector3& forward) noexcept;
+    OBB3(const AABB3& aabb) noexcept;
+    ~OBB3() = default;
+
+    void AddPaddingToSides(float paddingX, float paddingY, float paddingZ) noexcept;
+    void AddPaddingToSides(const Vector3& padding) noexcept;
+    void Translate(const Vector3& translation) noexcept;
+
+    Vector3 GetRight() const noexcept;
+    Vector3 GetUp() const noexcept;
+    Vector3 GetForward() const noexcept;
+
+    Vector3 CalcDimensions() const noexcept;
+    Vector3 CalcCenter() const noexcept;
+    float CalcVolume() const noexcept;
+
+    OBB3 operator+(const Vector3& translation) const noexcept;
+    OBB3 operator-(const Vector3& antiTranslation) const noexcept;
+    OBB3& operator+=(const Vector3& translation) noexcept;
+    OBB3& operator-=(const Vector3& antiTranslation) noexcept;
+
+protected:
+private:
+};
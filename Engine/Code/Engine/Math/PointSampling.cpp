@@ -0,0 +1,313 @@
+#include "Engine/Math/PointSampling.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Random.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+template<std::size_t D>
+using point_t = std::array<float, D>;
+
+template<std::size_t D>
+struct domain_t {
+    point_t<D> mins{};
+    point_t<D> maxs{};
+    //Wrapped domains measure distance across opposite faces.
+    bool wrap = false;
+};
+
+template<std::size_t D>
+class BackgroundGrid {
+public:
+    BackgroundGrid(const domain_t<D>& domain, float minDistance) noexcept
+        : _domain(domain)
+    {
+        //At most one point fits in a cell no wider than minDistance / sqrt(D).
+        const auto max_cell_size = minDistance / std::sqrt(static_cast<float>(D));
+        std::size_t cell_count = 1;
+        for(std::size_t d = 0; d < D; ++d) {
+            const auto extent = domain.maxs[d] - domain.mins[d];
+            _counts[d] = (std::max)(1, static_cast<int>(std::ceil(extent / max_cell_size)));
+            //A wrapped grid has to tile the domain exactly.
+            _cell_sizes[d] = domain.wrap ? extent / static_cast<float>(_counts[d]) : max_cell_size;
+            _reach[d] = (std::min)(static_cast<int>(std::ceil(minDistance / _cell_sizes[d])), static_cast<int>(MAX_SPAN / 2));
+            cell_count *= static_cast<std::size_t>(_counts[d]);
+        }
+        point_t<D> empty{};
+        empty.fill(std::numeric_limits<float>::infinity());
+        _cells.assign(cell_count, empty);
+    }
+
+    void Insert(const point_t<D>& point) noexcept {
+        _cells[CellIndex(CalcCell(point))] = point;
+    }
+
+    //True if no inserted point is closer than minDistance to candidate.
+    bool HasRoom(const point_t<D>& candidate, float minDistanceSquared) const noexcept {
+        const auto center = CalcCell(candidate);
+        //Cell coordinates to visit along each axis, wrapped or clipped to the grid.
+        std::array<std::array<std::size_t, MAX_SPAN>, D> spans{};
+        std::array<std::size_t, D> span_sizes{};
+        for(std::size_t d = 0; d < D; ++d) {
+            const auto reach = _reach[d];
+            //A wrapped neighbourhood as wide as the grid is the whole row; visit each cell once.
+            if(_domain.wrap && _counts[d] <= 2 * reach + 1) {
+                for(int cell = 0; cell < _counts[d]; ++cell) {
+                    spans[d][span_sizes[d]++] = static_cast<std::size_t>(cell);
+                }
+                continue;
+            }
+            for(int offset = -reach; offset <= reach; ++offset) {
+                auto cell = center[d] + offset;
+                if(_domain.wrap) {
+                    cell = (cell + _counts[d]) % _counts[d];
+                } else if(cell < 0 || _counts[d] <= cell) {
+                    continue;
+                }
+                spans[d][span_sizes[d]++] = static_cast<std::size_t>(cell);
+            }
+        }
+        //Empty cells hold a point at infinity, which is never too close.
+        const auto fits = [&](std::size_t index) {
+            return minDistanceSquared <= DistanceSquared(candidate, _cells[index]);
+        };
+        const auto row = static_cast<std::size_t>(_counts[0]);
+        if constexpr(D == 2) {
+            for(std::size_t y = 0; y < span_sizes[1]; ++y) {
+                for(std::size_t x = 0; x < span_sizes[0]; ++x) {
+                    if(!fits(spans[1][y] * row + spans[0][x])) {
+                        return false;
+                    }
+                }
+            }
+        } else {
+            const auto slice = row * static_cast<std::size_t>(_counts[1]);
+            for(std::size_t z = 0; z < span_sizes[2]; ++z) {
+                for(std::size_t y = 0; y < span_sizes[1]; ++y) {
+                    for(std::size_t x = 0; x < span_sizes[0]; ++x) {
+                        if(!fits(spans[2][z] * slice + spans[1][y] * row + spans[0][x])) {
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    float DistanceSquared(const point_t<D>& a, const point_t<D>& b) const noexcept {
+        float result = 0.0f;
+        for(std::size_t d = 0; d < D; ++d) {
+            auto delta = std::abs(a[d] - b[d]);
+            if(_domain.wrap) {
+                delta = (std::min)(delta, (_domain.maxs[d] - _domain.mins[d]) - delta);
+            }
+            result += delta * delta;
+        }
+        return result;
+    }
+
+private:
+    static constexpr std::size_t MAX_SPAN = 9;
+
+    std::array<int, D> CalcCell(const point_t<D>& point) const noexcept {
+        std::array<int, D> cell{};
+        for(std::size_t d = 0; d < D; ++d) {
+            cell[d] = std::clamp(static_cast<int>((point[d] - _domain.mins[d]) / _cell_sizes[d]), 0, _counts[d] - 1);
+        }
+        return cell;
+    }
+
+    std::size_t CellIndex(const std::array<int, D>& cell) const noexcept {
+        std::size_t index = 0;
+        for(std::size_t d = D; d-- > 0;) {
+            index = index * static_cast<std::size_t>(_counts[d]) + static_cast<std::size_t>(cell[d]);
+        }
+        return index;
+    }
+
+    domain_t<D> _domain{};
+    std::array<int, D> _counts{};
+    std::array<float, D> _cell_sizes{};
+    std::array<int, D> _reach{};
+    //Cells store their point so the neighbour test reads one array.
+    std::vector<point_t<D>> _cells{};
+};
+
+template<std::size_t D>
+point_t<D> RandomPointInBox(const domain_t<D>& domain, RandomStream& rng) noexcept {
+    point_t<D> result{};
+    for(std::size_t d = 0; d < D; ++d) {
+        result[d] = rng.GetFloatInRange(domain.mins[d], domain.maxs[d]);
+    }
+    return result;
+}
+
+//Uniform in the shell between minDistance and 2 * minDistance around center.
+template<std::size_t D>
+point_t<D> RandomPointInShell(const point_t<D>& center, float minDistance, RandomStream& rng) noexcept {
+    if constexpr(D == 2) {
+        const auto radius = minDistance * std::sqrt(1.0f + 3.0f * rng.GetFloatZeroUpToOne());
+        const auto angle = MathUtils::M_2PI * rng.GetFloatZeroUpToOne();
+        return point_t<D>{center[0] + radius * std::cos(angle), center[1] + radius * std::sin(angle)};
+    } else {
+        const auto radius = minDistance * std::cbrt(1.0f + 7.0f * rng.GetFloatZeroUpToOne());
+        const auto z = 2.0f * rng.GetFloatZeroUpToOne() - 1.0f;
+        const auto angle = MathUtils::M_2PI * rng.GetFloatZeroUpToOne();
+        const auto ring = std::sqrt((std::max)(0.0f, 1.0f - z * z));
+        return point_t<D>{center[0] + radius * ring * std::cos(angle), center[1] + radius * ring * std::sin(angle), center[2] + radius * z};
+    }
+}
+
+//Bridson's algorithm. Inside(point) limits the points to a shape within the domain box;
+//in a wrapped domain candidates are wrapped back into the box instead of rejected.
+template<std::size_t D, typename Inside>
+std::vector<point_t<D>> GeneratePoissonDisc(const domain_t<D>& domain, float minDistance, unsigned int seed, unsigned int maxAttempts, Inside&& inside) noexcept {
+    std::vector<point_t<D>> points{};
+    for(std::size_t d = 0; d < D; ++d) {
+        if(!(domain.mins[d] < domain.maxs[d])) {
+            return points;
+        }
+    }
+    if(!(0.0f < minDistance)) {
+        return points;
+    }
+    RandomStream rng{seed};
+    BackgroundGrid<D> grid{domain, minDistance};
+    const auto min_distance_squared = minDistance * minDistance;
+    std::vector<std::uint32_t> active{};
+
+    //Seed with a point inside the shape. Shapes cover most of their box, so this ends quickly.
+    for(unsigned int attempt = 0; attempt < 1000u; ++attempt) {
+        const auto first = RandomPointInBox(domain, rng);
+        if(inside(first)) {
+            points.push_back(first);
+            grid.Insert(first);
+            active.push_back(0u);
+            break;
+        }
+    }
+
+    while(!active.empty()) {
+        const auto slot = static_cast<std::size_t>(rng.GetIntLessThan(static_cast<int>(active.size())));
+        const auto center = points[active[slot]];
+        bool placed = false;
+        for(unsigned int attempt = 0; attempt < maxAttempts; ++attempt) {
+            auto candidate = RandomPointInShell(center, minDistance, rng);
+            bool in_domain = true;
+            for(std::size_t d = 0; d < D; ++d) {
+                if(domain.wrap) {
+                    const auto extent = domain.maxs[d] - domain.mins[d];
+                    candidate[d] -= extent * std::floor((candidate[d] - domain.mins[d]) / extent);
+                    //Rounding can land exactly on the upper edge.
+                    if(!(candidate[d] < domain.maxs[d])) {
+                        candidate[d] = domain.mins[d];
+                    }
+                } else if(candidate[d] < domain.mins[d] || domain.maxs[d] < candidate[d]) {
+                    in_domain = false;
+                }
+            }
+            if(!in_domain || !inside(candidate) || !grid.HasRoom(candidate, min_distance_squared)) {
+                continue;
+            }
+            const auto index = static_cast<std::uint32_t>(points.size());
+            points.push_back(candidate);
+            grid.Insert(candidate);
+            active.push_back(index);
+            placed = true;
+            break;
+        }
+        if(!placed) {
+            active[slot] = active.back();
+            active.pop_back();
+        }
+    }
+    return points;
+}
+
+} //End anonymous
+
+namespace MathUtils {
+
+std::vector<Vector2> GeneratePoissonDiscPoints(const AABB2& bounds, float minDistance, unsigned int seed /*= 0*/, unsigned int maxAttempts /*= 30*/) noexcept {
+    const domain_t<2> domain{{bounds.mins.x, bounds.mins.y}, {bounds.maxs.x, bounds.maxs.y}, false};
+    const auto points = GeneratePoissonDisc(domain, minDistance, seed, maxAttempts, [](const point_t<2>&) { return true; });
+    std::vector<Vector2> result{};
+    result.reserve(points.size());
+    for(const auto& p : points) {
+        result.emplace_back(p[0], p[1]);
+    }
+    return result;
+}
+
+std::vector<Vector2> GeneratePoissonDiscPoints(const Disc2& disc, float minDistance, unsigned int seed /*= 0*/, unsigned int maxAttempts /*= 30*/) noexcept {
+    const auto& c = disc.center;
+    const auto r = disc.radius;
+    const domain_t<2> domain{{c.x - r, c.y - r}, {c.x + r, c.y + r}, false};
+    const auto radius_squared = r * r;
+    const auto points = GeneratePoissonDisc(domain, minDistance, seed, maxAttempts, [&](const point_t<2>& p) {
+        const auto dx = p[0] - c.x;
+        const auto dy = p[1] - c.y;
+        return dx * dx + dy * dy <= radius_squared;
+    });
+    std::vector<Vector2> result{};
+    result.reserve(points.size());
+    for(const auto& p : points) {
+        result.emplace_back(p[0], p[1]);
+    }
+    return result;
+}
+
+std::vector<Vector3> GeneratePoissonDiscPoints(const AABB3& bounds, float minDistance, unsigned int seed /*= 0*/, unsigned int maxAttempts /*= 30*/) noexcept {
+    const domain_t<3> domain{{bounds.mins.x, bounds.mins.y, bounds.mins.z}, {bounds.maxs.x, bounds.maxs.y, bounds.maxs.z}, false};
+    const auto points = GeneratePoissonDisc(domain, minDistance, seed, maxAttempts, [](const point_t<3>&) { return true; });
+    std::vector<Vector3> result{};
+    result.reserve(points.size());
+    for(const auto& p : points) {
+        result.emplace_back(p[0], p[1], p[2]);
+    }
+    return result;
+}
+
+std::vector<Vector2> GenerateBlueNoiseTile(float minDistance, unsigned int seed /*= 0*/, unsigned int maxAttempts /*= 30*/) noexcept {
+    const domain_t<2> domain{{0.0f, 0.0f}, {1.0f, 1.0f}, true};
+    const auto points = GeneratePoissonDisc(domain, minDistance, seed, maxAttempts, [](const point_t<2>&) { return true; });
+    std::vector<Vector2> result{};
+    result.reserve(points.size());
+    for(const auto& p : points) {
+        result.emplace_back(p[0], p[1]);
+    }
+    return result;
+}
+
+void TileBlueNoisePoints(const std::vector<Vector2>& tile, float tileSize, const AABB2& region, std::vector<Vector2>& out) noexcept {
+    if(!(0.0f < tileSize)) {
+        return;
+    }
+    const auto first_x = static_cast<int>(std::floor(region.mins.x / tileSize));
+    const auto first_y = static_cast<int>(std::floor(region.mins.y / tileSize));
+    const auto last_x = static_cast<int>(std::floor(region.maxs.x / tileSize));
+    const auto last_y = static_cast<int>(std::floor(region.maxs.y / tileSize));
+    for(int y = first_y; y <= last_y; ++y) {
+        for(int x = first_x; x <= last_x; ++x) {
+            const Vector2 origin{static_cast<float>(x) * tileSize, static_cast<float>(y) * tileSize};
+            for(const auto& p : tile) {
+                const auto point = origin + p * tileSize;
+                if(region.mins.x <= point.x && point.x <= region.maxs.x && region.mins.y <= point.y && point.y <= region.maxs.y) {
+                    out.push_back(point);
+                }
+            }
+        }
+    }
+}
+
+} //End MathUtils
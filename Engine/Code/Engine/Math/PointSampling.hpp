@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <vector>
+
+class AABB2;
+class AABB3;
+class Disc2;
+
+//Evenly spread point sets for scattering foliage, props and spawn points.
+//Every generator is seeded; the same arguments always give the same points.
+namespace MathUtils {
+
+//Poisson-disc sampling (Bridson, "Fast Poisson Disk Sampling in Arbitrary Dimensions", 2007).
+//No two points are closer than minDistance. Points are added around existing ones until each has
+//failed maxAttempts times to fit a neighbour, so the region ends up close to full.
+//A background grid of minDistance / sqrt(dimensions) cells keeps the cost linear in the point count.
+std::vector<Vector2> GeneratePoissonDiscPoints(const AABB2& bounds, float minDistance, unsigned int seed = 0, unsigned int maxAttempts = 30) noexcept;
+std::vector<Vector2> GeneratePoissonDiscPoints(const Disc2& disc, float minDistance, unsigned int seed = 0, unsigned int maxAttempts = 30) noexcept;
+std::vector<Vector3> GeneratePoissonDiscPoints(const AABB3& bounds, float minDistance, unsigned int seed = 0, unsigned int maxAttempts = 30) noexcept;
+
+//Poisson-disc points in the unit square [0, 1) x [0, 1) that also keep minDistance across the
+//wrapped edges, so copies laid edge to edge keep the spacing. Generate a tile once and stamp it
+//over any region with TileBlueNoisePoints.
+std::vector<Vector2> GenerateBlueNoiseTile(float minDistance, unsigned int seed = 0, unsigned int maxAttempts = 30) noexcept;
+
+//Repeats a unit tile from GenerateBlueNoiseTile, scaled to tileSize, and appends the points inside region to out.
+//Points keep minDistance * tileSize from each other.
+void TileBlueNoisePoints(const std::vector<Vector2>& tile, float tileSize, const AABB2& region, std::vector<Vector2>& out) noexcept;
+
+} //End MathUtils
@@ -0,0 +1,121 @@
+#include "Engine/Math/PoseSoA.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+//Bones per job when a blend is split across a JobSystem.
+constexpr std::size_t MIN_POSE_JOB_SIZE = 1024;
+
+void LerpRange(const float* a, const float* b, float t, float* result, std::size_t first, std::size_t last) noexcept {
+    auto i = first;
+#ifdef MATH_SIMD_SSE
+    const __m128 tt = _mm_set1_ps(t);
+    for(; i + 4 <= last; i += 4) {
+        const __m128 v = _mm_loadu_ps(a + i);
+        _mm_storeu_ps(result + i, _mm_add_ps(v, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(b + i), v), tt)));
+    }
+#endif
+    for(; i < last; ++i) {
+        result[i] = a[i] + (b[i] - a[i]) * t;
+    }
+}
+
+void LerpRange(const Vector3SoA& a, const Vector3SoA& b, float t, Vector3SoA& result, std::size_t first, std::size_t last) noexcept {
+    LerpRange(a.GetXs(), b.GetXs(), t, result.GetXs(), first, last);
+    LerpRange(a.GetYs(), b.GetYs(), t, result.GetYs(), first, last);
+    LerpRange(a.GetZs(), b.GetZs(), t, result.GetZs(), first, last);
+}
+
+} //End anonymous
+
+PoseSoA::PoseSoA(std::size_t boneCount) noexcept {
+    resize(boneCount);
+}
+
+std::size_t PoseSoA::size() const noexcept {
+    return _rotations.size();
+}
+
+bool PoseSoA::empty() const noexcept {
+    return _rotations.empty();
+}
+
+void PoseSoA::resize(std::size_t boneCount) noexcept {
+    _translations.resize(boneCount, Vector3::ZERO);
+    _rotations.resize(boneCount, Quaternion::GetIdentity());
+    _scales.resize(boneCount, Vector3::ONE);
+}
+
+void PoseSoA::clear() noexcept {
+    _translations.clear();
+    _rotations.clear();
+    _scales.clear();
+}
+
+void PoseSoA::SetBone(std::size_t bone, const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept {
+    _translations.Set(bone, translation);
+    _rotations.Set(bone, rotation);
+    _scales.Set(bone, scale);
+}
+
+Vector3 PoseSoA::GetTranslation(std::size_t bone) const noexcept {
+    return _translations.Get(bone);
+}
+
+Quaternion PoseSoA::GetRotation(std::size_t bone) const noexcept {
+    return _rotations.Get(bone);
+}
+
+Vector3 PoseSoA::GetScale(std::size_t bone) const noexcept {
+    return _scales.Get(bone);
+}
+
+Vector3SoA& PoseSoA::GetTranslations() noexcept {
+    return _translations;
+}
+
+QuaternionSoA& PoseSoA::GetRotations() noexcept {
+    return _rotations;
+}
+
+Vector3SoA& PoseSoA::GetScales() noexcept {
+    return _scales;
+}
+
+const Vector3SoA& PoseSoA::GetTranslations() const noexcept {
+    return _translations;
+}
+
+const QuaternionSoA& PoseSoA::GetRotations() const noexcept {
+    return _rotations;
+}
+
+const Vector3SoA& PoseSoA::GetScales() const noexcept {
+    return _scales;
+}
+
+void PoseSoA::Blend(const PoseSoA& a, const PoseSoA& b, float t, PoseSoA& result, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "PoseSoA poses must have the same bone count.");
+    const auto count = a.size();
+    result.resize(count);
+    if(!count) {
+        return;
+    }
+    const auto kernel = [&](std::size_t first, std::size_t last) {
+        LerpRange(a._translations, b._translations, t, result._translations, first, last);
+        QuaternionSoA::Nlerp(a._rotations, b._rotations, t, result._rotations, first, last);
+        LerpRange(a._scales, b._scales, t, result._scales, first, last);
+    };
+    if(jobSystem) {
+        jobSystem->ParallelFor(count, MIN_POSE_JOB_SIZE, kernel);
+    } else {
+        kernel(0, count);
+    }
+}
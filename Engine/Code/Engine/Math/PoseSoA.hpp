@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Engine/Math/QuaternionSoA.hpp"
+#include "Engine/Math/Vector3SoA.hpp"
+
+#include <cstddef>
+
+class JobSystem;
+
+//Local translation, rotation and scale of every bone of a skeleton, stored as structures of arrays.
+//New bones start at the identity transform.
+class PoseSoA {
+public:
+    PoseSoA() = default;
+    PoseSoA(const PoseSoA& other) = default;
+    PoseSoA(PoseSoA&& other) = default;
+    PoseSoA& operator=(const PoseSoA& other) = default;
+    PoseSoA& operator=(PoseSoA&& other) = default;
+    ~PoseSoA() = default;
+
+    explicit PoseSoA(std::size_t boneCount) noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    void resize(std::size_t boneCount) noexcept;
+    void clear() noexcept;
+
+    void SetBone(std::size_t bone, const Vector3& translation, const Quaternion& rotation, const Vector3& scale) noexcept;
+    Vector3 GetTranslation(std::size_t bone) const noexcept;
+    Quaternion GetRotation(std::size_t bone) const noexcept;
+    Vector3 GetScale(std::size_t bone) const noexcept;
+
+    Vector3SoA& GetTranslations() noexcept;
+    QuaternionSoA& GetRotations() noexcept;
+    Vector3SoA& GetScales() noexcept;
+    const Vector3SoA& GetTranslations() const noexcept;
+    const QuaternionSoA& GetRotations() const noexcept;
+    const Vector3SoA& GetScales() const noexcept;
+
+    //Lerps translations and scales and nlerps rotations from a to b in one pass over the bones.
+    //Poses must have the same bone count; result is resized to match and may be one of the operands.
+    static void Blend(const PoseSoA& a, const PoseSoA& b, float t, PoseSoA& result, JobSystem* jobSystem = nullptr) noexcept;
+
+protected:
+private:
+    Vector3SoA _translations{};
+    QuaternionSoA _rotations{};
+    Vector3SoA _scales{};
+};
@@ -0,0 +1,297 @@
+#include "Engine/Math/QuaternionSoA.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/FastMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+//Elements per job when a blend is split across a JobSystem.
+constexpr std::size_t MIN_BLEND_JOB_SIZE = 4096;
+//Elements blended per pass; sized so the per-element scale buffers stay on the stack.
+constexpr std::size_t BLEND_CHUNK_SIZE = 256;
+//Same cutoff as MathUtils::SLERP, below which the angle is too small to divide by its sine.
+constexpr float SLERP_LINEAR_THRESHOLD = 0.99995f;
+
+void CalcDots(const QuaternionSoA& a, const QuaternionSoA& b, std::size_t first, std::size_t count, float* dots) noexcept {
+    const float* aw = a.GetWs() + first; const float* ax = a.GetXs() + first; const float* ay = a.GetYs() + first; const float* az = a.GetZs() + first;
+    const float* bw = b.GetWs() + first; const float* bx = b.GetXs() + first; const float* by = b.GetYs() + first; const float* bz = b.GetZs() + first;
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const __m128 ww = _mm_mul_ps(_mm_loadu_ps(aw + i), _mm_loadu_ps(bw + i));
+        const __m128 xx = _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+        const __m128 yy = _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i));
+        const __m128 zz = _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i));
+        _mm_storeu_ps(dots + i, _mm_add_ps(_mm_add_ps(ww, xx), _mm_add_ps(yy, zz)));
+    }
+#endif
+    for(; i < count; ++i) {
+        dots[i] = (aw[i] * bw[i] + ax[i] * bx[i]) + (ay[i] * by[i] + az[i] * bz[i]);
+    }
+}
+
+//result = normalize(scale_a * a + scale_b * b)
+void Combine(const QuaternionSoA& a, const QuaternionSoA& b, const float* scale_a, const float* scale_b, QuaternionSoA& result, std::size_t first, std::size_t count) noexcept {
+    const float* aw = a.GetWs() + first; const float* ax = a.GetXs() + first; const float* ay = a.GetYs() + first; const float* az = a.GetZs() + first;
+    const float* bw = b.GetWs() + first; const float* bx = b.GetXs() + first; const float* by = b.GetYs() + first; const float* bz = b.GetZs() + first;
+    float* rw = result.GetWs() + first; float* rx = result.GetXs() + first; float* ry = result.GetYs() + first; float* rz = result.GetZs() + first;
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(; i + 4 <= count; i += 4) {
+        const __m128 sa = _mm_loadu_ps(scale_a + i);
+        const __m128 sb = _mm_loadu_ps(scale_b + i);
+        const __m128 w = _mm_add_ps(_mm_mul_ps(sa, _mm_loadu_ps(aw + i)), _mm_mul_ps(sb, _mm_loadu_ps(bw + i)));
+        const __m128 x = _mm_add_ps(_mm_mul_ps(sa, _mm_loadu_ps(ax + i)), _mm_mul_ps(sb, _mm_loadu_ps(bx + i)));
+        const __m128 y = _mm_add_ps(_mm_mul_ps(sa, _mm_loadu_ps(ay + i)), _mm_mul_ps(sb, _mm_loadu_ps(by + i)));
+        const __m128 z = _mm_add_ps(_mm_mul_ps(sa, _mm_loadu_ps(az + i)), _mm_mul_ps(sb, _mm_loadu_ps(bz + i)));
+        const __m128 length_squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w, w), _mm_mul_ps(x, x)), _mm_add_ps(_mm_mul_ps(y, y), _mm_mul_ps(z, z)));
+        const __m128 inv_length = _mm_div_ps(one, _mm_sqrt_ps(length_squared));
+        _mm_storeu_ps(rw + i, _mm_mul_ps(w, inv_length));
+        _mm_storeu_ps(rx + i, _mm_mul_ps(x, inv_length));
+        _mm_storeu_ps(ry + i, _mm_mul_ps(y, inv_length));
+        _mm_storeu_ps(rz + i, _mm_mul_ps(z, inv_length));
+    }
+#endif
+    for(; i < count; ++i) {
+        const float w = scale_a[i] * aw[i] + scale_b[i] * bw[i];
+        const float x = scale_a[i] * ax[i] + scale_b[i] * bx[i];
+        const float y = scale_a[i] * ay[i] + scale_b[i] * by[i];
+        const float z = scale_a[i] * az[i] + scale_b[i] * bz[i];
+        const float inv_length = 1.0f / std::sqrt((w * w + x * x) + (y * y + z * z));
+        rw[i] = w * inv_length;
+        rx[i] = x * inv_length;
+        ry[i] = y * inv_length;
+        rz[i] = z * inv_length;
+    }
+}
+
+//Blends [first, last) in chunks. calc_scales turns the dot products of each chunk into
+//the weights of a and b, with the sign of b's weight flipped to take the shortest path.
+template<typename F>
+void BlendChunks(const QuaternionSoA& a, const QuaternionSoA& b, QuaternionSoA& result, std::size_t first, std::size_t last, F&& calc_scales) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "QuaternionSoA operands must be the same size.");
+    GUARANTEE_OR_DIE(first <= last && last <= a.size() && last <= result.size(), "QuaternionSoA blend range is outside the operands or result.");
+    float dots[BLEND_CHUNK_SIZE];
+    float scale_a[BLEND_CHUNK_SIZE];
+    float scale_b[BLEND_CHUNK_SIZE];
+    for(auto begin = first; begin < last; begin += BLEND_CHUNK_SIZE) {
+        const auto count = (std::min)(BLEND_CHUNK_SIZE, last - begin);
+        CalcDots(a, b, begin, count, dots);
+        calc_scales(dots, scale_a, scale_b, count);
+        Combine(a, b, scale_a, scale_b, result, begin, count);
+    }
+}
+
+template<typename F>
+void RunBlend(const QuaternionSoA& a, const QuaternionSoA& b, QuaternionSoA& result, JobSystem* jobSystem, F&& kernel) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "QuaternionSoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    if(!count) {
+        return;
+    }
+    if(jobSystem) {
+        jobSystem->ParallelFor(count, MIN_BLEND_JOB_SIZE, kernel);
+    } else {
+        kernel(0, count);
+    }
+}
+
+} //End anonymous
+
+QuaternionSoA::QuaternionSoA(std::size_t count, const Quaternion& value /*= Quaternion::GetIdentity()*/) noexcept
+    : _w(count, value.w)
+    , _x(count, value.axis.x)
+    , _y(count, value.axis.y)
+    , _z(count, value.axis.z)
+{
+    /* DO NOTHING */
+}
+
+QuaternionSoA::QuaternionSoA(const std::vector<Quaternion>& quaternions) noexcept {
+    FromQuaternions(quaternions);
+}
+
+void QuaternionSoA::FromQuaternions(const std::vector<Quaternion>& quaternions) noexcept {
+    const auto count = quaternions.size();
+    _w.resize(count);
+    _x.resize(count);
+    _y.resize(count);
+    _z.resize(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        _w[i] = quaternions[i].w;
+        _x[i] = quaternions[i].axis.x;
+        _y[i] = quaternions[i].axis.y;
+        _z[i] = quaternions[i].axis.z;
+    }
+}
+
+std::vector<Quaternion> QuaternionSoA::ToQuaternions() const noexcept {
+    std::vector<Quaternion> result{};
+    ToQuaternions(result);
+    return result;
+}
+
+void QuaternionSoA::ToQuaternions(std::vector<Quaternion>& out) const noexcept {
+    const auto count = size();
+    out.resize(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i] = Quaternion(_w[i], _x[i], _y[i], _z[i]);
+    }
+}
+
+std::size_t QuaternionSoA::size() const noexcept {
+    return _w.size();
+}
+
+bool QuaternionSoA::empty() const noexcept {
+    return _w.empty();
+}
+
+void QuaternionSoA::resize(std::size_t count, const Quaternion& value /*= Quaternion::GetIdentity()*/) noexcept {
+    _w.resize(count, value.w);
+    _x.resize(count, value.axis.x);
+    _y.resize(count, value.axis.y);
+    _z.resize(count, value.axis.z);
+}
+
+void QuaternionSoA::reserve(std::size_t count) noexcept {
+    _w.reserve(count);
+    _x.reserve(count);
+    _y.reserve(count);
+    _z.reserve(count);
+}
+
+void QuaternionSoA::clear() noexcept {
+    _w.clear();
+    _x.clear();
+    _y.clear();
+    _z.clear();
+}
+
+void QuaternionSoA::push_back(const Quaternion& value) noexcept {
+    _w.push_back(value.w);
+    _x.push_back(value.axis.x);
+    _y.push_back(value.axis.y);
+    _z.push_back(value.axis.z);
+}
+
+Quaternion QuaternionSoA::Get(std::size_t index) const noexcept {
+    return Quaternion(_w[index], _x[index], _y[index], _z[index]);
+}
+
+void QuaternionSoA::Set(std::size_t index, const Quaternion& value) noexcept {
+    _w[index] = value.w;
+    _x[index] = value.axis.x;
+    _y[index] = value.axis.y;
+    _z[index] = value.axis.z;
+}
+
+float* QuaternionSoA::GetWs() noexcept {
+    return _w.data();
+}
+
+float* QuaternionSoA::GetXs() noexcept {
+    return _x.data();
+}
+
+float* QuaternionSoA::GetYs() noexcept {
+    return _y.data();
+}
+
+float* QuaternionSoA::GetZs() noexcept {
+    return _z.data();
+}
+
+const float* QuaternionSoA::GetWs() const noexcept {
+    return _w.data();
+}
+
+const float* QuaternionSoA::GetXs() const noexcept {
+    return _x.data();
+}
+
+const float* QuaternionSoA::GetYs() const noexcept {
+    return _y.data();
+}
+
+const float* QuaternionSoA::GetZs() const noexcept {
+    return _z.data();
+}
+
+void QuaternionSoA::Nlerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    RunBlend(a, b, result, jobSystem, [&](std::size_t first, std::size_t last) { Nlerp(a, b, t, result, first, last); });
+}
+
+void QuaternionSoA::Nlerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, std::size_t first, std::size_t last) noexcept {
+    BlendChunks(a, b, result, first, last, [t](const float* dots, float* scale_a, float* scale_b, std::size_t count) {
+        for(std::size_t i = 0; i < count; ++i) {
+            scale_a[i] = 1.0f - t;
+            scale_b[i] = dots[i] < 0.0f ? -t : t;
+        }
+    });
+}
+
+void QuaternionSoA::Slerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    RunBlend(a, b, result, jobSystem, [&](std::size_t first, std::size_t last) { Slerp(a, b, t, result, first, last); });
+}
+
+void QuaternionSoA::Slerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, std::size_t first, std::size_t last) noexcept {
+    BlendChunks(a, b, result, first, last, [t](const float* dots, float* scale_a, float* scale_b, std::size_t count) {
+        float cos_angle[BLEND_CHUNK_SIZE];
+        float sin_angle[BLEND_CHUNK_SIZE];
+        float angle[BLEND_CHUNK_SIZE];
+        for(std::size_t i = 0; i < count; ++i) {
+            cos_angle[i] = (std::min)(std::abs(dots[i]), 1.0f);
+            sin_angle[i] = std::sqrt(1.0f - cos_angle[i] * cos_angle[i]);
+        }
+        MathUtils::FastMath::Atan2(sin_angle, cos_angle, angle, count);
+        for(std::size_t i = 0; i < count; ++i) {
+            angle[i] *= t;
+        }
+        //scale_a and scale_b hold sin(t * angle) and cos(t * angle) until the weights are formed.
+        MathUtils::FastMath::SinCos(angle, scale_b, scale_a, count);
+        for(std::size_t i = 0; i < count; ++i) {
+            const float sign = dots[i] < 0.0f ? -1.0f : 1.0f;
+            if(cos_angle[i] > SLERP_LINEAR_THRESHOLD) {
+                scale_a[i] = 1.0f - t;
+                scale_b[i] = sign * t;
+                continue;
+            }
+            const float weight_b = scale_b[i] / sin_angle[i];
+            scale_a[i] = scale_a[i] - cos_angle[i] * weight_b;
+            scale_b[i] = sign * weight_b;
+        }
+    });
+}
+
+void QuaternionSoA::SlerpFast(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    RunBlend(a, b, result, jobSystem, [&](std::size_t first, std::size_t last) { SlerpFast(a, b, t, result, first, last); });
+}
+
+void QuaternionSoA::SlerpFast(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, std::size_t first, std::size_t last) noexcept {
+    //Correction fitted over the angle between the inputs (Arseny Kapoulkine, "Approximating slerp").
+    BlendChunks(a, b, result, first, last, [t](const float* dots, float* scale_a, float* scale_b, std::size_t count) {
+        const float u = t - 0.5f;
+        const float v = t * u * (t - 1.0f);
+        for(std::size_t i = 0; i < count; ++i) {
+            const float d = std::abs(dots[i]);
+            const float k_a = 1.0904f + d * (-3.2452f + d * (3.55645f - d * 1.43519f));
+            const float k_b = 0.848013f + d * (-1.06021f + d * 0.215638f);
+            const float corrected_t = t + v * (k_a * u * u + k_b);
+            scale_a[i] = 1.0f - corrected_t;
+            scale_b[i] = dots[i] < 0.0f ? -corrected_t : corrected_t;
+        }
+    });
+}
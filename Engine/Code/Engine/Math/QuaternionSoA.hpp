@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Engine/Math/Quaternion.hpp"
+
+#include <cstddef>
+#include <vector>
+
+class JobSystem;
+
+//Structure-of-arrays storage for large numbers of unit quaternions, such as skeleton bone rotations.
+//The blends run four elements at a time with SSE when available and take the shortest path
+//between each pair. Operands must be the same size and already normalized.
+//Results are resized to match and may be one of the operands. With a JobSystem the work is split
+//across its workers; the ranged overloads blend [first, last) of an already sized result
+//for callers that split the work themselves. Mismatched sizes and ranges past the end of the
+//operands or result are caught by GUARANTEE_OR_DIE.
+class QuaternionSoA {
+public:
+    QuaternionSoA() = default;
+    QuaternionSoA(const QuaternionSoA& other) = default;
+    QuaternionSoA(QuaternionSoA&& other) = default;
+    QuaternionSoA& operator=(const QuaternionSoA& other) = default;
+    QuaternionSoA& operator=(QuaternionSoA&& other) = default;
+    ~QuaternionSoA() = default;
+
+    explicit QuaternionSoA(std::size_t count, const Quaternion& value = Quaternion::GetIdentity()) noexcept;
+    explicit QuaternionSoA(const std::vector<Quaternion>& quaternions) noexcept;
+
+    void FromQuaternions(const std::vector<Quaternion>& quaternions) noexcept;
+    std::vector<Quaternion> ToQuaternions() const noexcept;
+    void ToQuaternions(std::vector<Quaternion>& out) const noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    void resize(std::size_t count, const Quaternion& value = Quaternion::GetIdentity()) noexcept;
+    void reserve(std::size_t count) noexcept;
+    void clear() noexcept;
+    void push_back(const Quaternion& value) noexcept;
+
+    Quaternion Get(std::size_t index) const noexcept;
+    void Set(std::size_t index, const Quaternion& value) noexcept;
+
+    float* GetWs() noexcept;
+    float* GetXs() noexcept;
+    float* GetYs() noexcept;
+    float* GetZs() noexcept;
+    const float* GetWs() const noexcept;
+    const float* GetXs() const noexcept;
+    const float* GetYs() const noexcept;
+    const float* GetZs() const noexcept;
+
+    //Normalized linear interpolation. Cheapest; the angular speed is not constant over t.
+    static void Nlerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, JobSystem* jobSystem = nullptr) noexcept;
+    static void Nlerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, std::size_t first, std::size_t last) noexcept;
+
+    //Spherical linear interpolation. Matches MathUtils::SLERP to within 1e-6 per component.
+    static void Slerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, JobSystem* jobSystem = nullptr) noexcept;
+    static void Slerp(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, std::size_t first, std::size_t last) noexcept;
+
+    //Nlerp with t corrected by a polynomial fit so the angular speed is close to constant.
+    //Matches MathUtils::SLERP to within 2e-3 per component at about the cost of Nlerp.
+    static void SlerpFast(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, JobSystem* jobSystem = nullptr) noexcept;
+    static void SlerpFast(const QuaternionSoA& a, const QuaternionSoA& b, float t, QuaternionSoA& result, std::size_t first, std::size_t last) noexcept;
+
+protected:
+private:
+    std::vector<float> _w{};
+    std::vector<float> _x{};
+    std::vector<float> _y{};
+    std::vector<float> _z{};
+};
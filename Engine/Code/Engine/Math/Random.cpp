@@ -0,0 +1,335 @@
+#include "Engine/Math/Random.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include <algorithm>
+
+#ifdef MATH_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+//Values per job when a fill is split across a JobSystem.
+constexpr std::size_t MIN_RANDOM_JOB_SIZE = 4096;
+
+constexpr std::uint64_t PCG_MULTIPLIER = 6364136223846793005ull;
+constexpr std::uint64_t PCG_DEFAULT_SEED = 0x853C49E6748FEA9Bull;
+constexpr std::uint64_t PCG_DEFAULT_STREAM = 0xDA3E39CB94B95BDBull;
+
+//SquirrelNoise5 bit noise constants.
+constexpr std::uint32_t BIT_NOISE1 = 0xD2A80A3Fu;
+constexpr std::uint32_t BIT_NOISE2 = 0xA884F197u;
+constexpr std::uint32_t BIT_NOISE3 = 0x6C736F4Bu;
+constexpr std::uint32_t BIT_NOISE4 = 0xB79F3ABBu;
+constexpr std::uint32_t BIT_NOISE5 = 0x1B56C4F5u;
+
+constexpr float ONE_OVER_2_24 = 1.0f / 16777216.0f;
+
+std::uint32_t MangleBits(std::uint32_t position, std::uint32_t seed) noexcept {
+    std::uint32_t bits = position;
+    bits *= BIT_NOISE1;
+    bits += seed;
+    bits ^= (bits >> 9);
+    bits += BIT_NOISE2;
+    bits ^= (bits >> 11);
+    bits *= BIT_NOISE3;
+    bits ^= (bits >> 13);
+    bits += BIT_NOISE4;
+    bits ^= (bits >> 15);
+    bits *= BIT_NOISE5;
+    bits ^= (bits >> 17);
+    return bits;
+}
+
+//Positions are hashed 32 bits at a time; every 2^32 block past the first gets its own key.
+std::uint32_t BlockKey(std::uint32_t key, std::uint64_t position) noexcept {
+    const auto block = static_cast<std::uint32_t>(position >> 32);
+    return block ? MangleBits(block, key) : key;
+}
+
+float ToFloatZeroUpToOne(std::uint32_t bits) noexcept {
+    return static_cast<float>(bits >> 8) * ONE_OVER_2_24;
+}
+
+float ToFloatInRange(std::uint32_t bits, float minInclusive, float extent) noexcept {
+    return minInclusive + extent * ToFloatZeroUpToOne(bits);
+}
+
+//An extent of 0 stands for the full 2^32 values.
+std::uint32_t IntExtent(int minInclusive, int maxInclusive) noexcept {
+    return static_cast<std::uint32_t>(maxInclusive) - static_cast<std::uint32_t>(minInclusive) + 1u;
+}
+
+int ToIntInRange(std::uint32_t bits, int minInclusive, std::uint32_t extent) noexcept {
+    const auto offset = extent ? static_cast<std::uint32_t>((static_cast<std::uint64_t>(bits) * extent) >> 32) : bits;
+    return static_cast<int>(static_cast<std::uint32_t>(minInclusive) + offset);
+}
+
+#ifdef MATH_SIMD_SSE
+
+//SSE2 has no 32-bit low multiply; build it from the two 32x32->64 multiplies.
+__m128i MulLo32(__m128i a, __m128i b) noexcept {
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+//High 32 bits of the 64-bit products.
+__m128i MulHi32(__m128i a, __m128i b) noexcept {
+    const __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_or_si128(even, _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0)));
+}
+
+__m128i MangleBits(__m128i position, __m128i seed) noexcept {
+    __m128i bits = MulLo32(position, _mm_set1_epi32(static_cast<int>(BIT_NOISE1)));
+    bits = _mm_add_epi32(bits, seed);
+    bits = _mm_xor_si128(bits, _mm_srli_epi32(bits, 9));
+    bits = _mm_add_epi32(bits, _mm_set1_epi32(static_cast<int>(BIT_NOISE2)));
+    bits = _mm_xor_si128(bits, _mm_srli_epi32(bits, 11));
+    bits = MulLo32(bits, _mm_set1_epi32(static_cast<int>(BIT_NOISE3)));
+    bits = _mm_xor_si128(bits, _mm_srli_epi32(bits, 13));
+    bits = _mm_add_epi32(bits, _mm_set1_epi32(static_cast<int>(BIT_NOISE4)));
+    bits = _mm_xor_si128(bits, _mm_srli_epi32(bits, 15));
+    bits = MulLo32(bits, _mm_set1_epi32(static_cast<int>(BIT_NOISE5)));
+    return _mm_xor_si128(bits, _mm_srli_epi32(bits, 17));
+}
+
+#endif
+
+//Writes convert(value at position + i) to out[i] for i in [first, last).
+//Lanes is a callable taking (out + i, four hashed values) when SSE is available.
+template<typename T, typename Convert, typename Lanes>
+void FillRange(std::uint32_t key, std::uint64_t position, T* out, std::size_t first, std::size_t last, Convert&& convert, Lanes&& lanes) noexcept {
+    while(first < last) {
+        const std::uint64_t start = position + first;
+        const auto block_key = BlockKey(key, start);
+        const auto index = static_cast<std::uint32_t>(start);
+        //Stop at the end of the 2^32 block so every lane shares the block key.
+        const std::uint64_t block_remaining = (std::uint64_t{1} << 32) - index;
+        const auto end = first + static_cast<std::size_t>((std::min)(static_cast<std::uint64_t>(last - first), block_remaining));
+        std::size_t i = first;
+#ifdef MATH_SIMD_SSE
+        const __m128i seeds = _mm_set1_epi32(static_cast<int>(block_key));
+        const __m128i four = _mm_set1_epi32(4);
+        __m128i positions = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(index)), _mm_setr_epi32(0, 1, 2, 3));
+        for(; i + 4 <= end; i += 4) {
+            lanes(out + i, MangleBits(positions, seeds));
+            positions = _mm_add_epi32(positions, four);
+        }
+#else
+        (void)lanes;
+#endif
+        for(; i < end; ++i) {
+            out[i] = convert(MangleBits(index + static_cast<std::uint32_t>(i - first), block_key));
+        }
+        first = end;
+    }
+}
+
+template<typename F>
+void RunFill(std::size_t count, JobSystem* jobSystem, F&& kernel) noexcept {
+    if(jobSystem && MIN_RANDOM_JOB_SIZE < count) {
+        jobSystem->ParallelFor(count, MIN_RANDOM_JOB_SIZE, kernel);
+    } else {
+        kernel(0, count);
+    }
+}
+
+} //End anonymous
+
+PCG32::PCG32() noexcept
+    : PCG32(PCG_DEFAULT_SEED, PCG_DEFAULT_STREAM)
+{
+    /* DO NOTHING */
+}
+
+PCG32::PCG32(std::uint64_t seed, std::uint64_t stream /*= 0*/) noexcept {
+    Seed(seed, stream);
+}
+
+void PCG32::Seed(std::uint64_t seed, std::uint64_t stream /*= 0*/) noexcept {
+    _state = 0u;
+    _increment = (stream << 1u) | 1u;
+    (*this)();
+    _state += seed;
+    (*this)();
+}
+
+PCG32::result_type PCG32::operator()() noexcept {
+    const auto old_state = _state;
+    _state = old_state * PCG_MULTIPLIER + _increment;
+    const auto xorshifted = static_cast<std::uint32_t>(((old_state >> 18u) ^ old_state) >> 27u);
+    const auto rotation = static_cast<std::uint32_t>(old_state >> 59u);
+    return (xorshifted >> rotation) | (xorshifted << ((0u - rotation) & 31u));
+}
+
+//Brown, "Random Number Generation with Arbitrary Stride": compose the LCG step with itself log2(count) times.
+void PCG32::Discard(std::uint64_t count) noexcept {
+    std::uint64_t multiplier = 1u;
+    std::uint64_t increment = 0u;
+    std::uint64_t step_multiplier = PCG_MULTIPLIER;
+    std::uint64_t step_increment = _increment;
+    while(count) {
+        if(count & 1u) {
+            multiplier *= step_multiplier;
+            increment = increment * step_multiplier + step_increment;
+        }
+        step_increment = (step_multiplier + 1u) * step_increment;
+        step_multiplier *= step_multiplier;
+        count >>= 1u;
+    }
+    _state = multiplier * _state + increment;
+}
+
+bool PCG32::GetBool() noexcept {
+    return ((*this)() >> 31) != 0u;
+}
+
+int PCG32::GetIntLessThan(int maxValueNotInclusive) noexcept {
+    const auto bits = (*this)();
+    if(maxValueNotInclusive <= 0) {
+        return 0;
+    }
+    return ToIntInRange(bits, 0, static_cast<std::uint32_t>(maxValueNotInclusive));
+}
+
+int PCG32::GetIntInRange(int minInclusive, int maxInclusive) noexcept {
+    return ToIntInRange((*this)(), minInclusive, IntExtent(minInclusive, maxInclusive));
+}
+
+float PCG32::GetFloatZeroUpToOne() noexcept {
+    return ToFloatZeroUpToOne((*this)());
+}
+
+float PCG32::GetFloatInRange(float minInclusive, float maxInclusive) noexcept {
+    return ToFloatInRange((*this)(), minInclusive, maxInclusive - minInclusive);
+}
+
+void PCG32::FillFloats(float* out, std::size_t count, float minInclusive, float maxInclusive) noexcept {
+    const auto extent = maxInclusive - minInclusive;
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i] = ToFloatInRange((*this)(), minInclusive, extent);
+    }
+}
+
+void PCG32::FillInts(int* out, std::size_t count, int minInclusive, int maxInclusive) noexcept {
+    const auto extent = IntExtent(minInclusive, maxInclusive);
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i] = ToIntInRange((*this)(), minInclusive, extent);
+    }
+}
+
+RandomStream::RandomStream() noexcept
+    : RandomStream(0u, 0u)
+{
+    /* DO NOTHING */
+}
+
+RandomStream::RandomStream(unsigned int seed, unsigned int stream /*= 0*/) noexcept
+    : _key(MangleBits(stream, seed))
+{
+    /* DO NOTHING */
+}
+
+RandomStream::result_type RandomStream::operator()() noexcept {
+    return GetValueAt(_position++);
+}
+
+RandomStream::result_type RandomStream::GetValueAt(std::uint64_t position) const noexcept {
+    return MangleBits(static_cast<std::uint32_t>(position), BlockKey(_key, position));
+}
+
+std::uint64_t RandomStream::GetPosition() const noexcept {
+    return _position;
+}
+
+void RandomStream::SetPosition(std::uint64_t position) noexcept {
+    _position = position;
+}
+
+void RandomStream::Discard(std::uint64_t count) noexcept {
+    _position += count;
+}
+
+bool RandomStream::GetBool() noexcept {
+    return ((*this)() >> 31) != 0u;
+}
+
+int RandomStream::GetIntLessThan(int maxValueNotInclusive) noexcept {
+    const auto bits = (*this)();
+    if(maxValueNotInclusive <= 0) {
+        return 0;
+    }
+    return ToIntInRange(bits, 0, static_cast<std::uint32_t>(maxValueNotInclusive));
+}
+
+int RandomStream::GetIntInRange(int minInclusive, int maxInclusive) noexcept {
+    return ToIntInRange((*this)(), minInclusive, IntExtent(minInclusive, maxInclusive));
+}
+
+float RandomStream::GetFloatZeroUpToOne() noexcept {
+    return ToFloatZeroUpToOne((*this)());
+}
+
+float RandomStream::GetFloatInRange(float minInclusive, float maxInclusive) noexcept {
+    return ToFloatInRange((*this)(), minInclusive, maxInclusive - minInclusive);
+}
+
+void RandomStream::FillUints(std::uint32_t* out, std::size_t count, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto key = _key;
+    const auto position = _position;
+    RunFill(count, jobSystem, [=](std::size_t first, std::size_t last) {
+        FillRange(key, position, out, first, last
+                  , [](std::uint32_t bits) { return bits; }
+#ifdef MATH_SIMD_SSE
+                  , [](std::uint32_t* dest, __m128i bits) { _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), bits); }
+#else
+                  , nullptr
+#endif
+        );
+    });
+    _position += count;
+}
+
+void RandomStream::FillFloats(float* out, std::size_t count, float minInclusive, float maxInclusive, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto key = _key;
+    const auto position = _position;
+    const auto extent = maxInclusive - minInclusive;
+    RunFill(count, jobSystem, [=](std::size_t first, std::size_t last) {
+        FillRange(key, position, out, first, last
+                  , [=](std::uint32_t bits) { return ToFloatInRange(bits, minInclusive, extent); }
+#ifdef MATH_SIMD_SSE
+                  , [=](float* dest, __m128i bits) {
+                      const __m128 unit = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(bits, 8)), _mm_set1_ps(ONE_OVER_2_24));
+                      _mm_storeu_ps(dest, _mm_add_ps(_mm_set1_ps(minInclusive), _mm_mul_ps(_mm_set1_ps(extent), unit)));
+                  }
+#else
+                  , nullptr
+#endif
+        );
+    });
+    _position += count;
+}
+
+void RandomStream::FillInts(int* out, std::size_t count, int minInclusive, int maxInclusive, JobSystem* jobSystem /*= nullptr*/) noexcept {
+    const auto key = _key;
+    const auto position = _position;
+    const auto extent = IntExtent(minInclusive, maxInclusive);
+    RunFill(count, jobSystem, [=](std::size_t first, std::size_t last) {
+        FillRange(key, position, out, first, last
+                  , [=](std::uint32_t bits) { return ToIntInRange(bits, minInclusive, extent); }
+#ifdef MATH_SIMD_SSE
+                  , [=](int* dest, __m128i bits) {
+                      const __m128i offset = extent ? MulHi32(bits, _mm_set1_epi32(static_cast<int>(extent))) : bits;
+                      _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_add_epi32(offset, _mm_set1_epi32(minInclusive)));
+                  }
+#else
+                  , nullptr
+#endif
+        );
+    });
+    _position += count;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class JobSystem;
+
+//Small-state random number generators for hot paths such as particle and procedural spawning.
+//Both satisfy UniformRandomBitGenerator, so they can also drive the std:: distributions.
+//Float draws use the top 24 bits and fall in [minInclusive, maxInclusive): the top of the range is never drawn.
+//Int draws use a multiply and shift instead of rejection; for a range of n values
+//the bias is below n / 2^32. GetIntLessThan returns 0 for a bound of zero or less,
+//still advancing the generator by one value.
+
+//PCG32 (O'Neill, XSH-RR variant). 16 bytes of state with 2^63 selectable streams.
+//Sequential: each value depends on the previous one. Discard jumps ahead in O(log n).
+class PCG32 {
+public:
+    using result_type = std::uint32_t;
+
+    PCG32() noexcept;
+    PCG32(const PCG32& other) = default;
+    PCG32(PCG32&& other) = default;
+    PCG32& operator=(const PCG32& other) = default;
+    PCG32& operator=(PCG32&& other) = default;
+    ~PCG32() = default;
+
+    explicit PCG32(std::uint64_t seed, std::uint64_t stream = 0) noexcept;
+
+    static constexpr result_type min() noexcept { return 0u; }
+    static constexpr result_type max() noexcept { return 0xFFFFFFFFu; }
+    result_type operator()() noexcept;
+
+    void Seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept;
+    void Discard(std::uint64_t count) noexcept;
+
+    bool GetBool() noexcept;
+    int GetIntLessThan(int maxValueNotInclusive) noexcept;
+    int GetIntInRange(int minInclusive, int maxInclusive) noexcept;
+    float GetFloatZeroUpToOne() noexcept;
+    float GetFloatInRange(float minInclusive, float maxInclusive) noexcept;
+
+    void FillFloats(float* out, std::size_t count, float minInclusive, float maxInclusive) noexcept;
+    void FillInts(int* out, std::size_t count, int minInclusive, int maxInclusive) noexcept;
+
+private:
+    std::uint64_t _state{};
+    std::uint64_t _increment{};
+};
+
+//Counter-based generator: the value at each position is a hash of (position, seed, stream),
+//using Squirrel Eiserloh's SquirrelNoise5 bit noise. Any range of positions can be generated
+//independently, so the fills run four values per step with SSE and split across a JobSystem
+//with the same results as a serial fill. Give each job its own stream index for
+//reproducible per-job sequences. 8 bytes of position and 4 of key.
+class RandomStream {
+public:
+    using result_type = std::uint32_t;
+
+    RandomStream() noexcept;
+    RandomStream(const RandomStream& other) = default;
+    RandomStream(RandomStream&& other) = default;
+    RandomStream& operator=(const RandomStream& other) = default;
+    RandomStream& operator=(RandomStream&& other) = default;
+    ~RandomStream() = default;
+
+    explicit RandomStream(unsigned int seed, unsigned int stream = 0) noexcept;
+
+    static constexpr result_type min() noexcept { return 0u; }
+    static constexpr result_type max() noexcept { return 0xFFFFFFFFu; }
+    result_type operator()() noexcept;
+
+    //The value at position, without moving the stream.
+    result_type GetValueAt(std::uint64_t position) const noexcept;
+
+    std::uint64_t GetPosition() const noexcept;
+    void SetPosition(std::uint64_t position) noexcept;
+    void Discard(std::uint64_t count) noexcept;
+
+    bool GetBool() noexcept;
+    int GetIntLessThan(int maxValueNotInclusive) noexcept;
+    int GetIntInRange(int minInclusive, int maxInclusive) noexcept;
+    float GetFloatZeroUpToOne() noexcept;
+    float GetFloatInRange(float minInclusive, float maxInclusive) noexcept;
+
+    //Each fill writes the next count values, the same as count single draws, and moves the stream past them.
+    void FillUints(std::uint32_t* out, std::size_t count, JobSystem* jobSystem = nullptr) noexcept;
+    void FillFloats(float* out, std::size_t count, float minInclusive, float maxInclusive, JobSystem* jobSystem = nullptr) noexcept;
+    void FillInts(int* out, std::size_t count, int minInclusive, int maxInclusive, JobSystem* jobSystem = nullptr) noexcept;
+
+private:
+    std::uint32_t _key{};
+    std::uint64_t _position{};
+};
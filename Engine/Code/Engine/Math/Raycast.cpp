@@ -0,0 +1,796 @@
+#include "Engine/Math/Raycast.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/Vertex3D.hpp"
+
+#include "Engine/Math/BVH.hpp"
+#include "Engine/Math/Capsule3.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Plane3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace {
+
+constexpr std::size_t MAX_STACK_SIZE = 128;
+constexpr float INF = std::numeric_limits<float>::infinity();
+
+static_assert(RayPacket3::MAX_RAYS % 4 == 0, "Packets are traced four lanes at a time.");
+
+void SetHit(const Vector3& origin, const Vector3& displacement, float t, const Vector3& normal, RaycastHit3& hit) noexcept {
+    hit.t = t;
+    hit.point = origin + displacement * t;
+    hit.normal = normal;
+    hit.index = 0;
+}
+
+void SetInsideHit(const Vector3& origin, const Vector3& displacement, RaycastHit3& hit) noexcept {
+    SetHit(origin, displacement, 0.0f, -displacement.GetNormalize(), hit);
+}
+
+//First root of a sphere the segment starts outside of.
+bool IntersectSphereSurface(const Vector3& m, const Vector3& displacement, float radius, float& t) noexcept {
+    const auto a = MathUtils::DotProduct(displacement, displacement);
+    const auto b = MathUtils::DotProduct(m, displacement);
+    const auto c = MathUtils::DotProduct(m, m) - radius * radius;
+    const auto discriminant = b * b - a * c;
+    if(a == 0.0f || discriminant < 0.0f) {
+        return false;
+    }
+    t = (-b - std::sqrt(discriminant)) / a;
+    return 0.0f <= t && t <= 1.0f;
+}
+
+//Moller-Trumbore, two-sided, with the segment clipped to [0, tMax].
+bool IntersectTriangle(const Vector3& origin, const Vector3& displacement, const Vector3& a, const Vector3& b, const Vector3& c, float tMax, float& t) noexcept {
+    const auto e1 = b - a;
+    const auto e2 = c - a;
+    const auto p = MathUtils::CrossProduct(displacement, e2);
+    const auto det = MathUtils::DotProduct(e1, p);
+    if(det == 0.0f) {
+        return false;
+    }
+    const auto inv_det = 1.0f / det;
+    const auto s = origin - a;
+    const auto u = MathUtils::DotProduct(s, p) * inv_det;
+    if(u < 0.0f || 1.0f < u) {
+        return false;
+    }
+    const auto q = MathUtils::CrossProduct(s, e1);
+    const auto v = MathUtils::DotProduct(displacement, q) * inv_det;
+    if(v < 0.0f || 1.0f < u + v) {
+        return false;
+    }
+    t = MathUtils::DotProduct(e2, q) * inv_det;
+    return 0.0f <= t && t <= tMax;
+}
+
+Vector3 CalcTriangleNormal(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& displacement) noexcept {
+    const auto normal = MathUtils::CrossProduct(b - a, c - a).GetNormalize();
+    return MathUtils::DotProduct(normal, displacement) > 0.0f ? -normal : normal;
+}
+
+void GetTriangle(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, std::size_t triangle, Vector3& a, Vector3& b, Vector3& c) noexcept {
+    a = vbo[ibo[3 * triangle + 0]].position;
+    b = vbo[ibo[3 * triangle + 1]].position;
+    c = vbo[ibo[3 * triangle + 2]].position;
+}
+
+//Slab test clipped to [0, tMax]; tEntry is where the segment enters the box.
+bool EnterBox(const Vector3& origin, const Vector3& displacement, const Vector3& invDisplacement, const AABB3& box, float tMax, float& tEntry) noexcept {
+    const float origins[3] = {origin.x, origin.y, origin.z};
+    const float displacements[3] = {displacement.x, displacement.y, displacement.z};
+    const float inv_displacements[3] = {invDisplacement.x, invDisplacement.y, invDisplacement.z};
+    const float mins[3] = {box.mins.x, box.mins.y, box.mins.z};
+    const float maxs[3] = {box.maxs.x, box.maxs.y, box.maxs.z};
+    float t0 = 0.0f;
+    float t1 = tMax;
+    for(std::size_t axis = 0; axis < 3; ++axis) {
+        if(displacements[axis] == 0.0f) {
+            if(origins[axis] < mins[axis] || maxs[axis] < origins[axis]) {
+                return false;
+            }
+            continue;
+        }
+        const auto a = (mins[axis] - origins[axis]) * inv_displacements[axis];
+        const auto b = (maxs[axis] - origins[axis]) * inv_displacements[axis];
+        t0 = (std::max)(t0, (std::min)(a, b));
+        t1 = (std::min)(t1, (std::max)(a, b));
+        if(t1 < t0) {
+            return false;
+        }
+    }
+    tEntry = t0;
+    return true;
+}
+
+Vector3 CalcInverse(const Vector3& displacement) noexcept {
+    return Vector3{displacement.x != 0.0f ? 1.0f / displacement.x : 0.0f
+                  ,displacement.y != 0.0f ? 1.0f / displacement.y : 0.0f
+                  ,displacement.z != 0.0f ? 1.0f / displacement.z : 0.0f};
+}
+
+template<typename TraceRay>
+std::uint32_t TraceLanesSerial(const RayPacket3& rays, RayPacketHits3& hits, TraceRay&& traceRay) noexcept {
+    std::uint32_t updated = 0;
+    for(std::size_t lane = 0; lane < rays.count; ++lane) {
+        RaycastHit3 hit{};
+        if(traceRay(rays.Get(lane), hit) && hit.t < hits.t[lane]) {
+            hits.Set(lane, hit);
+            updated |= 1u << lane;
+        }
+    }
+    return updated;
+}
+
+#ifdef MATH_SIMD_SSE
+
+struct Lanes3 {
+    __m128 x;
+    __m128 y;
+    __m128 z;
+};
+
+Lanes3 SplatLanes(const Vector3& v) noexcept {
+    return Lanes3{_mm_set1_ps(v.x), _mm_set1_ps(v.y), _mm_set1_ps(v.z)};
+}
+
+Lanes3 operator+(const Lanes3& a, const Lanes3& b) noexcept {
+    return Lanes3{_mm_add_ps(a.x, b.x), _mm_add_ps(a.y, b.y), _mm_add_ps(a.z, b.z)};
+}
+
+Lanes3 operator-(const Lanes3& a, const Lanes3& b) noexcept {
+    return Lanes3{_mm_sub_ps(a.x, b.x), _mm_sub_ps(a.y, b.y), _mm_sub_ps(a.z, b.z)};
+}
+
+Lanes3 operator*(const Lanes3& a, __m128 scale) noexcept {
+    return Lanes3{_mm_mul_ps(a.x, scale), _mm_mul_ps(a.y, scale), _mm_mul_ps(a.z, scale)};
+}
+
+__m128 DotLanes(const Lanes3& a, const Lanes3& b) noexcept {
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.x, b.x), _mm_mul_ps(a.y, b.y)), _mm_mul_ps(a.z, b.z));
+}
+
+Lanes3 CrossLanes(const Lanes3& a, const Lanes3& b) noexcept {
+    return Lanes3{_mm_sub_ps(_mm_mul_ps(a.y, b.z), _mm_mul_ps(a.z, b.y))
+                 ,_mm_sub_ps(_mm_mul_ps(a.z, b.x), _mm_mul_ps(a.x, b.z))
+                 ,_mm_sub_ps(_mm_mul_ps(a.x, b.y), _mm_mul_ps(a.y, b.x))};
+}
+
+__m128 SelectLanes(__m128 mask, __m128 a, __m128 b) noexcept {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+Lanes3 SelectLanes(__m128 mask, const Lanes3& a, const Lanes3& b) noexcept {
+    return Lanes3{SelectLanes(mask, a.x, b.x), SelectLanes(mask, a.y, b.y), SelectLanes(mask, a.z, b.z)};
+}
+
+//Lane-wise Vector3::GetNormalize: zero-length vectors stay zero.
+Lanes3 NormalizeLanes(const Lanes3& a) noexcept {
+    const auto length = _mm_sqrt_ps(DotLanes(a, a));
+    const auto nonzero = _mm_cmpgt_ps(length, _mm_setzero_ps());
+    const auto inv_length = _mm_and_ps(nonzero, _mm_div_ps(_mm_set1_ps(1.0f), length));
+    return a * inv_length;
+}
+
+Lanes3 NegateLanes(const Lanes3& a) noexcept {
+    const auto sign = _mm_set1_ps(-0.0f);
+    return Lanes3{_mm_xor_ps(a.x, sign), _mm_xor_ps(a.y, sign), _mm_xor_ps(a.z, sign)};
+}
+
+__m128 ActiveLanes(std::size_t remaining) noexcept {
+    return _mm_cmplt_ps(_mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f), _mm_set1_ps(static_cast<float>(remaining)));
+}
+
+//Four segments of a packet with what every slab test needs.
+struct LaneRays {
+    Lanes3 origin;
+    Lanes3 displacement;
+    Lanes3 inv_displacement;
+    Lanes3 is_flat;
+    __m128 active;
+};
+
+LaneRays LoadLaneRays(const RayPacket3& rays, std::size_t lane) noexcept {
+    LaneRays result{};
+    result.origin = Lanes3{_mm_loadu_ps(rays.start_x.data() + lane), _mm_loadu_ps(rays.start_y.data() + lane), _mm_loadu_ps(rays.start_z.data() + lane)};
+    result.displacement = Lanes3{_mm_loadu_ps(rays.displacement_x.data() + lane), _mm_loadu_ps(rays.displacement_y.data() + lane), _mm_loadu_ps(rays.displacement_z.data() + lane)};
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps(1.0f);
+    result.is_flat = Lanes3{_mm_cmpeq_ps(result.displacement.x, zero), _mm_cmpeq_ps(result.displacement.y, zero), _mm_cmpeq_ps(result.displacement.z, zero)};
+    result.inv_displacement = Lanes3{_mm_andnot_ps(result.is_flat.x, _mm_div_ps(one, result.displacement.x))
+                                    ,_mm_andnot_ps(result.is_flat.y, _mm_div_ps(one, result.displacement.y))
+                                    ,_mm_andnot_ps(result.is_flat.z, _mm_div_ps(one, result.displacement.z))};
+    result.active = ActiveLanes(rays.count - lane);
+    return result;
+}
+
+//One slab of the lane-wise box test. Segments parallel to the slab get an unbounded interval
+//and are marked outside when they start outside it.
+void SlabLanes(__m128 origin, __m128 invDisplacement, __m128 isFlat, float lo, float hi, __m128& tNear, __m128& tFar, __m128& outside) noexcept {
+    const auto a = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(lo), origin), invDisplacement);
+    const auto b = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(hi), origin), invDisplacement);
+    tNear = SelectLanes(isFlat, _mm_set1_ps(-INF), _mm_min_ps(a, b));
+    tFar = SelectLanes(isFlat, _mm_set1_ps(INF), _mm_max_ps(a, b));
+    const auto off_slab = _mm_or_ps(_mm_cmplt_ps(origin, _mm_set1_ps(lo)), _mm_cmplt_ps(_mm_set1_ps(hi), origin));
+    outside = _mm_or_ps(outside, _mm_and_ps(isFlat, off_slab));
+}
+
+//Lane-wise EnterBox.
+__m128 EnterBoxLanes(const LaneRays& rays, const AABB3& box, __m128 tMax, __m128& tEntry) noexcept {
+    __m128 near_x, near_y, near_z, far_x, far_y, far_z;
+    auto outside = _mm_setzero_ps();
+    SlabLanes(rays.origin.x, rays.inv_displacement.x, rays.is_flat.x, box.mins.x, box.maxs.x, near_x, far_x, outside);
+    SlabLanes(rays.origin.y, rays.inv_displacement.y, rays.is_flat.y, box.mins.y, box.maxs.y, near_y, far_y, outside);
+    SlabLanes(rays.origin.z, rays.inv_displacement.z, rays.is_flat.z, box.mins.z, box.maxs.z, near_z, far_z, outside);
+    tEntry = _mm_max_ps(_mm_setzero_ps(), _mm_max_ps(near_x, _mm_max_ps(near_y, near_z)));
+    const auto t_exit = _mm_min_ps(tMax, _mm_min_ps(far_x, _mm_min_ps(far_y, far_z)));
+    return _mm_andnot_ps(outside, _mm_and_ps(rays.active, _mm_cmple_ps(tEntry, t_exit)));
+}
+
+//Writes the lanes in mask that hit closer than the packet's current hits. Returns the updated lanes.
+std::uint32_t StoreLanes(const LaneRays& rays, __m128 mask, __m128 t, const Lanes3& normal, std::uint32_t index, RayPacketHits3& hits, std::size_t lane) noexcept {
+    const auto best = _mm_loadu_ps(hits.t.data() + lane);
+    const auto closer = _mm_and_ps(_mm_and_ps(mask, rays.active), _mm_cmplt_ps(t, best));
+    const auto updated = static_cast<std::uint32_t>(_mm_movemask_ps(closer));
+    if(!updated) {
+        return 0;
+    }
+    const auto point = rays.origin + rays.displacement * t;
+    const auto blend = [closer, lane](std::array<float, RayPacket3::MAX_RAYS>& out, __m128 value) {
+        _mm_storeu_ps(out.data() + lane, SelectLanes(closer, value, _mm_loadu_ps(out.data() + lane)));
+    };
+    blend(hits.t, t);
+    blend(hits.point_x, point.x);
+    blend(hits.point_y, point.y);
+    blend(hits.point_z, point.z);
+    blend(hits.normal_x, normal.x);
+    blend(hits.normal_y, normal.y);
+    blend(hits.normal_z, normal.z);
+    for(std::size_t i = 0; i < 4; ++i) {
+        if(updated & (1u << i)) {
+            hits.index[lane + i] = index;
+        }
+    }
+    return updated << lane;
+}
+
+template<typename Kernel>
+std::uint32_t TraceLanes(const RayPacket3& rays, RayPacketHits3& hits, Kernel&& kernel) noexcept {
+    std::uint32_t updated = 0;
+    for(std::size_t lane = 0; lane < rays.count; lane += 4) {
+        const auto lane_rays = LoadLaneRays(rays, lane);
+        auto t = _mm_setzero_ps();
+        Lanes3 normal{};
+        const auto hit = kernel(lane_rays, t, normal);
+        updated |= StoreLanes(lane_rays, hit, t, normal, 0, hits, lane);
+    }
+    return updated;
+}
+
+__m128 RaycastLanes(const LaneRays& rays, const AABB3& box, __m128& t, Lanes3& normal) noexcept {
+    __m128 near_x, near_y, near_z, far_x, far_y, far_z;
+    auto outside = _mm_setzero_ps();
+    SlabLanes(rays.origin.x, rays.inv_displacement.x, rays.is_flat.x, box.mins.x, box.maxs.x, near_x, far_x, outside);
+    SlabLanes(rays.origin.y, rays.inv_displacement.y, rays.is_flat.y, box.mins.y, box.maxs.y, near_y, far_y, outside);
+    SlabLanes(rays.origin.z, rays.inv_displacement.z, rays.is_flat.z, box.mins.z, box.maxs.z, near_z, far_z, outside);
+    const auto zero = _mm_setzero_ps();
+    const auto t_min = _mm_max_ps(near_x, _mm_max_ps(near_y, near_z));
+    const auto t_max = _mm_min_ps(far_x, _mm_min_ps(far_y, far_z));
+    const auto hit = _mm_andnot_ps(outside, _mm_and_ps(_mm_cmpge_ps(t_max, _mm_max_ps(t_min, zero)), _mm_cmple_ps(t_min, _mm_set1_ps(1.0f))));
+    const auto inside = _mm_cmplt_ps(t_min, zero);
+    t = _mm_andnot_ps(inside, t_min);
+    //The face is on the first axis whose slab is entered last, facing against the segment.
+    const auto on_x = _mm_cmpeq_ps(near_x, t_min);
+    const auto on_y = _mm_andnot_ps(on_x, _mm_cmpeq_ps(near_y, t_min));
+    const auto on_z = _mm_andnot_ps(_mm_or_ps(on_x, on_y), _mm_cmpeq_ps(near_z, t_min));
+    const auto face_sign = [](__m128 d) { return SelectLanes(_mm_cmpgt_ps(d, _mm_setzero_ps()), _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f)); };
+    const Lanes3 face{_mm_and_ps(on_x, face_sign(rays.displacement.x)), _mm_and_ps(on_y, face_sign(rays.displacement.y)), _mm_and_ps(on_z, face_sign(rays.displacement.z))};
+    normal = SelectLanes(inside, NegateLanes(NormalizeLanes(rays.displacement)), face);
+    return hit;
+}
+
+//Lane-wise IntersectSphereSurface.
+__m128 IntersectSphereSurfaceLanes(const Lanes3& m, const Lanes3& displacement, __m128 radius, __m128& t) noexcept {
+    const auto a = DotLanes(displacement, displacement);
+    const auto b = DotLanes(m, displacement);
+    const auto c = _mm_sub_ps(DotLanes(m, m), _mm_mul_ps(radius, radius));
+    const auto discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(a, c));
+    const auto zero = _mm_setzero_ps();
+    t = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(zero, b), _mm_sqrt_ps(_mm_max_ps(discriminant, zero))), a);
+    const auto valid = _mm_and_ps(_mm_cmpneq_ps(a, zero), _mm_cmpge_ps(discriminant, zero));
+    return _mm_and_ps(valid, _mm_and_ps(_mm_cmple_ps(zero, t), _mm_cmple_ps(t, _mm_set1_ps(1.0f))));
+}
+
+__m128 RaycastLanes(const LaneRays& rays, const Sphere3& sphere, __m128& t, Lanes3& normal) noexcept {
+    const auto m = rays.origin - SplatLanes(sphere.center);
+    const auto radius = _mm_set1_ps(sphere.radius);
+    const auto inside = _mm_cmple_ps(_mm_sub_ps(DotLanes(m, m), _mm_mul_ps(radius, radius)), _mm_setzero_ps());
+    auto t_surface = _mm_setzero_ps();
+    const auto hit = _mm_or_ps(inside, IntersectSphereSurfaceLanes(m, rays.displacement, radius, t_surface));
+    t = _mm_andnot_ps(inside, t_surface);
+    const auto surface_normal = (m + rays.displacement * t) * _mm_set1_ps(1.0f / sphere.radius);
+    normal = SelectLanes(inside, NegateLanes(NormalizeLanes(rays.displacement)), surface_normal);
+    return hit;
+}
+
+__m128 RaycastLanes(const LaneRays& rays, const Capsule3& capsule, __m128& t, Lanes3& normal) noexcept {
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps(1.0f);
+    const auto radius = _mm_set1_ps(capsule.radius);
+    const auto r2 = _mm_mul_ps(radius, radius);
+    const auto inv_radius = _mm_set1_ps(1.0f / capsule.radius);
+    const auto ba_scalar = capsule.line.end - capsule.line.start;
+    const auto ba = SplatLanes(ba_scalar);
+    const auto baba = _mm_set1_ps(MathUtils::DotProduct(ba_scalar, ba_scalar));
+    const auto oa = rays.origin - SplatLanes(capsule.line.start);
+    const auto baoa = DotLanes(ba, oa);
+    const auto has_length = _mm_cmpgt_ps(baba, zero);
+    const auto projection = _mm_and_ps(has_length, _mm_min_ps(_mm_max_ps(_mm_div_ps(baoa, baba), zero), one));
+    const auto closest = oa - ba * projection;
+    const auto inside = _mm_cmple_ps(DotLanes(closest, closest), r2);
+
+    //Cylinder side, kept only between the two end caps.
+    const auto& d = rays.displacement;
+    const auto bard = DotLanes(ba, d);
+    const auto qa = _mm_sub_ps(_mm_mul_ps(baba, DotLanes(d, d)), _mm_mul_ps(bard, bard));
+    const auto qb = _mm_sub_ps(_mm_mul_ps(baba, DotLanes(d, oa)), _mm_mul_ps(baoa, bard));
+    const auto qc = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(baba, DotLanes(oa, oa)), _mm_mul_ps(baoa, baoa)), _mm_mul_ps(r2, baba));
+    const auto h = _mm_sub_ps(_mm_mul_ps(qb, qb), _mm_mul_ps(qa, qc));
+    const auto t_side = _mm_div_ps(_mm_sub_ps(_mm_sub_ps(zero, qb), _mm_sqrt_ps(_mm_max_ps(h, zero))), qa);
+    const auto y = _mm_add_ps(baoa, _mm_mul_ps(t_side, bard));
+    auto side = _mm_and_ps(_mm_cmpgt_ps(qa, zero), _mm_cmpge_ps(h, zero));
+    side = _mm_and_ps(side, _mm_and_ps(_mm_cmple_ps(zero, t_side), _mm_cmple_ps(t_side, one)));
+    side = _mm_and_ps(side, _mm_and_ps(_mm_cmpgt_ps(y, zero), _mm_cmplt_ps(y, baba)));
+    auto best = SelectLanes(side, t_side, _mm_set1_ps(INF));
+    auto best_normal = (oa + d * t_side - ba * _mm_div_ps(y, baba)) * inv_radius;
+
+    //End caps.
+    const auto cap = [&](const Lanes3& m) {
+        auto t_cap = zero;
+        const auto on_cap = IntersectSphereSurfaceLanes(m, d, radius, t_cap);
+        const auto closer = _mm_and_ps(on_cap, _mm_cmplt_ps(t_cap, best));
+        best = SelectLanes(closer, t_cap, best);
+        best_normal = SelectLanes(closer, (m + d * t_cap) * inv_radius, best_normal);
+    };
+    cap(oa);
+    cap(rays.origin - SplatLanes(capsule.line.end));
+
+    t = _mm_andnot_ps(inside, best);
+    normal = SelectLanes(inside, NegateLanes(NormalizeLanes(d)), best_normal);
+    return _mm_or_ps(inside, _mm_cmplt_ps(best, _mm_set1_ps(INF)));
+}
+
+__m128 RaycastLanes(const LaneRays& rays, const Plane3& plane, __m128& t, Lanes3& normal) noexcept {
+    const auto zero = _mm_setzero_ps();
+    const auto n = SplatLanes(plane.normal);
+    const auto distance = _mm_sub_ps(DotLanes(n, rays.origin), _mm_set1_ps(plane.dist));
+    const auto denominator = DotLanes(n, rays.displacement);
+    const auto on_plane = _mm_cmpeq_ps(distance, zero);
+    const auto t_cross = _mm_div_ps(_mm_sub_ps(zero, distance), denominator);
+    const auto crosses = _mm_and_ps(_mm_cmpneq_ps(denominator, zero), _mm_and_ps(_mm_cmple_ps(zero, t_cross), _mm_cmple_ps(t_cross, _mm_set1_ps(1.0f))));
+    t = _mm_andnot_ps(on_plane, t_cross);
+    normal = SelectLanes(_mm_cmplt_ps(distance, zero), NegateLanes(n), n);
+    return _mm_or_ps(on_plane, crosses);
+}
+
+//Lane-wise IntersectTriangle.
+__m128 IntersectTriangleLanes(const LaneRays& rays, const Vector3& a, const Vector3& b, const Vector3& c, __m128 tMax, __m128& t) noexcept {
+    const auto zero = _mm_setzero_ps();
+    const auto one = _mm_set1_ps(1.0f);
+    const auto e1 = SplatLanes(b - a);
+    const auto e2 = SplatLanes(c - a);
+    const auto p = CrossLanes(rays.displacement, e2);
+    const auto det = DotLanes(e1, p);
+    const auto inv_det = _mm_div_ps(one, det);
+    const auto s = rays.origin - SplatLanes(a);
+    const auto u = _mm_mul_ps(DotLanes(s, p), inv_det);
+    const auto q = CrossLanes(s, e1);
+    const auto v = _mm_mul_ps(DotLanes(rays.displacement, q), inv_det);
+    t = _mm_mul_ps(DotLanes(e2, q), inv_det);
+    auto hit = _mm_and_ps(_mm_cmpneq_ps(det, zero), _mm_and_ps(_mm_cmple_ps(zero, u), _mm_cmple_ps(u, one)));
+    hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(zero, v), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+    return _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(zero, t), _mm_cmple_ps(t, tMax)));
+}
+
+Lanes3 CalcTriangleNormalLanes(const LaneRays& rays, const Vector3& a, const Vector3& b, const Vector3& c) noexcept {
+    const auto n = SplatLanes(MathUtils::CrossProduct(b - a, c - a).GetNormalize());
+    return SelectLanes(_mm_cmpgt_ps(DotLanes(n, rays.displacement), _mm_setzero_ps()), NegateLanes(n), n);
+}
+
+#endif
+
+} //End anonymous
+
+void RayPacket3::Set(std::size_t lane, const LineSegment3& segment) noexcept {
+    const auto displacement = segment.CalcDisplacement();
+    start_x[lane] = segment.start.x;
+    start_y[lane] = segment.start.y;
+    start_z[lane] = segment.start.z;
+    displacement_x[lane] = displacement.x;
+    displacement_y[lane] = displacement.y;
+    displacement_z[lane] = displacement.z;
+}
+
+LineSegment3 RayPacket3::Get(std::size_t lane) const noexcept {
+    const Vector3 start{start_x[lane], start_y[lane], start_z[lane]};
+    return LineSegment3{start, start + Vector3{displacement_x[lane], displacement_y[lane], displacement_z[lane]}};
+}
+
+RayPacketHits3::RayPacketHits3() noexcept {
+    Reset();
+}
+
+void RayPacketHits3::Reset() noexcept {
+    t.fill(INF);
+}
+
+bool RayPacketHits3::IsHit(std::size_t lane) const noexcept {
+    return t[lane] < INF;
+}
+
+RaycastHit3 RayPacketHits3::Get(std::size_t lane) const noexcept {
+    RaycastHit3 hit{};
+    hit.point = Vector3{point_x[lane], point_y[lane], point_z[lane]};
+    hit.normal = Vector3{normal_x[lane], normal_y[lane], normal_z[lane]};
+    hit.t = t[lane];
+    hit.index = index[lane];
+    return hit;
+}
+
+void RayPacketHits3::Set(std::size_t lane, const RaycastHit3& hit) noexcept {
+    t[lane] = hit.t;
+    point_x[lane] = hit.point.x;
+    point_y[lane] = hit.point.y;
+    point_z[lane] = hit.point.z;
+    normal_x[lane] = hit.normal.x;
+    normal_y[lane] = hit.normal.y;
+    normal_z[lane] = hit.normal.z;
+    index[lane] = static_cast<std::uint32_t>(hit.index);
+}
+
+namespace MathUtils {
+
+bool Raycast(const LineSegment3& segment, const AABB3& box, RaycastHit3& hit) noexcept {
+    const auto origin = segment.start;
+    const auto displacement = segment.CalcDisplacement();
+    const float origins[3] = {origin.x, origin.y, origin.z};
+    const float displacements[3] = {displacement.x, displacement.y, displacement.z};
+    const float mins[3] = {box.mins.x, box.mins.y, box.mins.z};
+    const float maxs[3] = {box.maxs.x, box.maxs.y, box.maxs.z};
+    float t_min = -INF;
+    float t_max = INF;
+    std::size_t face_axis = 3;
+    for(std::size_t axis = 0; axis < 3; ++axis) {
+        if(displacements[axis] == 0.0f) {
+            if(origins[axis] < mins[axis] || maxs[axis] < origins[axis]) {
+                return false;
+            }
+            continue;
+        }
+        const auto inv_displacement = 1.0f / displacements[axis];
+        const auto a = (mins[axis] - origins[axis]) * inv_displacement;
+        const auto b = (maxs[axis] - origins[axis]) * inv_displacement;
+        const auto t_near = (std::min)(a, b);
+        if(t_min < t_near) {
+            t_min = t_near;
+            face_axis = axis;
+        }
+        t_max = (std::min)(t_max, (std::max)(a, b));
+    }
+    if(t_max < (std::max)(t_min, 0.0f) || 1.0f < t_min) {
+        return false;
+    }
+    if(t_min < 0.0f) {
+        SetInsideHit(origin, displacement, hit);
+        return true;
+    }
+    float normal[3] = {0.0f, 0.0f, 0.0f};
+    normal[face_axis] = 0.0f < displacements[face_axis] ? -1.0f : 1.0f;
+    SetHit(origin, displacement, t_min, Vector3{normal[0], normal[1], normal[2]}, hit);
+    return true;
+}
+
+bool Raycast(const LineSegment3& segment, const Sphere3& sphere, RaycastHit3& hit) noexcept {
+    const auto origin = segment.start;
+    const auto displacement = segment.CalcDisplacement();
+    const auto m = origin - sphere.center;
+    if(DotProduct(m, m) - sphere.radius * sphere.radius <= 0.0f) {
+        SetInsideHit(origin, displacement, hit);
+        return true;
+    }
+    float t = 0.0f;
+    if(!IntersectSphereSurface(m, displacement, sphere.radius, t)) {
+        return false;
+    }
+    SetHit(origin, displacement, t, (m + displacement * t) * (1.0f / sphere.radius), hit);
+    return true;
+}
+
+bool Raycast(const LineSegment3& segment, const Capsule3& capsule, RaycastHit3& hit) noexcept {
+    const auto origin = segment.start;
+    const auto d = segment.CalcDisplacement();
+    const auto ba = capsule.line.end - capsule.line.start;
+    const auto oa = origin - capsule.line.start;
+    const auto baba = DotProduct(ba, ba);
+    const auto baoa = DotProduct(ba, oa);
+    const auto r2 = capsule.radius * capsule.radius;
+    const auto projection = 0.0f < baba ? (std::min)((std::max)(baoa / baba, 0.0f), 1.0f) : 0.0f;
+    const auto closest = oa - ba * projection;
+    if(DotProduct(closest, closest) <= r2) {
+        SetInsideHit(origin, d, hit);
+        return true;
+    }
+    //Cylinder side, kept only between the two end caps.
+    const auto inv_radius = 1.0f / capsule.radius;
+    const auto bard = DotProduct(ba, d);
+    const auto qa = baba * DotProduct(d, d) - bard * bard;
+    const auto qb = baba * DotProduct(d, oa) - baoa * bard;
+    const auto qc = baba * DotProduct(oa, oa) - baoa * baoa - r2 * baba;
+    const auto h = qb * qb - qa * qc;
+    float best = INF;
+    Vector3 best_normal{};
+    if(0.0f < qa && 0.0f <= h) {
+        const auto t = (-qb - std::sqrt(h)) / qa;
+        const auto y = baoa + t * bard;
+        if(0.0f <= t && t <= 1.0f && 0.0f < y && y < baba) {
+            best = t;
+            best_normal = (oa + d * t - ba * (y / baba)) * inv_radius;
+        }
+    }
+    //End caps.
+    for(const auto& m : {oa, origin - capsule.line.end}) {
+        float t = 0.0f;
+        if(IntersectSphereSurface(m, d, capsule.radius, t) && t < best) {
+            best = t;
+            best_normal = (m + d * t) * inv_radius;
+        }
+    }
+    if(best == INF) {
+        return false;
+    }
+    SetHit(origin, d, best, best_normal, hit);
+    return true;
+}
+
+bool Raycast(const LineSegment3& segment, const Plane3& plane, RaycastHit3& hit) noexcept {
+    const auto origin = segment.start;
+    const auto displacement = segment.CalcDisplacement();
+    const auto distance = DotProduct(plane.normal, origin) - plane.dist;
+    const auto normal = distance < 0.0f ? -plane.normal : plane.normal;
+    if(distance == 0.0f) {
+        SetHit(origin, displacement, 0.0f, normal, hit);
+        return true;
+    }
+    const auto denominator = DotProduct(plane.normal, displacement);
+    if(denominator == 0.0f) {
+        return false;
+    }
+    const auto t = -distance / denominator;
+    if(t < 0.0f || 1.0f < t) {
+        return false;
+    }
+    SetHit(origin, displacement, t, normal, hit);
+    return true;
+}
+
+bool Raycast(const LineSegment3& segment, const Vector3& a, const Vector3& b, const Vector3& c, RaycastHit3& hit) noexcept {
+    const auto origin = segment.start;
+    const auto displacement = segment.CalcDisplacement();
+    float t = 0.0f;
+    if(!IntersectTriangle(origin, displacement, a, b, c, 1.0f, t)) {
+        return false;
+    }
+    SetHit(origin, displacement, t, CalcTriangleNormal(a, b, c, displacement), hit);
+    return true;
+}
+
+std::vector<AABB3> CalcTriangleBounds(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo) noexcept {
+    std::vector<AABB3> bounds(ibo.size() / 3);
+    for(std::size_t i = 0; i < bounds.size(); ++i) {
+        Vector3 a, b, c;
+        GetTriangle(vbo, ibo, i, a, b, c);
+        bounds[i].mins = Vector3{(std::min)(a.x, (std::min)(b.x, c.x)), (std::min)(a.y, (std::min)(b.y, c.y)), (std::min)(a.z, (std::min)(b.z, c.z))};
+        bounds[i].maxs = Vector3{(std::max)(a.x, (std::max)(b.x, c.x)), (std::max)(a.y, (std::max)(b.y, c.y)), (std::max)(a.z, (std::max)(b.z, c.z))};
+    }
+    return bounds;
+}
+
+bool Raycast(const LineSegment3& segment, const BVH& triangles, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, RaycastHit3& hit) noexcept {
+    const auto& nodes = triangles.GetNodes();
+    const auto& indices = triangles.GetPrimitiveIndices();
+    if(nodes.empty()) {
+        return false;
+    }
+    const auto origin = segment.start;
+    const auto displacement = segment.CalcDisplacement();
+    const auto inv_displacement = CalcInverse(displacement);
+    float root_t = 0.0f;
+    if(!EnterBox(origin, displacement, inv_displacement, nodes[0].bounds, 1.0f, root_t)) {
+        return false;
+    }
+    //Nearer child first; anything entered beyond the closest hit so far is skipped.
+    float best_t = 1.0f;
+    std::size_t best_triangle = 0;
+    bool found = false;
+    std::array<std::pair<std::uint32_t, float>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, root_t);
+    while(top) {
+        const auto entry = stack[--top];
+        if(found && best_t < entry.second) {
+            continue;
+        }
+        const auto& node = nodes[entry.first];
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                Vector3 a, b, c;
+                GetTriangle(vbo, ibo, indices[i], a, b, c);
+                float t = 0.0f;
+                if(IntersectTriangle(origin, displacement, a, b, c, best_t, t) && (!found || t < best_t)) {
+                    found = true;
+                    best_t = t;
+                    best_triangle = indices[i];
+                }
+            }
+            continue;
+        }
+        float t_left = 0.0f;
+        float t_right = 0.0f;
+        const bool hit_left = EnterBox(origin, displacement, inv_displacement, nodes[node.first].bounds, best_t, t_left);
+        const bool hit_right = EnterBox(origin, displacement, inv_displacement, nodes[node.first + 1].bounds, best_t, t_right);
+        if(hit_left && hit_right) {
+            const bool left_first = t_left <= t_right;
+            stack[top++] = left_first ? std::make_pair(node.first + 1, t_right) : std::make_pair(node.first, t_left);
+            stack[top++] = left_first ? std::make_pair(node.first, t_left) : std::make_pair(node.first + 1, t_right);
+        } else if(hit_left) {
+            stack[top++] = std::make_pair(node.first, t_left);
+        } else if(hit_right) {
+            stack[top++] = std::make_pair(node.first + 1, t_right);
+        }
+    }
+    if(!found) {
+        return false;
+    }
+    Vector3 a, b, c;
+    GetTriangle(vbo, ibo, best_triangle, a, b, c);
+    SetHit(origin, displacement, best_t, CalcTriangleNormal(a, b, c, displacement), hit);
+    hit.index = best_triangle;
+    return true;
+}
+
+std::uint32_t Raycast(const RayPacket3& rays, const AABB3& box, RayPacketHits3& hits) noexcept {
+#ifdef MATH_SIMD_SSE
+    return TraceLanes(rays, hits, [&box](const LaneRays& lanes, __m128& t, Lanes3& normal) { return RaycastLanes(lanes, box, t, normal); });
+#else
+    return TraceLanesSerial(rays, hits, [&box](const LineSegment3& segment, RaycastHit3& hit) { return Raycast(segment, box, hit); });
+#endif
+}
+
+std::uint32_t Raycast(const RayPacket3& rays, const Sphere3& sphere, RayPacketHits3& hits) noexcept {
+#ifdef MATH_SIMD_SSE
+    return TraceLanes(rays, hits, [&sphere](const LaneRays& lanes, __m128& t, Lanes3& normal) { return RaycastLanes(lanes, sphere, t, normal); });
+#else
+    return TraceLanesSerial(rays, hits, [&sphere](const LineSegment3& segment, RaycastHit3& hit) { return Raycast(segment, sphere, hit); });
+#endif
+}
+
+std::uint32_t Raycast(const RayPacket3& rays, const Capsule3& capsule, RayPacketHits3& hits) noexcept {
+#ifdef MATH_SIMD_SSE
+    return TraceLanes(rays, hits, [&capsule](const LaneRays& lanes, __m128& t, Lanes3& normal) { return RaycastLanes(lanes, capsule, t, normal); });
+#else
+    return TraceLanesSerial(rays, hits, [&capsule](const LineSegment3& segment, RaycastHit3& hit) { return Raycast(segment, capsule, hit); });
+#endif
+}
+
+std::uint32_t Raycast(const RayPacket3& rays, const Plane3& plane, RayPacketHits3& hits) noexcept {
+#ifdef MATH_SIMD_SSE
+    return TraceLanes(rays, hits, [&plane](const LaneRays& lanes, __m128& t, Lanes3& normal) { return RaycastLanes(lanes, plane, t, normal); });
+#else
+    return TraceLanesSerial(rays, hits, [&plane](const LineSegment3& segment, RaycastHit3& hit) { return Raycast(segment, plane, hit); });
+#endif
+}
+
+std::uint32_t Raycast(const RayPacket3& rays, const Vector3& a, const Vector3& b, const Vector3& c, RayPacketHits3& hits) noexcept {
+#ifdef MATH_SIMD_SSE
+    return TraceLanes(rays, hits, [&](const LaneRays& lanes, __m128& t, Lanes3& normal) {
+        normal = CalcTriangleNormalLanes(lanes, a, b, c);
+        return IntersectTriangleLanes(lanes, a, b, c, _mm_set1_ps(1.0f), t);
+    });
+#else
+    return TraceLanesSerial(rays, hits, [&](const LineSegment3& segment, RaycastHit3& hit) { return Raycast(segment, a, b, c, hit); });
+#endif
+}
+
+std::uint32_t Raycast(const RayPacket3& rays, const BVH& triangles, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, RayPacketHits3& hits) noexcept {
+#ifdef MATH_SIMD_SSE
+    const auto& nodes = triangles.GetNodes();
+    const auto& indices = triangles.GetPrimitiveIndices();
+    if(nodes.empty() || !rays.count) {
+        return 0;
+    }
+    constexpr std::size_t GROUP_COUNT = RayPacket3::MAX_RAYS / 4;
+    const std::size_t group_count = (rays.count + 3) / 4;
+    std::array<LaneRays, GROUP_COUNT> groups{};
+    for(std::size_t group = 0; group < group_count; ++group) {
+        groups[group] = LoadLaneRays(rays, 4 * group);
+    }
+    //Closest hit of each lane clipped to the segment, and the farthest of them for culling.
+    const auto calc_t_max = [&hits](std::size_t lane) { return _mm_min_ps(_mm_loadu_ps(hits.t.data() + lane), _mm_set1_ps(1.0f)); };
+    const auto calc_cull_t = [&]() {
+        auto t = 0.0f;
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            t = (std::max)(t, (std::min)(hits.t[lane], 1.0f));
+        }
+        return t;
+    };
+    //Nearest entry among the lanes that enter the box, or infinity when none do.
+    const auto enter = [&](const AABB3& box) {
+        auto nearest = _mm_set1_ps(INF);
+        for(std::size_t group = 0; group < group_count; ++group) {
+            auto t_entry = _mm_setzero_ps();
+            const auto entered = EnterBoxLanes(groups[group], box, calc_t_max(4 * group), t_entry);
+            nearest = _mm_min_ps(nearest, SelectLanes(entered, t_entry, _mm_set1_ps(INF)));
+        }
+        nearest = _mm_min_ps(nearest, _mm_shuffle_ps(nearest, nearest, _MM_SHUFFLE(2, 3, 0, 1)));
+        nearest = _mm_min_ps(nearest, _mm_shuffle_ps(nearest, nearest, _MM_SHUFFLE(1, 0, 3, 2)));
+        return _mm_cvtss_f32(nearest);
+    };
+    std::uint32_t updated = 0;
+    const auto root_t = enter(nodes[0].bounds);
+    if(root_t == INF) {
+        return 0;
+    }
+    std::array<std::pair<std::uint32_t, float>, MAX_STACK_SIZE> stack{};
+    std::size_t top = 0;
+    stack[top++] = std::make_pair(0u, root_t);
+    auto cull_t = calc_cull_t();
+    while(top) {
+        const auto entry = stack[--top];
+        if(cull_t < entry.second) {
+            continue;
+        }
+        const auto& node = nodes[entry.first];
+        if(node.IsLeaf()) {
+            for(auto i = node.first; i < node.first + node.count; ++i) {
+                Vector3 a, b, c;
+                GetTriangle(vbo, ibo, indices[i], a, b, c);
+                for(std::size_t group = 0; group < group_count; ++group) {
+                    auto t = _mm_setzero_ps();
+                    const auto hit = IntersectTriangleLanes(groups[group], a, b, c, calc_t_max(4 * group), t);
+                    if(_mm_movemask_ps(_mm_and_ps(hit, groups[group].active))) {
+                        updated |= StoreLanes(groups[group], hit, t, CalcTriangleNormalLanes(groups[group], a, b, c), indices[i], hits, 4 * group);
+                    }
+                }
+            }
+            cull_t = calc_cull_t();
+            continue;
+        }
+        const auto t_left = enter(nodes[node.first].bounds);
+        const auto t_right = enter(nodes[node.first + 1].bounds);
+        const bool left_first = t_left <= t_right;
+        const auto first = left_first ? std::make_pair(node.first, t_left) : std::make_pair(node.first + 1, t_right);
+        const auto second = left_first ? std::make_pair(node.first + 1, t_right) : std::make_pair(node.first, t_left);
+        if(second.second != INF) {
+            stack[top++] = second;
+        }
+        if(first.second != INF) {
+            stack[top++] = first;
+        }
+    }
+    return updated;
+#else
+    return TraceLanesSerial(rays, hits, [&](const LineSegment3& segment, RaycastHit3& hit) { return Raycast(segment, triangles, vbo, ibo, hit); });
+#endif
+}
+
+} //End MathUtils
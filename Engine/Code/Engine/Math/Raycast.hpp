@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class BVH;
+class Capsule3;
+class LineSegment3;
+class Plane3;
+class Sphere3;
+class Vertex3D;
+
+//Raycasts that report where a segment first touches a shape.
+//t is the fraction along the segment, so the hit point is start + t * (end - start).
+//A segment that starts inside a solid hits it at t zero, with the normal facing back along the segment.
+//Planes and triangles are two-sided: the normal faces the side the segment starts on.
+class RaycastHit3 {
+public:
+    Vector3 point{};
+    Vector3 normal{};
+    float t = 0.0f;
+    //Mesh raycasts: the triangle hit, numbered in ibo order. Zero for the other shapes.
+    std::size_t index = 0;
+};
+
+//Up to MAX_RAYS segments stored lane by lane for the packet raycasts.
+class RayPacket3 {
+public:
+    static constexpr std::size_t MAX_RAYS = 8;
+
+    void Set(std::size_t lane, const LineSegment3& segment) noexcept;
+    LineSegment3 Get(std::size_t lane) const noexcept;
+
+    std::array<float, MAX_RAYS> start_x{};
+    std::array<float, MAX_RAYS> start_y{};
+    std::array<float, MAX_RAYS> start_z{};
+    std::array<float, MAX_RAYS> displacement_x{};
+    std::array<float, MAX_RAYS> displacement_y{};
+    std::array<float, MAX_RAYS> displacement_z{};
+    std::size_t count = 0;
+};
+
+//Closest hit so far for each lane of a RayPacket3. Lanes start with t at infinity, meaning no hit.
+class RayPacketHits3 {
+public:
+    RayPacketHits3() noexcept;
+
+    void Reset() noexcept;
+    bool IsHit(std::size_t lane) const noexcept;
+    RaycastHit3 Get(std::size_t lane) const noexcept;
+    void Set(std::size_t lane, const RaycastHit3& hit) noexcept;
+
+    std::array<float, RayPacket3::MAX_RAYS> t{};
+    std::array<float, RayPacket3::MAX_RAYS> point_x{};
+    std::array<float, RayPacket3::MAX_RAYS> point_y{};
+    std::array<float, RayPacket3::MAX_RAYS> point_z{};
+    std::array<float, RayPacket3::MAX_RAYS> normal_x{};
+    std::array<float, RayPacket3::MAX_RAYS> normal_y{};
+    std::array<float, RayPacket3::MAX_RAYS> normal_z{};
+    std::array<std::uint32_t, RayPacket3::MAX_RAYS> index{};
+};
+
+namespace MathUtils {
+
+bool Raycast(const LineSegment3& segment, const AABB3& box, RaycastHit3& hit) noexcept;
+bool Raycast(const LineSegment3& segment, const Sphere3& sphere, RaycastHit3& hit) noexcept;
+bool Raycast(const LineSegment3& segment, const Capsule3& capsule, RaycastHit3& hit) noexcept;
+bool Raycast(const LineSegment3& segment, const Plane3& plane, RaycastHit3& hit) noexcept;
+bool Raycast(const LineSegment3& segment, const Vector3& a, const Vector3& b, const Vector3& c, RaycastHit3& hit) noexcept;
+
+//Triangle meshes given as a vbo and an ibo of three indices per triangle, e.g. from FileUtils::Obj.
+//Build the BVH once over CalcTriangleBounds and keep it with the mesh.
+std::vector<AABB3> CalcTriangleBounds(const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo) noexcept;
+bool Raycast(const LineSegment3& segment, const BVH& triangles, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, RaycastHit3& hit) noexcept;
+
+//Packet forms trace every ray in the packet against the same shape, four lanes per step when SSE is available.
+//A lane is updated only when its hit is closer than the one already in hits, so a packet can be traced
+//against many shapes in turn. Returns a mask with bit i set when lane i was updated.
+std::uint32_t Raycast(const RayPacket3& rays, const AABB3& box, RayPacketHits3& hits) noexcept;
+std::uint32_t Raycast(const RayPacket3& rays, const Sphere3& sphere, RayPacketHits3& hits) noexcept;
+std::uint32_t Raycast(const RayPacket3& rays, const Capsule3& capsule, RayPacketHits3& hits) noexcept;
+std::uint32_t Raycast(const RayPacket3& rays, const Plane3& plane, RayPacketHits3& hits) noexcept;
+std::uint32_t Raycast(const RayPacket3& rays, const Vector3& a, const Vector3& b, const Vector3& c, RayPacketHits3& hits) noexcept;
+//The packet walks the BVH together and skips a node only when no lane can hit anything closer in it,
+//so it pays off for coherent rays such as a camera's primary rays.
+std::uint32_t Raycast(const RayPacket3& rays, const BVH& triangles, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, RayPacketHits3& hits) noexcept;
+
+} //End MathUtils
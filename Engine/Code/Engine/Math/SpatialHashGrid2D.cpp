@@ -0,0 +1,158 @@
+#include "Engine/Math/SpatialHashGrid2D.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SpatialHashGrid2D::SpatialHashGrid2D(float cellSize) noexcept
+    : Broadphase2D()
+    , _cell_size((std::max)(cellSize, 0.0001f))
+    , _inv_cell_size(1.0f / _cell_size)
+{
+    /* DO NOTHING */
+}
+
+SpatialHashGrid2D::~SpatialHashGrid2D() noexcept {
+    /* DO NOTHING */
+}
+
+float SpatialHashGrid2D::GetCellSize() const noexcept {
+    return _cell_size;
+}
+
+std::size_t SpatialHashGrid2D::GetOccupiedCellCount() const noexcept {
+    return _cells.size();
+}
+
+IntVector2 SpatialHashGrid2D::CalcCellCoords(const Vector2& point) const noexcept {
+    return IntVector2{static_cast<int>(std::floor(point.x * _inv_cell_size)), static_cast<int>(std::floor(point.y * _inv_cell_size))};
+}
+
+SpatialHashGrid2D::CellRange SpatialHashGrid2D::CalcCellRange(const AABB2& bounds) const noexcept {
+    return CellRange{CalcCellCoords(bounds.mins), CalcCellCoords(bounds.maxs)};
+}
+
+std::uint64_t SpatialHashGrid2D::CalcCellKey(const IntVector2& coords) noexcept {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(coords.x)) << 32) | static_cast<std::uint32_t>(coords.y);
+}
+
+void SpatialHashGrid2D::AddToCells(std::size_t proxy, const CellRange& range) noexcept {
+    for(int y = range.mins.y; y <= range.maxs.y; ++y) {
+        for(int x = range.mins.x; x <= range.maxs.x; ++x) {
+            const IntVector2 coords{x, y};
+            auto& cell = _cells[CalcCellKey(coords)];
+            cell.coords = coords;
+            cell.proxies.push_back(static_cast<std::uint32_t>(proxy));
+        }
+    }
+}
+
+void SpatialHashGrid2D::RemoveFromCells(std::size_t proxy, const CellRange& range) noexcept {
+    for(int y = range.mins.y; y <= range.maxs.y; ++y) {
+        for(int x = range.mins.x; x <= range.maxs.x; ++x) {
+            const auto found = _cells.find(CalcCellKey(IntVector2{x, y}));
+            if(found == std::end(_cells)) {
+                continue;
+            }
+            auto& proxies = found->second.proxies;
+            const auto iter = std::find(std::begin(proxies), std::end(proxies), static_cast<std::uint32_t>(proxy));
+            if(iter != std::end(proxies)) {
+                *iter = proxies.back();
+                proxies.pop_back();
+            }
+            if(proxies.empty()) {
+                _cells.erase(found);
+            }
+        }
+    }
+}
+
+void SpatialHashGrid2D::OnInsert(std::size_t proxy) noexcept {
+    if(_ranges.size() <= proxy) {
+        _ranges.resize(proxy + 1);
+    }
+    _ranges[proxy] = CalcCellRange(GetBounds(proxy));
+    AddToCells(proxy, _ranges[proxy]);
+}
+
+void SpatialHashGrid2D::OnMove(std::size_t proxy, const AABB2& /*oldBounds*/) noexcept {
+    //Most moves stay within the same cells and only need the new bounds.
+    const auto range = CalcCellRange(GetBounds(proxy));
+    auto& old_range = _ranges[proxy];
+    if(range.mins == old_range.mins && range.maxs == old_range.maxs) {
+        return;
+    }
+    RemoveFromCells(proxy, old_range);
+    old_range = range;
+    AddToCells(proxy, range);
+}
+
+void SpatialHashGrid2D::OnRemove(std::size_t proxy) noexcept {
+    RemoveFromCells(proxy, _ranges[proxy]);
+}
+
+void SpatialHashGrid2D::OnClear() noexcept {
+    _cells.clear();
+    _ranges.clear();
+}
+
+void SpatialHashGrid2D::QueryRegion(const AABB2& region, std::vector<std::size_t>& results) const noexcept {
+    const auto range = CalcCellRange(region);
+    for(int y = range.mins.y; y <= range.maxs.y; ++y) {
+        for(int x = range.mins.x; x <= range.maxs.x; ++x) {
+            const IntVector2 coords{x, y};
+            const auto found = _cells.find(CalcCellKey(coords));
+            if(found == std::end(_cells)) {
+                continue;
+            }
+            for(const auto proxy : found->second.proxies) {
+                const auto& bounds = GetBounds(proxy);
+                if(!MathUtils::DoAABBsOverlap(region, bounds)) {
+                    continue;
+                }
+                //A proxy spanning several cells is reported only from the cell holding
+                //the lower corner of its overlap with the region.
+                const Vector2 corner{(std::max)(region.mins.x, bounds.mins.x), (std::max)(region.mins.y, bounds.mins.y)};
+                if(CalcCellCoords(corner) == coords) {
+                    results.push_back(proxy);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHashGrid2D::QueryPoint(const Vector2& point, std::vector<std::size_t>& results) const noexcept {
+    const auto found = _cells.find(CalcCellKey(CalcCellCoords(point)));
+    if(found == std::end(_cells)) {
+        return;
+    }
+    for(const auto proxy : found->second.proxies) {
+        const auto& bounds = GetBounds(proxy);
+        if(bounds.mins.x <= point.x && point.x <= bounds.maxs.x && bounds.mins.y <= point.y && point.y <= bounds.maxs.y) {
+            results.push_back(proxy);
+        }
+    }
+}
+
+void SpatialHashGrid2D::QueryPairs(std::vector<proxy_pair_t>& results) const noexcept {
+    for(const auto& key_cell : _cells) {
+        const auto& cell = key_cell.second;
+        const auto& proxies = cell.proxies;
+        for(std::size_t i = 0; i < proxies.size(); ++i) {
+            const auto& a = GetBounds(proxies[i]);
+            for(std::size_t j = i + 1; j < proxies.size(); ++j) {
+                const auto& b = GetBounds(proxies[j]);
+                if(!MathUtils::DoAABBsOverlap(a, b)) {
+                    continue;
+                }
+                //Pairs sharing several cells are reported only from the cell holding the lower corner of their overlap.
+                const Vector2 corner{(std::max)(a.mins.x, b.mins.x), (std::max)(a.mins.y, b.mins.y)};
+                if(CalcCellCoords(corner) != cell.coords) {
+                    continue;
+                }
+                results.emplace_back((std::min)(proxies[i], proxies[j]), (std::max)(proxies[i], proxies[j]));
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Engine/Math/Broadphase2D.hpp"
+#include "Engine/Math/IntVector2.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+//Uniform grid broadphase. Only occupied cells are stored, keyed by cell coordinate.
+//Works best when the cell size is a little larger than a typical shape;
+//shapes much larger than a cell are stored in every cell they touch.
+class SpatialHashGrid2D : public Broadphase2D {
+public:
+    explicit SpatialHashGrid2D(float cellSize) noexcept;
+    SpatialHashGrid2D(const SpatialHashGrid2D& other) = default;
+    SpatialHashGrid2D(SpatialHashGrid2D&& other) = default;
+    SpatialHashGrid2D& operator=(const SpatialHashGrid2D& other) = default;
+    SpatialHashGrid2D& operator=(SpatialHashGrid2D&& other) = default;
+    virtual ~SpatialHashGrid2D() noexcept;
+
+    float GetCellSize() const noexcept;
+    std::size_t GetOccupiedCellCount() const noexcept;
+
+    virtual void QueryRegion(const AABB2& region, std::vector<std::size_t>& results) const noexcept override;
+    virtual void QueryPoint(const Vector2& point, std::vector<std::size_t>& results) const noexcept override;
+    virtual void QueryPairs(std::vector<proxy_pair_t>& results) const noexcept override;
+
+protected:
+    virtual void OnInsert(std::size_t proxy) noexcept override;
+    virtual void OnMove(std::size_t proxy, const AABB2& oldBounds) noexcept override;
+    virtual void OnRemove(std::size_t proxy) noexcept override;
+    virtual void OnClear() noexcept override;
+
+private:
+    struct Cell {
+        IntVector2 coords{};
+        std::vector<std::uint32_t> proxies{};
+    };
+    struct CellRange {
+        IntVector2 mins{};
+        IntVector2 maxs{};
+    };
+
+    IntVector2 CalcCellCoords(const Vector2& point) const noexcept;
+    CellRange CalcCellRange(const AABB2& bounds) const noexcept;
+    static std::uint64_t CalcCellKey(const IntVector2& coords) noexcept;
+    void AddToCells(std::size_t proxy, const CellRange& range) noexcept;
+    void RemoveFromCells(std::size_t proxy, const CellRange& range) noexcept;
+
+    float _cell_size = 1.0f;
+    float _inv_cell_size = 1.0f;
+    std::unordered_map<std::uint64_t, Cell> _cells{};
+    std::vector<CellRange> _ranges{};
+};
@@ -8,19 +8,6 @@
 #include <cmath>
 #include <sstream>
 
-const Vector2 Vector2::ZERO(0.0f, 0.0f);
-const Vector2 Vector2::X_AXIS(1.0f, 0.0f);
-const Vector2 Vector2::Y_AXIS(0.0f, 1.0f);
-const Vector2 Vector2::ONE(1.0f, 1.0);
-const Vector2 Vector2::XY_AXIS(1.0f, 1.0);
-const Vector2 Vector2::YX_AXIS(1.0f, 1.0);
-
-Vector2::Vector2(float initialX, float initialY) noexcept
-: x(initialX)
-, y(initialY)
-{
-    /* DO NOTHING */
-}
 
 Vector2::Vector2(const Vector3& rhs) noexcept
     : x(rhs.x)
@@ -57,82 +44,6 @@ Vector2::Vector2(const IntVector2& intvec2) noexcept
     /* DO NOTHING */
 }
 
-Vector2 Vector2::operator+(const Vector2& rhs) const noexcept {
-    return Vector2(x + rhs.x, y + rhs.y);
-}
-
-Vector2& Vector2::operator+=(const Vector2& rhs) noexcept {
-    x += rhs.x;
-    y += rhs.y;
-    return *this;
-}
-
-Vector2 Vector2::operator-(const Vector2& rhs) const noexcept {
-    return Vector2(x - rhs.x, y - rhs.y);
-}
-
-Vector2& Vector2::operator-=(const Vector2& rhs) noexcept {
-    x -= rhs.x;
-    y -= rhs.y;
-    return *this;
-}
-
-Vector2 Vector2::operator-() const noexcept {
-    return Vector2(-x, -y);
-}
-
-Vector2 Vector2::operator*(const Vector2& rhs) const noexcept {
-    return Vector2(x * rhs.x, y * rhs.y);
-}
-
-Vector2 operator*(float lhs, const Vector2& rhs) noexcept {
-    return Vector2(lhs * rhs.x, lhs * rhs.y);
-}
-
-Vector2 Vector2::operator*(float scalar) const noexcept {
-    return Vector2(x * scalar, y * scalar);
-}
-
-Vector2& Vector2::operator*=(float scalar) noexcept {
-    x *= scalar;
-    y *= scalar;
-    return *this;
-}
-
-Vector2& Vector2::operator*=(const Vector2& rhs) noexcept {
-    x *= rhs.x;
-    y *= rhs.y;
-    return *this;
-}
-
-Vector2 Vector2::operator/(float scalar) const noexcept {
-    return Vector2(x / scalar, y / scalar);
-}
-
-Vector2 Vector2::operator/=(float scalar) noexcept {
-    x /= scalar;
-    y /= scalar;
-    return *this;
-}
-
-Vector2 Vector2::operator/(const Vector2& rhs) const noexcept {
-    return Vector2(x / rhs.x, y / rhs.y);
-}
-
-Vector2 Vector2::operator/=(const Vector2& rhs) noexcept {
-    x /= rhs.x;
-    y /= rhs.y;
-    return *this;
-}
-
-bool Vector2::operator==(const Vector2& rhs) const noexcept {
-    return x == rhs.x && y == rhs.y;
-}
-
-bool Vector2::operator!=(const Vector2& rhs) const noexcept {
-    return !(*this == rhs);
-}
-
 
 std::ostream& operator<<(std::ostream& out_stream, const Vector2& v) noexcept {
     out_stream << '[' << v.x << ',' << v.y << ']';
@@ -156,11 +67,6 @@ std::istream& operator>>(std::istream& in_stream, Vector2& v) noexcept {
 }
 
 
-void Vector2::GetXY(float& outX, float& outY) const noexcept {
-    outX = x;
-    outY = y;
-}
-
 float* Vector2::GetAsFloatArray() noexcept {
     return &x;
 }
@@ -177,10 +83,6 @@ float Vector2::CalcLength() const noexcept {
     return std::sqrt(CalcLengthSquared());
 }
 
-float Vector2::CalcLengthSquared() const noexcept {
-    return x * x + y * y;
-}
-
 void Vector2::SetHeadingDegrees(float headingDegrees) noexcept {
     SetHeadingRadians(MathUtils::ConvertDegreesToRadians(headingDegrees));
 }
@@ -261,19 +163,6 @@ Vector2 Vector2::GetRightHandNormal() noexcept {
     return result;
 }
 
-void Vector2::Rotate90Degrees() noexcept {
-    SetXY(-y, x);
-}
-
-void Vector2::RotateNegative90Degrees() noexcept {
-    SetXY(y, -x);
-}
-
-void Vector2::SetXY(float newX, float newY) noexcept {
-    x = newX;
-    y = newY;
-}
-
 
 void swap(Vector2& a, Vector2& b) noexcept {
     std::swap(a.x, b.y);
@@ -23,41 +23,41 @@ public:
     ~Vector2() = default;
 
     explicit Vector2(const std::string& value) noexcept;
-    explicit Vector2(float initialX, float initialY) noexcept;
+    explicit constexpr Vector2(float initialX, float initialY) noexcept;
     explicit Vector2(const Vector3& rhs) noexcept;
     explicit Vector2(const IntVector2& intvec2) noexcept;
 
-    Vector2 operator+(const Vector2& rhs) const noexcept;
-    Vector2& operator+=(const Vector2& rhs) noexcept;
+    constexpr Vector2 operator+(const Vector2& rhs) const noexcept;
+    constexpr Vector2& operator+=(const Vector2& rhs) noexcept;
 
-    Vector2 operator-() const noexcept;
-    Vector2 operator-(const Vector2& rhs) const noexcept;
-    Vector2& operator-=(const Vector2& rhs) noexcept;
+    constexpr Vector2 operator-() const noexcept;
+    constexpr Vector2 operator-(const Vector2& rhs) const noexcept;
+    constexpr Vector2& operator-=(const Vector2& rhs) noexcept;
 
-    friend Vector2 operator*(float lhs, const Vector2& rhs) noexcept;
-    Vector2 operator*(float scalar) const noexcept;
-    Vector2& operator*=(float scalar) noexcept;
-    Vector2 operator*(const Vector2& rhs) const noexcept;
-    Vector2& operator*=(const Vector2& rhs) noexcept;
+    friend constexpr Vector2 operator*(float lhs, const Vector2& rhs) noexcept;
+    constexpr Vector2 operator*(float scalar) const noexcept;
+    constexpr Vector2& operator*=(float scalar) noexcept;
+    constexpr Vector2 operator*(const Vector2& rhs) const noexcept;
+    constexpr Vector2& operator*=(const Vector2& rhs) noexcept;
 
-    Vector2 operator/(float scalar) const noexcept;
-    Vector2 operator/=(float scalar) noexcept;
-    Vector2 operator/(const Vector2& rhs) const noexcept;
-    Vector2 operator/=(const Vector2& rhs) noexcept;
+    constexpr Vector2 operator/(float scalar) const noexcept;
+    constexpr Vector2 operator/=(float scalar) noexcept;
+    constexpr Vector2 operator/(const Vector2& rhs) const noexcept;
+    constexpr Vector2 operator/=(const Vector2& rhs) noexcept;
 
-    bool operator==(const Vector2& rhs) const noexcept;
-    bool operator!=(const Vector2& rhs) const noexcept;
+    constexpr bool operator==(const Vector2& rhs) const noexcept;
+    constexpr bool operator!=(const Vector2& rhs) const noexcept;
 
     friend std::ostream& operator<<(std::ostream& out_stream, const Vector2& v) noexcept;
     friend std::istream& operator>>(std::istream& in_stream, Vector2& v) noexcept;
 
-    void GetXY(float& outX, float& outY) const noexcept;
+    constexpr void GetXY(float& outX, float& outY) const noexcept;
     float* GetAsFloatArray() noexcept;
 
     float CalcHeadingRadians() const noexcept;
     float CalcHeadingDegrees() const noexcept;
     float CalcLength() const noexcept;
-    float CalcLengthSquared() const noexcept;
+    constexpr float CalcLengthSquared() const noexcept;
 
 
     void SetHeadingDegrees(float headingDegrees) noexcept;
@@ -74,11 +74,11 @@ public:
 
     Vector2 GetLeftHandNormal() noexcept;
     Vector2 GetRightHandNormal() noexcept;
-    void Rotate90Degrees() noexcept;
-    void RotateNegative90Degrees() noexcept;
+    constexpr void Rotate90Degrees() noexcept;
+    constexpr void RotateNegative90Degrees() noexcept;
     void RotateRadians(float radians) noexcept;
 
-    void SetXY(float newX, float newY) noexcept;
+    constexpr void SetXY(float newX, float newY) noexcept;
 
     float x = 0.0f;
     float y = 0.0f;
@@ -87,4 +87,116 @@ public:
 
 protected:
 private:
-};
\ No newline at end of file
+};
+
+constexpr Vector2::Vector2(float initialX, float initialY) noexcept
+: x(initialX)
+, y(initialY)
+{
+    /* DO NOTHING */
+}
+
+constexpr Vector2 Vector2::operator+(const Vector2& rhs) const noexcept {
+    return Vector2(x + rhs.x, y + rhs.y);
+}
+
+constexpr Vector2& Vector2::operator+=(const Vector2& rhs) noexcept {
+    x += rhs.x;
+    y += rhs.y;
+    return *this;
+}
+
+constexpr Vector2 Vector2::operator-(const Vector2& rhs) const noexcept {
+    return Vector2(x - rhs.x, y - rhs.y);
+}
+
+constexpr Vector2& Vector2::operator-=(const Vector2& rhs) noexcept {
+    x -= rhs.x;
+    y -= rhs.y;
+    return *this;
+}
+
+constexpr Vector2 Vector2::operator-() const noexcept {
+    return Vector2(-x, -y);
+}
+
+constexpr Vector2 Vector2::operator*(const Vector2& rhs) const noexcept {
+    return Vector2(x * rhs.x, y * rhs.y);
+}
+
+constexpr Vector2 operator*(float lhs, const Vector2& rhs) noexcept {
+    return Vector2(lhs * rhs.x, lhs * rhs.y);
+}
+
+constexpr Vector2 Vector2::operator*(float scalar) const noexcept {
+    return Vector2(x * scalar, y * scalar);
+}
+
+constexpr Vector2& Vector2::operator*=(float scalar) noexcept {
+    x *= scalar;
+    y *= scalar;
+    return *this;
+}
+
+constexpr Vector2& Vector2::operator*=(const Vector2& rhs) noexcept {
+    x *= rhs.x;
+    y *= rhs.y;
+    return *this;
+}
+
+constexpr Vector2 Vector2::operator/(float scalar) const noexcept {
+    return Vector2(x / scalar, y / scalar);
+}
+
+constexpr Vector2 Vector2::operator/=(float scalar) noexcept {
+    x /= scalar;
+    y /= scalar;
+    return *this;
+}
+
+constexpr Vector2 Vector2::operator/(const Vector2& rhs) const noexcept {
+    return Vector2(x / rhs.x, y / rhs.y);
+}
+
+constexpr Vector2 Vector2::operator/=(const Vector2& rhs) noexcept {
+    x /= rhs.x;
+    y /= rhs.y;
+    return *this;
+}
+
+constexpr bool Vector2::operator==(const Vector2& rhs) const noexcept {
+    return x == rhs.x && y == rhs.y;
+}
+
+constexpr bool Vector2::operator!=(const Vector2& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr void Vector2::GetXY(float& outX, float& outY) const noexcept {
+    outX = x;
+    outY = y;
+}
+
+constexpr float Vector2::CalcLengthSquared() const noexcept {
+    return x * x + y * y;
+}
+
+constexpr void Vector2::Rotate90Degrees() noexcept {
+    SetXY(-y, x);
+}
+
+constexpr void Vector2::RotateNegative90Degrees() noexcept {
+    SetXY(y, -x);
+}
+
+constexpr void Vector2::SetXY(float newX, float newY) noexcept {
+    x = newX;
+    y = newY;
+}
+
+inline constexpr Vector2 Vector2::ZERO(0.0f, 0.0f);
+inline constexpr Vector2 Vector2::X_AXIS(1.0f, 0.0f);
+inline constexpr Vector2 Vector2::Y_AXIS(0.0f, 1.0f);
+inline constexpr Vector2 Vector2::ONE(1.0f, 1.0f);
+inline constexpr Vector2 Vector2::XY_AXIS(1.0f, 1.0f);
+inline constexpr Vector2 Vector2::YX_AXIS(1.0f, 1.0f);
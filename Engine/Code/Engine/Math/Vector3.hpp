@@ -1,8 +1,9 @@
 #pragma once
 
+#include "Engine/Math/Vector2.hpp"
+
 #include <string>
 
-class Vector2;
 class IntVector3;
 class Vector4;
 class Quaternion;
@@ -28,50 +29,50 @@ public:
     ~Vector3() = default;
 
     explicit Vector3(const std::string& value) noexcept;
-    explicit Vector3(float initialX, float initialY, float initialZ) noexcept;
-    explicit Vector3(const Vector2& vec2) noexcept;
+    explicit constexpr Vector3(float initialX, float initialY, float initialZ) noexcept;
+    explicit constexpr Vector3(const Vector2& vec2) noexcept;
     explicit Vector3(const IntVector3& intvec3) noexcept;
-    explicit Vector3(const Vector2& xy, float initialZ) noexcept;
+    explicit constexpr Vector3(const Vector2& xy, float initialZ) noexcept;
     explicit Vector3(const Vector4& vec4) noexcept;
     explicit Vector3(const Quaternion& q) noexcept;
 
-    Vector3 operator+(const Vector3& rhs) const noexcept;
-    Vector3& operator+=(const Vector3& rhs) noexcept;
+    constexpr Vector3 operator+(const Vector3& rhs) const noexcept;
+    constexpr Vector3& operator+=(const Vector3& rhs) noexcept;
 
-    Vector3 operator-() const noexcept;
-    Vector3 operator-(const Vector3& rhs) const noexcept;
-    Vector3& operator-=(const Vector3& rhs) noexcept;
+    constexpr Vector3 operator-() const noexcept;
+    constexpr Vector3 operator-(const Vector3& rhs) const noexcept;
+    constexpr Vector3& operator-=(const Vector3& rhs) noexcept;
 
-    friend Vector3 operator*(float lhs, const Vector3& rhs) noexcept;
-    Vector3 operator*(float scalar) const noexcept;
-    Vector3& operator*=(float scalar) noexcept;
-    Vector3 operator*(const Vector3& rhs) const noexcept;
-    Vector3& operator*=(const Vector3& rhs) noexcept;
+    friend constexpr Vector3 operator*(float lhs, const Vector3& rhs) noexcept;
+    constexpr Vector3 operator*(float scalar) const noexcept;
+    constexpr Vector3& operator*=(float scalar) noexcept;
+    constexpr Vector3 operator*(const Vector3& rhs) const noexcept;
+    constexpr Vector3& operator*=(const Vector3& rhs) noexcept;
 
-    friend Vector3 operator/(float lhs, const Vector3& v) noexcept;
-    Vector3 operator/(float scalar) const noexcept;
-    Vector3 operator/=(float scalar) noexcept;
-    Vector3 operator/(const Vector3& rhs) const noexcept;
-    Vector3 operator/=(const Vector3& rhs) noexcept;
+    friend constexpr Vector3 operator/(float lhs, const Vector3& v) noexcept;
+    constexpr Vector3 operator/(float scalar) const noexcept;
+    constexpr Vector3 operator/=(float scalar) noexcept;
+    constexpr Vector3 operator/(const Vector3& rhs) const noexcept;
+    constexpr Vector3 operator/=(const Vector3& rhs) noexcept;
 
-    bool operator==(const Vector3& rhs) const noexcept;
-    bool operator!=(const Vector3& rhs) const noexcept;
+    constexpr bool operator==(const Vector3& rhs) const noexcept;
+    constexpr bool operator!=(const Vector3& rhs) const noexcept;
 
     friend std::ostream& operator<<(std::ostream& out_stream, const Vector3& v) noexcept;
     friend std::istream& operator>>(std::istream& in_stream, Vector3& v) noexcept;
 
-    void GetXYZ(float& outX, float& outY, float& outZ) const noexcept;
-    Vector2 GetXY() const noexcept;
-    Vector3 GetXYZ() const noexcept;
+    constexpr void GetXYZ(float& outX, float& outY, float& outZ) const noexcept;
+    constexpr Vector2 GetXY() const noexcept;
+    constexpr Vector3 GetXYZ() const noexcept;
     float* GetAsFloatArray() noexcept;
 
     float CalcLength() const noexcept;
-    float CalcLengthSquared() const noexcept;
+    constexpr float CalcLengthSquared() const noexcept;
     
     float Normalize() noexcept;
     Vector3 GetNormalize() const noexcept;
 
-    void SetXYZ(float newX, float newY, float newZ) noexcept;
+    constexpr void SetXYZ(float newX, float newY, float newZ) noexcept;
 
     float x = 0.0f;
     float y = 0.0f;
@@ -82,3 +83,146 @@ public:
 protected:
 private:
 };
+
+constexpr Vector3::Vector3(float initialX, float initialY, float initialZ) noexcept
+: x(initialX)
+, y(initialY)
+, z(initialZ)
+{
+    /* DO NOTHING */
+}
+
+constexpr Vector3::Vector3(const Vector2& xy, float initialZ) noexcept
+    : x(xy.x)
+    , y(xy.y)
+    , z(initialZ)
+{
+    /* DO NOTHING */
+}
+
+constexpr Vector3::Vector3(const Vector2& vec2) noexcept
+    : x(vec2.x)
+    , y(vec2.y)
+    , z(0.0f)
+{
+    /* DO NOTHING */
+}
+
+constexpr Vector3 Vector3::operator+(const Vector3& rhs) const noexcept {
+    return Vector3(x + rhs.x, y + rhs.y, z + rhs.z);
+}
+
+constexpr Vector3& Vector3::operator+=(const Vector3& rhs) noexcept {
+    x += rhs.x;
+    y += rhs.y;
+    z += rhs.z;
+    return *this;
+}
+
+constexpr Vector3 Vector3::operator-(const Vector3& rhs) const noexcept {
+    return Vector3(x - rhs.x, y - rhs.y, z - rhs.z);
+}
+
+constexpr Vector3& Vector3::operator-=(const Vector3& rhs) noexcept {
+    x -= rhs.x;
+    y -= rhs.y;
+    z -= rhs.z;
+    return *this;
+}
+
+constexpr Vector3 Vector3::operator-() const noexcept {
+    return Vector3(-x, -y, -z);
+}
+
+constexpr Vector3 Vector3::operator*(const Vector3& rhs) const noexcept {
+    return Vector3(x * rhs.x, y * rhs.y, z * rhs.z);
+}
+
+constexpr Vector3 operator*(float lhs, const Vector3& rhs) noexcept {
+    return Vector3(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z);
+}
+
+constexpr Vector3 Vector3::operator*(float scalar) const noexcept {
+    return Vector3(x * scalar, y * scalar, z * scalar);
+}
+
+constexpr Vector3& Vector3::operator*=(float scalar) noexcept {
+    x *= scalar;
+    y *= scalar;
+    z *= scalar;
+    return *this;
+}
+
+constexpr Vector3& Vector3::operator*=(const Vector3& rhs) noexcept {
+    x *= rhs.x;
+    y *= rhs.y;
+    z *= rhs.z;
+    return *this;
+}
+
+constexpr Vector3 operator/(float lhs, const Vector3& v) noexcept {
+    return Vector3(lhs / v.x, lhs / v.y, lhs / v.z);
+}
+
+constexpr Vector3 Vector3::operator/(float scalar) const noexcept {
+    return Vector3(x / scalar, y / scalar, z / scalar);
+}
+
+constexpr Vector3 Vector3::operator/=(float scalar) noexcept {
+    x /= scalar;
+    y /= scalar;
+    z /= scalar;
+    return *this;
+}
+
+constexpr Vector3 Vector3::operator/(const Vector3& rhs) const noexcept {
+    return Vector3(x / rhs.x, y / rhs.y, z / rhs.z);
+}
+
+constexpr Vector3 Vector3::operator/=(const Vector3& rhs) noexcept {
+    x /= rhs.x;
+    y /= rhs.y;
+    z /= rhs.z;
+    return *this;
+}
+
+constexpr bool Vector3::operator==(const Vector3& rhs) const noexcept {
+    return x == rhs.x && y == rhs.y && z == rhs.z;
+}
+
+constexpr bool Vector3::operator!=(const Vector3& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr void Vector3::GetXYZ(float& outX, float& outY, float& outZ) const noexcept {
+    outX = x;
+    outY = y;
+    outZ = z;
+}
+
+constexpr Vector3 Vector3::GetXYZ() const noexcept {
+    return Vector3{ x, y, z };
+}
+
+constexpr Vector2 Vector3::GetXY() const noexcept {
+    return Vector2{ x, y };
+}
+
+constexpr float Vector3::CalcLengthSquared() const noexcept {
+    return x * x + y * y + z * z;
+}
+
+constexpr void Vector3::SetXYZ(float newX, float newY, float newZ) noexcept {
+    x = newX;
+    y = newY;
+    z = newZ;
+}
+
+inline constexpr Vector3 Vector3::ZERO(0.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::X_AXIS(1.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::Y_AXIS(0.0f, 1.0f, 0.0f);
+inline constexpr Vector3 Vector3::Z_AXIS(0.0f, 0.0f, 1.0f);
+inline constexpr Vector3 Vector3::XY_AXIS(1.0f, 1.0f, 0.0f);
+inline constexpr Vector3 Vector3::XZ_AXIS(1.0f, 0.0f, 1.0f);
+inline constexpr Vector3 Vector3::YZ_AXIS(0.0f, 1.0f, 1.0f);
+inline constexpr Vector3 Vector3::ONE(1.0f, 1.0f, 1.0f);
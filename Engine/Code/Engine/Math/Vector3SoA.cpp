@@ -0,0 +1,322 @@
+#include "Engine/Math/Vector3SoA.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <cmath>
+
+#ifdef MATH_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+Vector3SoA::Vector3SoA(std::size_t count, const Vector3& value /*= Vector3::ZERO*/) noexcept
+    : _x(count, value.x)
+    , _y(count, value.y)
+    , _z(count, value.z)
+{
+    /* DO NOTHING */
+}
+
+Vector3SoA::Vector3SoA(const std::vector<Vector3>& vectors) noexcept {
+    FromVector3s(vectors);
+}
+
+void Vector3SoA::FromVector3s(const std::vector<Vector3>& vectors) noexcept {
+    const auto count = vectors.size();
+    _x.resize(count);
+    _y.resize(count);
+    _z.resize(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        _x[i] = vectors[i].x;
+        _y[i] = vectors[i].y;
+        _z[i] = vectors[i].z;
+    }
+}
+
+std::vector<Vector3> Vector3SoA::ToVector3s() const noexcept {
+    std::vector<Vector3> result{};
+    ToVector3s(result);
+    return result;
+}
+
+void Vector3SoA::ToVector3s(std::vector<Vector3>& out) const noexcept {
+    const auto count = size();
+    out.resize(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        out[i] = Vector3(_x[i], _y[i], _z[i]);
+    }
+}
+
+std::size_t Vector3SoA::size() const noexcept {
+    return _x.size();
+}
+
+bool Vector3SoA::empty() const noexcept {
+    return _x.empty();
+}
+
+void Vector3SoA::resize(std::size_t count, const Vector3& value /*= Vector3::ZERO*/) noexcept {
+    _x.resize(count, value.x);
+    _y.resize(count, value.y);
+    _z.resize(count, value.z);
+}
+
+void Vector3SoA::reserve(std::size_t count) noexcept {
+    _x.reserve(count);
+    _y.reserve(count);
+    _z.reserve(count);
+}
+
+void Vector3SoA::clear() noexcept {
+    _x.clear();
+    _y.clear();
+    _z.clear();
+}
+
+void Vector3SoA::push_back(const Vector3& value) noexcept {
+    _x.push_back(value.x);
+    _y.push_back(value.y);
+    _z.push_back(value.z);
+}
+
+Vector3 Vector3SoA::Get(std::size_t index) const noexcept {
+    return Vector3(_x[index], _y[index], _z[index]);
+}
+
+void Vector3SoA::Set(std::size_t index, const Vector3& value) noexcept {
+    _x[index] = value.x;
+    _y[index] = value.y;
+    _z[index] = value.z;
+}
+
+float* Vector3SoA::GetXs() noexcept {
+    return _x.data();
+}
+
+float* Vector3SoA::GetYs() noexcept {
+    return _y.data();
+}
+
+float* Vector3SoA::GetZs() noexcept {
+    return _z.data();
+}
+
+const float* Vector3SoA::GetXs() const noexcept {
+    return _x.data();
+}
+
+const float* Vector3SoA::GetYs() const noexcept {
+    return _y.data();
+}
+
+const float* Vector3SoA::GetZs() const noexcept {
+    return _z.data();
+}
+
+void Vector3SoA::Add(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& result) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "Vector3SoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    const float* bx = b.GetXs(); const float* by = b.GetYs(); const float* bz = b.GetZs();
+    float* rx = result.GetXs(); float* ry = result.GetYs(); float* rz = result.GetZs();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(rx + i, _mm_add_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)));
+        _mm_storeu_ps(ry + i, _mm_add_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i)));
+        _mm_storeu_ps(rz + i, _mm_add_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i)));
+    }
+#endif
+    for(; i < count; ++i) {
+        rx[i] = ax[i] + bx[i];
+        ry[i] = ay[i] + by[i];
+        rz[i] = az[i] + bz[i];
+    }
+}
+
+void Vector3SoA::Subtract(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& result) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "Vector3SoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    const float* bx = b.GetXs(); const float* by = b.GetYs(); const float* bz = b.GetZs();
+    float* rx = result.GetXs(); float* ry = result.GetYs(); float* rz = result.GetZs();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(rx + i, _mm_sub_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)));
+        _mm_storeu_ps(ry + i, _mm_sub_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i)));
+        _mm_storeu_ps(rz + i, _mm_sub_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i)));
+    }
+#endif
+    for(; i < count; ++i) {
+        rx[i] = ax[i] - bx[i];
+        ry[i] = ay[i] - by[i];
+        rz[i] = az[i] - bz[i];
+    }
+}
+
+void Vector3SoA::Scale(const Vector3SoA& a, float scale, Vector3SoA& result) noexcept {
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    float* rx = result.GetXs(); float* ry = result.GetYs(); float* rz = result.GetZs();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    const __m128 s = _mm_set1_ps(scale);
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(rx + i, _mm_mul_ps(_mm_loadu_ps(ax + i), s));
+        _mm_storeu_ps(ry + i, _mm_mul_ps(_mm_loadu_ps(ay + i), s));
+        _mm_storeu_ps(rz + i, _mm_mul_ps(_mm_loadu_ps(az + i), s));
+    }
+#endif
+    for(; i < count; ++i) {
+        rx[i] = ax[i] * scale;
+        ry[i] = ay[i] * scale;
+        rz[i] = az[i] * scale;
+    }
+}
+
+void Vector3SoA::Cross(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& result) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "Vector3SoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    const float* bx = b.GetXs(); const float* by = b.GetYs(); const float* bz = b.GetZs();
+    float* rx = result.GetXs(); float* ry = result.GetYs(); float* rz = result.GetZs();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const __m128 x1 = _mm_loadu_ps(ax + i); const __m128 y1 = _mm_loadu_ps(ay + i); const __m128 z1 = _mm_loadu_ps(az + i);
+        const __m128 x2 = _mm_loadu_ps(bx + i); const __m128 y2 = _mm_loadu_ps(by + i); const __m128 z2 = _mm_loadu_ps(bz + i);
+        _mm_storeu_ps(rx + i, _mm_sub_ps(_mm_mul_ps(y1, z2), _mm_mul_ps(z1, y2)));
+        _mm_storeu_ps(ry + i, _mm_sub_ps(_mm_mul_ps(z1, x2), _mm_mul_ps(x1, z2)));
+        _mm_storeu_ps(rz + i, _mm_sub_ps(_mm_mul_ps(x1, y2), _mm_mul_ps(y1, x2)));
+    }
+#endif
+    for(; i < count; ++i) {
+        const float x1 = ax[i]; const float y1 = ay[i]; const float z1 = az[i];
+        const float x2 = bx[i]; const float y2 = by[i]; const float z2 = bz[i];
+        rx[i] = y1 * z2 - z1 * y2;
+        ry[i] = z1 * x2 - x1 * z2;
+        rz[i] = x1 * y2 - y1 * x2;
+    }
+}
+
+void Vector3SoA::Lerp(const Vector3SoA& a, const Vector3SoA& b, float t, Vector3SoA& result) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "Vector3SoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    const float* bx = b.GetXs(); const float* by = b.GetYs(); const float* bz = b.GetZs();
+    float* rx = result.GetXs(); float* ry = result.GetYs(); float* rz = result.GetZs();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    const __m128 tt = _mm_set1_ps(t);
+    for(; i + 4 <= count; i += 4) {
+        const __m128 x1 = _mm_loadu_ps(ax + i); const __m128 y1 = _mm_loadu_ps(ay + i); const __m128 z1 = _mm_loadu_ps(az + i);
+        _mm_storeu_ps(rx + i, _mm_add_ps(x1, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(bx + i), x1), tt)));
+        _mm_storeu_ps(ry + i, _mm_add_ps(y1, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(by + i), y1), tt)));
+        _mm_storeu_ps(rz + i, _mm_add_ps(z1, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(bz + i), z1), tt)));
+    }
+#endif
+    for(; i < count; ++i) {
+        rx[i] = ax[i] + (bx[i] - ax[i]) * t;
+        ry[i] = ay[i] + (by[i] - ay[i]) * t;
+        rz[i] = az[i] + (bz[i] - az[i]) * t;
+    }
+}
+
+void Vector3SoA::Normalize(const Vector3SoA& a, Vector3SoA& result) noexcept {
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    float* rx = result.GetXs(); float* ry = result.GetYs(); float* rz = result.GetZs();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(ax + i); const __m128 y = _mm_loadu_ps(ay + i); const __m128 z = _mm_loadu_ps(az + i);
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        //Lanes with zero length divide to inf/nan and are masked back to zero.
+        const __m128 non_zero = _mm_cmpgt_ps(length, zero);
+        const __m128 inv_length = _mm_and_ps(non_zero, _mm_div_ps(one, length));
+        _mm_storeu_ps(rx + i, _mm_mul_ps(x, inv_length));
+        _mm_storeu_ps(ry + i, _mm_mul_ps(y, inv_length));
+        _mm_storeu_ps(rz + i, _mm_mul_ps(z, inv_length));
+    }
+#endif
+    for(; i < count; ++i) {
+        const float length = std::sqrt(ax[i] * ax[i] + ay[i] * ay[i] + az[i] * az[i]);
+        const float inv_length = length > 0.0f ? 1.0f / length : 0.0f;
+        rx[i] = ax[i] * inv_length;
+        ry[i] = ay[i] * inv_length;
+        rz[i] = az[i] * inv_length;
+    }
+}
+
+void Vector3SoA::Dot(const Vector3SoA& a, const Vector3SoA& b, std::vector<float>& result) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "Vector3SoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    const float* bx = b.GetXs(); const float* by = b.GetYs(); const float* bz = b.GetZs();
+    float* r = result.data();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const __m128 xx = _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+        const __m128 yy = _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i));
+        const __m128 zz = _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i));
+        _mm_storeu_ps(r + i, _mm_add_ps(_mm_add_ps(xx, yy), zz));
+    }
+#endif
+    for(; i < count; ++i) {
+        r[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+    }
+}
+
+void Vector3SoA::Length(const Vector3SoA& a, std::vector<float>& result) noexcept {
+    LengthSquared(a, result);
+    const auto count = result.size();
+    float* r = result.data();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(r + i, _mm_sqrt_ps(_mm_loadu_ps(r + i)));
+    }
+#endif
+    for(; i < count; ++i) {
+        r[i] = std::sqrt(r[i]);
+    }
+}
+
+void Vector3SoA::LengthSquared(const Vector3SoA& a, std::vector<float>& result) noexcept {
+    Dot(a, a, result);
+}
+
+void Vector3SoA::Distance(const Vector3SoA& a, const Vector3SoA& b, std::vector<float>& result) noexcept {
+    GUARANTEE_OR_DIE(a.size() == b.size(), "Vector3SoA operands must be the same size.");
+    const auto count = a.size();
+    result.resize(count);
+    const float* ax = a.GetXs(); const float* ay = a.GetYs(); const float* az = a.GetZs();
+    const float* bx = b.GetXs(); const float* by = b.GetYs(); const float* bz = b.GetZs();
+    float* r = result.data();
+    std::size_t i = 0;
+#ifdef MATH_SIMD_SSE
+    for(; i + 4 <= count; i += 4) {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i));
+        const __m128 dz = _mm_sub_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i));
+        _mm_storeu_ps(r + i, _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz))));
+    }
+#endif
+    for(; i < count; ++i) {
+        const float dx = ax[i] - bx[i];
+        const float dy = ay[i] - by[i];
+        const float dz = az[i] - bz[i];
+        r[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
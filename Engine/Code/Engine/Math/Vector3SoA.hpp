@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Engine/Math/Vector3.hpp"
+
+#include <cstddef>
+#include <vector>
+
+//Structure-of-arrays storage for large numbers of Vector3s.
+//The bulk operations run four elements at a time with SSE when available.
+//Operands must be the same size, checked with GUARANTEE_OR_DIE; results are resized to match and may be one of the operands.
+class Vector3SoA {
+public:
+    Vector3SoA() = default;
+    Vector3SoA(const Vector3SoA& other) = default;
+    Vector3SoA(Vector3SoA&& other) = default;
+    Vector3SoA& operator=(const Vector3SoA& other) = default;
+    Vector3SoA& operator=(Vector3SoA&& other) = default;
+    ~Vector3SoA() = default;
+
+    explicit Vector3SoA(std::size_t count, const Vector3& value = Vector3::ZERO) noexcept;
+    explicit Vector3SoA(const std::vector<Vector3>& vectors) noexcept;
+
+    void FromVector3s(const std::vector<Vector3>& vectors) noexcept;
+    std::vector<Vector3> ToVector3s() const noexcept;
+    void ToVector3s(std::vector<Vector3>& out) const noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    void resize(std::size_t count, const Vector3& value = Vector3::ZERO) noexcept;
+    void reserve(std::size_t count) noexcept;
+    void clear() noexcept;
+    void push_back(const Vector3& value) noexcept;
+
+    Vector3 Get(std::size_t index) const noexcept;
+    void Set(std::size_t index, const Vector3& value) noexcept;
+
+    float* GetXs() noexcept;
+    float* GetYs() noexcept;
+    float* GetZs() noexcept;
+    const float* GetXs() const noexcept;
+    const float* GetYs() const noexcept;
+    const float* GetZs() const noexcept;
+
+    static void Add(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& result) noexcept;
+    static void Subtract(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& result) noexcept;
+    static void Scale(const Vector3SoA& a, float scale, Vector3SoA& result) noexcept;
+    static void Cross(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& result) noexcept;
+    static void Lerp(const Vector3SoA& a, const Vector3SoA& b, float t, Vector3SoA& result) noexcept;
+    //Zero-length vectors stay zero, as with Vector3::Normalize.
+    static void Normalize(const Vector3SoA& a, Vector3SoA& result) noexcept;
+
+    static void Dot(const Vector3SoA& a, const Vector3SoA& b, std::vector<float>& result) noexcept;
+    static void Length(const Vector3SoA& a, std::vector<float>& result) noexcept;
+    static void LengthSquared(const Vector3SoA& a, std::vector<float>& result) noexcept;
+    static void Distance(const Vector3SoA& a, const Vector3SoA& b, std::vector<float>& result) noexcept;
+
+protected:
+private:
+    std::vector<float> _x{};
+    std::vector<float> _y{};
+    std::vector<float> _z{};
+};
@@ -1,9 +1,10 @@
 #pragma once
 
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+
 #include <string>
 
-class Vector2;
-class Vector3;
 class IntVector4;
 
 class Vector4 {
@@ -45,47 +46,47 @@ public:
 
     explicit Vector4(const std::string& value) noexcept;
     explicit Vector4(const IntVector4& intvec4) noexcept;
-    explicit Vector4(const Vector3& xyz, float initialW) noexcept;
-    explicit Vector4(const Vector2& xy, float initialZ, float initialW) noexcept;
-    explicit Vector4(const Vector2& xy, const Vector2& zw) noexcept;
-    explicit Vector4(float initialX, float initialY, float initialZ, float initialW) noexcept;
-
-    bool operator==(const Vector4& rhs) const noexcept;
-    bool operator!=(const Vector4& rhs) const noexcept;
-
-    Vector4 operator+(const Vector4& rhs) const noexcept;
-    Vector4 operator-(const Vector4& rhs) const noexcept;
-    Vector4 operator*(const Vector4& rhs) const noexcept;
-    Vector4 operator*(float scale) const noexcept;
-    Vector4 operator/(const Vector4 rhs) const noexcept;
-    Vector4 operator/(float inv_scale) const noexcept;
-
-    friend Vector4 operator*(float lhs, const Vector4& rhs) noexcept;
-    Vector4& operator*=(float scale) noexcept;
-    Vector4& operator*=(const Vector4& rhs) noexcept;
-    Vector4& operator/=(const Vector4& rhs) noexcept;
-    Vector4& operator+=(const Vector4& rhs) noexcept;
-    Vector4& operator-=(const Vector4& rhs) noexcept;
-
-    Vector4 operator-() const noexcept;
+    explicit constexpr Vector4(const Vector3& xyz, float initialW) noexcept;
+    explicit constexpr Vector4(const Vector2& xy, float initialZ, float initialW) noexcept;
+    explicit constexpr Vector4(const Vector2& xy, const Vector2& zw) noexcept;
+    explicit constexpr Vector4(float initialX, float initialY, float initialZ, float initialW) noexcept;
+
+    constexpr bool operator==(const Vector4& rhs) const noexcept;
+    constexpr bool operator!=(const Vector4& rhs) const noexcept;
+
+    constexpr Vector4 operator+(const Vector4& rhs) const noexcept;
+    constexpr Vector4 operator-(const Vector4& rhs) const noexcept;
+    constexpr Vector4 operator*(const Vector4& rhs) const noexcept;
+    constexpr Vector4 operator*(float scale) const noexcept;
+    constexpr Vector4 operator/(const Vector4 rhs) const noexcept;
+    constexpr Vector4 operator/(float inv_scale) const noexcept;
+
+    friend constexpr Vector4 operator*(float lhs, const Vector4& rhs) noexcept;
+    constexpr Vector4& operator*=(float scale) noexcept;
+    constexpr Vector4& operator*=(const Vector4& rhs) noexcept;
+    constexpr Vector4& operator/=(const Vector4& rhs) noexcept;
+    constexpr Vector4& operator+=(const Vector4& rhs) noexcept;
+    constexpr Vector4& operator-=(const Vector4& rhs) noexcept;
+
+    constexpr Vector4 operator-() const noexcept;
 
     friend std::ostream& operator<<(std::ostream& out_stream, const Vector4& v) noexcept;
     friend std::istream& operator>>(std::istream& in_stream, Vector4& v) noexcept;
 
-    Vector2 GetXY() const noexcept;
-    Vector2 GetZW() const noexcept;
+    constexpr Vector2 GetXY() const noexcept;
+    constexpr Vector2 GetZW() const noexcept;
 
-    void GetXYZ(float& out_x, float& out_y, float& out_z) const noexcept;
-    void GetXYZW(float& out_x, float& out_y, float& out_z, float& out_w) const noexcept;
-    void SetXYZ(float newX, float newY, float newZ) noexcept;
-    void SetXYZW(float newX, float newY, float newZ, float newW) noexcept;
+    constexpr void GetXYZ(float& out_x, float& out_y, float& out_z) const noexcept;
+    constexpr void GetXYZW(float& out_x, float& out_y, float& out_z, float& out_w) const noexcept;
+    constexpr void SetXYZ(float newX, float newY, float newZ) noexcept;
+    constexpr void SetXYZW(float newX, float newY, float newZ, float newW) noexcept;
 
     float* GetAsFloatArray() noexcept;
 
     float CalcLength3D() const noexcept;
-    float CalcLength3DSquared() const noexcept;
+    constexpr float CalcLength3DSquared() const noexcept;
     float CalcLength4D() const noexcept;
-    float CalcLength4DSquared() const noexcept;
+    constexpr float CalcLength4DSquared() const noexcept;
     void CalcHomogeneous() noexcept;
 
     float Normalize4D() noexcept;
@@ -103,4 +104,183 @@ public:
 
 protected:
 private:
-};
\ No newline at end of file
+};
+
+constexpr Vector4::Vector4(const Vector3& xyz, float initialW) noexcept
+    : x(xyz.x)
+    , y(xyz.y)
+    , z(xyz.z)
+    , w(initialW) {
+    /* DO NOTHING */
+}
+
+constexpr Vector4::Vector4(const Vector2& xy, float initialZ, float initialW) noexcept
+    : x(xy.x)
+    , y(xy.y)
+    , z(initialZ)
+    , w(initialW) {
+    /* DO NOTHING */
+}
+
+constexpr Vector4::Vector4(const Vector2& xy, const Vector2& zw) noexcept
+    : x(xy.x)
+    , y(xy.y)
+    , z(zw.x)
+    , w(zw.y) {
+    /* DO NOTHING */
+}
+
+constexpr Vector4::Vector4(float initialX, float initialY, float initialZ, float initialW) noexcept
+    : x(initialX)
+    , y(initialY)
+    , z(initialZ)
+    , w(initialW) {
+    /* DO NOTHING */
+}
+
+constexpr Vector4& Vector4::operator+=(const Vector4& rhs) noexcept {
+    x += rhs.x;
+    y += rhs.y;
+    z += rhs.z;
+    w += rhs.w;
+    return *this;
+}
+
+constexpr Vector4& Vector4::operator-=(const Vector4& rhs) noexcept {
+    x -= rhs.x;
+    y -= rhs.y;
+    z -= rhs.z;
+    w -= rhs.w;
+    return *this;
+}
+
+constexpr Vector4 Vector4::operator-(const Vector4& rhs) const noexcept {
+    return Vector4(x - rhs.x, y - rhs.y, z - rhs.z, w - rhs.w);
+}
+
+constexpr Vector4 Vector4::operator-() const noexcept {
+    return Vector4(-x, -y, -z, -w);
+}
+
+constexpr Vector2 Vector4::GetXY() const noexcept {
+    return Vector2(x, y);
+}
+
+constexpr Vector2 Vector4::GetZW() const noexcept {
+    return Vector2(z, w);
+}
+
+constexpr void Vector4::GetXYZ(float& out_x, float& out_y, float& out_z) const noexcept {
+    out_x = x;
+    out_y = y;
+    out_z = z;
+}
+
+constexpr void Vector4::GetXYZW(float& out_x, float& out_y, float& out_z, float& out_w) const noexcept {
+    out_x = x;
+    out_y = y;
+    out_z = z;
+    out_w = w;
+}
+
+constexpr void Vector4::SetXYZ(float newX, float newY, float newZ) noexcept {
+    x = newX;
+    y = newY;
+    z = newZ;
+}
+
+constexpr void Vector4::SetXYZW(float newX, float newY, float newZ, float newW) noexcept {
+    x = newX;
+    y = newY;
+    z = newZ;
+    w = newW;
+}
+
+constexpr float Vector4::CalcLength3DSquared() const noexcept {
+    return x * x + y * y + z * z;
+}
+
+constexpr float Vector4::CalcLength4DSquared() const noexcept {
+    return x * x + y * y + z * z + w * w;
+}
+
+constexpr Vector4 Vector4::operator*(const Vector4& rhs) const noexcept {
+    return Vector4(x * rhs.x, y * rhs.y, z * rhs.z, w * rhs.w);
+}
+
+constexpr Vector4 operator*(float lhs, const Vector4& rhs) noexcept {
+    return Vector4(lhs * rhs.x, lhs * rhs.y, lhs * rhs.z, lhs * rhs.w);
+}
+
+constexpr Vector4 Vector4::operator*(float scale) const noexcept {
+    return Vector4(x * scale, y * scale, z * scale, w * scale);
+}
+
+constexpr Vector4& Vector4::operator*=(float scale) noexcept {
+    x *= scale;
+    y *= scale;
+    z *= scale;
+    w *= scale;
+    return *this;
+}
+
+constexpr Vector4& Vector4::operator*=(const Vector4& rhs) noexcept {
+    x *= rhs.x;
+    y *= rhs.y;
+    z *= rhs.z;
+    w *= rhs.w;
+    return *this;
+}
+
+constexpr Vector4& Vector4::operator/=(const Vector4& rhs) noexcept {
+    x /= rhs.x;
+    y /= rhs.y;
+    z /= rhs.z;
+    w /= rhs.w;
+    return *this;
+}
+
+constexpr Vector4 Vector4::operator/(const Vector4 rhs) const noexcept {
+    return Vector4(x / rhs.x, y / rhs.y, z / rhs.z, w / rhs.w);
+}
+
+constexpr Vector4 Vector4::operator/(float inv_scale) const noexcept {
+    return Vector4(x / inv_scale, y / inv_scale, z / inv_scale, w / inv_scale);
+}
+
+constexpr Vector4 Vector4::operator+(const Vector4& rhs) const noexcept {
+    return Vector4(x + rhs.x, y + rhs.y, z + rhs.z, w + rhs.w);
+}
+
+constexpr bool Vector4::operator!=(const Vector4& rhs) const noexcept {
+    return !(*this == rhs);
+}
+
+constexpr bool Vector4::operator==(const Vector4& rhs) const noexcept {
+    return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+}
+
+inline constexpr Vector4 Vector4::ZERO(0.0f, 0.0f, 0.0f, 0.0f);
+inline constexpr Vector4 Vector4::ONE(1.0f, 1.0f, 1.0f, 1.0f);
+inline constexpr Vector4 Vector4::ZERO_XYZ_ONE_W(0.0f, 0.0f, 0.0f, 1.0f);
+inline constexpr Vector4 Vector4::ONE_XYZ_ZERO_W(1.0f, 1.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::X_AXIS(1.0f, 0.0f, 0.0f, 0.0f);
+inline constexpr Vector4 Vector4::XY_AXIS(1.0f, 1.0f, 0.0f, 0.0f);
+inline constexpr Vector4 Vector4::XZ_AXIS(1.0f, 0.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::XW_AXIS(1.0f, 0.0f, 0.0f, 1.0f);
+inline constexpr Vector4 Vector4::Y_AXIS(0.0f, 1.0f, 0.0f, 0.0f);
+inline constexpr Vector4 Vector4::YX_AXIS(1.0f, 1.0f, 0.0f, 0.0f);
+inline constexpr Vector4 Vector4::YZ_AXIS(0.0f, 1.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::YW_AXIS(0.0f, 1.0f, 0.0f, 1.0f);
+inline constexpr Vector4 Vector4::Z_AXIS(0.0f, 0.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::ZX_AXIS(1.0f, 0.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::ZY_AXIS(0.0f, 1.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::ZW_AXIS(0.0f, 0.0f, 1.0f, 1.0f);
+inline constexpr Vector4 Vector4::W_AXIS(0.0f, 0.0f, 0.0f, 1.0f);
+inline constexpr Vector4 Vector4::WX_AXIS(1.0f, 0.0f, 0.0f, 1.0f);
+inline constexpr Vector4 Vector4::WY_AXIS(0.0f, 1.0f, 0.0f, 1.0f);
+inline constexpr Vector4 Vector4::WZ_AXIS(0.0f, 0.0f, 1.0f, 1.0f);
+inline constexpr Vector4 Vector4::XYZ_AXIS(1.0f, 1.0f, 1.0f, 0.0f);
+inline constexpr Vector4 Vector4::YZW_AXIS(0.0f, 1.0f, 1.0f, 1.0f);
+inline constexpr Vector4 Vector4::XZW_AXIS(1.0f, 0.0f, 1.0f, 1.0f);
+inline constexpr Vector4 Vector4::XYW_AXIS(1.0f, 1.0f, 0.0f, 1.0f);
@@ -0,0 +1,280 @@
+#include "Engine/Profiling/HitchRecorder.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/ThreadUtils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+std::atomic<HitchRecorder*> HitchRecorder::_active{nullptr};
+std::atomic_size_t HitchRecorder::_records_in_flight{0};
+
+HitchRecorder::HitchRecorder(JobSystem& jobSystem, std::size_t maxEvents /*= 65536*/, std::size_t maxFrames /*= 300*/) noexcept
+    : _events((std::max)(maxEvents, std::size_t{1u}))
+    , _frames((std::max)(maxFrames, std::size_t{1u}))
+    , _snapshot_events(_events.size())
+    , _snapshot_frames(_frames.size())
+    , _frame_begin(TimeUtils::Now())
+    , _job_system(&jobSystem)
+{
+    _is_running = true;
+    _job_system->SetCategorySignal(JobType::Io, &_io_signal);
+    _io_worker = std::thread(&HitchRecorder::Io_worker, this);
+    ThreadUtils::SetThreadDescription(_io_worker, L"HitchRecorder Io");
+    HitchRecorder* expected = nullptr;
+    _active.compare_exchange_strong(expected, this);
+}
+
+HitchRecorder::~HitchRecorder() noexcept {
+    HitchRecorder* expected = this;
+    _active.compare_exchange_strong(expected, nullptr);
+    //A thread that loaded _active before it was cleared may still be writing into the rings.
+    //Recorders count themselves in before loading _active, so once the count drains no one can still hold this.
+    while(_records_in_flight.load()) {
+        std::this_thread::yield();
+    }
+    _is_running = false;
+    _io_signal.notify_all();
+    if(_io_worker.joinable()) {
+        _io_worker.join();
+    }
+    _job_system->SetCategorySignal(JobType::Io, nullptr);
+    _job_system = nullptr;
+}
+
+void HitchRecorder::Io_worker() noexcept {
+    JobConsumer jc;
+    jc.AddCategory(JobType::Io);
+    while(_is_running) {
+        {
+            std::unique_lock<std::mutex> lock(_cs);
+            //Dispatch notifies without holding our lock; the timeout covers a missed wake-up.
+            _io_signal.wait_for(lock, std::chrono::milliseconds(100), [&jc, this]()->bool { return !_is_running || jc.HasJobs(); });
+        }
+        jc.ConsumeAll();
+    }
+    //Finish any dump that was requested before shutdown.
+    jc.ConsumeAll();
+}
+
+void HitchRecorder::BeginFrame() noexcept {
+    _frame_begin = TimeUtils::Now();
+}
+
+void HitchRecorder::EndFrame() noexcept {
+    const auto now = TimeUtils::Now();
+    const auto index = _frame_index.load();
+    auto& frame = _frames[index % _frames.size()];
+    frame.index = index;
+    frame.begin = _frame_begin;
+    frame.end = now;
+    ++_frame_index;
+    if(TimeUtils::FPMilliseconds{now - _frame_begin} > GetHitchThreshold()) {
+        Dump();
+    }
+}
+
+bool HitchRecorder::Dump() noexcept {
+    bool expected = false;
+    if(!_dump_in_flight.compare_exchange_strong(expected, true)) {
+        return false;
+    }
+    Snapshot();
+    _job_system->Run(JobType::Io, [this](void*) { WriteTrace(); }, nullptr);
+    return true;
+}
+
+void HitchRecorder::Record(EventType type, const char* name, time_point_t begin, time_point_t end) noexcept {
+    const auto cursor = _event_cursor.fetch_add(1);
+    auto& slot = _events[cursor % _events.size()];
+    //A zero sequence marks the slot as being written so readers skip it. The fence keeps the
+    //payload writes below from becoming visible before the zero does.
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    auto& e = slot.event;
+    e.begin = begin;
+    e.end = end;
+    e.thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    e.frame_index = _frame_index.load(std::memory_order_relaxed);
+    e.type = type;
+    const auto length = name ? (std::min)(std::strlen(name), event_t::MAX_NAME_LENGTH) : std::size_t{0u};
+    if(length) {
+        std::memcpy(e.name, name, length);
+    }
+    e.name[length] = '\0';
+    slot.sequence.store(cursor + 1, std::memory_order_release);
+}
+
+void HitchRecorder::RecordScope(const char* name, time_point_t begin, time_point_t end) noexcept {
+    ++_records_in_flight;
+    if(auto recorder = _active.load()) {
+        recorder->Record(EventType::Scope, name, begin, end);
+    }
+    --_records_in_flight;
+}
+
+void HitchRecorder::RecordJob(const JobType& type, time_point_t begin, time_point_t end) noexcept {
+    static const char* names[] = {
+        "Job Generic",
+        "Job Logging",
+        "Job Io",
+        "Job Render",
+        "Job Main",
+    };
+    const auto index = static_cast<std::size_t>(type);
+    ++_records_in_flight;
+    if(auto recorder = _active.load()) {
+        recorder->Record(EventType::Job, index < std::size(names) ? names[index] : "Job", begin, end);
+    }
+    --_records_in_flight;
+}
+
+HitchRecorder* HitchRecorder::GetActive() noexcept {
+    return _active.load();
+}
+
+void HitchRecorder::Snapshot() noexcept {
+    const auto frame_count = (std::min)(static_cast<std::size_t>(_frame_index.load()), _frames.size());
+    const auto first_frame = _frame_index.load() - frame_count;
+    for(std::size_t i = 0; i < frame_count; ++i) {
+        _snapshot_frames[i] = _frames[(first_frame + i) % _frames.size()];
+    }
+    _snapshot_frame_count = frame_count;
+    const auto window_begin = frame_count ? _snapshot_frames[0].begin : time_point_t{};
+
+    const std::uint64_t capacity = _events.size();
+    const auto last = _event_cursor.load();
+    const auto first = last > capacity ? last - capacity : std::uint64_t{0u};
+    std::size_t count = 0;
+    for(auto cursor = first; cursor < last; ++cursor) {
+        const auto& slot = _events[cursor % capacity];
+        if(slot.sequence.load(std::memory_order_acquire) != cursor + 1) {
+            continue;
+        }
+        auto& e = _snapshot_events[count];
+        e = slot.event;
+        //Overwritten while copying; drop it rather than report a torn event. The fence keeps the
+        //copy above from being read after the sequence is checked again.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(slot.sequence.load(std::memory_order_relaxed) != cursor + 1) {
+            continue;
+        }
+        if(e.end < window_begin) {
+            continue;
+        }
+        ++count;
+    }
+    _snapshot_event_count = count;
+}
+
+namespace {
+void WriteJsonString(std::ostream& os, const char* str) noexcept {
+    os << '"';
+    for(auto c = str; *c; ++c) {
+        if(*c == '"' || *c == '\\') {
+            os << '\\' << *c;
+        } else if(static_cast<unsigned char>(*c) >= 0x20) {
+            os << *c;
+        }
+    }
+    os << '"';
+}
+}
+
+void HitchRecorder::WriteTrace() noexcept {
+    std::filesystem::path folder{};
+    {
+        std::scoped_lock<std::mutex> _lock(_cs);
+        folder = _output_folder;
+    }
+    FileUtils::CreateFolders(folder);
+    TimeUtils::DateTimeStampOptions opts;
+    opts.use_separator = true;
+    opts.is_filename = true;
+    const auto hitch_frame = _snapshot_frame_count ? _snapshot_frames[_snapshot_frame_count - 1].index : std::uint64_t{0u};
+    auto filepath = folder / ("hitch_" + TimeUtils::GetDateTimeStampFromNow(opts) + "_frame" + std::to_string(hitch_frame) + ".json");
+    filepath.make_preferred();
+
+    std::ofstream ofs{filepath};
+    if(ofs.fail()) {
+        DebuggerPrintf("HitchRecorder could not open trace file for writing.\n");
+        _dump_in_flight = false;
+        return;
+    }
+    using us_t = std::chrono::duration<double, std::micro>;
+    const auto origin = _snapshot_frame_count ? _snapshot_frames[0].begin : (_snapshot_event_count ? _snapshot_events[0].begin : time_point_t{});
+    std::unordered_map<std::size_t, int> thread_ids{};
+    ofs << std::fixed << std::setprecision(3);
+    ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    for(std::size_t i = 0; i < _snapshot_frame_count; ++i) {
+        const auto& f = _snapshot_frames[i];
+        ofs << (first ? "" : ",\n");
+        ofs << "{\"name\":\"Frame " << f.index << "\",\"cat\":\"Frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":"
+            << us_t{f.begin - origin}.count() << ",\"dur\":" << us_t{f.end - f.begin}.count() << '}';
+        first = false;
+    }
+    for(std::size_t i = 0; i < _snapshot_event_count; ++i) {
+        const auto& e = _snapshot_events[i];
+        auto tid = thread_ids.try_emplace(e.thread_id, static_cast<int>(thread_ids.size()) + 1).first->second;
+        ofs << (first ? "" : ",\n");
+        ofs << "{\"name\":";
+        WriteJsonString(ofs, e.name);
+        ofs << ",\"cat\":\"" << (e.type == EventType::Job ? "Job" : "Scope") << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+            << ",\"ts\":" << us_t{e.begin - origin}.count() << ",\"dur\":" << us_t{e.end - e.begin}.count()
+            << ",\"args\":{\"frame\":" << e.frame_index << "}}";
+        first = false;
+    }
+    ofs << "\n]}\n";
+    ofs.close();
+    {
+        std::scoped_lock<std::mutex> _lock(_cs);
+        _last_dump_path = filepath;
+    }
+    ++_dump_count;
+    _dump_in_flight = false;
+}
+
+void HitchRecorder::SetHitchThreshold(TimeUtils::FPMilliseconds threshold) noexcept {
+    std::scoped_lock<std::mutex> _lock(_cs);
+    _hitch_threshold = threshold;
+}
+
+TimeUtils::FPMilliseconds HitchRecorder::GetHitchThreshold() const noexcept {
+    std::scoped_lock<std::mutex> _lock(_cs);
+    return _hitch_threshold;
+}
+
+void HitchRecorder::SetOutputFolder(const std::filesystem::path& folder) noexcept {
+    std::scoped_lock<std::mutex> _lock(_cs);
+    _output_folder = folder;
+}
+
+std::filesystem::path HitchRecorder::GetOutputFolder() const noexcept {
+    std::scoped_lock<std::mutex> _lock(_cs);
+    return _output_folder;
+}
+
+std::size_t HitchRecorder::GetEventCapacity() const noexcept {
+    return _events.size();
+}
+
+std::size_t HitchRecorder::GetFrameCapacity() const noexcept {
+    return _frames.size();
+}
+
+std::size_t HitchRecorder::GetDumpCount() const noexcept {
+    return _dump_count.load();
+}
+
+std::filesystem::path HitchRecorder::GetLastDumpPath() const noexcept {
+    std::scoped_lock<std::mutex> _lock(_cs);
+    return _last_dump_path;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+enum class JobType : std::size_t;
+
+//Keeps the last few seconds of ProfileLogScope and JobSystem events in fixed-size rings.
+//When a frame takes longer than the hitch threshold, the window is written to a
+//Chrome trace file (chrome://tracing) on a JobType::Io job.
+//All storage is allocated up front; recording never allocates.
+class HitchRecorder {
+public:
+    using time_point_t = std::chrono::time_point<std::chrono::steady_clock>;
+
+    enum class EventType : std::uint8_t {
+        Scope,
+        Job,
+    };
+
+    struct event_t {
+        static constexpr std::size_t MAX_NAME_LENGTH = 63;
+        time_point_t begin{};
+        time_point_t end{};
+        std::size_t thread_id = 0;
+        std::uint64_t frame_index = 0;
+        EventType type = EventType::Scope;
+        char name[MAX_NAME_LENGTH + 1] = {};
+    };
+
+    struct frame_t {
+        std::uint64_t index = 0;
+        time_point_t begin{};
+        time_point_t end{};
+    };
+
+    HitchRecorder(JobSystem& jobSystem, std::size_t maxEvents = 65536, std::size_t maxFrames = 300) noexcept;
+    ~HitchRecorder() noexcept;
+
+    HitchRecorder() = delete;
+    HitchRecorder(const HitchRecorder&) = delete;
+    HitchRecorder(HitchRecorder&&) = delete;
+    HitchRecorder& operator=(const HitchRecorder&) = delete;
+    HitchRecorder& operator=(HitchRecorder&&) = delete;
+
+    void BeginFrame() noexcept;
+    void EndFrame() noexcept;
+
+    //Requests a dump of the current window regardless of frame time.
+    //Returns false if a dump is already being written.
+    bool Dump() noexcept;
+
+    void SetHitchThreshold(TimeUtils::FPMilliseconds threshold) noexcept;
+    TimeUtils::FPMilliseconds GetHitchThreshold() const noexcept;
+    void SetOutputFolder(const std::filesystem::path& folder) noexcept;
+    std::filesystem::path GetOutputFolder() const noexcept;
+
+    std::size_t GetEventCapacity() const noexcept;
+    std::size_t GetFrameCapacity() const noexcept;
+    std::size_t GetDumpCount() const noexcept;
+    std::filesystem::path GetLastDumpPath() const noexcept;
+
+    void Record(EventType type, const char* name, time_point_t begin, time_point_t end) noexcept;
+
+    //Forward to the active recorder, if any. Safe to call from any thread, even while the active
+    //recorder is being destroyed: its destructor waits for recordings already under way.
+    static void RecordScope(const char* name, time_point_t begin, time_point_t end) noexcept;
+    static void RecordJob(const JobType& type, time_point_t begin, time_point_t end) noexcept;
+    static HitchRecorder* GetActive() noexcept;
+protected:
+private:
+    struct slot_t {
+        std::atomic_uint64_t sequence{0};
+        event_t event{};
+    };
+
+    void Io_worker() noexcept;
+    void Snapshot() noexcept;
+    void WriteTrace() noexcept;
+
+    std::vector<slot_t> _events;
+    std::vector<frame_t> _frames;
+    std::vector<event_t> _snapshot_events;
+    std::vector<frame_t> _snapshot_frames;
+    std::size_t _snapshot_event_count = 0;
+    std::size_t _snapshot_frame_count = 0;
+    std::atomic_uint64_t _event_cursor{0};
+    std::atomic_uint64_t _frame_index{0};
+    time_point_t _frame_begin{};
+    TimeUtils::FPMilliseconds _hitch_threshold{33.3f};
+    std::filesystem::path _output_folder{"Data/Profiling/"};
+    std::filesystem::path _last_dump_path{};
+    mutable std::mutex _cs{};
+    std::condition_variable _io_signal{};
+    std::thread _io_worker{};
+    JobSystem* _job_system = nullptr;
+    std::atomic_size_t _dump_count{0};
+    std::atomic_bool _dump_in_flight = false;
+    std::atomic_bool _is_running = false;
+    static std::atomic<HitchRecorder*> _active;
+    static std::atomic_size_t _records_in_flight;
+};
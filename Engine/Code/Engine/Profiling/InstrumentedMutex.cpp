@@ -0,0 +1,164 @@
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+struct InstrumentedMutex::counters_t {
+    std::string name{};
+    std::atomic_uint64_t acquisitions{0};
+    std::atomic_uint64_t contentions{0};
+    std::atomic_uint64_t total_wait_ns{0};
+    std::atomic_uint64_t max_wait_ns{0};
+    std::atomic_uint64_t total_hold_ns{0};
+    std::atomic_uint64_t max_hold_ns{0};
+};
+
+namespace {
+
+std::mutex& GetRegistryMutex() noexcept {
+    static std::mutex registry_cs{};
+    return registry_cs;
+}
+
+template<typename Counters>
+std::vector<std::unique_ptr<Counters>>& GetRegistry() noexcept {
+    static std::vector<std::unique_ptr<Counters>> registry{};
+    return registry;
+}
+
+void AtomicMax(std::atomic_uint64_t& target, std::uint64_t value) noexcept {
+    auto current = target.load(std::memory_order_relaxed);
+    while(current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        /* DO NOTHING */
+    }
+}
+
+std::uint64_t ToNanoseconds(std::chrono::steady_clock::duration d) noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+}
+
+} //End anonymous
+
+InstrumentedMutex::InstrumentedMutex(const char* name /*= "Unnamed"*/) noexcept
+    : _counters(FindOrCreateCounters(name))
+{
+    /* DO NOTHING */
+}
+
+InstrumentedMutex::counters_t* InstrumentedMutex::FindOrCreateCounters(const char* name) noexcept {
+    std::scoped_lock<std::mutex> _lock(GetRegistryMutex());
+    auto& registry = GetRegistry<counters_t>();
+    const std::string key = name ? name : "Unnamed";
+    auto found = std::find_if(std::begin(registry), std::end(registry), [&key](const auto& c) { return c->name == key; });
+    if(found != std::end(registry)) {
+        return found->get();
+    }
+    registry.push_back(std::make_unique<counters_t>());
+    registry.back()->name = key;
+    return registry.back().get();
+}
+
+void InstrumentedMutex::lock() noexcept {
+    //Uncontended path: one try_lock, no clock reads beyond the hold timer.
+    if(_mutex.try_lock()) {
+        _acquired_at = TimeUtils::Now();
+        _counters->acquisitions.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    const auto wait_begin = TimeUtils::Now();
+    _mutex.lock();
+    _acquired_at = TimeUtils::Now();
+    const auto waited = ToNanoseconds(_acquired_at - wait_begin);
+    _counters->acquisitions.fetch_add(1, std::memory_order_relaxed);
+    _counters->contentions.fetch_add(1, std::memory_order_relaxed);
+    _counters->total_wait_ns.fetch_add(waited, std::memory_order_relaxed);
+    AtomicMax(_counters->max_wait_ns, waited);
+}
+
+bool InstrumentedMutex::try_lock() noexcept {
+    if(!_mutex.try_lock()) {
+        _counters->contentions.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    _acquired_at = TimeUtils::Now();
+    _counters->acquisitions.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void InstrumentedMutex::unlock() noexcept {
+    const auto held = ToNanoseconds(TimeUtils::Now() - _acquired_at);
+    _mutex.unlock();
+    _counters->total_hold_ns.fetch_add(held, std::memory_order_relaxed);
+    AtomicMax(_counters->max_hold_ns, held);
+}
+
+std::mutex& InstrumentedMutex::native() noexcept {
+    return _mutex;
+}
+
+std::vector<InstrumentedMutex::stats_t> InstrumentedMutex::GetTopContended(std::size_t count /*= 10*/) noexcept {
+    std::vector<stats_t> result{};
+    {
+        std::scoped_lock<std::mutex> _lock(GetRegistryMutex());
+        const auto& registry = GetRegistry<counters_t>();
+        result.reserve(registry.size());
+        for(const auto& c : registry) {
+            using ns_t = std::chrono::duration<std::uint64_t, std::nano>;
+            stats_t s{};
+            s.name = c->name;
+            s.acquisitions = c->acquisitions.load();
+            s.contentions = c->contentions.load();
+            s.total_wait = ns_t{c->total_wait_ns.load()};
+            s.max_wait = ns_t{c->max_wait_ns.load()};
+            s.total_hold = ns_t{c->total_hold_ns.load()};
+            s.max_hold = ns_t{c->max_hold_ns.load()};
+            result.push_back(s);
+        }
+    }
+    std::sort(std::begin(result), std::end(result), [](const stats_t& a, const stats_t& b) {
+        if(a.total_wait != b.total_wait) {
+            return a.total_wait > b.total_wait;
+        }
+        return a.contentions > b.contentions;
+    });
+    if(result.size() > count) {
+        result.resize(count);
+    }
+    return result;
+}
+
+std::string InstrumentedMutex::GetReport(std::size_t count /*= 10*/) noexcept {
+    std::ostringstream ss;
+    ss << std::left << std::setw(32) << "Lock"
+       << std::right << std::setw(12) << "Acquired"
+       << std::setw(12) << "Contended"
+       << std::setw(14) << "Wait (us)"
+       << std::setw(14) << "Max Wait"
+       << std::setw(14) << "Hold (us)"
+       << std::setw(14) << "Max Hold" << '\n';
+    ss << std::fixed << std::setprecision(1);
+    for(const auto& s : GetTopContended(count)) {
+        ss << std::left << std::setw(32) << s.name
+           << std::right << std::setw(12) << s.acquisitions
+           << std::setw(12) << s.contentions
+           << std::setw(14) << s.total_wait.count()
+           << std::setw(14) << s.max_wait.count()
+           << std::setw(14) << s.total_hold.count()
+           << std::setw(14) << s.max_hold.count() << '\n';
+    }
+    return ss.str();
+}
+
+void InstrumentedMutex::ResetStats() noexcept {
+    std::scoped_lock<std::mutex> _lock(GetRegistryMutex());
+    for(auto& c : GetRegistry<counters_t>()) {
+        c->acquisitions = 0;
+        c->contentions = 0;
+        c->total_wait_ns = 0;
+        c->max_wait_ns = 0;
+        c->total_hold_ns = 0;
+        c->max_hold_ns = 0;
+    }
+}
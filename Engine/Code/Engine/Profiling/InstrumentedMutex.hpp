@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+//Drop-in std::mutex replacement that records per-name lock statistics.
+//Every instance constructed with the same name shares one set of counters.
+//Engine code uses ProfiledMutex, which is only instrumented when PROFILE_LOCKS is defined.
+class InstrumentedMutex {
+public:
+    struct stats_t {
+        std::string name{};
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contentions = 0;
+        TimeUtils::FPMicroseconds total_wait{};
+        TimeUtils::FPMicroseconds max_wait{};
+        TimeUtils::FPMicroseconds total_hold{};
+        TimeUtils::FPMicroseconds max_hold{};
+    };
+
+    explicit InstrumentedMutex(const char* name = "Unnamed") noexcept;
+    ~InstrumentedMutex() = default;
+
+    InstrumentedMutex(const InstrumentedMutex&) = delete;
+    InstrumentedMutex(InstrumentedMutex&&) = delete;
+    InstrumentedMutex& operator=(const InstrumentedMutex&) = delete;
+    InstrumentedMutex& operator=(InstrumentedMutex&&) = delete;
+
+    void lock() noexcept;
+    bool try_lock() noexcept;
+    void unlock() noexcept;
+
+    //For std::condition_variable waits. Acquisitions through the native mutex are not recorded.
+    std::mutex& native() noexcept;
+
+    //Sorted by total wait time, most contended first.
+    static std::vector<stats_t> GetTopContended(std::size_t count = 10) noexcept;
+    static std::string GetReport(std::size_t count = 10) noexcept;
+    static void ResetStats() noexcept;
+protected:
+private:
+    struct counters_t;
+    static counters_t* FindOrCreateCounters(const char* name) noexcept;
+
+    std::mutex _mutex{};
+    counters_t* _counters = nullptr;
+    std::chrono::time_point<std::chrono::steady_clock> _acquired_at{};
+};
+
+//Uninstrumented stand-in with the same interface, so call sites need no #ifdefs.
+class UninstrumentedMutex : public std::mutex {
+public:
+    explicit UninstrumentedMutex([[maybe_unused]]const char* name = nullptr) noexcept
+        : std::mutex()
+    {
+        /* DO NOTHING */
+    }
+    std::mutex& native() noexcept {
+        return *this;
+    }
+};
+
+#if defined(PROFILE_BUILD) && defined(PROFILE_LOCKS)
+using ProfiledMutex = InstrumentedMutex;
+#else
+using ProfiledMutex = UninstrumentedMutex;
+#endif
@@ -4,6 +4,8 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 
+#include "Engine/Profiling/HitchRecorder.hpp"
+
 #include <iomanip>
 #include <sstream>
 
@@ -16,6 +18,7 @@ ProfileLogScope::ProfileLogScope(const std::string& scopeName) noexcept
 
 ProfileLogScope::~ProfileLogScope() noexcept {
     auto now = TimeUtils::Now();
+    HitchRecorder::RecordScope(_scope_name.c_str(), _time_at_creation, now);
     TimeUtils::FPMicroseconds elapsedTime = (now - _time_at_creation);
     std::ostringstream ss;
     ss << "ProfileLogScope " << _scope_name << " took " << elapsedTime.count() << " us.\n";
@@ -3,17 +3,21 @@
 #include "Engine/Core/BuildConfig.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/StringUtils.hpp"
-#include "Engine/Core/Win.hpp"
 
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
 #include <functional>
+#include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <ostream>
 #include <sstream>
 #include <string_view>
 
-#ifdef PROFILE_BUILD
+#if defined(PROFILE_BUILD) && defined(PLATFORM_WINDOWS)
+#include "Engine/Core/Win.hpp"
 #include <DbgHelp.h>
 
 static constexpr auto MAX_FILENAME_LENGTH = 1024u;
@@ -38,10 +42,19 @@ static SymFromAddr_t LSymFromAddr;
 static SymGetLineFromAddr64_t LSymGetLineFromAddr64;
 static SymCleanup_t LSymCleanup;
 
+#elif defined(PROFILE_BUILD) && defined(PLATFORM_LINUX)
+//Requires linking with -rdynamic (-Wl,--export-dynamic) for non-exported symbols to have names.
+//Frames without a name still report their module and offset for offline addr2line lookups.
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+
 #endif
 
+
 std::atomic_uint64_t StackTrace::_refs(0);
 std::shared_mutex StackTrace::_cs{};
+std::unordered_map<void*, StackTrace::frame_t> StackTrace::_symbol_cache{};
 std::atomic_bool StackTrace::_did_init(false);
 
 StackTrace::StackTrace() noexcept
@@ -57,19 +70,56 @@ StackTrace::StackTrace([[maybe_unused]]unsigned long framesToSkip,
         Initialize();
     }
     ++_refs;
+    framesToCapture = (std::min)(framesToCapture, MAX_FRAMES_PER_CALLSTACK);
+#if defined(PLATFORM_WINDOWS)
     unsigned long count = ::CaptureStackBackTrace(1ul + framesToSkip, framesToCapture, _frames, &hash);
+#elif defined(PLATFORM_LINUX)
+    //backtrace has no skip parameter; capture the extra frames and shift them out.
+    const unsigned long skip = 1ul + framesToSkip;
+    unsigned long count = static_cast<unsigned long>(::backtrace(_frames, static_cast<int>(MAX_FRAMES_PER_CALLSTACK)));
+    if(count > skip) {
+        count = (std::min)(count - skip, framesToCapture);
+        std::memmove(_frames, _frames + skip, count * sizeof(void*));
+    } else {
+        count = 0ul;
+    }
+    //FNV-1a over the return addresses, analogous to the hash CaptureStackBackTrace reports.
+    std::uint64_t fnv = 14695981039346656037ull;
+    for(unsigned long i = 0; i < count; ++i) {
+        fnv ^= static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(_frames[i]));
+        fnv *= 1099511628211ull;
+    }
+    hash = static_cast<unsigned long>(fnv ^ (fnv >> 32));
+#else
+    unsigned long count = 0ul;
+#endif
     if(!count) {
         DebuggerPrintf("StackTrace unavailable. All frames were skipped.\n");
         return;
     }
     _frame_count = (std::min)(count, MAX_FRAMES_PER_CALLSTACK);
-    
-    GetLines(this, MAX_CALLSTACK_LINES);
 #else
     DebuggerPrintf("StackTrace unavailable. Attempting to call StackTrace in non-profile build. \n");
 #endif
 }
 
+StackTrace::StackTrace(const StackTrace& other) noexcept
+    : hash(other.hash)
+    , _frame_count(other._frame_count)
+{
+#ifdef PROFILE_BUILD
+    ++_refs;
+#endif
+    std::copy(other._frames, other._frames + other._frame_count, _frames);
+}
+
+StackTrace& StackTrace::operator=(const StackTrace& rhs) noexcept {
+    hash = rhs.hash;
+    _frame_count = rhs._frame_count;
+    std::copy(rhs._frames, rhs._frames + rhs._frame_count, _frames);
+    return *this;
+}
+
 StackTrace::~StackTrace() noexcept {
 #ifdef PROFILE_BUILD
     --_refs;
@@ -80,7 +130,7 @@ StackTrace::~StackTrace() noexcept {
 }
 
 void StackTrace::Initialize() noexcept {
-#ifdef PROFILE_BUILD
+#if defined(PROFILE_BUILD) && defined(PLATFORM_WINDOWS)
     debugHelpModule = ::LoadLibraryA("DbgHelp.dll");
     if(!debugHelpModule) {
         return;
@@ -113,64 +163,132 @@ void StackTrace::Initialize() noexcept {
 
     symbol->MaxNameLen = MAX_FILENAME_LENGTH;
     symbol->SizeOfStruct = SYMBOL_INFO_SIZE;
+#elif defined(PROFILE_BUILD) && defined(PLATFORM_LINUX)
+    //The first call to backtrace loads the unwinder (and allocates);
+    //do it here so the first real capture stays cheap.
+    std::scoped_lock<std::shared_mutex> _lock(_cs);
+    if(!_did_init) {
+        void* warmup[1];
+        ::backtrace(warmup, 1);
+        _did_init = true;
+    }
 #endif
 }
 
-void StackTrace::GetLines([[maybe_unused]]StackTrace* st,
-                          [[maybe_unused]]unsigned long max_lines) noexcept {
-#ifndef PROFILE_BUILD
-    return;
-#else
+StackTrace::frame_t StackTrace::Symbolize([[maybe_unused]]void* address) noexcept {
+    frame_t result{};
+    result.address = address;
+#if defined(PROFILE_BUILD) && defined(PLATFORM_WINDOWS)
+    if(!_did_init || !symbol) {
+        return result;
+    }
     IMAGEHLP_LINE64 line_info{};
     DWORD line_offset = 0;
     line_info.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
-
-    uint32_t count = std::min(max_lines, st->_frame_count);
-    if(!count) {
-        DebuggerPrintf("StackTrace unavailable. No stack to trace.\n");
-        return;
+    auto ptr = reinterpret_cast<DWORD64>(address);
+    //DbgHelp is single-threaded and the symbol buffer is shared.
+    std::scoped_lock<std::shared_mutex> _lock(_cs);
+    if(!LSymFromAddr(process, ptr, nullptr, symbol)) {
+        return result;
     }
-    for(uint32_t i = 0; i < count; ++i) {
-        auto ptr = reinterpret_cast<DWORD64>(st->_frames[i]);
-        bool got_addr = false;
-        {
-            std::scoped_lock<std::shared_mutex> _lock(_cs);
-            got_addr = LSymFromAddr(process, ptr, nullptr, symbol);
-        }
-        if(!got_addr) {
-            DebuggerPrintf("StackTrace unavailable. No stack to trace.\n");
-            return;
-        }
-        bool got_line = false;
-        {
-            std::scoped_lock<std::shared_mutex> _lock(_cs);
-            got_line = LSymGetLineFromAddr64(process, ptr, &line_offset, &line_info);
+    result.symbol = std::string(symbol->Name, symbol->NameLen);
+    result.module_offset = static_cast<std::uintptr_t>(ptr - symbol->ModBase);
+    if(LSymGetLineFromAddr64(process, ptr, &line_offset, &line_info)) {
+        result.filepath = line_info.FileName ? line_info.FileName : "";
+        result.line = line_info.LineNumber;
+    }
+#elif defined(PROFILE_BUILD) && defined(PLATFORM_LINUX)
+    //Return addresses point one past the call; step back into the calling instruction.
+    auto call_site = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(address) - 1u);
+    Dl_info info{};
+    if(!::dladdr(call_site, &info)) {
+        return result;
+    }
+    if(info.dli_fname) {
+        result.filepath = info.dli_fname;
+    }
+    result.module_offset = reinterpret_cast<std::uintptr_t>(call_site) - reinterpret_cast<std::uintptr_t>(info.dli_fbase);
+    if(info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        result.symbol = (status == 0 && demangled) ? demangled : info.dli_sname;
+        std::free(demangled);
+    } else {
+        //Static or stripped symbols: fall back to module+offset for offline addr2line lookup.
+        const auto slash = result.filepath.find_last_of('/');
+        std::ostringstream ss;
+        ss << (slash == std::string::npos ? result.filepath : result.filepath.substr(slash + 1)) << "+0x" << std::hex << result.module_offset;
+        result.symbol = ss.str();
+    }
+#endif
+    return result;
+}
+
+StackTrace::frame_t StackTrace::GetCachedSymbol(void* address) noexcept {
+    {
+        std::shared_lock<std::shared_mutex> _lock(_cs);
+        if(auto found = _symbol_cache.find(address); found != std::end(_symbol_cache)) {
+            return found->second;
         }
-        if(got_line) {
-            const auto name_length_plus_one = static_cast<std::size_t>(symbol->NameLen) + 1u;
-            auto s = reinterpret_cast<char*>(std::malloc(name_length_plus_one));
-            if(s) {
-                ::strcpy_s(s, name_length_plus_one, symbol->Name);
-                s[symbol->NameLen] = '\0';
-                DebuggerPrintf("\t%s(%d): %s\n", line_info.FileName, line_info.LineNumber, s);
-                std::free(s);
-            }
+    }
+    auto result = Symbolize(address);
+    {
+        std::scoped_lock<std::shared_mutex> _lock(_cs);
+        _symbol_cache.try_emplace(address, result);
+    }
+    return result;
+}
+
+void StackTrace::ClearSymbolCache() noexcept {
+    std::scoped_lock<std::shared_mutex> _lock(_cs);
+    _symbol_cache.clear();
+}
+
+unsigned long StackTrace::GetFrameCount() const noexcept {
+    return _frame_count;
+}
+
+void* StackTrace::GetFrameAddress(unsigned long index) const noexcept {
+    return index < _frame_count ? _frames[index] : nullptr;
+}
+
+unsigned long StackTrace::GetHash() const noexcept {
+    return hash;
+}
+
+std::vector<StackTrace::frame_t> StackTrace::GetFrames() const noexcept {
+    std::vector<frame_t> result{};
+    result.reserve(_frame_count);
+    for(unsigned long i = 0; i < _frame_count; ++i) {
+        result.push_back(GetCachedSymbol(_frames[i]));
+    }
+    return result;
+}
+
+std::string StackTrace::ToString() const noexcept {
+    if(!_frame_count) {
+        return std::string{"StackTrace unavailable. No stack to trace.\n"};
+    }
+    std::ostringstream ss;
+    for(const auto& frame : GetFrames()) {
+        ss << '\t' << (frame.filepath.empty() ? "N/A" : frame.filepath) << '(' << frame.line << "): ";
+        if(frame.symbol.empty()) {
+            ss << "0x" << std::hex << reinterpret_cast<std::uintptr_t>(frame.address) << std::dec;
         } else {
-            const auto name_length_plus_one = static_cast<std::size_t>(symbol->NameLen) + 1u;
-            auto s = reinterpret_cast<char*>(std::malloc(name_length_plus_one));
-            if(s) {
-                ::strcpy_s(s, name_length_plus_one, symbol->Name);
-                s[symbol->NameLen] = '\0';
-                DebuggerPrintf("\tN/A(%d): %s\n", 0, s);
-                std::free(s);
-            }
+            ss << frame.symbol;
         }
+        ss << '\n';
     }
-#endif
+    return ss.str();
+}
+
+void StackTrace::Print() const noexcept {
+    const auto str = ToString();
+    DebuggerPrintf("%s", str.c_str());
 }
 
 void StackTrace::Shutdown() noexcept {
-#ifdef PROFILE_BUILD
+#if defined(PROFILE_BUILD) && defined(PLATFORM_WINDOWS)
     if(symbol) {
         std::free(symbol);
         symbol = nullptr;
@@ -179,11 +297,14 @@ void StackTrace::Shutdown() noexcept {
     {
         std::scoped_lock<std::shared_mutex> _lock(_cs);
         LSymCleanup(process);
+        _symbol_cache.clear();
     }
 
     ::FreeLibrary(debugHelpModule);
     debugHelpModule = nullptr;
     _did_init = false;
+#elif defined(PROFILE_BUILD) && defined(PLATFORM_LINUX)
+    //Loaded modules stay mapped for the life of the process, so cached symbols remain valid.
 #endif
 }
 
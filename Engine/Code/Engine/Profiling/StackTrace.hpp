@@ -3,28 +3,56 @@
 #include "Engine/Core/BuildConfig.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class StackTrace final {
 public:
+
+    struct frame_t {
+        void* address = nullptr;
+        std::string symbol{};
+        std::string filepath{};
+        unsigned long line = 0ul;
+        std::uintptr_t module_offset = 0u;
+    };
+
+    //Capturing only records return addresses.
+    //Symbols are looked up when GetFrames, ToString, or Print are called.
     StackTrace() noexcept;
 	StackTrace([[maybe_unused]]unsigned long framesToSkip,
                [[maybe_unused]]unsigned long framesToCapture) noexcept;
+    StackTrace(const StackTrace& other) noexcept;
+    StackTrace& operator=(const StackTrace& rhs) noexcept;
     ~StackTrace() noexcept;
+
+    unsigned long GetFrameCount() const noexcept;
+    void* GetFrameAddress(unsigned long index) const noexcept;
+    unsigned long GetHash() const noexcept;
+
+    std::vector<frame_t> GetFrames() const noexcept;
+    std::string ToString() const noexcept;
+    void Print() const noexcept;
+
+    static void ClearSymbolCache() noexcept;
+
     bool operator==(const StackTrace& rhs) const noexcept;
     bool operator!=(const StackTrace& rhs) const noexcept;
 protected:
 private:
     static void Initialize() noexcept;
     static void Shutdown() noexcept;
-    static void GetLines([[maybe_unused]]StackTrace* st, [[maybe_unused]]unsigned long max_lines) noexcept;
+    static frame_t Symbolize([[maybe_unused]]void* address) noexcept;
+    static frame_t GetCachedSymbol(void* address) noexcept;
     unsigned long hash = 0;
     unsigned long _frame_count = 0;
     static constexpr auto MAX_FRAMES_PER_CALLSTACK = 128ul;
     void* _frames[MAX_FRAMES_PER_CALLSTACK];
     static std::shared_mutex _cs;
+    static std::unordered_map<void*, frame_t> _symbol_cache;
     static std::atomic_uint64_t _refs;
     static std::atomic_bool _did_init;
 };
@@ -32,10 +60,10 @@ private:
 
 #ifdef PROFILE_BUILD
 #undef UNIQUE_STACKTRACE
-#define UNIQUE_STACKTRACE {static StackTrace TOKEN_PASTE(st,__LINE__);}
-#define STACKTRACE { StackTrace TOKEN_PASTE(st,__LINE__);}
-#define STACKTRACE_WITH_ARGS(skip, capture) { StackTrace TOKEN_PASTE(st,__LINE__)(skip, capture);}
-#define UNIQUE_STACKTRACE_WITH_ARGS(skip, capture) {static StackTrace TOKEN_PASTE(st,__LINE__)(skip, capture);}
+#define UNIQUE_STACKTRACE {static StackTrace TOKEN_PASTE(st,__LINE__); static const bool TOKEN_PASTE(st_printed,__LINE__) = (TOKEN_PASTE(st,__LINE__).Print(), true); UNUSED(TOKEN_PASTE(st_printed,__LINE__));}
+#define STACKTRACE { StackTrace TOKEN_PASTE(st,__LINE__); TOKEN_PASTE(st,__LINE__).Print();}
+#define STACKTRACE_WITH_ARGS(skip, capture) { StackTrace TOKEN_PASTE(st,__LINE__)(skip, capture); TOKEN_PASTE(st,__LINE__).Print();}
+#define UNIQUE_STACKTRACE_WITH_ARGS(skip, capture) {static StackTrace TOKEN_PASTE(st,__LINE__)(skip, capture); static const bool TOKEN_PASTE(st_printed,__LINE__) = (TOKEN_PASTE(st,__LINE__).Print(), true); UNUSED(TOKEN_PASTE(st_printed,__LINE__));}
 #else
 #undef UNIQUE_STACKTRACE_WITH_ARGS
 #define UNIQUE_STACKTRACE_WITH_ARGS(skip, capture)
@@ -1,6 +1,7 @@
 #include "Engine/Renderer/Renderer.hpp"
 
 #include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/Clock.hpp"
 #include "Engine/Core/DataUtils.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/FileUtils.hpp"
@@ -11,6 +12,7 @@
 #include "Engine/Core/Vertex3D.hpp"
 
 #include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/FastMath.hpp"
 #include "Engine/Math/Frustum.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/OBB2.hpp"
@@ -213,6 +215,13 @@ void Renderer::UpdateGameTime(TimeUtils::FPSeconds deltaSeconds) noexcept {
     SetConstantBuffer(TIME_BUFFER_INDEX, _time_cb.get());
 }
 
+void Renderer::UpdateGameTime(const Clock& gameClock) noexcept {
+    _time_data.game_time = gameClock.GetTotalTime().count();
+    _time_data.game_frame_time = gameClock.GetFrameTime().count();
+    _time_cb->Update(_rhi_context.get(), &_time_data);
+    SetConstantBuffer(TIME_BUFFER_INDEX, _time_cb.get());
+}
+
 void Renderer::UpdateSystemTime(TimeUtils::FPSeconds deltaSeconds) noexcept {
     _time_data.system_time += deltaSeconds.count();
     _time_data.system_frame_time = deltaSeconds.count();
@@ -934,8 +943,11 @@ void Renderer::DrawFilledCircle2D(const Vector2& center, float radius, const Rgb
     float anglePerVertex = 360.0f / static_cast<float>(num_sides);
     for(float degrees = 0.0f; degrees < 360.0f; degrees += anglePerVertex) {
         float radians = MathUtils::ConvertDegreesToRadians(degrees);
-        float pX = radius * std::cos(radians) + center.x;
-        float pY = radius * std::sin(radians) + center.y;
+        float sin_angle{};
+        float cos_angle{};
+        MathUtils::FastMath::SinCos(radians, sin_angle, cos_angle);
+        float pX = radius * cos_angle + center.x;
+        float pY = radius * sin_angle + center.y;
         verts.emplace_back(Vector2(pX, pY), 0.0f);
     }
 
@@ -1094,8 +1106,11 @@ void Renderer::DrawPolygon2D(float centerX, float centerY, float radius, std::si
     float anglePerVertex = 360.0f / num_sides_as_float;
     for(float degrees = 0.0f; degrees < 360.0f; degrees += anglePerVertex) {
         float radians = MathUtils::ConvertDegreesToRadians(degrees);
-        float pX = radius * std::cos(radians) + centerX;
-        float pY = radius * std::sin(radians) + centerY;
+        float sin_angle{};
+        float cos_angle{};
+        MathUtils::FastMath::SinCos(radians, sin_angle, cos_angle);
+        float pX = radius * cos_angle + centerX;
+        float pY = radius * sin_angle + centerY;
         verts.emplace_back(Vector2(pX, pY), 0.0f);
     }
 
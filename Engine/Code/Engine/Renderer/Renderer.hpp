@@ -26,6 +26,7 @@
 class AABB2;
 class AnimatedSprite;
 class BlendState;
+class Clock;
 class ConstantBuffer;
 class DepthStencilState;
 struct DepthStencilDesc;
@@ -292,6 +293,8 @@ public:
     void RegisterFontsFromFolder(std::filesystem::path folderpath, bool recursive = false) noexcept;
 
     void UpdateGameTime(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    //Uses the clock's total time directly so scaled or paused game time does not drift.
+    void UpdateGameTime(const Clock& gameClock) noexcept;
 
     void ResetModelViewProjection() noexcept;
     void AppendModelMatrix(const Matrix4& modelMatrix) noexcept;
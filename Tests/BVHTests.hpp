@@ -0,0 +1,306 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+#include "RandomShapes.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/BVH.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Matrix4.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<AABB3> MakeRandomBVHBoxes(std::size_t count, unsigned int seed, float worldSize = 100.0f) {
+    return MakeRandomBoxes(count, seed, worldSize, 0.1f, 2.0f);
+}
+
+//Brute force slab test in double precision.
+bool ReferenceSegmentHit(const LineSegment3& segment, const AABB3& box, double& tEntry) {
+    const double origin[3] = {segment.start.x, segment.start.y, segment.start.z};
+    const double direction[3] = {segment.end.x - origin[0], segment.end.y - origin[1], segment.end.z - origin[2]};
+    const double mins[3] = {box.mins.x, box.mins.y, box.mins.z};
+    const double maxs[3] = {box.maxs.x, box.maxs.y, box.maxs.z};
+    double t0 = 0.0;
+    double t1 = 1.0;
+    for(int axis = 0; axis < 3; ++axis) {
+        if(direction[axis] == 0.0) {
+            if(origin[axis] < mins[axis] || maxs[axis] < origin[axis]) {
+                return false;
+            }
+            continue;
+        }
+        double a = (mins[axis] - origin[axis]) / direction[axis];
+        double b = (maxs[axis] - origin[axis]) / direction[axis];
+        t0 = (std::max)(t0, (std::min)(a, b));
+        t1 = (std::min)(t1, (std::max)(a, b));
+    }
+    tEntry = t0;
+    return t0 <= t1;
+}
+
+template<typename Test>
+std::vector<std::size_t> BruteForceQuery(const std::vector<AABB3>& boxes, Test&& test) {
+    std::vector<std::size_t> result{};
+    for(std::size_t i = 0; i < boxes.size(); ++i) {
+        if(test(boxes[i])) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::vector<std::size_t> Sorted(std::vector<std::size_t> values) {
+    std::sort(std::begin(values), std::end(values));
+    return values;
+}
+
+bool SphereTouchesBox(const Sphere3& sphere, const AABB3& box) {
+    return MathUtils::CalcDistanceSquared(sphere.center, MathUtils::CalcClosestPoint(sphere.center, box)) <= sphere.radius * sphere.radius;
+}
+
+} //End anonymous
+
+TEST(BVH, EmptyTreeFindsNothing) {
+    BVH bvh{std::vector<AABB3>{}};
+    std::vector<std::size_t> results{};
+    std::size_t index = 0;
+    float t = 0.0f;
+    EXPECT_TRUE(bvh.empty());
+    EXPECT_EQ(bvh.QueryOverlap(AABB3::NEG_ONE_TO_ONE, results), 0u);
+    EXPECT_FALSE(bvh.Raycast(LineSegment3{Vector3::ZERO, Vector3::X_AXIS}, index, t));
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(bvh.GetBounds().mins, Vector3::ZERO);
+    EXPECT_EQ(bvh.GetBounds().maxs, Vector3::ZERO);
+}
+
+TEST(BVH, EveryPrimitiveIsInExactlyOneLeaf) {
+    const auto boxes = MakeRandomBVHBoxes(5000, 1u);
+    const BVH bvh{boxes};
+    EXPECT_EQ(bvh.size(), boxes.size());
+    auto indices = bvh.GetPrimitiveIndices();
+    std::sort(std::begin(indices), std::end(indices));
+    for(std::size_t i = 0; i < indices.size(); ++i) {
+        ASSERT_EQ(indices[i], i);
+    }
+    std::size_t leaf_primitives = 0;
+    const auto& nodes = bvh.GetNodes();
+    for(std::size_t i = 0; i < nodes.size(); ++i) {
+        if(nodes[i].IsLeaf()) {
+            leaf_primitives += nodes[i].count;
+        } else {
+            //Flat layout: siblings are adjacent and always after their parent.
+            EXPECT_GT(nodes[i].first, i);
+            EXPECT_LT(nodes[i].first + 1, nodes.size());
+        }
+    }
+    EXPECT_EQ(leaf_primitives, boxes.size());
+    EXPECT_LT(bvh.CalcDepth(), 64u);
+}
+
+TEST(BVH, OverlapQueriesMatchBruteForce) {
+    const auto boxes = MakeRandomBVHBoxes(5000, 2u);
+    const BVH bvh{boxes};
+    std::mt19937 rng{3u};
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.0f, 20.0f);
+    for(int query = 0; query < 200; ++query) {
+        const Vector3 center{coord(rng), coord(rng), coord(rng)};
+        const AABB3 box{center, size(rng), size(rng), size(rng)};
+        std::vector<std::size_t> results{};
+        const auto added = bvh.QueryOverlap(box, results);
+        EXPECT_EQ(added, results.size());
+        EXPECT_EQ(Sorted(results), BruteForceQuery(boxes, [&box](const AABB3& b) { return MathUtils::DoAABBsOverlap(box, b); }));
+
+        const Sphere3 sphere{center, size(rng)};
+        results.clear();
+        bvh.QueryOverlap(sphere, results);
+        EXPECT_EQ(Sorted(results), BruteForceQuery(boxes, [&sphere](const AABB3& b) { return SphereTouchesBox(sphere, b); }));
+    }
+}
+
+TEST(BVH, RayQueriesMatchBruteForce) {
+    const auto boxes = MakeRandomBVHBoxes(5000, 4u);
+    const BVH bvh{boxes};
+    for(const auto& segment : MakeRandomSegments(200, 5u, 110.0f)) {
+        std::vector<std::size_t> results{};
+        bvh.QueryRay(segment, results);
+        double t = 0.0;
+        EXPECT_EQ(Sorted(results), BruteForceQuery(boxes, [&](const AABB3& b) { return ReferenceSegmentHit(segment, b, t); }));
+
+        double closest_t = 2.0;
+        for(const auto& box : boxes) {
+            if(ReferenceSegmentHit(segment, box, t)) {
+                closest_t = (std::min)(closest_t, t);
+            }
+        }
+        std::size_t hit_index = 0;
+        float hit_t = 0.0f;
+        const bool hit = bvh.Raycast(segment, hit_index, hit_t);
+        EXPECT_EQ(hit, closest_t <= 1.0);
+        if(hit) {
+            EXPECT_NEAR(hit_t, closest_t, 1e-5);
+            double index_t = 0.0;
+            EXPECT_TRUE(ReferenceSegmentHit(segment, boxes[hit_index], index_t));
+            EXPECT_NEAR(index_t, closest_t, 1e-5);
+        }
+    }
+}
+
+TEST(BVH, FrustumQueryMatchesFrustumCull) {
+    const auto boxes = MakeRandomBVHBoxes(20000, 6u);
+    const BVH bvh{boxes};
+    const auto projection = Matrix4::CreateDXPerspectiveProjection(60.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    const auto view = Matrix4::CreateLookAtMatrix(Vector3::ZERO, Vector3::Z_AXIS, Vector3::Y_AXIS);
+    const auto frustum = Frustum::CreateFromViewProjectionMatrix(projection * view, 16.0f / 9.0f, 60.0f, Vector3::Z_AXIS, 0.1f, 100.0f, true);
+    std::vector<std::size_t> expected{};
+    frustum.Cull(boxes, expected);
+    std::vector<std::size_t> results{};
+    const auto added = bvh.QueryVisible(frustum, results);
+    EXPECT_EQ(added, expected.size());
+    EXPECT_EQ(Sorted(results), expected);
+    EXPECT_FALSE(results.empty());
+}
+
+TEST(BVH, RefitFollowsMovedPrimitives) {
+    auto boxes = MakeRandomBVHBoxes(3000, 7u);
+    BVH bvh{boxes};
+    std::mt19937 rng{8u};
+    std::uniform_real_distribution<float> offset(-10.0f, 10.0f);
+    for(auto& box : boxes) {
+        box.Translate(Vector3{offset(rng), offset(rng), offset(rng)});
+    }
+    bvh.Refit(boxes);
+    AABB3 expected_bounds = boxes[0];
+    for(const auto& box : boxes) {
+        expected_bounds.StretchToIncludePoint(box.mins);
+        expected_bounds.StretchToIncludePoint(box.maxs);
+    }
+    EXPECT_EQ(bvh.GetBounds().mins, expected_bounds.mins);
+    EXPECT_EQ(bvh.GetBounds().maxs, expected_bounds.maxs);
+
+    const AABB3 query{Vector3::ZERO, 30.0f, 30.0f, 30.0f};
+    std::vector<std::size_t> results{};
+    bvh.QueryOverlap(query, results);
+    EXPECT_EQ(Sorted(results), BruteForceQuery(boxes, [&query](const AABB3& b) { return MathUtils::DoAABBsOverlap(query, b); }));
+
+    bvh.SetPrimitiveBounds(0, AABB3{Vector3{500.0f, 500.0f, 500.0f}, 1.0f, 1.0f, 1.0f});
+    bvh.Refit();
+    results.clear();
+    bvh.QueryOverlap(AABB3{Vector3{500.0f, 500.0f, 500.0f}, 0.5f, 0.5f, 0.5f}, results);
+    EXPECT_EQ(results, std::vector<std::size_t>{0});
+}
+
+TEST(BVH, CoincidentPrimitivesStayShallow) {
+    const std::vector<AABB3> boxes(10000, AABB3{Vector3::ZERO, 1.0f, 1.0f, 1.0f});
+    const BVH bvh{boxes};
+    EXPECT_LT(bvh.CalcDepth(), 20u);
+    std::vector<std::size_t> results{};
+    EXPECT_EQ(bvh.QueryOverlap(Sphere3{Vector3::ZERO, 0.5f}, results), boxes.size());
+}
+
+TEST(BVH, ParallelBuildMatchesSerialBuild) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    const auto boxes = MakeRandomBVHBoxes(100000, 9u);
+    const BVH serial{boxes};
+    const BVH parallel{boxes, &jobs};
+    jobs.Shutdown();
+    ASSERT_EQ(serial.GetNodes().size(), parallel.GetNodes().size());
+    EXPECT_EQ(serial.GetPrimitiveIndices(), parallel.GetPrimitiveIndices());
+    for(std::size_t i = 0; i < serial.GetNodes().size(); ++i) {
+        const auto& a = serial.GetNodes()[i];
+        const auto& b = parallel.GetNodes()[i];
+        ASSERT_EQ(a.first, b.first);
+        ASSERT_EQ(a.count, b.count);
+        ASSERT_EQ(a.bounds.mins, b.bounds.mins);
+        ASSERT_EQ(a.bounds.maxs, b.bounds.maxs);
+    }
+}
+
+TEST(BVHBenchmarks, DISABLED_BuildAndQuery) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    for(const std::size_t count : {std::size_t{10000}, std::size_t{1000000}}) {
+        //Keep density roughly constant so queries return similar numbers of hits.
+        const auto world_size = 100.0f * std::cbrt(count / 10000.0f);
+        const auto boxes = MakeRandomBVHBoxes(count, 10u, world_size);
+        const auto label = std::to_string(count);
+        const auto build_iterations = count > 100000 ? 3 : 20;
+        BVH bvh{};
+        RunBenchmark("BVH Build " + label, build_iterations, count, [&]() {
+            bvh.Build(boxes);
+            DoNotOptimize(bvh);
+        });
+        RunBenchmark("BVH Build JobSystem " + label, build_iterations, count, [&]() {
+            bvh.Build(boxes, &jobs);
+            DoNotOptimize(bvh);
+        });
+        RunBenchmark("BVH Refit " + label, build_iterations, count, [&]() {
+            bvh.Refit();
+            DoNotOptimize(bvh);
+        });
+
+        std::vector<AABB3> queries{};
+        std::mt19937 rng{11u};
+        std::uniform_real_distribution<float> coord(-world_size, world_size);
+        for(int i = 0; i < 100; ++i) {
+            queries.emplace_back(Vector3{coord(rng), coord(rng), coord(rng)}, 5.0f, 5.0f, 5.0f);
+        }
+        std::vector<std::size_t> results{};
+        RunBenchmark("Brute force AABB overlap " + label, 1, queries.size(), [&]() {
+            results.clear();
+            for(const auto& query : queries) {
+                for(std::size_t i = 0; i < boxes.size(); ++i) {
+                    if(MathUtils::DoAABBsOverlap(query, boxes[i])) {
+                        results.push_back(i);
+                    }
+                }
+            }
+            DoNotOptimize(results);
+        });
+        RunBenchmark("BVH AABB overlap " + label, 10, queries.size(), [&]() {
+            results.clear();
+            for(const auto& query : queries) {
+                bvh.QueryOverlap(query, results);
+            }
+            DoNotOptimize(results);
+        });
+
+        const auto segments = MakeRandomSegments(100, 12u, 110.0f);
+        RunBenchmark("Brute force closest ray hit " + label, 1, segments.size(), [&]() {
+            double total = 0.0;
+            for(const auto& segment : segments) {
+                double closest = 2.0;
+                double t = 0.0;
+                for(const auto& box : boxes) {
+                    if(ReferenceSegmentHit(segment, box, t)) {
+                        closest = (std::min)(closest, t);
+                    }
+                }
+                total += closest;
+            }
+            DoNotOptimize(total);
+        });
+        RunBenchmark("BVH Raycast " + label, 10, segments.size(), [&]() {
+            float total = 0.0f;
+            for(const auto& segment : segments) {
+                std::size_t index = 0;
+                float t = 0.0f;
+                total += bvh.Raycast(segment, index, t) ? t : 2.0f;
+            }
+            DoNotOptimize(total);
+        });
+    }
+    jobs.Shutdown();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//Benchmarks are registered as DISABLED_ tests so the normal test run stays fast.
+//Run them with --gtest_also_run_disabled_tests --gtest_filter=*Benchmarks*
+
+template<typename F>
+TimeUtils::FPNanoseconds RunBenchmark(const std::string& name, std::size_t iterations, std::size_t items_per_iteration, F&& f) {
+    f(); //Warm caches and any lazy initialization.
+    const auto start = TimeUtils::Now();
+    for(std::size_t i = 0; i < iterations; ++i) {
+        f();
+    }
+    const auto end = TimeUtils::Now();
+    const auto total = TimeUtils::FPNanoseconds{end - start};
+    const auto items = static_cast<float>(iterations * (items_per_iteration ? items_per_iteration : 1));
+    const auto per_item = total / items;
+    std::cout << "[ BENCHMARK] " << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2) << per_item.count() << " ns/item "
+              << std::setw(14) << std::setprecision(0) << (items / TimeUtils::FPSeconds{total}.count()) << " items/s\n";
+    return per_item;
+}
+
+template<typename F>
+TimeUtils::FPNanoseconds RunBenchmark(const std::string& name, std::size_t iterations, F&& f) {
+    return RunBenchmark(name, iterations, 1, std::forward<F>(f));
+}
+
+//Makes the compiler assume value is read, so the work that produced it is not optimized away.
+template<typename T>
+void DoNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+    const volatile char* bytes = reinterpret_cast<const volatile char*>(&value);
+    static_cast<void>(*bytes);
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
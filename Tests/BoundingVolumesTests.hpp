@@ -0,0 +1,382 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+#include "RandomShapes.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/BoundingVolumes.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+//Surface points of a box of the given half extents, turned off the world axes and moved off the origin,
+//like the vertices of a prop mesh placed in a level.
+std::vector<Vector3> MakeRotatedBoxSurfacePoints(std::size_t count, const Vector3& halfExtents, unsigned int seed) {
+    const auto right = Vector3{2.0f, 1.0f, 0.5f}.GetNormalize();
+    const auto up = MathUtils::CrossProduct(Vector3{0.0f, 0.0f, 1.0f}, right).GetNormalize();
+    const auto forward = MathUtils::CrossProduct(right, up);
+    const Vector3 offset{12.0f, -7.0f, 3.0f};
+    return MakeRandomShapes<Vector3>(count, seed, [=](RandomShapeSource& source, std::size_t) {
+        auto local = source.GetPointInCube(1.0f);
+        const auto side = source.GetIntInRange(0, 5);
+        const auto sign = side % 2 ? 1.0f : -1.0f;
+        if(side / 2 == 0) {
+            local.x = sign;
+        } else if(side / 2 == 1) {
+            local.y = sign;
+        } else {
+            local.z = sign;
+        }
+        return offset + right * (local.x * halfExtents.x) + up * (local.y * halfExtents.y) + forward * (local.z * halfExtents.z);
+    });
+}
+
+//Vertices of a lumpy, stretched sphere mesh, turned off the world axes: (rings + 1) * segments points.
+std::vector<Vector3> MakeLumpyEllipsoidPoints(std::size_t rings, std::size_t segments, const Vector3& radii) {
+    const auto pi = 3.14159265f;
+    const auto right = Vector3{1.0f, 1.0f, 1.0f}.GetNormalize();
+    const auto up = MathUtils::CrossProduct(Vector3{0.0f, 0.0f, 1.0f}, right).GetNormalize();
+    const auto forward = MathUtils::CrossProduct(right, up);
+    std::vector<Vector3> result{};
+    for(std::size_t ring = 0; ring <= rings; ++ring) {
+        for(std::size_t segment = 0; segment < segments; ++segment) {
+            const auto theta = pi * static_cast<float>(ring) / static_cast<float>(rings);
+            const auto phi = 2.0f * pi * static_cast<float>(segment) / static_cast<float>(segments);
+            const auto bump = 1.0f + 0.1f * std::sin(5.0f * phi) * std::sin(3.0f * theta);
+            result.push_back(right * (radii.x * bump * std::sin(theta) * std::cos(phi)) + up * (radii.y * bump * std::sin(theta) * std::sin(phi)) + forward * (radii.z * bump * std::cos(theta)));
+        }
+    }
+    return result;
+}
+
+//Every point is on or behind every face, the faces close up (V - E + F = 2) and wind outward.
+void ExpectValidHull(const std::vector<Vector3>& points, const ConvexHull3& hull) {
+    ASSERT_FALSE(hull.indices.empty());
+    ASSERT_EQ(hull.indices.size() % 3, 0u);
+    const auto faces = hull.indices.size() / 3;
+    EXPECT_EQ(static_cast<long long>(hull.vertices.size()) - static_cast<long long>(3 * faces / 2) + static_cast<long long>(faces), 2);
+    Vector3 centroid{};
+    for(const auto& vertex : hull.vertices) {
+        centroid += vertex;
+    }
+    centroid /= static_cast<float>(hull.vertices.size());
+    for(std::size_t face = 0; face < faces; ++face) {
+        const auto& a = hull.vertices[hull.indices[3 * face + 0]];
+        const auto& b = hull.vertices[hull.indices[3 * face + 1]];
+        const auto& c = hull.vertices[hull.indices[3 * face + 2]];
+        const auto normal = MathUtils::CrossProduct(b - a, c - a).GetNormalize();
+        EXPECT_LT(MathUtils::DotProduct(normal, centroid - a), 0.0f);
+        for(const auto& p : points) {
+            ASSERT_LT(MathUtils::DotProduct(normal, p - a), 1e-3f);
+        }
+    }
+}
+
+std::set<std::tuple<float, float, float>> MakeBoundingVolumeVertexSet(const std::vector<Vector3>& vertices) {
+    std::set<std::tuple<float, float, float>> result{};
+    for(const auto& v : vertices) {
+        result.emplace(v.x, v.y, v.z);
+    }
+    return result;
+}
+
+//Smallest sphere through two, three or four of the points that holds them all.
+float CalcBruteForceMinimalRadius(const std::vector<Vector3>& points) {
+    auto best = (std::numeric_limits<float>::max)();
+    const auto consider = [&](const Vector3& center) {
+        if(!std::isfinite(center.x + center.y + center.z)) {
+            return;
+        }
+        auto radius = 0.0f;
+        for(const auto& p : points) {
+            radius = (std::max)(radius, (p - center).CalcLength());
+        }
+        best = (std::min)(best, radius);
+    };
+    const auto n = points.size();
+    for(std::size_t i = 0; i < n; ++i) {
+        for(auto j = i + 1; j < n; ++j) {
+            consider((points[i] + points[j]) * 0.5f);
+            for(auto k = j + 1; k < n; ++k) {
+                const auto ab = points[j] - points[i];
+                const auto ac = points[k] - points[i];
+                const auto normal = MathUtils::CrossProduct(ab, ac);
+                consider(points[i] + (MathUtils::CrossProduct(normal, ab) * ac.CalcLengthSquared() + MathUtils::CrossProduct(ac, normal) * ab.CalcLengthSquared()) / (2.0f * normal.CalcLengthSquared()));
+                for(auto l = k + 1; l < n; ++l) {
+                    const auto w = points[l] - points[i];
+                    const auto determinant = MathUtils::DotProduct(ab, MathUtils::CrossProduct(ac, w));
+                    consider(points[i] + (MathUtils::CrossProduct(ac, w) * ab.CalcLengthSquared() + MathUtils::CrossProduct(w, ab) * ac.CalcLengthSquared() + MathUtils::CrossProduct(ab, ac) * w.CalcLengthSquared()) / (2.0f * determinant));
+                }
+            }
+        }
+    }
+    return best;
+}
+
+} //End anonymous
+
+TEST(BoundingVolumes, ConvexHull2DIsConvexAndHoldsEveryPoint) {
+    std::mt19937 rng{21u};
+    std::uniform_real_distribution<float> coord(-5.0f, 5.0f);
+    std::vector<Vector2> points{};
+    for(std::size_t i = 0; i < 5000; ++i) {
+        points.emplace_back(coord(rng), coord(rng));
+    }
+    const auto hull = MathUtils::CalcConvexHull(points);
+    ASSERT_GE(hull.size(), 3u);
+    for(std::size_t i = 0; i < hull.size(); ++i) {
+        const auto& a = hull[i];
+        const auto& b = hull[(i + 1) % hull.size()];
+        const auto& c = hull[(i + 2) % hull.size()];
+        EXPECT_GT((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x), 0.0f);
+        for(const auto& p : points) {
+            ASSERT_GE((b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x), -1e-4f);
+        }
+    }
+
+    //Points along the edges of a square leave only its corners.
+    std::vector<Vector2> square{};
+    for(int i = 0; i <= 10; ++i) {
+        const auto t = static_cast<float>(i - 5) / 5.0f;
+        square.insert(square.end(), {Vector2{t, -1.0f}, Vector2{t, 1.0f}, Vector2{-1.0f, t}, Vector2{1.0f, t}, Vector2{t * 0.5f, 0.0f}});
+    }
+    const auto corners = MathUtils::CalcConvexHull(square);
+    ASSERT_EQ(corners.size(), 4u);
+    EXPECT_EQ(corners[0], Vector2(-1.0f, -1.0f));
+    EXPECT_EQ(corners[1], Vector2(1.0f, -1.0f));
+    EXPECT_EQ(corners[2], Vector2(1.0f, 1.0f));
+    EXPECT_EQ(corners[3], Vector2(-1.0f, 1.0f));
+
+    EXPECT_TRUE(MathUtils::CalcConvexHull(std::vector<Vector2>{}).empty());
+    EXPECT_EQ(MathUtils::CalcConvexHull(std::vector<Vector2>(3, Vector2{1.0f, 2.0f})).size(), 1u);
+    EXPECT_EQ(MathUtils::CalcConvexHull(std::vector<Vector2>{Vector2{0.0f, 0.0f}, Vector2{2.0f, 2.0f}, Vector2{1.0f, 1.0f}}).size(), 2u);
+}
+
+TEST(BoundingVolumes, ConvexHull3DIsClosedAndHoldsEveryPoint) {
+    const auto ball = MakeRandomBallPoints(4000, 22u, 5.0f);
+    ExpectValidHull(ball, MathUtils::CalcConvexHull(ball));
+    const auto lumpy = MakeLumpyEllipsoidPoints(30, 40, Vector3{6.0f, 3.0f, 2.0f});
+    ExpectValidHull(lumpy, MathUtils::CalcConvexHull(lumpy));
+
+    //A grid filling a cube is full of coplanar and collinear points; only the corners are on the hull.
+    std::vector<Vector3> grid{};
+    for(int x = 0; x <= 6; ++x) {
+        for(int y = 0; y <= 6; ++y) {
+            for(int z = 0; z <= 6; ++z) {
+                grid.emplace_back(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+            }
+        }
+    }
+    const auto cube = MathUtils::CalcConvexHull(grid);
+    ExpectValidHull(grid, cube);
+    EXPECT_EQ(cube.vertices.size(), 8u);
+    EXPECT_EQ(cube.indices.size(), 36u);
+
+    //Flat sets give an outline, lines their ends and a repeated point itself.
+    std::vector<Vector3> flat{};
+    for(const auto& p : MakeRandomBallPoints(200, 23u, 1.0f)) {
+        flat.emplace_back(p.x + p.y, p.x - p.y, 2.0f * p.x);
+    }
+    const auto outline = MathUtils::CalcConvexHull(flat);
+    EXPECT_TRUE(outline.indices.empty());
+    EXPECT_GE(outline.vertices.size(), 3u);
+    const auto line = MathUtils::CalcConvexHull(std::vector<Vector3>{Vector3{0.0f, 0.0f, 0.0f}, Vector3{3.0f, 3.0f, 3.0f}, Vector3{1.0f, 1.0f, 1.0f}});
+    EXPECT_TRUE(line.indices.empty());
+    EXPECT_EQ(line.vertices.size(), 2u);
+    EXPECT_EQ(MathUtils::CalcConvexHull(std::vector<Vector3>(4, Vector3::ONE)).vertices.size(), 1u);
+    EXPECT_TRUE(MathUtils::CalcConvexHull(std::vector<Vector3>{}).vertices.empty());
+}
+
+TEST(BoundingVolumes, ParallelResultsMatchSerial) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    const auto points = MakeRandomBallPoints(40000, 24u, 5.0f);
+    const auto serial = MathUtils::CalcConvexHull(points);
+    const auto parallel = MathUtils::CalcConvexHull(points, &jobs);
+    ExpectValidHull(points, parallel);
+    EXPECT_EQ(MakeBoundingVolumeVertexSet(serial.vertices), MakeBoundingVolumeVertexSet(parallel.vertices));
+
+    std::vector<Vector2> flat{};
+    for(const auto& p : points) {
+        flat.emplace_back(p.x, p.y);
+    }
+    EXPECT_EQ(MathUtils::CalcConvexHull(flat), MathUtils::CalcConvexHull(flat, &jobs));
+
+    const auto box = MathUtils::CalcBoundingBox(points);
+    const auto parallel_box = MathUtils::CalcBoundingBox(points, &jobs);
+    EXPECT_EQ(box.mins, parallel_box.mins);
+    EXPECT_EQ(box.maxs, parallel_box.maxs);
+
+    const auto minimal = MathUtils::CalcMinimalBoundingSphere(points);
+    const auto parallel_minimal = MathUtils::CalcMinimalBoundingSphere(points, &jobs);
+    EXPECT_NEAR(minimal.radius, parallel_minimal.radius, 1e-4f);
+
+    const auto obb = MathUtils::CalcBoundingOBB(points);
+    const auto parallel_obb = MathUtils::CalcBoundingOBB(points, &jobs);
+    EXPECT_NEAR(obb.CalcVolume(), parallel_obb.CalcVolume(), 1e-3f * obb.CalcVolume());
+
+    //Ritter's chunks grow separately, so the parallel sphere can differ but must still hold every point.
+    const auto ritter = MathUtils::CalcBoundingSphereRitter(points, &jobs);
+    for(const auto& p : points) {
+        ASSERT_TRUE(MathUtils::IsPointInside(ritter, p));
+    }
+    jobs.Shutdown();
+}
+
+TEST(BoundingVolumes, SpheresHoldEveryPointAndWelzlIsMinimal) {
+    for(unsigned int seed = 0; seed < 20; ++seed) {
+        const auto points = MakeRandomBallPoints(9, 100u + seed, 4.0f);
+        const auto minimal = MathUtils::CalcMinimalBoundingSphere(points);
+        const auto ritter = MathUtils::CalcBoundingSphereRitter(points);
+        for(const auto& p : points) {
+            EXPECT_TRUE(MathUtils::IsPointInside(minimal, p));
+            EXPECT_TRUE(MathUtils::IsPointInside(ritter, p));
+        }
+        EXPECT_NEAR(minimal.radius, CalcBruteForceMinimalRadius(points), 1e-3f);
+        EXPECT_LE(minimal.radius, ritter.radius * (1.0f + 1e-5f));
+    }
+
+    //Points on a sphere are bounded by that sphere.
+    std::vector<Vector3> shell{};
+    const Vector3 center{3.0f, -2.0f, 1.0f};
+    for(const auto& p : MakeRandomBallPoints(5000, 25u, 1.0f)) {
+        shell.push_back(center + p.GetNormalize() * 2.5f);
+    }
+    const auto minimal = MathUtils::CalcMinimalBoundingSphere(shell);
+    EXPECT_NEAR(minimal.radius, 2.5f, 1e-2f);
+    EXPECT_NEAR((minimal.center - center).CalcLength(), 0.0f, 1e-2f);
+    for(const auto& p : shell) {
+        ASSERT_TRUE(MathUtils::IsPointInside(minimal, p));
+    }
+
+    EXPECT_EQ(MathUtils::CalcMinimalBoundingSphere(std::vector<Vector3>{}).radius, 0.0f);
+    const auto single = MathUtils::CalcMinimalBoundingSphere(std::vector<Vector3>{Vector3::ONE});
+    EXPECT_EQ(single.center, Vector3::ONE);
+    EXPECT_EQ(single.radius, 0.0f);
+}
+
+TEST(BoundingVolumes, OBBFitsRotatedBoxes) {
+    const Vector3 half_extents{4.0f, 1.5f, 0.5f};
+    const auto points = MakeRotatedBoxSurfacePoints(20000, half_extents, 26u);
+    const auto obb = MathUtils::CalcBoundingOBB(points);
+    const auto aabb = MathUtils::CalcBoundingBox(points);
+    const auto aabb_size = aabb.CalcDimensions();
+    EXPECT_NEAR(MathUtils::DotProduct(obb.right, obb.up), 0.0f, 1e-4f);
+    EXPECT_NEAR(MathUtils::DotProduct(obb.right, obb.forward), 0.0f, 1e-4f);
+    EXPECT_NEAR(MathUtils::DotProduct(obb.up, obb.forward), 0.0f, 1e-4f);
+    EXPECT_NEAR(obb.forward.CalcLength(), 1.0f, 1e-4f);
+    //The true box has volume 8 * 4 * 1.5 * 0.5 = 24.
+    EXPECT_LT(obb.CalcVolume(), 24.0f * 1.05f);
+    EXPECT_LT(obb.CalcVolume(), 0.5f * aabb_size.x * aabb_size.y * aabb_size.z);
+    auto grown = obb;
+    grown.AddPaddingToSides(1e-4f, 1e-4f, 1e-4f);
+    for(const auto& p : points) {
+        ASSERT_TRUE(MathUtils::IsPointInside(grown, p));
+    }
+
+    //Axis-aligned data: the world axes win and the AABB comes back.
+    const auto ball = MakeRandomBallPoints(1000, 27u, 2.0f);
+    std::vector<Vector3> aligned{};
+    for(const auto& p : ball) {
+        aligned.emplace_back(std::round(p.x), std::round(p.y), std::round(p.z));
+    }
+    const auto aligned_obb = MathUtils::CalcBoundingOBB(aligned);
+    const auto aligned_size = MathUtils::CalcBoundingBox(aligned).CalcDimensions();
+    EXPECT_LE(aligned_obb.CalcVolume(), aligned_size.x * aligned_size.y * aligned_size.z * (1.0f + 1e-5f));
+}
+
+TEST(BoundingVolumes, OBBIsTheSameFarFromTheOrigin) {
+    const Vector3 half_extents{40.0f, 15.0f, 0.5f};
+    const auto points = MakeRotatedBoxSurfacePoints(20000, half_extents, 28u);
+    const Vector3 offset{250000.0f, -125000.0f, 62500.0f};
+    std::vector<Vector3> far_points{};
+    far_points.reserve(points.size());
+    for(const auto& p : points) {
+        far_points.push_back(p + offset);
+    }
+    const auto near_obb = MathUtils::CalcBoundingOBB(points);
+    const auto far_obb = MathUtils::CalcBoundingOBB(far_points);
+    EXPECT_NEAR(far_obb.CalcVolume(), near_obb.CalcVolume(), near_obb.CalcVolume() * 0.02f);
+    EXPECT_NEAR(std::abs(MathUtils::DotProduct(far_obb.forward, near_obb.forward)), 1.0f, 1e-3f);
+    auto grown = far_obb;
+    grown.AddPaddingToSides(0.05f, 0.05f, 0.05f);
+    for(const auto& p : far_points) {
+        ASSERT_TRUE(MathUtils::IsPointInside(grown, p));
+    }
+}
+
+TEST(BoundingVolumesBenchmarks, DISABLED_FitAndTightness) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    const auto pi = 3.14159265f;
+    struct TestMesh {
+        std::string name;
+        std::vector<Vector3> points;
+    };
+    //Generated point sets shaped like common props stand in for loaded meshes, so the run needs no asset files.
+    std::vector<TestMesh> meshes{};
+    meshes.push_back({"crate", MakeRotatedBoxSurfacePoints(1 << 20, Vector3{4.0f, 1.5f, 0.5f}, 28u)});
+    meshes.push_back({"lumpy ellipsoid", MakeLumpyEllipsoidPoints(1024, 1024, Vector3{6.0f, 3.0f, 2.0f})});
+    meshes.push_back({"ball", MakeRandomBallPoints(1 << 20, 29u, 5.0f)});
+    for(const auto& mesh : meshes) {
+        const auto& points = mesh.points;
+        const auto label = " " + mesh.name + " " + std::to_string(points.size());
+        RunBenchmark("AABB" + label, 5, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcBoundingBox(points));
+        });
+        RunBenchmark("AABB JobSystem" + label, 5, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcBoundingBox(points, &jobs));
+        });
+        RunBenchmark("Hull" + label, 3, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcConvexHull(points).indices.size());
+        });
+        RunBenchmark("Hull JobSystem" + label, 3, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcConvexHull(points, &jobs).indices.size());
+        });
+        RunBenchmark("Ritter" + label, 5, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcBoundingSphereRitter(points));
+        });
+        RunBenchmark("Ritter JobSystem" + label, 5, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcBoundingSphereRitter(points, &jobs));
+        });
+        RunBenchmark("Welzl" + label, 3, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcMinimalBoundingSphere(points));
+        });
+        RunBenchmark("Welzl JobSystem" + label, 3, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcMinimalBoundingSphere(points, &jobs));
+        });
+        RunBenchmark("PCA OBB" + label, 5, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcBoundingOBB(points));
+        });
+        RunBenchmark("PCA OBB JobSystem" + label, 5, points.size(), [&]() {
+            DoNotOptimize(MathUtils::CalcBoundingOBB(points, &jobs));
+        });
+        //Tightness as volume relative to the AABB; smaller is tighter.
+        const auto aabb_size = MathUtils::CalcBoundingBox(points).CalcDimensions();
+        const auto aabb_volume = aabb_size.x * aabb_size.y * aabb_size.z;
+        const auto sphere_volume = [pi](const Sphere3& sphere) {
+            return 4.0f / 3.0f * pi * sphere.radius * sphere.radius * sphere.radius;
+        };
+        std::cout << "[ BENCHMARK] " << mesh.name << " volume / AABB volume:" << std::setprecision(3)
+                  << " OBB " << MathUtils::CalcBoundingOBB(points).CalcVolume() / aabb_volume
+                  << " Ritter " << sphere_volume(MathUtils::CalcBoundingSphereRitter(points)) / aabb_volume
+                  << " Welzl " << sphere_volume(MathUtils::CalcMinimalBoundingSphere(points)) / aabb_volume
+                  << " hull vertices " << MathUtils::CalcConvexHull(points).vertices.size() << "\n";
+    }
+    jobs.Shutdown();
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+#include "RandomShapes.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Broadphase2D.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/LooseQuadtree2D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/OBB2.hpp"
+#include "Engine/Math/SpatialHashGrid2D.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+using proxy_pairs_t = std::vector<Broadphase2D::proxy_pair_t>;
+
+std::vector<std::unique_ptr<Broadphase2D>> MakeBroadphases() {
+    std::vector<std::unique_ptr<Broadphase2D>> result{};
+    result.push_back(std::make_unique<SpatialHashGrid2D>(4.0f));
+    result.push_back(std::make_unique<LooseQuadtree2D>(AABB2{-200.0f, -200.0f, 200.0f, 200.0f}, 8));
+    return result;
+}
+
+//Mostly small discs plus a few large ones and a few outside the world bounds.
+std::vector<Disc2> MakeRandomDiscs(std::size_t count, unsigned int seed, float worldSize = 200.0f) {
+    return MakeRandomShapes<Disc2>(count, seed, [=](RandomShapeSource& source, std::size_t i) {
+        const auto r = (i % 97 == 0) ? 20.0f : source.GetFloatInRange(0.25f, 2.0f);
+        const auto scale = (i % 101 == 0) ? 1.5f : 1.0f;
+        const auto x = source.GetFloatInRange(-worldSize, worldSize);
+        const auto y = source.GetFloatInRange(-worldSize, worldSize);
+        return Disc2{x * scale, y * scale, r};
+    });
+}
+
+proxy_pairs_t BruteForcePairs(const Broadphase2D& broadphase, const std::vector<std::size_t>& proxies) {
+    proxy_pairs_t result{};
+    for(std::size_t i = 0; i < proxies.size(); ++i) {
+        for(std::size_t j = i + 1; j < proxies.size(); ++j) {
+            if(MathUtils::DoAABBsOverlap(broadphase.GetBounds(proxies[i]), broadphase.GetBounds(proxies[j]))) {
+                result.emplace_back((std::min)(proxies[i], proxies[j]), (std::max)(proxies[i], proxies[j]));
+            }
+        }
+    }
+    std::sort(std::begin(result), std::end(result));
+    return result;
+}
+
+proxy_pairs_t QuerySortedPairs(const Broadphase2D& broadphase) {
+    proxy_pairs_t result{};
+    broadphase.QueryPairs(result);
+    std::sort(std::begin(result), std::end(result));
+    return result;
+}
+
+template<typename T>
+std::vector<T> Sorted(std::vector<T> values) {
+    std::sort(std::begin(values), std::end(values));
+    return values;
+}
+
+} //End anonymous
+
+TEST(Broadphase2D, RegionAndPointQueriesMatchBruteForce) {
+    const auto discs = MakeRandomDiscs(2000, 1u);
+    for(auto& broadphase : MakeBroadphases()) {
+        SCOPED_TRACE(dynamic_cast<SpatialHashGrid2D*>(broadphase.get()) ? "SpatialHashGrid2D" : "LooseQuadtree2D");
+        std::vector<std::size_t> proxies{};
+        for(const auto& disc : discs) {
+            proxies.push_back(broadphase->Insert(disc));
+        }
+        ASSERT_EQ(broadphase->size(), discs.size());
+        std::mt19937 rng{2u};
+        std::uniform_real_distribution<float> coord(-250.0f, 250.0f);
+        std::uniform_real_distribution<float> size(0.0f, 40.0f);
+        for(int query = 0; query < 100; ++query) {
+            const Vector2 center{coord(rng), coord(rng)};
+            const AABB2 region{center, size(rng), size(rng)};
+            std::vector<std::size_t> expected{};
+            std::vector<std::size_t> expected_point{};
+            for(const auto proxy : proxies) {
+                const auto& bounds = broadphase->GetBounds(proxy);
+                if(MathUtils::DoAABBsOverlap(region, bounds)) {
+                    expected.push_back(proxy);
+                }
+                if(MathUtils::IsPointInside(bounds, center)) {
+                    expected_point.push_back(proxy);
+                }
+            }
+            std::vector<std::size_t> results{};
+            broadphase->QueryRegion(region, results);
+            EXPECT_EQ(Sorted(results), expected);
+            results.clear();
+            broadphase->QueryPoint(center, results);
+            EXPECT_EQ(Sorted(results), expected_point);
+        }
+    }
+}
+
+TEST(Broadphase2D, PairsMatchBruteForce) {
+    const auto discs = MakeRandomDiscs(3000, 3u);
+    for(auto& broadphase : MakeBroadphases()) {
+        SCOPED_TRACE(dynamic_cast<SpatialHashGrid2D*>(broadphase.get()) ? "SpatialHashGrid2D" : "LooseQuadtree2D");
+        std::vector<std::size_t> proxies{};
+        for(const auto& disc : discs) {
+            proxies.push_back(broadphase->Insert(disc));
+        }
+        const auto pairs = QuerySortedPairs(*broadphase);
+        EXPECT_EQ(pairs, BruteForcePairs(*broadphase, proxies));
+        EXPECT_TRUE(std::adjacent_find(std::begin(pairs), std::end(pairs)) == std::end(pairs));
+        EXPECT_FALSE(pairs.empty());
+    }
+}
+
+TEST(Broadphase2D, MoveRemoveAndReinsertStayConsistent) {
+    auto discs = MakeRandomDiscs(2000, 4u);
+    for(auto& broadphase : MakeBroadphases()) {
+        SCOPED_TRACE(dynamic_cast<SpatialHashGrid2D*>(broadphase.get()) ? "SpatialHashGrid2D" : "LooseQuadtree2D");
+        std::vector<std::size_t> proxies{};
+        for(const auto& disc : discs) {
+            proxies.push_back(broadphase->Insert(disc));
+        }
+        std::mt19937 rng{5u};
+        std::uniform_real_distribution<float> step(-6.0f, 6.0f);
+        for(int frame = 0; frame < 5; ++frame) {
+            for(std::size_t i = 0; i < proxies.size(); ++i) {
+                auto disc = discs[proxies[i]];
+                disc.Translate(Vector2{step(rng), step(rng)});
+                broadphase->Move(proxies[i], disc);
+            }
+            EXPECT_EQ(QuerySortedPairs(*broadphase), BruteForcePairs(*broadphase, proxies));
+        }
+        //Remove every third proxy, then insert replacements that reuse the freed ids.
+        std::vector<std::size_t> kept{};
+        for(std::size_t i = 0; i < proxies.size(); ++i) {
+            if(i % 3 == 0) {
+                broadphase->Remove(proxies[i]);
+                EXPECT_FALSE(broadphase->IsValid(proxies[i]));
+            } else {
+                kept.push_back(proxies[i]);
+            }
+        }
+        EXPECT_EQ(broadphase->size(), kept.size());
+        EXPECT_EQ(QuerySortedPairs(*broadphase), BruteForcePairs(*broadphase, kept));
+        for(int i = 0; i < 100; ++i) {
+            const auto proxy = broadphase->Insert(AABB2{Vector2{step(rng), step(rng)}, 1.0f, 1.0f});
+            EXPECT_LT(proxy, proxies.size());
+            kept.push_back(proxy);
+        }
+        EXPECT_EQ(QuerySortedPairs(*broadphase), BruteForcePairs(*broadphase, kept));
+        broadphase->Clear();
+        EXPECT_TRUE(broadphase->empty());
+        proxy_pairs_t pairs{};
+        broadphase->QueryPairs(pairs);
+        EXPECT_TRUE(pairs.empty());
+    }
+}
+
+TEST(Broadphase2D, FilterPairsRunsNarrowphase) {
+    const auto discs = MakeRandomDiscs(3000, 6u);
+    std::vector<OBB2> boxes{};
+    for(const auto& disc : discs) {
+        boxes.emplace_back(disc.center, disc.radius, disc.radius * 0.5f, disc.center.x * 7.0f);
+    }
+    proxy_pairs_t expected_discs{};
+    proxy_pairs_t expected_boxes{};
+    for(std::size_t i = 0; i < discs.size(); ++i) {
+        for(std::size_t j = i + 1; j < discs.size(); ++j) {
+            if(MathUtils::DoDiscsOverlap(discs[i], discs[j])) {
+                expected_discs.emplace_back(i, j);
+            }
+            if(MathUtils::DoOBBsOverlap(boxes[i], boxes[j])) {
+                expected_boxes.emplace_back(i, j);
+            }
+        }
+    }
+    for(auto& broadphase : MakeBroadphases()) {
+        SCOPED_TRACE(dynamic_cast<SpatialHashGrid2D*>(broadphase.get()) ? "SpatialHashGrid2D" : "LooseQuadtree2D");
+        for(const auto& disc : discs) {
+            broadphase->Insert(disc);
+        }
+        proxy_pairs_t hits{};
+        Broadphase2D::FilterPairs(QuerySortedPairs(*broadphase), discs.data(), [](const Disc2& a, const Disc2& b) { return MathUtils::DoDiscsOverlap(a, b); }, hits);
+        EXPECT_EQ(hits, expected_discs);
+
+        broadphase->Clear();
+        for(const auto& box : boxes) {
+            broadphase->Insert(box);
+        }
+        hits.clear();
+        Broadphase2D::FilterPairs(QuerySortedPairs(*broadphase), boxes.data(), [](const OBB2& a, const OBB2& b) { return MathUtils::DoOBBsOverlap(a, b); }, hits);
+        EXPECT_EQ(hits, expected_boxes);
+    }
+}
+
+TEST(Broadphase2DBenchmarks, DISABLED_FiftyThousandMovingDiscs) {
+    constexpr std::size_t count = 50000;
+    constexpr float world_size = 1000.0f;
+    std::mt19937 rng{7u};
+    std::uniform_real_distribution<float> coord(-world_size, world_size);
+    std::uniform_real_distribution<float> radius(0.5f, 2.0f);
+    std::uniform_real_distribution<float> speed(-1.0f, 1.0f);
+    std::vector<Disc2> start_discs{};
+    std::vector<Vector2> velocities{};
+    for(std::size_t i = 0; i < count; ++i) {
+        start_discs.emplace_back(coord(rng), coord(rng), radius(rng));
+        velocities.emplace_back(speed(rng), speed(rng));
+    }
+    proxy_pairs_t candidates{};
+    proxy_pairs_t hits{};
+    RunBenchmark("Brute force disc pairs 50k", 1, count, [&]() {
+        hits.clear();
+        for(std::size_t i = 0; i < count; ++i) {
+            for(std::size_t j = i + 1; j < count; ++j) {
+                if(MathUtils::DoDiscsOverlap(start_discs[i], start_discs[j])) {
+                    hits.emplace_back(i, j);
+                }
+            }
+        }
+        DoNotOptimize(hits);
+    });
+    const auto run = [&](const char* name, Broadphase2D& broadphase) {
+        auto discs = start_discs;
+        for(const auto& disc : discs) {
+            broadphase.Insert(disc);
+        }
+        RunBenchmark(name, 20, count, [&]() {
+            for(std::size_t i = 0; i < count; ++i) {
+                discs[i].Translate(velocities[i]);
+                broadphase.Move(i, discs[i]);
+            }
+            candidates.clear();
+            hits.clear();
+            broadphase.QueryPairs(candidates);
+            Broadphase2D::FilterPairs(candidates, discs.data(), [](const Disc2& a, const Disc2& b) { return MathUtils::DoDiscsOverlap(a, b); }, hits);
+            DoNotOptimize(hits);
+        });
+    };
+    SpatialHashGrid2D grid{4.0f};
+    run("SpatialHashGrid2D move+pairs 50k", grid);
+    LooseQuadtree2D quadtree{AABB2{-world_size, -world_size, world_size, world_size}, 10};
+    run("LooseQuadtree2D move+pairs 50k", quadtree);
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Engine/Core/Clock.hpp"
+#include "Engine/Core/FixedTimestep.hpp"
+#include "Engine/Core/FramePacer.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+TEST(Clock, MasterAccumulatesTickedTime) {
+    Clock master{};
+    master.Tick(TimeUtils::FPSeconds{0.5f});
+    master.Tick(TimeUtils::FPSeconds{0.25f});
+    EXPECT_FLOAT_EQ(master.GetFrameTime().count(), 0.25f);
+    EXPECT_FLOAT_EQ(master.GetTotalTime().count(), 0.75f);
+    EXPECT_EQ(master.GetFrameCount(), 2u);
+}
+
+TEST(Clock, ChildScalesParentDelta) {
+    Clock master{};
+    Clock child{master};
+    Clock grandchild{child};
+    child.SetScale(0.5f);
+    grandchild.SetScale(4.0f);
+    master.Tick(TimeUtils::FPSeconds{1.0f});
+    EXPECT_FLOAT_EQ(child.GetFrameTime().count(), 0.5f);
+    EXPECT_FLOAT_EQ(grandchild.GetFrameTime().count(), 2.0f);
+    EXPECT_EQ(grandchild.GetParent(), &child);
+}
+
+TEST(Clock, PausedClockStopsItsSubtree) {
+    Clock master{};
+    Clock child{master};
+    Clock grandchild{child};
+    child.Pause();
+    master.Tick(TimeUtils::FPSeconds{1.0f});
+    EXPECT_FLOAT_EQ(master.GetTotalTime().count(), 1.0f);
+    EXPECT_FLOAT_EQ(child.GetTotalTime().count(), 0.0f);
+    EXPECT_FLOAT_EQ(grandchild.GetTotalTime().count(), 0.0f);
+    child.Resume();
+    master.Tick(TimeUtils::FPSeconds{1.0f});
+    EXPECT_FLOAT_EQ(grandchild.GetTotalTime().count(), 1.0f);
+}
+
+TEST(Clock, DestroyedParentOrphansChildren) {
+    auto parent = std::make_unique<Clock>();
+    Clock child{*parent};
+    parent.reset();
+    EXPECT_EQ(child.GetParent(), nullptr);
+    child.Tick(TimeUtils::FPSeconds{1.0f});
+    EXPECT_FLOAT_EQ(child.GetTotalTime().count(), 1.0f);
+}
+
+TEST(Clock, DetachedClockTicksFromDetachTime) {
+    //Both clocks are created, then sit attached while real time passes.
+    Clock master{};
+    Clock detached{master};
+    auto child = std::make_unique<Clock>(master);
+    Clock grandchild{*child};
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    detached.SetParent(nullptr);
+    detached.Tick();
+    EXPECT_LT(detached.GetFrameTime().count(), 0.04f);
+    //Orphaned by the parent's destruction.
+    child.reset();
+    grandchild.Tick();
+    EXPECT_LT(grandchild.GetFrameTime().count(), 0.04f);
+}
+
+TEST(FixedTimestep, RunsWholeStepsAndKeepsRemainder) {
+    FixedTimestep timestep{TimeUtils::FPSeconds{0.125f}};
+    EXPECT_EQ(timestep.Accumulate(TimeUtils::FPSeconds{0.3125f}), 2u);
+    int steps = 0;
+    while(timestep.Step()) {
+        ++steps;
+    }
+    EXPECT_EQ(steps, 2);
+    EXPECT_FLOAT_EQ(timestep.GetAlpha(), 0.5f);
+    EXPECT_EQ(timestep.Accumulate(TimeUtils::FPSeconds{0.0625f}), 1u);
+}
+
+TEST(FixedTimestep, ClampsLongStalls) {
+    FixedTimestep timestep{10u, 4u};
+    EXPECT_EQ(timestep.Accumulate(TimeUtils::FPSeconds{10.0f}), 4u);
+    EXPECT_GT(timestep.GetDroppedStepCount(), 90u);
+    int steps = 0;
+    while(timestep.Step()) {
+        ++steps;
+    }
+    EXPECT_EQ(steps, 4);
+}
+
+TEST(FramePacer, HoldsTargetRate) {
+    FramePacer pacer{100u};
+    pacer.Reset();
+    const auto start = TimeUtils::Now();
+    for(int i = 0; i < 20; ++i) {
+        pacer.Wait();
+    }
+    const auto elapsed = TimeUtils::FPSeconds{TimeUtils::Now() - start}.count();
+    //Deadlines advance by exactly one period, so twenty frames never finish early.
+    EXPECT_GE(elapsed, 0.199f);
+    EXPECT_LT(elapsed, 0.5f);
+}
+
+TEST(FramePacer, ResynchronizesAfterStall) {
+    FramePacer pacer{TimeUtils::FPSeconds{0.005f}};
+    pacer.Reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    pacer.Wait();
+    //A late frame must not be followed by a burst of zero-length catch-up frames.
+    const auto delta = pacer.Wait();
+    EXPECT_GE(delta.count(), 0.0045f);
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Math/IntVector2.hpp"
+#include "Engine/Math/IntVector3.hpp"
+#include "Engine/Math/IntVector4.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Matrix4.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector4.hpp"
+
+#include <array>
+#include <random>
+#include <vector>
+
+namespace {
+
+//Eight points on the unit circle, counter-clockwise from the positive x axis.
+constexpr std::array<Vector2, 8> UNIT_CIRCLE_POINTS{
+    Vector2::X_AXIS
+    , Vector2{MathUtils::M_1_SQRT2, MathUtils::M_1_SQRT2}
+    , Vector2::Y_AXIS
+    , Vector2{-MathUtils::M_1_SQRT2, MathUtils::M_1_SQRT2}
+    , -Vector2::X_AXIS
+    , Vector2{-MathUtils::M_1_SQRT2, -MathUtils::M_1_SQRT2}
+    , -Vector2::Y_AXIS
+    , Vector2{MathUtils::M_1_SQRT2, -MathUtils::M_1_SQRT2}
+};
+
+constexpr std::array<Vector3, 4> MakeQuad(const Vector2& center, const Vector2& halfExtents) noexcept {
+    return std::array<Vector3, 4>{
+        Vector3{center + Vector2{-halfExtents.x, -halfExtents.y}}
+        , Vector3{center + Vector2{-halfExtents.x, halfExtents.y}}
+        , Vector3{center + Vector2{halfExtents.x, halfExtents.y}}
+        , Vector3{center + Vector2{halfExtents.x, -halfExtents.y}}
+    };
+}
+
+constexpr auto DEFAULT_QUAD = MakeQuad(Vector2::ZERO, Vector2::ONE * 0.5f);
+
+constexpr Vector3 TransformPoint(const Matrix4& m, const Vector3& p) noexcept {
+    const auto v = m.GetIBasis() * p.x + m.GetJBasis() * p.y + m.GetKBasis() * p.z + m.GetTBasis();
+    return Vector3{v.x, v.y, v.z};
+}
+
+//Out-of-line stand-ins for the old .cpp definitions, called through pointers so they cannot be inlined.
+Vector3 AddOutOfLine(const Vector3& a, const Vector3& b) noexcept {
+    return a + b;
+}
+
+Vector3 ScaleOutOfLine(const Vector3& a, float s) noexcept {
+    return a * s;
+}
+
+float DotOutOfLine(const Vector3& a, const Vector3& b) noexcept {
+    return MathUtils::DotProduct(a, b);
+}
+
+} //End anonymous
+
+static_assert(Vector2::ZERO == Vector2{}, "Vector2::ZERO must be constexpr");
+static_assert(Vector2::ONE == Vector2{1.0f, 1.0f}, "Vector2::ONE must be constexpr");
+static_assert(Vector2{1.0f, 2.0f} + Vector2{3.0f, 4.0f} == Vector2{4.0f, 6.0f}, "Vector2 addition must be constexpr");
+static_assert(2.0f * Vector2{1.0f, 2.0f} - Vector2::ONE == Vector2{1.0f, 3.0f}, "Vector2 scaling must be constexpr");
+static_assert(Vector2{3.0f, 4.0f}.CalcLengthSquared() == 25.0f, "Vector2 length squared must be constexpr");
+
+static_assert(Vector3{Vector2{1.0f, 2.0f}, 3.0f} == Vector3{1.0f, 2.0f, 3.0f}, "Vector3 from Vector2 must be constexpr");
+static_assert(Vector3{2.0f, 4.0f, 6.0f} / 2.0f == Vector3{1.0f, 2.0f, 3.0f}, "Vector3 division must be constexpr");
+static_assert(MathUtils::CrossProduct(Vector3::X_AXIS, Vector3::Y_AXIS) == Vector3::Z_AXIS, "CrossProduct must be constexpr");
+static_assert(MathUtils::DotProduct(Vector3{1.0f, 2.0f, 3.0f}, Vector3{4.0f, 5.0f, 6.0f}) == 32.0f, "DotProduct must be constexpr");
+static_assert(MathUtils::CalcDistanceSquared(Vector3::ZERO, Vector3::ONE) == 3.0f, "CalcDistanceSquared must be constexpr");
+
+static_assert(Vector4{Vector3::ONE, 2.0f}.CalcLength4DSquared() == 7.0f, "Vector4 length squared must be constexpr");
+static_assert(Vector4{Vector2::ONE, Vector2::ZERO}.GetXY() == Vector2::ONE, "Vector4 swizzles must be constexpr");
+static_assert(MathUtils::DotProduct(Vector4::ONE, Vector4::ONE) == 4.0f, "Vector4 DotProduct must be constexpr");
+
+static_assert(IntVector2{1, 2} + IntVector2::ONE == IntVector2{2, 3}, "IntVector2 addition must be constexpr");
+static_assert(IntVector2{4, 6} / 2 == IntVector2{2, 3}, "IntVector2 division must be constexpr");
+static_assert(IntVector3{IntVector2::ONE, 5} == IntVector3{1, 1, 5}, "IntVector3 from IntVector2 must be constexpr");
+static_assert(IntVector4{IntVector3::ZERO, 1} == IntVector4{0, 0, 0, 1}, "IntVector4 from IntVector3 must be constexpr");
+
+static_assert(Matrix4::I.CalculateTrace() == 4.0f, "Matrix4::I must be constexpr");
+static_assert(Matrix4::CreateTranslationMatrix(Vector3{1.0f, 2.0f, 3.0f}).GetTBasis() == Vector4{1.0f, 2.0f, 3.0f, 1.0f}, "Translation matrices must be constexpr");
+static_assert(Matrix4::CreateScaleMatrix(Vector3{2.0f, 3.0f, 4.0f}).GetDiagonal() == Vector4{2.0f, 3.0f, 4.0f, 1.0f}, "Scale matrices must be constexpr");
+static_assert((Matrix4::I + Matrix4::I - 2.0f * Matrix4::I).CalculateTrace() == 0.0f, "Matrix4 arithmetic must be constexpr");
+static_assert(TransformPoint(Matrix4::CreateTranslationMatrix(Vector3::ONE), Vector3::ZERO) == Vector3::ONE, "Matrix4 bases must be constexpr");
+
+static_assert(UNIT_CIRCLE_POINTS[2] == Vector2::Y_AXIS, "Unit circle table must be built at compile time");
+static_assert(DEFAULT_QUAD[0] == Vector3{-0.5f, -0.5f, 0.0f} && DEFAULT_QUAD[2] == Vector3{0.5f, 0.5f, 0.0f}, "Default quad must be built at compile time");
+
+TEST(ConstexprMath, UnitCirclePointsAreUnitLength) {
+    for(const auto& p : UNIT_CIRCLE_POINTS) {
+        EXPECT_NEAR(p.CalcLengthSquared(), 1.0f, 1e-6f);
+    }
+    for(std::size_t i = 0; i < UNIT_CIRCLE_POINTS.size(); ++i) {
+        const auto& a = UNIT_CIRCLE_POINTS[i];
+        const auto& b = UNIT_CIRCLE_POINTS[(i + 2) % UNIT_CIRCLE_POINTS.size()];
+        EXPECT_NEAR(MathUtils::DotProduct(a, b), 0.0f, 1e-6f);
+    }
+}
+
+TEST(ConstexprMath, CompileTimeResultsMatchRuntime) {
+    std::mt19937 rng{1u};
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    for(int i = 0; i < 100; ++i) {
+        const Vector3 a{coord(rng), coord(rng), coord(rng)};
+        const Vector3 b{coord(rng), coord(rng), coord(rng)};
+        const auto translation = Matrix4::CreateTranslationMatrix(b);
+        const auto transformed = translation.TransformPosition(a);
+        const auto expected = TransformPoint(translation, a);
+        EXPECT_FLOAT_EQ(transformed.x, expected.x);
+        EXPECT_FLOAT_EQ(transformed.y, expected.y);
+        EXPECT_FLOAT_EQ(transformed.z, expected.z);
+        EXPECT_FLOAT_EQ(MathUtils::DotProduct(a, b), a.x * b.x + a.y * b.y + a.z * b.z);
+    }
+}
+
+TEST(ConstexprMathBenchmarks, DISABLED_InlineVectorArithmetic) {
+    constexpr std::size_t count = 1 << 16;
+    std::mt19937 rng{2u};
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    std::vector<Vector3> positions{};
+    std::vector<Vector3> velocities{};
+    for(std::size_t i = 0; i < count; ++i) {
+        positions.emplace_back(coord(rng), coord(rng), coord(rng));
+        velocities.emplace_back(coord(rng), coord(rng), coord(rng));
+    }
+    auto* volatile add = &AddOutOfLine;
+    auto* volatile scale = &ScaleOutOfLine;
+    auto* volatile dot = &DotOutOfLine;
+    auto out_of_line = positions;
+    RunBenchmark("Vector3 integrate+dot out-of-line", 100, count, [&]() {
+        float sum = 0.0f;
+        for(std::size_t i = 0; i < count; ++i) {
+            out_of_line[i] = add(out_of_line[i], scale(velocities[i], 0.016f));
+            sum += dot(out_of_line[i], velocities[i]);
+        }
+        DoNotOptimize(sum);
+    });
+    auto inlined = positions;
+    RunBenchmark("Vector3 integrate+dot inline", 100, count, [&]() {
+        float sum = 0.0f;
+        for(std::size_t i = 0; i < count; ++i) {
+            inlined[i] += velocities[i] * 0.016f;
+            sum += MathUtils::DotProduct(inlined[i], velocities[i]);
+        }
+        DoNotOptimize(sum);
+    });
+}
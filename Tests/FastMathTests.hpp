@@ -0,0 +1,191 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Math/FastMath.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<float> MakeRange(float lo, float hi, std::size_t count) {
+    std::vector<float> result(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        result[i] = lo + (hi - lo) * static_cast<float>(i) / static_cast<float>(count - 1);
+    }
+    return result;
+}
+
+std::vector<float> MakeRandomFloats(float lo, float hi, std::size_t count, unsigned int seed) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<float> dist(lo, hi);
+    std::vector<float> result(count);
+    for(auto& f : result) {
+        f = dist(rng);
+    }
+    return result;
+}
+
+template<typename Fast, typename Reference>
+double MaxAbsError(const std::vector<float>& inputs, Fast&& fast, Reference&& reference) {
+    double max_error = 0.0;
+    for(const auto x : inputs) {
+        max_error = (std::max)(max_error, std::abs(static_cast<double>(fast(x)) - reference(static_cast<double>(x))));
+    }
+    return max_error;
+}
+
+template<typename Fast, typename Reference>
+double MaxRelError(const std::vector<float>& inputs, Fast&& fast, Reference&& reference) {
+    double max_error = 0.0;
+    for(const auto x : inputs) {
+        const auto expected = reference(static_cast<double>(x));
+        max_error = (std::max)(max_error, std::abs(static_cast<double>(fast(x)) - expected) / std::abs(expected));
+    }
+    return max_error;
+}
+
+} //End anonymous
+
+TEST(FastMath, SinCosAbsoluteErrorAcrossRange) {
+    const auto inputs = MakeRange(-8192.0f, 8192.0f, 4000001);
+    EXPECT_LT(MaxAbsError(inputs, [](float x) { return MathUtils::FastMath::Sin(x); }, [](double x) { return std::sin(x); }), 2e-7);
+    EXPECT_LT(MaxAbsError(inputs, [](float x) { return MathUtils::FastMath::Cos(x); }, [](double x) { return std::cos(x); }), 2e-7);
+    const auto small = MakeRange(-2.0f * MathUtils::M_PI, 2.0f * MathUtils::M_PI, 100001);
+    EXPECT_LT(MaxAbsError(small, [](float x) { return MathUtils::FastMath::Sin(x); }, [](double x) { return std::sin(x); }), 1.2e-7);
+    EXPECT_LT(MaxAbsError(small, [](float x) { return MathUtils::FastMath::Cos(x); }, [](double x) { return std::cos(x); }), 1.2e-7);
+    for(const auto x : small) {
+        float s{};
+        float c{};
+        MathUtils::FastMath::SinCos(x, s, c);
+        EXPECT_EQ(s, MathUtils::FastMath::Sin(x));
+        EXPECT_EQ(c, MathUtils::FastMath::Cos(x));
+    }
+}
+
+TEST(FastMath, Atan2AbsoluteErrorAcrossCircle) {
+    double max_error = 0.0;
+    for(const auto radius : {1e-30f, 1e-3f, 1.0f, 1e3f, 1e30f}) {
+        for(const auto angle : MakeRange(-MathUtils::M_PI, MathUtils::M_PI, 200001)) {
+            const auto y = radius * std::sin(angle);
+            const auto x = radius * std::cos(angle);
+            const auto expected = std::atan2(static_cast<double>(y), static_cast<double>(x));
+            max_error = (std::max)(max_error, std::abs(static_cast<double>(MathUtils::FastMath::Atan2(y, x)) - expected));
+        }
+    }
+    EXPECT_LT(max_error, 3e-7);
+    EXPECT_EQ(MathUtils::FastMath::Atan2(0.0f, 0.0f), 0.0f);
+    EXPECT_FLOAT_EQ(MathUtils::FastMath::Atan2(0.0f, -1.0f), MathUtils::M_PI);
+    EXPECT_FLOAT_EQ(MathUtils::FastMath::Atan2(1.0f, 0.0f), MathUtils::M_1PI_2);
+    EXPECT_FLOAT_EQ(MathUtils::FastMath::Atan2(-1.0f, 0.0f), -MathUtils::M_1PI_2);
+}
+
+TEST(FastMath, ExpRelativeErrorAcrossRange) {
+    const auto inputs = MakeRange(-87.3f, 88.3f, 2000001);
+    EXPECT_LT(MaxRelError(inputs, [](float x) { return MathUtils::FastMath::Exp(x); }, [](double x) { return std::exp(x); }), 3e-7);
+    EXPECT_EQ(MathUtils::FastMath::Exp(0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(MathUtils::FastMath::Exp(-1000.0f), MathUtils::FastMath::Exp(-87.3f));
+    EXPECT_TRUE(std::isfinite(MathUtils::FastMath::Exp(1000.0f)));
+}
+
+TEST(FastMath, RsqrtRelativeErrorAcrossRange) {
+    std::vector<float> inputs{};
+    for(float x = 1e-30f; x < 1e30f; x *= 1.0001f) {
+        inputs.push_back(x);
+    }
+    EXPECT_LT(MaxRelError(inputs, [](float x) { return MathUtils::FastMath::Rsqrt(x); }, [](double x) { return 1.0 / std::sqrt(x); }), 2e-6);
+}
+
+TEST(FastMath, BatchMatchesScalar) {
+    //Odd count so the scalar tail runs too.
+    const auto angles = MakeRandomFloats(-1000.0f, 1000.0f, 1027, 1u);
+    const auto ys = MakeRandomFloats(-10.0f, 10.0f, angles.size(), 2u);
+    const auto xs = MakeRandomFloats(-10.0f, 10.0f, angles.size(), 3u);
+    const auto exps = MakeRandomFloats(-100.0f, 100.0f, angles.size(), 4u);
+    const auto positives = MakeRandomFloats(1e-6f, 1e6f, angles.size(), 5u);
+    const auto count = angles.size();
+    std::vector<float> sines(count);
+    std::vector<float> cosines(count);
+    std::vector<float> sines2(count);
+    std::vector<float> cosines2(count);
+    std::vector<float> atans(count);
+    std::vector<float> exp_results(count);
+    std::vector<float> rsqrts(count);
+    MathUtils::FastMath::Sin(angles.data(), sines.data(), count);
+    MathUtils::FastMath::Cos(angles.data(), cosines.data(), count);
+    MathUtils::FastMath::SinCos(angles.data(), sines2.data(), cosines2.data(), count);
+    MathUtils::FastMath::Atan2(ys.data(), xs.data(), atans.data(), count);
+    MathUtils::FastMath::Exp(exps.data(), exp_results.data(), count);
+    MathUtils::FastMath::Rsqrt(positives.data(), rsqrts.data(), count);
+    for(std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(sines[i], MathUtils::FastMath::Sin(angles[i]));
+        EXPECT_EQ(cosines[i], MathUtils::FastMath::Cos(angles[i]));
+        EXPECT_EQ(sines2[i], sines[i]);
+        EXPECT_EQ(cosines2[i], cosines[i]);
+        EXPECT_EQ(atans[i], MathUtils::FastMath::Atan2(ys[i], xs[i]));
+        EXPECT_EQ(exp_results[i], MathUtils::FastMath::Exp(exps[i]));
+        EXPECT_EQ(rsqrts[i], MathUtils::FastMath::Rsqrt(positives[i]));
+    }
+}
+
+TEST(FastMathBenchmarks, DISABLED_Throughput) {
+    constexpr std::size_t count = 1 << 16;
+    const auto angles = MakeRandomFloats(-100.0f, 100.0f, count, 6u);
+    const auto ys = MakeRandomFloats(-10.0f, 10.0f, count, 7u);
+    const auto xs = MakeRandomFloats(-10.0f, 10.0f, count, 8u);
+    const auto positives = MakeRandomFloats(1e-3f, 1e3f, count, 9u);
+    std::vector<float> a(count);
+    std::vector<float> b(count);
+    RunBenchmark("std::sin + std::cos", 100, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            a[i] = std::sin(angles[i]);
+            b[i] = std::cos(angles[i]);
+        }
+        DoNotOptimize(a);
+    });
+    RunBenchmark("FastMath::SinCos scalar", 100, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            MathUtils::FastMath::SinCos(angles[i], a[i], b[i]);
+        }
+        DoNotOptimize(a);
+    });
+    RunBenchmark("FastMath::SinCos batch", 100, count, [&]() {
+        MathUtils::FastMath::SinCos(angles.data(), a.data(), b.data(), count);
+        DoNotOptimize(a);
+    });
+    RunBenchmark("std::atan2", 100, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            a[i] = std::atan2(ys[i], xs[i]);
+        }
+        DoNotOptimize(a);
+    });
+    RunBenchmark("FastMath::Atan2 batch", 100, count, [&]() {
+        MathUtils::FastMath::Atan2(ys.data(), xs.data(), a.data(), count);
+        DoNotOptimize(a);
+    });
+    RunBenchmark("std::exp", 100, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            a[i] = std::exp(ys[i]);
+        }
+        DoNotOptimize(a);
+    });
+    RunBenchmark("FastMath::Exp batch", 100, count, [&]() {
+        MathUtils::FastMath::Exp(ys.data(), a.data(), count);
+        DoNotOptimize(a);
+    });
+    RunBenchmark("1 / std::sqrt", 100, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            a[i] = 1.0f / std::sqrt(positives[i]);
+        }
+        DoNotOptimize(a);
+    });
+    RunBenchmark("FastMath::Rsqrt batch", 100, count, [&]() {
+        MathUtils::FastMath::Rsqrt(positives.data(), a.data(), count);
+        DoNotOptimize(a);
+    });
+}
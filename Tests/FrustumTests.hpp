@@ -0,0 +1,198 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+#include "RandomShapes.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/Matrix4.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+//Camera at the origin looking down +Z.
+Frustum MakeTestFrustum() {
+    const auto projection = Matrix4::CreateDXPerspectiveProjection(60.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+    const auto view = Matrix4::CreateLookAtMatrix(Vector3::ZERO, Vector3::Z_AXIS, Vector3::Y_AXIS);
+    return Frustum::CreateFromViewProjectionMatrix(projection * view, 16.0f / 9.0f, 60.0f, Vector3::Z_AXIS, 0.1f, 100.0f, true);
+}
+
+std::array<Plane3, 6> GetPlanes(const Frustum& frustum) {
+    return {frustum.GetLeft(), frustum.GetRight(), frustum.GetTop(), frustum.GetBottom(), frustum.GetNear(), frustum.GetFar()};
+}
+
+double SignedDistance(const Plane3& plane, double x, double y, double z) {
+    return plane.normal.x * x + plane.normal.y * y + plane.normal.z * z - plane.dist;
+}
+
+//Brute force: a box is culled when all eight corners are behind the same plane.
+//Returns the smallest margin by which the result was decided so near-ties can be told apart.
+bool ReferenceIsVisible(const std::array<Plane3, 6>& planes, const AABB3& box, double& margin) {
+    margin = 1e30;
+    for(const auto& plane : planes) {
+        double furthest = -1e30;
+        for(int corner = 0; corner < 8; ++corner) {
+            const double x = (corner & 1) ? box.maxs.x : box.mins.x;
+            const double y = (corner & 2) ? box.maxs.y : box.mins.y;
+            const double z = (corner & 4) ? box.maxs.z : box.mins.z;
+            furthest = (std::max)(furthest, SignedDistance(plane, x, y, z));
+        }
+        margin = (std::min)(margin, std::fabs(furthest));
+        if(furthest < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReferenceIsVisible(const std::array<Plane3, 6>& planes, const Sphere3& sphere, double& margin) {
+    margin = 1e30;
+    for(const auto& plane : planes) {
+        const double d = SignedDistance(plane, sphere.center.x, sphere.center.y, sphere.center.z) + sphere.radius;
+        margin = (std::min)(margin, std::fabs(d));
+        if(d < 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<Sphere3> MakeRandomSpheres(std::size_t count, unsigned int seed) {
+    return MakeRandomShapes<Sphere3>(count, seed, [](RandomShapeSource& source, std::size_t) {
+        const auto center = source.GetPointInCube(120.0f);
+        return Sphere3{center, source.GetFloatInRange(0.1f, 8.0f)};
+    });
+}
+
+} //End anonymous
+
+TEST(Frustum, ExtractsAllSixPlanes) {
+    const auto frustum = MakeTestFrustum();
+    EXPECT_TRUE(frustum.IsVisible(Vector3{0.0f, 0.0f, 10.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{0.0f, 0.0f, -10.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{0.0f, 0.0f, 0.05f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{0.0f, 0.0f, 150.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{-50.0f, 0.0f, 10.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{50.0f, 0.0f, 10.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{0.0f, 50.0f, 10.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Vector3{0.0f, -50.0f, 10.0f}));
+    for(const auto& plane : GetPlanes(frustum)) {
+        EXPECT_NEAR(plane.normal.CalcLength(), 1.0f, 1e-5f);
+    }
+}
+
+TEST(Frustum, SingleVolumeTests) {
+    const auto frustum = MakeTestFrustum();
+    EXPECT_TRUE(frustum.IsVisible(AABB3{Vector3{-1.0f, -1.0f, 9.0f}, Vector3{1.0f, 1.0f, 11.0f}}));
+    EXPECT_FALSE(frustum.IsVisible(AABB3{Vector3{-1.0f, -1.0f, -11.0f}, Vector3{1.0f, 1.0f, -9.0f}}));
+    //Straddling the near plane.
+    EXPECT_TRUE(frustum.IsVisible(AABB3{Vector3{-1.0f, -1.0f, -1.0f}, Vector3{1.0f, 1.0f, 1.0f}}));
+    EXPECT_TRUE(frustum.IsVisible(Sphere3{Vector3{0.0f, 0.0f, 10.0f}, 1.0f}));
+    EXPECT_TRUE(frustum.IsVisible(Sphere3{Vector3{0.0f, 0.0f, 101.0f}, 2.0f}));
+    EXPECT_FALSE(frustum.IsVisible(Sphere3{Vector3{0.0f, 0.0f, 103.0f}, 2.0f}));
+}
+
+TEST(Frustum, CullBoxesMatchesBruteForce) {
+    const auto frustum = MakeTestFrustum();
+    const auto planes = GetPlanes(frustum);
+    //Not a multiple of four, to cover the tail.
+    const auto boxes = MakeRandomBoxes(10003, 1u, 120.0f, 0.1f, 8.0f);
+    std::vector<std::uint8_t> visible{};
+    frustum.CullMask(boxes.data(), boxes.size(), visible);
+    ASSERT_EQ(visible.size(), boxes.size());
+    std::size_t visible_count = 0;
+    for(std::size_t i = 0; i < boxes.size(); ++i) {
+        double margin = 0.0;
+        const bool expected = ReferenceIsVisible(planes, boxes[i], margin);
+        EXPECT_EQ(frustum.IsVisible(boxes[i]), visible[i] != 0) << "index " << i;
+        if(margin > 1e-3) {
+            EXPECT_EQ(visible[i] != 0, expected) << "index " << i;
+        }
+        visible_count += visible[i];
+    }
+    EXPECT_GT(visible_count, 0u);
+    EXPECT_LT(visible_count, boxes.size());
+
+    std::vector<std::size_t> indices{};
+    EXPECT_EQ(frustum.Cull(boxes, indices), visible_count);
+    ASSERT_EQ(indices.size(), visible_count);
+    for(const auto index : indices) {
+        EXPECT_TRUE(visible[index]);
+    }
+}
+
+TEST(Frustum, CullSpheresMatchesBruteForce) {
+    const auto frustum = MakeTestFrustum();
+    const auto planes = GetPlanes(frustum);
+    const auto spheres = MakeRandomSpheres(10003, 2u);
+    std::vector<std::uint8_t> visible{};
+    frustum.CullMask(spheres.data(), spheres.size(), visible);
+    ASSERT_EQ(visible.size(), spheres.size());
+    std::size_t visible_count = 0;
+    for(std::size_t i = 0; i < spheres.size(); ++i) {
+        double margin = 0.0;
+        const bool expected = ReferenceIsVisible(planes, spheres[i], margin);
+        EXPECT_EQ(frustum.IsVisible(spheres[i]), visible[i] != 0) << "index " << i;
+        if(margin > 1e-3) {
+            EXPECT_EQ(visible[i] != 0, expected) << "index " << i;
+        }
+        visible_count += visible[i];
+    }
+    EXPECT_GT(visible_count, 0u);
+    EXPECT_LT(visible_count, spheres.size());
+}
+
+TEST(Frustum, CullOnJobSystemMatchesSerial) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    const auto frustum = MakeTestFrustum();
+    const auto boxes = MakeRandomBoxes(50001, 3u, 120.0f, 0.1f, 8.0f);
+    std::vector<std::size_t> serial{};
+    std::vector<std::size_t> parallel{};
+    frustum.Cull(boxes, serial);
+    frustum.Cull(boxes, parallel, &jobs);
+    EXPECT_EQ(serial, parallel);
+    jobs.Shutdown();
+}
+
+TEST(FrustumBenchmarks, DISABLED_Cull100kBoxes) {
+    const auto frustum = MakeTestFrustum();
+    const auto planes = GetPlanes(frustum);
+    const auto boxes = MakeRandomBoxes(100000, 4u, 120.0f, 0.1f, 8.0f);
+    std::vector<std::uint8_t> visible{};
+    std::vector<std::size_t> indices{};
+    RunBenchmark("Frustum brute-force corners", 20, boxes.size(), [&]() {
+        std::size_t count = 0;
+        double margin = 0.0;
+        for(const auto& box : boxes) {
+            count += ReferenceIsVisible(planes, box, margin) ? 1 : 0;
+        }
+        DoNotOptimize(count);
+    });
+    RunBenchmark("Frustum IsVisible loop", 20, boxes.size(), [&]() {
+        std::size_t count = 0;
+        for(const auto& box : boxes) {
+            count += frustum.IsVisible(box) ? 1 : 0;
+        }
+        DoNotOptimize(count);
+    });
+    RunBenchmark("Frustum CullMask", 20, boxes.size(), [&]() {
+        frustum.CullMask(boxes.data(), boxes.size(), visible);
+        DoNotOptimize(visible);
+    });
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    RunBenchmark("Frustum Cull JobSystem", 20, boxes.size(), [&]() {
+        indices.clear();
+        frustum.Cull(boxes, indices, &jobs);
+        DoNotOptimize(indices);
+    });
+    jobs.Shutdown();
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Profiling/HitchRecorder.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+bool WaitForDumps(const HitchRecorder& recorder, std::size_t count) {
+    const auto start = TimeUtils::Now();
+    while(recorder.GetDumpCount() < count) {
+        if(TimeUtils::FPSeconds{TimeUtils::Now() - start}.count() > 5.0f) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+std::size_t CountOccurrences(const std::string& haystack, const std::string& needle) {
+    std::size_t count = 0;
+    for(auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+std::filesystem::path GetHitchTestFolder() {
+    return std::filesystem::temp_directory_path() / "HitchRecorderTests";
+}
+
+}
+
+TEST(HitchRecorder, IsActiveOnlyWhileAlive) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    {
+        HitchRecorder recorder(jobs, 16, 4);
+        EXPECT_EQ(HitchRecorder::GetActive(), &recorder);
+    }
+    EXPECT_EQ(HitchRecorder::GetActive(), nullptr);
+    //No recorder: must be a no-op.
+    HitchRecorder::RecordScope("Orphan", TimeUtils::Now(), TimeUtils::Now());
+}
+
+TEST(HitchRecorder, SlowFrameWritesTrace) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    HitchRecorder recorder(jobs, 64, 8);
+    recorder.SetOutputFolder(GetHitchTestFolder());
+    recorder.SetHitchThreshold(TimeUtils::FPMilliseconds{1.0f});
+    recorder.BeginFrame();
+    const auto begin = TimeUtils::Now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    HitchRecorder::RecordScope("SlowScope", begin, TimeUtils::Now());
+    recorder.EndFrame();
+    ASSERT_TRUE(WaitForDumps(recorder, 1));
+    const auto path = recorder.GetLastDumpPath();
+    std::string trace{};
+    ASSERT_TRUE(FileUtils::ReadBufferFromFile(trace, path));
+    EXPECT_NE(trace.find("\"Frame 0\""), std::string::npos);
+    EXPECT_NE(trace.find("\"SlowScope\""), std::string::npos);
+    std::filesystem::remove(path);
+}
+
+TEST(HitchRecorder, FastFrameDoesNotWriteTrace) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    HitchRecorder recorder(jobs, 64, 8);
+    recorder.SetOutputFolder(GetHitchTestFolder());
+    recorder.SetHitchThreshold(TimeUtils::FPMilliseconds{1000.0f});
+    recorder.BeginFrame();
+    recorder.EndFrame();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(recorder.GetDumpCount(), 0u);
+}
+
+TEST(HitchRecorder, RingKeepsMostRecentEvents) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    HitchRecorder recorder(jobs, 16, 4);
+    recorder.SetOutputFolder(GetHitchTestFolder());
+    recorder.SetHitchThreshold(TimeUtils::FPMilliseconds{1000.0f});
+    recorder.BeginFrame();
+    for(int i = 0; i < 100; ++i) {
+        const auto now = TimeUtils::Now();
+        HitchRecorder::RecordScope(("Scope" + std::to_string(i)).c_str(), now, now);
+    }
+    recorder.EndFrame();
+    ASSERT_TRUE(recorder.Dump());
+    ASSERT_TRUE(WaitForDumps(recorder, 1));
+    const auto path = recorder.GetLastDumpPath();
+    std::string trace{};
+    ASSERT_TRUE(FileUtils::ReadBufferFromFile(trace, path));
+    EXPECT_EQ(CountOccurrences(trace, "\"cat\":\"Scope\""), recorder.GetEventCapacity());
+    EXPECT_NE(trace.find("\"Scope99\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"Scope83\""), std::string::npos);
+    std::filesystem::remove(path);
+}
+
+TEST(HitchRecorder, RecordingWhileDestroyedIsSafe) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    std::atomic_bool done{false};
+    std::vector<std::thread> writers{};
+    for(int i = 0; i < 4; ++i) {
+        writers.emplace_back([&done]() {
+            while(!done) {
+                const auto now = TimeUtils::Now();
+                HitchRecorder::RecordScope("Racing", now, now);
+            }
+        });
+    }
+    //Each destructor frees the rings the writers may be in the middle of filling.
+    for(int i = 0; i < 50; ++i) {
+        HitchRecorder recorder(jobs, 16, 4);
+        std::this_thread::yield();
+    }
+    done = true;
+    for(auto& writer : writers) {
+        writer.join();
+    }
+    EXPECT_EQ(HitchRecorder::GetActive(), nullptr);
+}
+
+TEST(HitchRecorder, SnapshotDuringWritesHasNoTornEvents) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    HitchRecorder recorder(jobs, 64, 4);
+    recorder.SetOutputFolder(GetHitchTestFolder());
+    recorder.SetHitchThreshold(TimeUtils::FPMilliseconds{1000.0f});
+    recorder.BeginFrame();
+    //Every event's duration in microseconds matches the number in its name, so an event
+    //put together from two different writes shows up as a mismatch.
+    std::atomic_bool done{false};
+    std::vector<std::thread> writers{};
+    for(int i = 0; i < 4; ++i) {
+        writers.emplace_back([&done, i]() {
+            const std::string names[] = {"Torn" + std::to_string(i + 1), "Torn" + std::to_string(i + 5)};
+            const long long durations[] = {i + 1, i + 5};
+            for(std::size_t n = 0; !done; ++n) {
+                const auto begin = TimeUtils::Now();
+                const auto end = begin + std::chrono::microseconds(durations[n % 2]);
+                HitchRecorder::RecordScope(names[n % 2].c_str(), begin, end);
+            }
+        });
+    }
+    std::size_t checked = 0;
+    for(std::size_t dump = 1; dump <= 20; ++dump) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_TRUE(recorder.Dump());
+        ASSERT_TRUE(WaitForDumps(recorder, dump));
+        const auto path = recorder.GetLastDumpPath();
+        std::string trace{};
+        ASSERT_TRUE(FileUtils::ReadBufferFromFile(trace, path));
+        std::filesystem::remove(path);
+        const std::string name_key = "\"name\":\"Torn";
+        const std::string dur_key = "\"dur\":";
+        for(auto pos = trace.find(name_key); pos != std::string::npos; pos = trace.find(name_key, pos + 1)) {
+            const auto named = std::stoi(trace.substr(pos + name_key.size()));
+            const auto dur = std::stod(trace.substr(trace.find(dur_key, pos) + dur_key.size()));
+            EXPECT_DOUBLE_EQ(dur, static_cast<double>(named));
+            ++checked;
+        }
+    }
+    done = true;
+    for(auto& writer : writers) {
+        writer.join();
+    }
+    EXPECT_GT(checked, 0u);
+}
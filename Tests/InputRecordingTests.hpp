@@ -0,0 +1,193 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Engine/Core/Clock.hpp"
+
+#include "Engine/Input/InputRecording.hpp"
+#include "Engine/Input/InputSystem.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+InputRecording MakeTestRecording() {
+    InputRecording::keys_t initial{};
+    initial.set(5);
+    InputRecording recording(TimeUtils::FPSeconds{1.0f / 120.0f}, initial);
+    InputRecording::frame_t frame{};
+    frame.keys = initial;
+    for(int i = 0; i < 100; ++i) {
+        if(i % 10 == 0) {
+            frame.keys.flip(static_cast<std::size_t>(i % 64));
+        }
+        frame.mouse_delta = Vector2::ZERO;
+        if(i % 7 == 0) {
+            frame.mouse_delta = Vector2{0.25f * i, -1.5f};
+            frame.mouse_coords += frame.mouse_delta;
+        }
+        frame.wheel = (i % 13 == 0) ? 120 : 0;
+        frame.wheel_horizontal = (i % 17 == 0) ? -120 : 0;
+        recording.AddFrame(frame);
+    }
+    return recording;
+}
+
+void ExpectSameFrames(const InputRecording& a, const InputRecording& b) {
+    ASSERT_EQ(a.GetFrameCount(), b.GetFrameCount());
+    EXPECT_EQ(a.GetInitialKeys(), b.GetInitialKeys());
+    EXPECT_FLOAT_EQ(a.GetTimestep().count(), b.GetTimestep().count());
+    for(std::size_t i = 0; i < a.GetFrameCount(); ++i) {
+        const auto& fa = a.GetFrame(i);
+        const auto& fb = b.GetFrame(i);
+        EXPECT_EQ(fa.keys, fb.keys) << "frame " << i;
+        EXPECT_EQ(fa.mouse_coords, fb.mouse_coords) << "frame " << i;
+        EXPECT_EQ(fa.mouse_delta, fb.mouse_delta) << "frame " << i;
+        EXPECT_EQ(fa.wheel, fb.wheel) << "frame " << i;
+        EXPECT_EQ(fa.wheel_horizontal, fb.wheel_horizontal) << "frame " << i;
+    }
+}
+
+}
+
+TEST(InputRecording, SerializeRoundTripsExactly) {
+    const auto original = MakeTestRecording();
+    std::stringstream ss;
+    ASSERT_TRUE(original.Serialize(ss));
+    InputRecording loaded{};
+    ASSERT_TRUE(loaded.Deserialize(ss));
+    ExpectSameFrames(original, loaded);
+}
+
+TEST(InputRecording, UnchangedFramesCostOneByte) {
+    InputRecording recording{};
+    std::stringstream empty_ss;
+    recording.Serialize(empty_ss);
+    const auto header_size = empty_ss.str().size();
+    for(int i = 0; i < 1000; ++i) {
+        recording.AddFrame(InputRecording::frame_t{});
+    }
+    std::stringstream ss;
+    recording.Serialize(ss);
+    EXPECT_EQ(ss.str().size(), header_size + 1000u);
+}
+
+TEST(InputRecording, ManyToggledKeysRoundTrip) {
+    InputRecording recording{};
+    InputRecording::frame_t frame{};
+    frame.keys.set();
+    recording.AddFrame(frame);
+    recording.AddFrame(InputRecording::frame_t{});
+    std::stringstream ss;
+    recording.Serialize(ss);
+    InputRecording loaded{};
+    ASSERT_TRUE(loaded.Deserialize(ss));
+    ExpectSameFrames(recording, loaded);
+}
+
+TEST(InputRecording, LargeWheelDeltasRoundTrip) {
+    InputRecording recording{};
+    InputRecording::frame_t frame{};
+    frame.wheel = 40000;
+    frame.wheel_horizontal = -70000;
+    recording.AddFrame(frame);
+    frame.wheel = (std::numeric_limits<int>::max)();
+    frame.wheel_horizontal = (std::numeric_limits<int>::min)();
+    recording.AddFrame(frame);
+    std::stringstream ss;
+    recording.Serialize(ss);
+    InputRecording loaded{};
+    ASSERT_TRUE(loaded.Deserialize(ss));
+    ExpectSameFrames(recording, loaded);
+}
+
+TEST(InputRecording, ReadsSixteenBitWheelVersion) {
+    //Version 1 header, one frame with only a wheel delta of -120 stored in 16 bits.
+    std::string data{"IREC\x01", 5};
+    const float timestep = 0.5f;
+    const std::uint32_t frame_count = 1;
+    const std::int16_t wheel = -120;
+    data.append(reinterpret_cast<const char*>(&timestep), sizeof(timestep));
+    data.append(reinterpret_cast<const char*>(&frame_count), sizeof(frame_count));
+    data.append(InputRecording::MAX_KEYS / 8, '\0');
+    data.push_back('\x10');
+    data.append(reinterpret_cast<const char*>(&wheel), sizeof(wheel));
+    std::stringstream ss{data};
+    InputRecording loaded{};
+    ASSERT_TRUE(loaded.Deserialize(ss));
+    ASSERT_EQ(loaded.GetFrameCount(), 1u);
+    EXPECT_EQ(loaded.GetFrame(0).wheel, -120);
+    EXPECT_EQ(loaded.GetFrame(0).wheel_horizontal, 0);
+    EXPECT_FLOAT_EQ(loaded.GetTimestep().count(), 0.5f);
+}
+
+TEST(InputRecording, RejectsBadData) {
+    std::stringstream bad_magic{std::string{"NOPE\x01"}};
+    InputRecording loaded{};
+    EXPECT_FALSE(loaded.Deserialize(bad_magic));
+
+    const auto original = MakeTestRecording();
+    std::stringstream ss;
+    original.Serialize(ss);
+    auto truncated = ss.str();
+    truncated.resize(truncated.size() / 2);
+    std::stringstream truncated_ss{truncated};
+    EXPECT_FALSE(loaded.Deserialize(truncated_ss));
+    EXPECT_TRUE(loaded.empty());
+}
+
+TEST(InputRecording, RejectsFrameCountLargerThanData) {
+    const auto original = MakeTestRecording();
+    std::stringstream ss;
+    original.Serialize(ss);
+    auto corrupt = ss.str();
+    //The frame count follows the magic, version and timestep.
+    const std::uint32_t huge_count = (std::numeric_limits<std::uint32_t>::max)();
+    corrupt.replace(9, sizeof(huge_count), reinterpret_cast<const char*>(&huge_count), sizeof(huge_count));
+    std::stringstream corrupt_ss{corrupt};
+    InputRecording loaded{};
+    EXPECT_FALSE(loaded.Deserialize(corrupt_ss));
+    EXPECT_TRUE(loaded.empty());
+}
+
+TEST(InputSystemReplay, PlaybackReproducesRecordedQueries) {
+    const auto space = InputSystem::ConvertKeyCodeToWinVK(KeyCode::Space);
+    InputSystem live{};
+    live.StartRecording(TimeUtils::FPSeconds{1.0f / 30.0f});
+    std::vector<bool> live_pressed{};
+    std::vector<bool> live_down{};
+    for(int i = 0; i < 10; ++i) {
+        live.BeginFrame();
+        if(i == 2) {
+            live.RegisterKeyDown(space);
+        }
+        if(i == 6) {
+            live.RegisterKeyUp(space);
+        }
+        live_pressed.push_back(live.WasKeyJustPressed(KeyCode::Space));
+        live_down.push_back(live.IsKeyDown(KeyCode::Space));
+        live.EndFrame();
+    }
+    const auto recording = live.StopRecording();
+    ASSERT_EQ(recording.GetFrameCount(), 10u);
+
+    InputSystem replay{};
+    replay.StartPlayback(recording);
+    EXPECT_FLOAT_EQ(replay.GetPlaybackTimestep().count(), 1.0f / 30.0f);
+    Clock clock{};
+    for(int i = 0; i < 10; ++i) {
+        replay.BeginFrame();
+        ASSERT_TRUE(replay.IsPlayingBack());
+        replay.TickClock(clock);
+        EXPECT_FLOAT_EQ(clock.GetFrameTime().count(), 1.0f / 30.0f);
+        EXPECT_EQ(replay.WasKeyJustPressed(KeyCode::Space), live_pressed[i]) << "frame " << i;
+        EXPECT_EQ(replay.IsKeyDown(KeyCode::Space), live_down[i]) << "frame " << i;
+        replay.EndFrame();
+    }
+    replay.BeginFrame();
+    EXPECT_FALSE(replay.IsPlayingBack());
+}
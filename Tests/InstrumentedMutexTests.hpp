@@ -0,0 +1,84 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Engine/Profiling/InstrumentedMutex.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+
+TEST(InstrumentedMutex, CountsUncontendedAcquisitions) {
+    InstrumentedMutex::ResetStats();
+    InstrumentedMutex m{"InstrumentedMutexTests::Uncontended"};
+    for(int i = 0; i < 10; ++i) {
+        std::scoped_lock<InstrumentedMutex> lock(m);
+    }
+    const auto stats = InstrumentedMutex::GetTopContended(1000);
+    auto found = std::find_if(std::begin(stats), std::end(stats), [](const auto& s) { return s.name == "InstrumentedMutexTests::Uncontended"; });
+    ASSERT_NE(found, std::end(stats));
+    EXPECT_EQ(found->acquisitions, 10u);
+    EXPECT_EQ(found->contentions, 0u);
+}
+
+TEST(InstrumentedMutex, SameNameSharesCounters) {
+    InstrumentedMutex::ResetStats();
+    InstrumentedMutex a{"InstrumentedMutexTests::Shared"};
+    InstrumentedMutex b{"InstrumentedMutexTests::Shared"};
+    { std::scoped_lock<InstrumentedMutex> lock(a); }
+    { std::scoped_lock<InstrumentedMutex> lock(b); }
+    const auto stats = InstrumentedMutex::GetTopContended(1000);
+    auto found = std::find_if(std::begin(stats), std::end(stats), [](const auto& s) { return s.name == "InstrumentedMutexTests::Shared"; });
+    ASSERT_NE(found, std::end(stats));
+    EXPECT_EQ(found->acquisitions, 2u);
+}
+
+TEST(InstrumentedMutex, RecordsContentionAndRanksIt) {
+    InstrumentedMutex::ResetStats();
+    InstrumentedMutex quiet{"InstrumentedMutexTests::Quiet"};
+    InstrumentedMutex hot{"InstrumentedMutexTests::Hot"};
+    { std::scoped_lock<InstrumentedMutex> lock(quiet); }
+    hot.lock();
+    std::thread waiter([&hot]() {
+        std::scoped_lock<InstrumentedMutex> lock(hot);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    hot.unlock();
+    waiter.join();
+    const auto top = InstrumentedMutex::GetTopContended(1);
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].name, "InstrumentedMutexTests::Hot");
+    EXPECT_EQ(top[0].acquisitions, 2u);
+    EXPECT_EQ(top[0].contentions, 1u);
+    EXPECT_GT(top[0].total_wait.count(), 0.0f);
+    EXPECT_GE(top[0].max_hold.count(), 10000.0f);
+    EXPECT_NE(InstrumentedMutex::GetReport(1).find("InstrumentedMutexTests::Hot"), std::string::npos);
+}
+
+TEST(InstrumentedMutex, TryLockFailureCountsAsContention) {
+    InstrumentedMutex::ResetStats();
+    InstrumentedMutex m{"InstrumentedMutexTests::TryLock"};
+    m.lock();
+    bool acquired = true;
+    std::thread other([&m, &acquired]() { acquired = m.try_lock(); });
+    other.join();
+    m.unlock();
+    EXPECT_FALSE(acquired);
+    const auto top = InstrumentedMutex::GetTopContended(1000);
+    auto found = std::find_if(std::begin(top), std::end(top), [](const auto& s) { return s.name == "InstrumentedMutexTests::TryLock"; });
+    ASSERT_NE(found, std::end(top));
+    EXPECT_EQ(found->contentions, 1u);
+}
+
+TEST(ProfiledMutex, IsUsableAsStdMutex) {
+    ProfiledMutex m{"ProfiledMutexTests"};
+    std::scoped_lock<ProfiledMutex> lock(m);
+    bool acquired = true;
+    std::thread other([&m, &acquired]() {
+        std::unique_lock<std::mutex> native_lock(m.native(), std::try_to_lock);
+        acquired = native_lock.owns_lock();
+    });
+    other.join();
+    EXPECT_FALSE(acquired);
+}
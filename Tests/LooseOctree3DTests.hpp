@@ -0,0 +1,397 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+#include "RandomShapes.hpp"
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/BVH.hpp"
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/LooseOctree3D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Matrix4.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+//Mostly small boxes plus a few large ones, and optionally a few outside the world bounds.
+std::vector<AABB3> MakeRandomOctreeBoxes(std::size_t count, unsigned int seed, bool withOutsiders = true, float worldSize = 200.0f) {
+    return MakeRandomShapes<AABB3>(count, seed, [=](RandomShapeSource& source, std::size_t i) {
+        const auto r = (i % 97 == 0) ? 20.0f : source.GetFloatInRange(0.25f, 2.0f);
+        const auto scale = (withOutsiders && i % 101 == 0) ? 1.5f : 1.0f;
+        return AABB3{source.GetPointInCube(worldSize) * scale, r, r, r};
+    });
+}
+
+//Camera at (0, 0, -150) looking down +Z.
+Frustum MakeOctreeTestFrustum() {
+    const auto projection = Matrix4::CreateDXPerspectiveProjection(60.0f, 16.0f / 9.0f, 0.1f, 250.0f);
+    const auto view = Matrix4::CreateLookAtMatrix(Vector3{0.0f, 0.0f, -150.0f}, Vector3::Z_AXIS, Vector3::Y_AXIS);
+    return Frustum::CreateFromViewProjectionMatrix(projection * view, 16.0f / 9.0f, 60.0f, Vector3::Z_AXIS, 0.1f, 250.0f, true);
+}
+
+float OctreeDistanceSquared(const Vector3& point, const AABB3& box) {
+    return MathUtils::CalcDistanceSquared(point, MathUtils::CalcClosestPoint(point, box));
+}
+
+template<typename Test>
+std::vector<std::size_t> OctreeBruteForceQuery(const LooseOctree3D& octree, const std::vector<std::size_t>& proxies, Test&& test) {
+    std::vector<std::size_t> result{};
+    for(const auto proxy : proxies) {
+        if(test(octree.GetBounds(proxy))) {
+            result.push_back(proxy);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::size_t> OctreeBruteForceNearest(const LooseOctree3D& octree, const std::vector<std::size_t>& proxies, const Vector3& point, std::size_t k) {
+    std::vector<std::pair<float, std::size_t>> ranked{};
+    for(const auto proxy : proxies) {
+        ranked.emplace_back(OctreeDistanceSquared(point, octree.GetBounds(proxy)), proxy);
+    }
+    std::sort(ranked.begin(), ranked.end());
+    std::vector<std::size_t> result{};
+    for(std::size_t i = 0; i < k && i < ranked.size(); ++i) {
+        result.push_back(ranked[i].second);
+    }
+    return result;
+}
+
+std::vector<std::size_t> SortedProxies(std::vector<std::size_t> values) {
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+void ExpectOctreeMatchesBruteForce(const LooseOctree3D& octree, const std::vector<std::size_t>& proxies, unsigned int seed) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<float> coord(-260.0f, 260.0f);
+    std::uniform_real_distribution<float> extent(1.0f, 40.0f);
+    std::vector<std::size_t> results{};
+    for(int i = 0; i < 20; ++i) {
+        const Vector3 center{coord(rng), coord(rng), coord(rng)};
+        const auto half = extent(rng);
+        const AABB3 box{center, half, half * 0.5f, half * 2.0f};
+        results.clear();
+        const auto added = octree.QueryOverlap(box, results);
+        EXPECT_EQ(added, results.size());
+        EXPECT_EQ(SortedProxies(results), OctreeBruteForceQuery(octree, proxies, [&](const AABB3& b) { return MathUtils::DoAABBsOverlap(box, b); }));
+
+        const Sphere3 sphere{center, half};
+        results.clear();
+        octree.QueryOverlap(sphere, results);
+        EXPECT_EQ(SortedProxies(results), OctreeBruteForceQuery(octree, proxies, [&](const AABB3& b) { return OctreeDistanceSquared(sphere.center, b) <= sphere.radius * sphere.radius; }));
+
+        const LineSegment3 segment{center, Vector3{coord(rng), coord(rng), coord(rng)}};
+        results.clear();
+        octree.QueryRay(segment, results);
+        std::vector<std::size_t> expected_ray{};
+        BVH brute{};
+        for(const auto proxy : proxies) {
+            //A one-box BVH runs the same slab test on each proxy.
+            brute.Build(&octree.GetBounds(proxy), 1);
+            std::vector<std::size_t> hit{};
+            if(brute.QueryRay(segment, hit)) {
+                expected_ray.push_back(proxy);
+            }
+        }
+        EXPECT_EQ(SortedProxies(results), SortedProxies(expected_ray));
+
+        results.clear();
+        octree.QueryNearest(center, 10, results);
+        EXPECT_EQ(results, OctreeBruteForceNearest(octree, proxies, center, 10));
+    }
+    const auto frustum = MakeOctreeTestFrustum();
+    results.clear();
+    octree.QueryVisible(frustum, results);
+    EXPECT_FALSE(results.empty());
+    EXPECT_EQ(SortedProxies(results), OctreeBruteForceQuery(octree, proxies, [&](const AABB3& b) { return frustum.IsVisible(b); }));
+}
+
+} //End anonymous
+
+TEST(LooseOctree3D, EmptyTreeFindsNothing) {
+    const LooseOctree3D octree{AABB3{Vector3{-10.0f, -10.0f, -10.0f}, Vector3{10.0f, 10.0f, 10.0f}}};
+    std::vector<std::size_t> results{};
+    EXPECT_EQ(octree.QueryOverlap(AABB3{Vector3::ZERO, 100.0f, 100.0f, 100.0f}, results), 0u);
+    EXPECT_EQ(octree.QueryNearest(Vector3::ZERO, 4, results), 0u);
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(octree.empty());
+    EXPECT_EQ(octree.GetNodeCount(), 1u);
+}
+
+TEST(LooseOctree3D, QueriesMatchBruteForce) {
+    LooseOctree3D octree{AABB3{Vector3{-200.0f, -200.0f, -200.0f}, Vector3{200.0f, 200.0f, 200.0f}}, 8};
+    std::vector<std::size_t> proxies{};
+    for(const auto& box : MakeRandomOctreeBoxes(3000, 1u)) {
+        proxies.push_back(octree.Insert(box));
+    }
+    EXPECT_EQ(octree.size(), 3000u);
+    ExpectOctreeMatchesBruteForce(octree, proxies, 2u);
+}
+
+TEST(LooseOctree3D, ClusteredInsertsSplitSeveralLevels) {
+    //Tiny boxes packed in one corner make each split push them down into a fresh child that splits
+    //again, growing the node pool while the parent's split is still walking its children.
+    LooseOctree3D octree{AABB3{Vector3{-200.0f, -200.0f, -200.0f}, Vector3{200.0f, 200.0f, 200.0f}}, 8};
+    std::vector<std::size_t> proxies{};
+    for(std::size_t i = 0; i < 64; ++i) {
+        const Vector3 center{190.0f + 0.1f * (i % 4), 190.0f + 0.1f * ((i / 4) % 4), 190.0f + 0.1f * (i / 16)};
+        proxies.push_back(octree.Insert(AABB3{center, 0.01f, 0.01f, 0.01f}));
+    }
+    EXPECT_EQ(octree.size(), 64u);
+    EXPECT_GT(octree.GetNodeCount(), 4u);
+    std::vector<std::size_t> results{};
+    octree.QueryOverlap(AABB3{Vector3{189.0f, 189.0f, 189.0f}, Vector3{191.0f, 191.0f, 191.0f}}, results);
+    EXPECT_EQ(SortedProxies(results), SortedProxies(proxies));
+    results.clear();
+    octree.QueryNearest(Vector3{190.0f, 190.0f, 190.0f}, 5, results);
+    EXPECT_EQ(results, OctreeBruteForceNearest(octree, proxies, Vector3{190.0f, 190.0f, 190.0f}, 5));
+}
+
+TEST(LooseOctree3D, MovesRemovesAndReinsertsStayConsistent) {
+    LooseOctree3D octree{AABB3{Vector3{-200.0f, -200.0f, -200.0f}, Vector3{200.0f, 200.0f, 200.0f}}, 8};
+    auto boxes = MakeRandomOctreeBoxes(2000, 3u);
+    std::vector<std::size_t> proxies{};
+    for(const auto& box : boxes) {
+        proxies.push_back(octree.Insert(box));
+    }
+    std::mt19937 rng{4u};
+    std::uniform_real_distribution<float> jitter(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> coord(-250.0f, 250.0f);
+    std::uniform_real_distribution<float> half_size(0.1f, 30.0f);
+    for(int frame = 0; frame < 30; ++frame) {
+        for(std::size_t i = 0; i < proxies.size(); ++i) {
+            auto& box = boxes[i];
+            if(i % 50 == static_cast<std::size_t>(frame) % 50) {
+                //Teleport and resize, so objects change depth as well as place.
+                const auto r = half_size(rng);
+                box = AABB3{Vector3{coord(rng), coord(rng), coord(rng)}, r, r, r};
+            } else {
+                box.Translate(Vector3{jitter(rng), jitter(rng), jitter(rng)});
+            }
+            octree.Move(proxies[i], box);
+        }
+    }
+    ExpectOctreeMatchesBruteForce(octree, proxies, 5u);
+
+    //Remove every third object, then put new ones in; ids are reused.
+    std::vector<std::size_t> kept{};
+    std::vector<std::size_t> removed{};
+    for(std::size_t i = 0; i < proxies.size(); ++i) {
+        if(i % 3 == 0) {
+            octree.Remove(proxies[i]);
+            removed.push_back(proxies[i]);
+        } else {
+            kept.push_back(proxies[i]);
+        }
+    }
+    EXPECT_EQ(octree.size(), kept.size());
+    EXPECT_FALSE(octree.IsValid(removed.front()));
+    ExpectOctreeMatchesBruteForce(octree, kept, 6u);
+    for(const auto& box : MakeRandomOctreeBoxes(removed.size(), 7u)) {
+        const auto proxy = octree.Insert(box);
+        EXPECT_TRUE(std::find(removed.begin(), removed.end(), proxy) != removed.end());
+        kept.push_back(proxy);
+    }
+    ExpectOctreeMatchesBruteForce(octree, kept, 8u);
+    octree.Move(proxies[0] + 100000, AABB3{});
+    octree.Remove(proxies[0] + 100000);
+    EXPECT_EQ(octree.size(), kept.size());
+}
+
+TEST(LooseOctree3D, EmptiedNodesReturnToPool) {
+    LooseOctree3D octree{AABB3{Vector3{-200.0f, -200.0f, -200.0f}, Vector3{200.0f, 200.0f, 200.0f}}, 8};
+    const auto boxes = MakeRandomOctreeBoxes(2000, 9u);
+    std::vector<std::size_t> proxies{};
+    for(const auto& box : boxes) {
+        proxies.push_back(octree.Insert(box));
+    }
+    const auto node_count = octree.GetNodeCount();
+    const auto capacity = octree.GetNodeCapacity();
+    EXPECT_GT(node_count, 100u);
+    EXPECT_EQ(node_count, capacity);
+    for(const auto proxy : proxies) {
+        octree.Remove(proxy);
+    }
+    EXPECT_EQ(octree.GetNodeCount(), 1u);
+    EXPECT_EQ(octree.GetNodeCapacity(), capacity);
+    for(const auto& box : boxes) {
+        octree.Insert(box);
+    }
+    EXPECT_EQ(octree.GetNodeCount(), node_count);
+    EXPECT_EQ(octree.GetNodeCapacity(), capacity);
+
+    //A lone object stays at the root; a crowded node splits and merges back once it thins out.
+    LooseOctree3D small{AABB3{Vector3{-8.0f, -8.0f, -8.0f}, Vector3{8.0f, 8.0f, 8.0f}}, 4};
+    std::vector<std::size_t> crowd{};
+    crowd.push_back(small.Insert(AABB3{Vector3{-0.5f, 1.0f, 1.0f}, 0.1f, 0.1f, 0.1f}));
+    EXPECT_EQ(small.GetNodeCount(), 1u);
+    for(int i = 0; i < 12; ++i) {
+        crowd.push_back(small.Insert(AABB3{Vector3{-6.0f + 0.1f * i, 6.0f, 6.0f}, 0.1f, 0.1f, 0.1f}));
+    }
+    EXPECT_GT(small.GetNodeCount(), 1u);
+
+    //An object going back and forth across a cell boundary reuses the same pooled nodes.
+    small.Move(crowd[0], AABB3{Vector3{0.5f, 1.0f, 1.0f}, 0.1f, 0.1f, 0.1f});
+    small.Move(crowd[0], AABB3{Vector3{-0.5f, 1.0f, 1.0f}, 0.1f, 0.1f, 0.1f});
+    const auto small_count = small.GetNodeCount();
+    const auto small_capacity = small.GetNodeCapacity();
+    for(int i = 0; i < 10; ++i) {
+        small.Move(crowd[0], AABB3{Vector3{(i % 2) ? -0.5f : 0.5f, 1.0f, 1.0f}, 0.1f, 0.1f, 0.1f});
+    }
+    EXPECT_EQ(small.GetNodeCapacity(), small_capacity);
+    EXPECT_EQ(small.GetNodeCount(), small_count);
+    for(std::size_t i = 4; i < crowd.size(); ++i) {
+        small.Remove(crowd[i]);
+    }
+    EXPECT_EQ(small.GetNodeCount(), 1u);
+    std::vector<std::size_t> results{};
+    EXPECT_EQ(small.QueryOverlap(small.GetWorldBounds(), results), 4u);
+}
+
+TEST(LooseOctree3D, NearestOrdersByDistanceAndRespectsMaxDistance) {
+    LooseOctree3D octree{AABB3{Vector3{-100.0f, -100.0f, -100.0f}, Vector3{100.0f, 100.0f, 100.0f}}};
+    const auto far = octree.Insert(Sphere3{Vector3{50.0f, 0.0f, 0.0f}, 1.0f});
+    const auto near = octree.Insert(Sphere3{Vector3{5.0f, 0.0f, 0.0f}, 1.0f});
+    const auto containing = octree.Insert(AABB3{Vector3::ZERO, 80.0f, 80.0f, 80.0f});
+    const auto middle = octree.Insert(Sphere3{Vector3{0.0f, -20.0f, 0.0f}, 1.0f});
+    const auto outside = octree.Insert(Sphere3{Vector3{0.0f, 0.0f, 500.0f}, 1.0f});
+    std::vector<std::size_t> results{};
+    EXPECT_EQ(octree.QueryNearest(Vector3::ZERO, 10, results), 5u);
+    EXPECT_EQ(results, (std::vector<std::size_t>{containing, near, middle, far, outside}));
+    results.clear();
+    EXPECT_EQ(octree.QueryNearest(Vector3::ZERO, 2, results), 2u);
+    EXPECT_EQ(results, (std::vector<std::size_t>{containing, near}));
+    results.clear();
+    EXPECT_EQ(octree.QueryNearest(Vector3::ZERO, 10, results, 20.0f), 3u);
+    EXPECT_EQ(results, (std::vector<std::size_t>{containing, near, middle}));
+    results.clear();
+    octree.QueryNearest(Vector3{0.0f, 0.0f, 600.0f}, 1, results);
+    EXPECT_EQ(results, std::vector<std::size_t>{outside});
+}
+
+TEST(LooseOctree3DBenchmarks, DISABLED_UpdateHeavy) {
+    //Every object moves every frame; a few queries run between frames.
+    constexpr std::size_t count = 20000;
+    constexpr int frames = 10;
+    auto boxes = MakeRandomOctreeBoxes(count, 20u, false);
+    std::vector<Vector3> velocities(count);
+    std::mt19937 rng{21u};
+    std::uniform_real_distribution<float> speed(-0.5f, 0.5f);
+    for(auto& velocity : velocities) {
+        velocity = Vector3{speed(rng), speed(rng), speed(rng)};
+    }
+    const auto queries = MakeRandomOctreeBoxes(32, 22u, false);
+    std::vector<std::size_t> results{};
+    LooseOctree3D octree{AABB3{Vector3{-200.0f, -200.0f, -200.0f}, Vector3{200.0f, 200.0f, 200.0f}}, 8};
+    std::vector<std::size_t> proxies{};
+    for(const auto& box : boxes) {
+        proxies.push_back(octree.Insert(box));
+    }
+    RunBenchmark("LooseOctree3D Move", frames, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            boxes[i].Translate(velocities[i]);
+            octree.Move(proxies[i], boxes[i]);
+        }
+        results.clear();
+        for(const auto& query : queries) {
+            octree.QueryOverlap(query, results);
+        }
+        DoNotOptimize(results);
+    });
+    BVH bvh{};
+    RunBenchmark("BVH Build", frames, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            boxes[i].Translate(velocities[i]);
+        }
+        bvh.Build(boxes);
+        results.clear();
+        for(const auto& query : queries) {
+            bvh.QueryOverlap(query, results);
+        }
+        DoNotOptimize(results);
+    });
+    RunBenchmark("BVH Refit", frames, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            boxes[i].Translate(velocities[i]);
+        }
+        bvh.Refit(boxes);
+        results.clear();
+        for(const auto& query : queries) {
+            bvh.QueryOverlap(query, results);
+        }
+        DoNotOptimize(results);
+    });
+}
+
+TEST(LooseOctree3DBenchmarks, DISABLED_QueryHeavy) {
+    constexpr std::size_t count = 100000;
+    const auto boxes = MakeRandomOctreeBoxes(count, 30u, false);
+    LooseOctree3D octree{AABB3{Vector3{-200.0f, -200.0f, -200.0f}, Vector3{200.0f, 200.0f, 200.0f}}, 8};
+    for(const auto& box : boxes) {
+        octree.Insert(box);
+    }
+    const BVH bvh{boxes};
+    std::mt19937 rng{31u};
+    std::uniform_real_distribution<float> coord(-200.0f, 200.0f);
+    std::vector<Vector3> points{};
+    for(int i = 0; i < 1000; ++i) {
+        points.emplace_back(coord(rng), coord(rng), coord(rng));
+    }
+    std::vector<std::size_t> results{};
+    RunBenchmark("LooseOctree3D AABB overlap", 5, points.size(), [&]() {
+        results.clear();
+        for(const auto& p : points) {
+            octree.QueryOverlap(AABB3{p, 5.0f, 5.0f, 5.0f}, results);
+        }
+        DoNotOptimize(results);
+    });
+    RunBenchmark("BVH AABB overlap", 5, points.size(), [&]() {
+        results.clear();
+        for(const auto& p : points) {
+            bvh.QueryOverlap(AABB3{p, 5.0f, 5.0f, 5.0f}, results);
+        }
+        DoNotOptimize(results);
+    });
+    RunBenchmark("LooseOctree3D Sphere overlap", 5, points.size(), [&]() {
+        results.clear();
+        for(const auto& p : points) {
+            octree.QueryOverlap(Sphere3{p, 5.0f}, results);
+        }
+        DoNotOptimize(results);
+    });
+    RunBenchmark("LooseOctree3D Ray", 5, points.size(), [&]() {
+        results.clear();
+        for(std::size_t i = 0; i + 1 < points.size(); ++i) {
+            octree.QueryRay(LineSegment3{points[i], points[i + 1]}, results);
+        }
+        DoNotOptimize(results);
+    });
+    RunBenchmark("LooseOctree3D Nearest 8", 5, points.size(), [&]() {
+        results.clear();
+        for(const auto& p : points) {
+            octree.QueryNearest(p, 8, results);
+        }
+        DoNotOptimize(results);
+    });
+    const auto frustum = MakeOctreeTestFrustum();
+    RunBenchmark("LooseOctree3D Frustum", 20, 1, [&]() {
+        results.clear();
+        octree.QueryVisible(frustum, results);
+        DoNotOptimize(results);
+    });
+    RunBenchmark("BVH Frustum", 20, 1, [&]() {
+        results.clear();
+        bvh.QueryVisible(frustum, results);
+        DoNotOptimize(results);
+    });
+}
@@ -0,0 +1,449 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Core/BuildConfig.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/Vertex3D.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Matrix4.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector4.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//Plain scalar reference implementations to check the Matrix4 SIMD paths against.
+using mat4_t = std::array<float, 16>;
+
+mat4_t ToArray(const Matrix4& m) {
+    const Vector4 rows[4] = {m.GetXComponents(), m.GetYComponents(), m.GetZComponents(), m.GetWComponents()};
+    mat4_t result{};
+    for(std::size_t r = 0; r < 4; ++r) {
+        result[4 * r + 0] = rows[r].x;
+        result[4 * r + 1] = rows[r].y;
+        result[4 * r + 2] = rows[r].z;
+        result[4 * r + 3] = rows[r].w;
+    }
+    return result;
+}
+
+mat4_t ReferenceMultiply(const mat4_t& a, const mat4_t& b) {
+    mat4_t result{};
+    for(std::size_t r = 0; r < 4; ++r) {
+        for(std::size_t c = 0; c < 4; ++c) {
+            float sum = 0.0f;
+            for(std::size_t k = 0; k < 4; ++k) {
+                sum += a[4 * r + k] * b[4 * k + c];
+            }
+            result[4 * r + c] = sum;
+        }
+    }
+    return result;
+}
+
+std::array<float, 4> ReferenceTransform(const mat4_t& m, const std::array<float, 4>& v) {
+    std::array<float, 4> result{};
+    for(std::size_t r = 0; r < 4; ++r) {
+        result[r] = m[4 * r + 0] * v[0] + m[4 * r + 1] * v[1] + m[4 * r + 2] * v[2] + m[4 * r + 3] * v[3];
+    }
+    return result;
+}
+
+float ReferenceMinor(const mat4_t& m, std::size_t row, std::size_t col) {
+    float sub[9]{};
+    std::size_t i = 0;
+    for(std::size_t r = 0; r < 4; ++r) {
+        for(std::size_t c = 0; c < 4; ++c) {
+            if(r != row && c != col) {
+                sub[i++] = m[4 * r + c];
+            }
+        }
+    }
+    return sub[0] * (sub[4] * sub[8] - sub[5] * sub[7])
+         - sub[1] * (sub[3] * sub[8] - sub[5] * sub[6])
+         + sub[2] * (sub[3] * sub[7] - sub[4] * sub[6]);
+}
+
+//Cofactor expansion, as the scalar Matrix4::CalculateInverse does.
+mat4_t ReferenceInverse(const mat4_t& m) {
+    mat4_t adjugate{};
+    float det = 0.0f;
+    for(std::size_t r = 0; r < 4; ++r) {
+        for(std::size_t c = 0; c < 4; ++c) {
+            const float sign = ((r + c) % 2) ? -1.0f : 1.0f;
+            adjugate[4 * c + r] = sign * ReferenceMinor(m, r, c);
+        }
+    }
+    for(std::size_t c = 0; c < 4; ++c) {
+        det += m[c] * adjugate[4 * c];
+    }
+    for(auto& e : adjugate) {
+        e /= det;
+    }
+    return adjugate;
+}
+
+Matrix4 MakeRandomTransform(std::mt19937& rng) {
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    std::uniform_real_distribution<float> offset(-100.0f, 100.0f);
+    const auto T = Matrix4::CreateTranslationMatrix(Vector3{offset(rng), offset(rng), offset(rng)});
+    const auto R = Matrix4::Create3DXRotationMatrix(angle(rng)) * Matrix4::Create3DYRotationMatrix(angle(rng)) * Matrix4::Create3DZRotationMatrix(angle(rng));
+    const auto S = Matrix4::CreateScaleMatrix(Vector3{scale(rng), scale(rng), scale(rng)});
+    return T * R * S;
+}
+
+Matrix4 MakeRandomMatrix(std::mt19937& rng) {
+    std::uniform_real_distribution<float> element(-4.0f, 4.0f);
+    float values[16]{};
+    for(auto& v : values) {
+        v = element(rng);
+    }
+    //Diagonally dominant keeps the inverse well-conditioned.
+    values[0] += 10.0f;
+    values[5] += 10.0f;
+    values[10] += 10.0f;
+    values[15] += 10.0f;
+    return Matrix4(values);
+}
+
+void ExpectMatrixNear(const mat4_t& a, const mat4_t& b, float tolerance) {
+    for(std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_NEAR(a[i], b[i], tolerance) << "index " << i;
+    }
+}
+
+} //End anonymous
+
+TEST(Matrix4, IsSixteenByteAligned) {
+    EXPECT_EQ(alignof(Matrix4), 16u);
+    EXPECT_EQ(sizeof(Matrix4), 16u * sizeof(float));
+    std::vector<Matrix4> matrices(7);
+    for(const auto& m : matrices) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&m) % 16u, 0u);
+    }
+}
+
+TEST(Matrix4, MultiplyMatchesScalar) {
+    std::mt19937 rng{1234u};
+    for(int i = 0; i < 100; ++i) {
+        const auto a = MakeRandomMatrix(rng);
+        const auto b = MakeRandomTransform(rng);
+        const auto expected = ReferenceMultiply(ToArray(a), ToArray(b));
+        ExpectMatrixNear(ToArray(a * b), expected, 1e-3f);
+        auto c = a;
+        c *= b;
+        ExpectMatrixNear(ToArray(c), expected, 1e-3f);
+        auto d = a;
+        d.ConcatenateTransform(b);
+        ExpectMatrixNear(ToArray(d), expected, 1e-3f);
+    }
+}
+
+TEST(Matrix4, MultiplyAssignAliasingSelf) {
+    std::mt19937 rng{42u};
+    const auto a = MakeRandomMatrix(rng);
+    const auto expected = ReferenceMultiply(ToArray(a), ToArray(a));
+    auto b = a;
+    b *= b;
+    ExpectMatrixNear(ToArray(b), expected, 1e-3f);
+}
+
+TEST(Matrix4, TransformMatchesScalar) {
+    std::mt19937 rng{99u};
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    for(int i = 0; i < 100; ++i) {
+        const auto m = MakeRandomTransform(rng);
+        const auto mat = ToArray(m);
+        const Vector3 p{coord(rng), coord(rng), coord(rng)};
+
+        const auto expected_position = ReferenceTransform(mat, {p.x, p.y, p.z, 1.0f});
+        const auto position = m.TransformPosition(p);
+        EXPECT_NEAR(position.x, expected_position[0], 1e-3f);
+        EXPECT_NEAR(position.y, expected_position[1], 1e-3f);
+        EXPECT_NEAR(position.z, expected_position[2], 1e-3f);
+
+        const auto expected_direction = ReferenceTransform(mat, {p.x, p.y, p.z, 0.0f});
+        const auto direction = m.TransformDirection(p);
+        EXPECT_NEAR(direction.x, expected_direction[0], 1e-3f);
+        EXPECT_NEAR(direction.y, expected_direction[1], 1e-3f);
+        EXPECT_NEAR(direction.z, expected_direction[2], 1e-3f);
+
+        const auto position2 = m.TransformPosition(Vector2{p.x, p.y});
+        const auto expected_position2 = ReferenceTransform(mat, {p.x, p.y, 0.0f, 1.0f});
+        EXPECT_NEAR(position2.x, expected_position2[0], 1e-3f);
+        EXPECT_NEAR(position2.y, expected_position2[1], 1e-3f);
+
+        const Vector4 h{p.x, p.y, p.z, 0.5f};
+        const auto expected_vector = ReferenceTransform(mat, {h.x, h.y, h.z, h.w});
+        const auto vector = m.TransformVector(h);
+        EXPECT_NEAR(vector.x, expected_vector[0], 1e-3f);
+        EXPECT_NEAR(vector.y, expected_vector[1], 1e-3f);
+        EXPECT_NEAR(vector.z, expected_vector[2], 1e-3f);
+        EXPECT_NEAR(vector.w, expected_vector[3], 1e-3f);
+    }
+}
+
+TEST(Matrix4, TransposeMatchesScalar) {
+    std::mt19937 rng{7u};
+    const auto m = MakeRandomMatrix(rng);
+    const auto mat = ToArray(m);
+    mat4_t expected{};
+    for(std::size_t r = 0; r < 4; ++r) {
+        for(std::size_t c = 0; c < 4; ++c) {
+            expected[4 * c + r] = mat[4 * r + c];
+        }
+    }
+    ExpectMatrixNear(ToArray(Matrix4::CreateTransposeMatrix(m)), expected, 0.0f);
+    auto t = m;
+    t.Transpose();
+    ExpectMatrixNear(ToArray(t), expected, 0.0f);
+}
+
+TEST(Matrix4, InverseMatchesScalar) {
+    std::mt19937 rng{2018u};
+    for(int i = 0; i < 100; ++i) {
+        const auto m = (i % 2) ? MakeRandomMatrix(rng) : MakeRandomTransform(rng);
+        const auto expected = ReferenceInverse(ToArray(m));
+        const auto inverse = Matrix4::CalculateInverse(m);
+        ExpectMatrixNear(ToArray(inverse), expected, 1e-4f);
+        ExpectMatrixNear(ToArray(m * inverse), ToArray(Matrix4::I), 1e-4f);
+        auto in_place = m;
+        in_place.CalculateInverse();
+        ExpectMatrixNear(ToArray(in_place), ToArray(inverse), 0.0f);
+    }
+}
+
+TEST(Matrix4, BatchTransformMatchesSingle) {
+    std::mt19937 rng{5u};
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    const auto m = MakeRandomTransform(rng);
+    //Not a multiple of four, to cover the tail.
+    std::vector<Vector3> points(103);
+    for(auto& p : points) {
+        p = Vector3{coord(rng), coord(rng), coord(rng)};
+    }
+    std::vector<Vector3> positions{};
+    std::vector<Vector3> directions{};
+    m.TransformPositions(points, positions);
+    m.TransformDirections(points, directions);
+    ASSERT_EQ(positions.size(), points.size());
+    ASSERT_EQ(directions.size(), points.size());
+    for(std::size_t i = 0; i < points.size(); ++i) {
+        const auto expected_position = m.TransformPosition(points[i]);
+        const auto expected_direction = m.TransformDirection(points[i]);
+        EXPECT_NEAR(positions[i].x, expected_position.x, 1e-3f);
+        EXPECT_NEAR(positions[i].y, expected_position.y, 1e-3f);
+        EXPECT_NEAR(positions[i].z, expected_position.z, 1e-3f);
+        EXPECT_NEAR(directions[i].x, expected_direction.x, 1e-3f);
+        EXPECT_NEAR(directions[i].y, expected_direction.y, 1e-3f);
+        EXPECT_NEAR(directions[i].z, expected_direction.z, 1e-3f);
+    }
+    //In place.
+    m.TransformPositions(points.data(), points.data(), points.size());
+    for(std::size_t i = 0; i < points.size(); ++i) {
+        EXPECT_FLOAT_EQ(points[i].x, positions[i].x);
+        EXPECT_FLOAT_EQ(points[i].y, positions[i].y);
+        EXPECT_FLOAT_EQ(points[i].z, positions[i].z);
+    }
+}
+
+TEST(Matrix4, BatchTransformVertices) {
+    std::mt19937 rng{6u};
+    std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+    const auto m = MakeRandomTransform(rng);
+    std::vector<Vertex3D> vertices{};
+    for(int i = 0; i < 11; ++i) {
+        vertices.emplace_back(Vector3{coord(rng), coord(rng), coord(rng)}, Rgba::Red, Vector2{coord(rng), coord(rng)}
+                              , Vector3{coord(rng), coord(rng), coord(rng)}, Vector3{coord(rng), coord(rng), coord(rng)}, Vector3{coord(rng), coord(rng), coord(rng)});
+    }
+    std::vector<Vertex3D> out{};
+    m.TransformVertices(vertices, out);
+    ASSERT_EQ(out.size(), vertices.size());
+    const auto normal_matrix = Matrix4::CreateTransposeMatrix(Matrix4::CalculateInverse(m));
+    for(std::size_t i = 0; i < vertices.size(); ++i) {
+        const auto& v = vertices[i];
+        const auto& r = out[i];
+        const Vector3 expected[] = {m.TransformPosition(v.position), normal_matrix.TransformDirection(v.normal).GetNormalize(), m.TransformDirection(v.tangent), m.TransformDirection(v.bitangent)};
+        const Vector3 actual[] = {r.position, r.normal, r.tangent, r.bitangent};
+        for(std::size_t k = 0; k < 4; ++k) {
+            EXPECT_NEAR(actual[k].x, expected[k].x, 1e-4f);
+            EXPECT_NEAR(actual[k].y, expected[k].y, 1e-4f);
+            EXPECT_NEAR(actual[k].z, expected[k].z, 1e-4f);
+        }
+        EXPECT_FLOAT_EQ(r.color.x, v.color.x);
+        EXPECT_FLOAT_EQ(r.color.w, v.color.w);
+        EXPECT_FLOAT_EQ(r.texcoords.x, v.texcoords.x);
+        EXPECT_FLOAT_EQ(r.texcoords.y, v.texcoords.y);
+    }
+}
+
+TEST(Matrix4, BatchTransformVerticesKeepsNormalsPerpendicular) {
+    //A 45 degree slope in xy squashed along x: the transformed tangent is no longer
+    //perpendicular to the normal pushed through the same matrix.
+    const auto m = Matrix4::CreateTranslationMatrix(Vector3{3.0f, -2.0f, 1.0f}) * Matrix4::CreateScaleMatrix(Vector3{4.0f, 1.0f, 0.5f});
+    const auto tangent = Vector3{1.0f, 1.0f, 0.0f}.GetNormalize();
+    const auto normal = Vector3{-1.0f, 1.0f, 0.0f}.GetNormalize();
+    //Five vertices so the SIMD path covers a full group and a tail.
+    std::vector<Vertex3D> vertices(5, Vertex3D(Vector3::ZERO, Rgba::White, Vector2::ZERO, normal, tangent, Vector3::Z_AXIS));
+    std::vector<Vertex3D> out{};
+    m.TransformVertices(vertices, out);
+    const auto expected = Vector3{-1.0f, 4.0f, 0.0f}.GetNormalize();
+    for(const auto& r : out) {
+        EXPECT_NEAR(MathUtils::DotProduct(r.normal, r.tangent), 0.0f, 1e-5f);
+        EXPECT_NEAR(r.normal.CalcLength(), 1.0f, 1e-5f);
+        EXPECT_NEAR(r.normal.x, expected.x, 1e-5f);
+        EXPECT_NEAR(r.normal.y, expected.y, 1e-5f);
+        EXPECT_NEAR(r.normal.z, expected.z, 1e-5f);
+    }
+    //A mirroring matrix flips the normal with the surface.
+    const auto mirror = Matrix4::CreateScaleMatrix(Vector3{-2.0f, 1.0f, 1.0f});
+    mirror.TransformVertices(vertices, out);
+    const auto mirrored = Vector3{0.5f, 1.0f, 0.0f}.GetNormalize();
+    EXPECT_NEAR(out[0].normal.x, mirrored.x, 1e-5f);
+    EXPECT_NEAR(out[0].normal.y, mirrored.y, 1e-5f);
+}
+
+TEST(Matrix4, BatchTransformOnJobSystem) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    std::mt19937 rng{8u};
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    const auto m = MakeRandomTransform(rng);
+    std::vector<Vector3> points(100003);
+    for(auto& p : points) {
+        p = Vector3{coord(rng), coord(rng), coord(rng)};
+    }
+    std::vector<Vector3> serial{};
+    std::vector<Vector3> parallel{};
+    m.TransformPositions(points, serial);
+    m.TransformPositions(points, parallel, &jobs);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for(std::size_t i = 0; i < serial.size(); ++i) {
+        ASSERT_EQ(parallel[i], serial[i]) << "index " << i;
+    }
+    jobs.Shutdown();
+}
+
+TEST(JobSystem, ParallelForCoversEveryIndexOnce) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    std::vector<std::atomic_int> hits(10007);
+    jobs.ParallelFor(hits.size(), 64, [&hits](std::size_t begin, std::size_t end) {
+        for(auto i = begin; i < end; ++i) {
+            ++hits[i];
+        }
+    });
+    for(const auto& hit : hits) {
+        ASSERT_EQ(hit.load(), 1);
+    }
+    jobs.Shutdown();
+}
+
+TEST(JobSystem, ConsumedJobLivesUntilCreatorReleasesIt) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    int runs = 0;
+    auto job = jobs.Create(JobType::Generic, [&runs](void*) { ++runs; }, nullptr);
+    jobs.Dispatch(job);
+    JobConsumer consumer{};
+    consumer.AddCategory(JobType::Generic);
+    //Drain whatever reached the queue, on this thread if there are no workers.
+    while(job->state != JobState::Finished) {
+        consumer.ConsumeAll();
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(runs, 1);
+    //A worker may still be dropping the queue's reference, so either side can be the one to free it.
+    jobs.Release(job);
+    jobs.Shutdown();
+}
+
+//Compare against a build with MATH_NO_SIMD defined for the scalar numbers.
+#ifdef MATH_SIMD_SSE
+constexpr const char* MATRIX4_BENCHMARK_PATH = " (SSE)";
+#else
+constexpr const char* MATRIX4_BENCHMARK_PATH = " (scalar)";
+#endif
+
+TEST(Matrix4Benchmarks, DISABLED_Multiply) {
+    std::mt19937 rng{1u};
+    std::vector<Matrix4> matrices{};
+    for(int i = 0; i < 1024; ++i) {
+        matrices.push_back(MakeRandomTransform(rng));
+    }
+    RunBenchmark(std::string("Matrix4 multiply") + MATRIX4_BENCHMARK_PATH, 1000, matrices.size(), [&]() {
+        Matrix4 acc{};
+        for(const auto& m : matrices) {
+            acc *= m;
+        }
+        DoNotOptimize(acc);
+    });
+}
+
+TEST(Matrix4Benchmarks, DISABLED_TransformPosition) {
+    std::mt19937 rng{2u};
+    const auto m = MakeRandomTransform(rng);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::vector<Vector3> points(4096);
+    for(auto& p : points) {
+        p = Vector3{coord(rng), coord(rng), coord(rng)};
+    }
+    RunBenchmark(std::string("Matrix4 TransformPosition") + MATRIX4_BENCHMARK_PATH, 1000, points.size(), [&]() {
+        float sum = 0.0f;
+        for(const auto& p : points) {
+            sum += m.TransformPosition(p).x;
+        }
+        DoNotOptimize(sum);
+    });
+}
+
+TEST(Matrix4Benchmarks, DISABLED_Inverse) {
+    std::mt19937 rng{3u};
+    std::vector<Matrix4> matrices{};
+    for(int i = 0; i < 1024; ++i) {
+        matrices.push_back(MakeRandomMatrix(rng));
+    }
+    RunBenchmark(std::string("Matrix4 CalculateInverse") + MATRIX4_BENCHMARK_PATH, 100, matrices.size(), [&]() {
+        float sum = 0.0f;
+        for(const auto& m : matrices) {
+            sum += Matrix4::CalculateInverse(m).GetXComponents().w;
+        }
+        DoNotOptimize(sum);
+    });
+}
+
+TEST(Matrix4Benchmarks, DISABLED_TransformPositionsMillion) {
+    std::mt19937 rng{4u};
+    const auto m = MakeRandomTransform(rng);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::vector<Vector3> points(1000000);
+    for(auto& p : points) {
+        p = Vector3{coord(rng), coord(rng), coord(rng)};
+    }
+    std::vector<Vector3> out(points.size());
+    RunBenchmark(std::string("1M TransformPosition loop") + MATRIX4_BENCHMARK_PATH, 20, points.size(), [&]() {
+        for(std::size_t i = 0; i < points.size(); ++i) {
+            out[i] = m.TransformPosition(points[i]);
+        }
+        DoNotOptimize(out);
+    });
+    RunBenchmark(std::string("1M TransformPositions") + MATRIX4_BENCHMARK_PATH, 20, points.size(), [&]() {
+        m.TransformPositions(points.data(), out.data(), points.size());
+        DoNotOptimize(out);
+    });
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    RunBenchmark(std::string("1M TransformPositions JobSystem") + MATRIX4_BENCHMARK_PATH, 20, points.size(), [&]() {
+        m.TransformPositions(points.data(), out.data(), points.size(), &jobs);
+        DoNotOptimize(out);
+    });
+    jobs.Shutdown();
+}
@@ -0,0 +1,327 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+#include "RandomShapes.hpp"
+
+#include "Engine/Core/Vertex3D.hpp"
+
+#include "Engine/Math/BVH.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/MeshBVH.hpp"
+#include "Engine/Math/Raycast.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+//Closed lumpy sphere of about 2 * rings * segments triangles around the origin.
+void MakeMeshBVHTestMesh(std::size_t rings, std::size_t segments, float radius, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) {
+    vbo.clear();
+    ibo.clear();
+    const auto pi = 3.14159265f;
+    const auto surface = [&](float theta, float phi) {
+        const Vector3 direction{std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta)};
+        return direction * (radius * (1.0f + 0.15f * std::sin(3.0f * phi) * std::sin(2.0f * theta)));
+    };
+    vbo.emplace_back(surface(0.0f, 0.0f));
+    for(std::size_t ring = 1; ring < rings; ++ring) {
+        for(std::size_t segment = 0; segment < segments; ++segment) {
+            const auto theta = pi * static_cast<float>(ring) / static_cast<float>(rings);
+            const auto phi = 2.0f * pi * static_cast<float>(segment) / static_cast<float>(segments);
+            vbo.emplace_back(surface(theta, phi));
+        }
+    }
+    vbo.emplace_back(surface(pi, 0.0f));
+    const auto count = static_cast<unsigned int>(segments);
+    const auto last = static_cast<unsigned int>(vbo.size() - 1);
+    const auto at = [&](std::size_t ring, unsigned int segment) {
+        return static_cast<unsigned int>(1 + (ring - 1) * segments) + segment % count;
+    };
+    for(unsigned int segment = 0; segment < count; ++segment) {
+        ibo.insert(ibo.end(), {0u, at(1, segment), at(1, segment + 1)});
+        ibo.insert(ibo.end(), {last, at(rings - 1, segment + 1), at(rings - 1, segment)});
+    }
+    for(std::size_t ring = 1; ring + 1 < rings; ++ring) {
+        for(unsigned int segment = 0; segment < count; ++segment) {
+            ibo.insert(ibo.end(), {at(ring, segment), at(ring + 1, segment), at(ring, segment + 1)});
+            ibo.insert(ibo.end(), {at(ring, segment + 1), at(ring + 1, segment), at(ring + 1, segment + 1)});
+        }
+    }
+}
+
+float CalcMeshBVHTestDistance(const Vector3& point, const std::vector<Vertex3D>& vbo, const std::vector<unsigned int>& ibo, Vector3* closest = nullptr, std::size_t* triangle = nullptr) {
+    auto best = (std::numeric_limits<float>::max)();
+    for(std::size_t i = 0; i < ibo.size() / 3; ++i) {
+        const auto candidate = MathUtils::CalcClosestPoint(point, vbo[ibo[3 * i]].position, vbo[ibo[3 * i + 1]].position, vbo[ibo[3 * i + 2]].position);
+        const auto distance = (point - candidate).CalcLength();
+        if(distance < best) {
+            best = distance;
+            if(closest) {
+                *closest = candidate;
+            }
+            if(triangle) {
+                *triangle = i;
+            }
+        }
+    }
+    return best;
+}
+
+} //End anonymous
+
+TEST(MeshBVH, NodesAreCompactAndCoverEveryTriangle) {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeMeshBVHTestMesh(24, 32, 5.0f, vbo, ibo);
+    const MeshBVH mesh{vbo, ibo};
+    ASSERT_FALSE(mesh.empty());
+    EXPECT_EQ(sizeof(MeshBVH::Node), 32u);
+    EXPECT_EQ(mesh.GetTriangleCount(), ibo.size() / 3);
+    std::size_t leaf_triangles = 0;
+    for(std::size_t i = 0; i < mesh.GetNodes().size(); ++i) {
+        const auto& node = mesh.GetNodes()[i];
+        if(node.IsLeaf()) {
+            leaf_triangles += node.count;
+        } else {
+            EXPECT_LT(i, node.first);
+        }
+    }
+    EXPECT_EQ(leaf_triangles, ibo.size() / 3);
+    const auto bounds = mesh.GetBounds();
+    for(const auto& vertex : vbo) {
+        EXPECT_TRUE(MathUtils::IsPointInside(bounds, vertex.position));
+    }
+
+    MeshBVH empty{std::vector<Vertex3D>{}, std::vector<unsigned int>{}};
+    EXPECT_TRUE(empty.empty());
+    RaycastHit3 hit{};
+    EXPECT_FALSE(empty.Raycast(LineSegment3{Vector3{-10.0f, 0.0f, 0.0f}, Vector3{10.0f, 0.0f, 0.0f}}, hit));
+}
+
+TEST(MeshBVH, RaycastMatchesBVHRaycast) {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeMeshBVHTestMesh(24, 32, 5.0f, vbo, ibo);
+    const MeshBVH mesh{vbo, ibo};
+    const BVH bvh{MathUtils::CalcTriangleBounds(vbo, ibo)};
+    const auto starts = MakeRandomPoints(2000, 11u, 8.0f);
+    const auto ends = MakeRandomPoints(2000, 12u, 8.0f);
+    std::size_t hit_count = 0;
+    for(std::size_t i = 0; i < starts.size(); ++i) {
+        const LineSegment3 segment{starts[i], ends[i]};
+        RaycastHit3 expected{};
+        RaycastHit3 actual{};
+        const bool expected_hit = MathUtils::Raycast(segment, bvh, vbo, ibo, expected);
+        ASSERT_EQ(expected_hit, mesh.Raycast(segment, actual));
+        if(!expected_hit) {
+            continue;
+        }
+        ++hit_count;
+        EXPECT_NEAR(expected.t, actual.t, 1e-4f);
+        EXPECT_NEAR(expected.point.x, actual.point.x, 1e-3f);
+        EXPECT_NEAR(expected.point.y, actual.point.y, 1e-3f);
+        EXPECT_NEAR(expected.point.z, actual.point.z, 1e-3f);
+        //Rays through a shared edge may report either triangle.
+        if(expected.index == actual.index) {
+            EXPECT_NEAR(expected.normal.x, actual.normal.x, 1e-3f);
+            EXPECT_NEAR(expected.normal.y, actual.normal.y, 1e-3f);
+            EXPECT_NEAR(expected.normal.z, actual.normal.z, 1e-3f);
+        }
+    }
+    EXPECT_GT(hit_count, starts.size() / 4);
+}
+
+TEST(MeshBVH, ClosestPointMatchesBruteForce) {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeMeshBVHTestMesh(24, 32, 5.0f, vbo, ibo);
+    const MeshBVH mesh{vbo, ibo};
+    for(const auto& point : MakeRandomPoints(1000, 13u, 9.0f)) {
+        Vector3 expected{};
+        std::size_t expected_triangle = 0;
+        const auto distance = CalcMeshBVHTestDistance(point, vbo, ibo, &expected, &expected_triangle);
+        Vector3 closest{};
+        std::size_t triangle = 0;
+        ASSERT_TRUE(mesh.CalcClosestPoint(point, closest, triangle));
+        EXPECT_NEAR(distance, (point - closest).CalcLength(), 1e-4f);
+        //Points nearest an edge or corner have several equally close triangles.
+        if(expected_triangle == triangle) {
+            EXPECT_NEAR(expected.x, closest.x, 1e-4f);
+            EXPECT_NEAR(expected.y, closest.y, 1e-4f);
+            EXPECT_NEAR(expected.z, closest.z, 1e-4f);
+        }
+        if(std::abs(distance - 0.5f) > 1e-4f) {
+            EXPECT_EQ(distance < 0.5f, mesh.CalcClosestPoint(point, closest, triangle, 0.5f));
+        }
+        EXPECT_FALSE(mesh.CalcClosestPoint(point, closest, triangle, -distance - 1.0f));
+    }
+}
+
+TEST(MeshBVH, SweepSphereStopsAtFirstContact) {
+    //Unit quad in the z = 0 plane: a face contact and an edge contact with known answers.
+    const std::vector<Vertex3D> quad_vbo{Vertex3D{Vector3{-1.0f, -1.0f, 0.0f}}, Vertex3D{Vector3{1.0f, -1.0f, 0.0f}}, Vertex3D{Vector3{1.0f, 1.0f, 0.0f}}, Vertex3D{Vector3{-1.0f, 1.0f, 0.0f}}};
+    const std::vector<unsigned int> quad_ibo{0, 1, 2, 0, 2, 3};
+    const MeshBVH quad{quad_vbo, quad_ibo};
+    RaycastHit3 hit{};
+    ASSERT_TRUE(quad.SweepSphere(Sphere3{Vector3{0.2f, 0.1f, 2.0f}, 0.5f}, Vector3{0.0f, 0.0f, -4.0f}, hit));
+    EXPECT_NEAR(hit.t, 0.375f, 1e-5f);
+    EXPECT_NEAR(hit.point.x, 0.2f, 1e-5f);
+    EXPECT_NEAR(hit.point.y, 0.1f, 1e-5f);
+    EXPECT_NEAR(hit.point.z, 0.0f, 1e-5f);
+    EXPECT_NEAR(hit.normal.z, 1.0f, 1e-5f);
+    ASSERT_TRUE(quad.SweepSphere(Sphere3{Vector3{3.0f, 0.5f, 0.0f}, 0.5f}, Vector3{-4.0f, 0.0f, 0.0f}, hit));
+    EXPECT_NEAR(hit.t, 0.375f, 1e-5f);
+    EXPECT_NEAR(hit.point.x, 1.0f, 1e-5f);
+    EXPECT_NEAR(hit.point.y, 0.5f, 1e-5f);
+    EXPECT_NEAR(hit.normal.x, 1.0f, 1e-5f);
+    EXPECT_FALSE(quad.SweepSphere(Sphere3{Vector3{3.0f, 0.0f, 0.0f}, 0.5f}, Vector3{1.0f, 0.0f, 0.0f}, hit));
+    ASSERT_TRUE(quad.SweepSphere(Sphere3{Vector3{0.0f, 0.0f, 0.25f}, 0.5f}, Vector3{4.0f, 0.0f, 0.0f}, hit));
+    EXPECT_EQ(hit.t, 0.0f);
+
+    //On the lumpy sphere: the sphere just touches the mesh at the hit and never overlaps it before.
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeMeshBVHTestMesh(16, 24, 5.0f, vbo, ibo);
+    const MeshBVH mesh{vbo, ibo};
+    const auto starts = MakeRandomPoints(300, 14u, 9.0f);
+    const auto ends = MakeRandomPoints(300, 15u, 9.0f);
+    std::mt19937 rng{16u};
+    std::uniform_real_distribution<float> radius_distribution(0.1f, 1.5f);
+    std::size_t hit_count = 0;
+    for(std::size_t i = 0; i < starts.size(); ++i) {
+        const Sphere3 sphere{starts[i], radius_distribution(rng)};
+        const auto displacement = ends[i] - starts[i];
+        const bool is_hit = mesh.SweepSphere(sphere, displacement, hit);
+        const auto t_end = is_hit ? hit.t : 1.0f;
+        for(std::size_t step = 0; step < 32; ++step) {
+            const auto t = t_end * static_cast<float>(step) / 32.0f;
+            if(is_hit && hit.t == 0.0f) {
+                break;
+            }
+            EXPECT_GT(CalcMeshBVHTestDistance(sphere.center + displacement * t, vbo, ibo), sphere.radius - 1e-3f);
+        }
+        if(!is_hit) {
+            continue;
+        }
+        ++hit_count;
+        const auto center = sphere.center + displacement * hit.t;
+        const auto distance = CalcMeshBVHTestDistance(center, vbo, ibo);
+        if(hit.t == 0.0f) {
+            EXPECT_LE(distance, sphere.radius + 1e-3f);
+        } else {
+            EXPECT_NEAR(distance, sphere.radius, 1e-3f);
+            EXPECT_NEAR((center - hit.point).CalcLength(), sphere.radius, 1e-3f);
+            EXPECT_NEAR(MathUtils::DotProduct(hit.normal, (center - hit.point).GetNormalize()), 1.0f, 1e-3f);
+        }
+        EXPECT_NEAR(CalcMeshBVHTestDistance(hit.point, vbo, ibo), 0.0f, 1e-3f);
+    }
+    EXPECT_GT(hit_count, starts.size() / 4);
+}
+
+TEST(MeshBVH, CacheRoundTrip) {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeMeshBVHTestMesh(24, 32, 5.0f, vbo, ibo);
+    const MeshBVH built{vbo, ibo};
+    const auto path = std::filesystem::temp_directory_path() / "MeshBVHTests.mbvh";
+    ASSERT_TRUE(built.Save(path));
+    MeshBVH loaded{};
+    ASSERT_TRUE(loaded.Load(path));
+    ASSERT_EQ(built.GetNodes().size(), loaded.GetNodes().size());
+    EXPECT_EQ(built.GetTriangleCount(), loaded.GetTriangleCount());
+    const auto starts = MakeRandomPoints(500, 17u, 8.0f);
+    const auto ends = MakeRandomPoints(500, 18u, 8.0f);
+    for(std::size_t i = 0; i < starts.size(); ++i) {
+        RaycastHit3 expected{};
+        RaycastHit3 actual{};
+        const LineSegment3 segment{starts[i], ends[i]};
+        ASSERT_EQ(built.Raycast(segment, expected), loaded.Raycast(segment, actual));
+        EXPECT_EQ(expected.t, actual.t);
+        EXPECT_EQ(expected.index, actual.index);
+        Vector3 expected_point{};
+        Vector3 actual_point{};
+        std::size_t expected_triangle = 0;
+        std::size_t actual_triangle = 0;
+        built.CalcClosestPoint(starts[i], expected_point, expected_triangle);
+        loaded.CalcClosestPoint(starts[i], actual_point, actual_triangle);
+        EXPECT_EQ(expected_point, actual_point);
+        EXPECT_EQ(expected_triangle, actual_triangle);
+    }
+
+    //Truncated and foreign files are rejected and leave the index empty.
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+    EXPECT_FALSE(loaded.Load(path));
+    EXPECT_TRUE(loaded.empty());
+    {
+        std::ofstream garbage{path, std::ios_base::binary | std::ios_base::trunc};
+        garbage << "not a mesh cache, just some text that is long enough";
+    }
+    EXPECT_FALSE(loaded.Load(path));
+    std::filesystem::remove(path);
+    EXPECT_FALSE(loaded.Load(path));
+    EXPECT_TRUE(loaded.empty());
+}
+
+TEST(MeshBVHBenchmarks, DISABLED_BuildLoadAndQueries) {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeMeshBVHTestMesh(256, 320, 5.0f, vbo, ibo);
+    const auto path = std::filesystem::temp_directory_path() / "MeshBVHBenchmarks.mbvh";
+    MeshBVH mesh{};
+    RunBenchmark("Build (160k triangles)", 3, [&]() {
+        mesh.Build(vbo, ibo);
+        DoNotOptimize(mesh.GetNodes().data());
+    });
+    mesh.Save(path);
+    RunBenchmark("Load (160k triangles)", 3, [&]() {
+        mesh.Load(path);
+        DoNotOptimize(mesh.GetNodes().data());
+    });
+    std::filesystem::remove(path);
+
+    const BVH bvh{MathUtils::CalcTriangleBounds(vbo, ibo)};
+    const auto starts = MakeRandomPoints(1 << 15, 19u, 8.0f);
+    const auto ends = MakeRandomPoints(1 << 15, 20u, 8.0f);
+    RunBenchmark("Raycast BVH + vbo/ibo", 5, starts.size(), [&]() {
+        RaycastHit3 hit{};
+        std::size_t hits = 0;
+        for(std::size_t i = 0; i < starts.size(); ++i) {
+            hits += MathUtils::Raycast(LineSegment3{starts[i], ends[i]}, bvh, vbo, ibo, hit);
+        }
+        DoNotOptimize(hits);
+    });
+    RunBenchmark("Raycast MeshBVH", 5, starts.size(), [&]() {
+        RaycastHit3 hit{};
+        std::size_t hits = 0;
+        for(std::size_t i = 0; i < starts.size(); ++i) {
+            hits += mesh.Raycast(LineSegment3{starts[i], ends[i]}, hit);
+        }
+        DoNotOptimize(hits);
+    });
+    RunBenchmark("Closest point", 5, starts.size(), [&]() {
+        Vector3 closest{};
+        std::size_t triangle = 0;
+        std::size_t found = 0;
+        for(const auto& point : starts) {
+            found += mesh.CalcClosestPoint(point, closest, triangle);
+        }
+        DoNotOptimize(found);
+    });
+    RunBenchmark("Sweep sphere (r = 0.25)", 5, starts.size(), [&]() {
+        RaycastHit3 hit{};
+        std::size_t hits = 0;
+        for(std::size_t i = 0; i < starts.size(); ++i) {
+            hits += mesh.SweepSphere(Sphere3{starts[i], 0.25f}, ends[i] - starts[i], hit);
+        }
+        DoNotOptimize(hits);
+    });
+}
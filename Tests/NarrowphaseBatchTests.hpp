@@ -0,0 +1,269 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/OBB2.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using candidate_pairs_t = std::vector<std::pair<std::size_t, std::size_t>>;
+
+//Coordinates on a coarse grid so many shapes touch exactly and the strict/non-strict comparisons matter.
+class RandomShapes {
+public:
+    explicit RandomShapes(unsigned int seed) : _rng(seed) {}
+    float Coord() { return std::uniform_int_distribution<int>(-40, 40)(_rng) * 0.25f; }
+    float Size() { return std::uniform_int_distribution<int>(0, 16)(_rng) * 0.25f; }
+    float Angle() { return std::uniform_int_distribution<int>(0, 3)(_rng) ? std::uniform_real_distribution<float>(-360.0f, 360.0f)(_rng) : std::uniform_int_distribution<int>(0, 8)(_rng) * 45.0f; }
+    Disc2 MakeDisc() { return Disc2{Coord(), Coord(), Size()}; }
+    Sphere3 MakeSphere() { return Sphere3{Vector3{Coord(), Coord(), Coord()}, Size()}; }
+    AABB2 MakeAABB2() { const Vector2 mins{Coord(), Coord()}; return AABB2{mins, mins + Vector2{Size(), Size()}}; }
+    AABB3 MakeAABB3() { const Vector3 mins{Coord(), Coord(), Coord()}; return AABB3{mins, mins + Vector3{Size(), Size(), Size()}}; }
+    OBB2 MakeOBB2() { return OBB2{Vector2{Coord(), Coord()}, Size(), Size(), Angle()}; }
+    std::mt19937& GetEngine() { return _rng; }
+
+private:
+    std::mt19937 _rng;
+};
+
+template<typename Shape, typename Make>
+std::vector<Shape> MakeShapes(std::size_t count, Make&& make) {
+    std::vector<Shape> result{};
+    result.reserve(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        result.push_back(make());
+    }
+    return result;
+}
+
+candidate_pairs_t MakeRandomPairs(std::size_t shapeCount, std::size_t count, std::mt19937& rng) {
+    std::uniform_int_distribution<std::size_t> index(0, shapeCount - 1);
+    candidate_pairs_t result{};
+    for(std::size_t i = 0; i < count; ++i) {
+        result.emplace_back(index(rng), index(rng));
+    }
+    return result;
+}
+
+//Checks both batch forms against the single-pair function for every count from 0 to 9,
+//so the four-wide loop and the scalar tail are both covered, then for a large batch.
+template<typename Shape, typename Single, typename Batch, typename BatchPairs>
+void ExpectBatchMatchesSingle(const std::vector<Shape>& shapes, std::mt19937& rng, Single&& single, Batch&& batch, BatchPairs&& batchPairs) {
+    const auto half = shapes.size() / 2;
+    const auto* a = shapes.data();
+    const auto* b = shapes.data() + half;
+    std::vector<std::uint8_t> result{};
+    for(std::size_t count = 0; count < 10; ++count) {
+        batch(a, b, count, result);
+        ASSERT_EQ(result.size(), count);
+        for(std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(result[i], single(a[i], b[i]) ? 1 : 0) << "count " << count << " index " << i;
+        }
+    }
+    batch(a, b, half, result);
+    ASSERT_EQ(result.size(), half);
+    std::size_t hits = 0;
+    for(std::size_t i = 0; i < half; ++i) {
+        const auto expected = single(a[i], b[i]);
+        hits += expected ? 1 : 0;
+        EXPECT_EQ(result[i], expected ? 1 : 0) << "index " << i;
+    }
+    EXPECT_GT(hits, 0u);
+    EXPECT_LT(hits, half);
+
+    const auto pairs = MakeRandomPairs(shapes.size(), shapes.size() + 3, rng);
+    batchPairs(shapes.data(), pairs, result);
+    ASSERT_EQ(result.size(), pairs.size());
+    for(std::size_t i = 0; i < pairs.size(); ++i) {
+        EXPECT_EQ(result[i], single(shapes[pairs[i].first], shapes[pairs[i].second]) ? 1 : 0) << "pair " << i;
+    }
+}
+
+} //End anonymous
+
+TEST(NarrowphaseBatch, DiscsMatchSingleTests) {
+    RandomShapes random{1u};
+    const auto discs = MakeShapes<Disc2>(4000, [&]() { return random.MakeDisc(); });
+    ExpectBatchMatchesSingle(discs, random.GetEngine()
+        , [](const Disc2& a, const Disc2& b) { return MathUtils::DoDiscsOverlap(a, b); }
+        , [](const Disc2* a, const Disc2* b, std::size_t count, std::vector<std::uint8_t>& result) { MathUtils::DoDiscsOverlap(a, b, count, result); }
+        , [](const Disc2* shapes, const candidate_pairs_t& pairs, std::vector<std::uint8_t>& result) { MathUtils::DoDiscsOverlap(shapes, pairs, result); });
+}
+
+TEST(NarrowphaseBatch, SpheresMatchSingleTests) {
+    RandomShapes random{2u};
+    const auto spheres = MakeShapes<Sphere3>(4000, [&]() { return random.MakeSphere(); });
+    ExpectBatchMatchesSingle(spheres, random.GetEngine()
+        , [](const Sphere3& a, const Sphere3& b) { return MathUtils::DoSpheresOverlap(a, b); }
+        , [](const Sphere3* a, const Sphere3* b, std::size_t count, std::vector<std::uint8_t>& result) { MathUtils::DoSpheresOverlap(a, b, count, result); }
+        , [](const Sphere3* shapes, const candidate_pairs_t& pairs, std::vector<std::uint8_t>& result) { MathUtils::DoSpheresOverlap(shapes, pairs, result); });
+}
+
+TEST(NarrowphaseBatch, AABB2sMatchSingleTests) {
+    RandomShapes random{3u};
+    const auto boxes = MakeShapes<AABB2>(4000, [&]() { return random.MakeAABB2(); });
+    ExpectBatchMatchesSingle(boxes, random.GetEngine()
+        , [](const AABB2& a, const AABB2& b) { return MathUtils::DoAABBsOverlap(a, b); }
+        , [](const AABB2* a, const AABB2* b, std::size_t count, std::vector<std::uint8_t>& result) { MathUtils::DoAABBsOverlap(a, b, count, result); }
+        , [](const AABB2* shapes, const candidate_pairs_t& pairs, std::vector<std::uint8_t>& result) { MathUtils::DoAABBsOverlap(shapes, pairs, result); });
+}
+
+TEST(NarrowphaseBatch, AABB3sMatchSingleTests) {
+    RandomShapes random{4u};
+    const auto boxes = MakeShapes<AABB3>(4000, [&]() { return random.MakeAABB3(); });
+    ExpectBatchMatchesSingle(boxes, random.GetEngine()
+        , [](const AABB3& a, const AABB3& b) { return MathUtils::DoAABBsOverlap(a, b); }
+        , [](const AABB3* a, const AABB3* b, std::size_t count, std::vector<std::uint8_t>& result) { MathUtils::DoAABBsOverlap(a, b, count, result); }
+        , [](const AABB3* shapes, const candidate_pairs_t& pairs, std::vector<std::uint8_t>& result) { MathUtils::DoAABBsOverlap(shapes, pairs, result); });
+}
+
+TEST(NarrowphaseBatch, OBB2sMatchSingleTests) {
+    RandomShapes random{5u};
+    const auto boxes = MakeShapes<OBB2>(4000, [&]() { return random.MakeOBB2(); });
+    ExpectBatchMatchesSingle(boxes, random.GetEngine()
+        , [](const OBB2& a, const OBB2& b) { return MathUtils::DoOBBsOverlap(a, b); }
+        , [](const OBB2* a, const OBB2* b, std::size_t count, std::vector<std::uint8_t>& result) { MathUtils::DoOBBsOverlap(a, b, count, result); }
+        , [](const OBB2* shapes, const candidate_pairs_t& pairs, std::vector<std::uint8_t>& result) { MathUtils::DoOBBsOverlap(shapes, pairs, result); });
+}
+
+TEST(NarrowphaseBatch, SoAFormsMatchSingleTests) {
+    RandomShapes random{7u};
+    const auto discs = MakeShapes<Disc2>(2000, [&]() { return random.MakeDisc(); });
+    const auto spheres = MakeShapes<Sphere3>(2000, [&]() { return random.MakeSphere(); });
+    std::vector<float> x{};
+    std::vector<float> y{};
+    std::vector<float> z{};
+    std::vector<float> radius{};
+    for(const auto& d : discs) {
+        x.push_back(d.center.x);
+        y.push_back(d.center.y);
+        radius.push_back(d.radius);
+    }
+    //First half against second half; every count up to 9 covers the tail, then the whole set.
+    const auto half = discs.size() / 2;
+    std::vector<std::uint8_t> result{};
+    for(const auto count : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{7}, std::size_t{9}, half}) {
+        MathUtils::DoDiscsOverlap(x.data(), y.data(), radius.data(), x.data() + half, y.data() + half, radius.data() + half, count, result);
+        ASSERT_EQ(result.size(), count);
+        for(std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(result[i], MathUtils::DoDiscsOverlap(discs[i], discs[half + i]) ? 1 : 0) << "disc " << i;
+        }
+    }
+    x.clear();
+    y.clear();
+    radius.clear();
+    for(const auto& sphere : spheres) {
+        x.push_back(sphere.center.x);
+        y.push_back(sphere.center.y);
+        z.push_back(sphere.center.z);
+        radius.push_back(sphere.radius);
+    }
+    for(const auto count : {std::size_t{0}, std::size_t{2}, std::size_t{4}, std::size_t{6}, half}) {
+        MathUtils::DoSpheresOverlap(x.data(), y.data(), z.data(), radius.data(), x.data() + half, y.data() + half, z.data() + half, radius.data() + half, count, result);
+        ASSERT_EQ(result.size(), count);
+        for(std::size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(result[i], MathUtils::DoSpheresOverlap(spheres[i], spheres[half + i]) ? 1 : 0) << "sphere " << i;
+        }
+    }
+}
+
+TEST(NarrowphaseBatch, OBB2sKnownCases) {
+    //Axis-aligned, touching, rotated into the gap and zero-size boxes.
+    const std::vector<OBB2> a{
+          OBB2{Vector2{0.0f, 0.0f}, 1.0f, 1.0f, 0.0f}
+        , OBB2{Vector2{0.0f, 0.0f}, 1.0f, 1.0f, 0.0f}
+        , OBB2{Vector2{0.0f, 0.0f}, 1.0f, 1.0f, 45.0f}
+        , OBB2{Vector2{0.0f, 0.0f}, 0.0f, 0.0f, 0.0f}
+        , OBB2{Vector2{0.0f, 0.0f}, 4.0f, 0.1f, 90.0f}
+    };
+    const std::vector<OBB2> b{
+          OBB2{Vector2{1.5f, 0.0f}, 1.0f, 1.0f, 0.0f}
+        , OBB2{Vector2{3.0f, 0.0f}, 1.0f, 1.0f, 0.0f}
+        , OBB2{Vector2{2.5f, 2.5f}, 1.0f, 1.0f, 45.0f}
+        , OBB2{Vector2{0.5f, 0.5f}, 1.0f, 1.0f, 30.0f}
+        , OBB2{Vector2{0.0f, 3.5f}, 0.5f, 0.5f, 0.0f}
+    };
+    std::vector<std::uint8_t> result{};
+    MathUtils::DoOBBsOverlap(a.data(), b.data(), a.size(), result);
+    ASSERT_EQ(result.size(), a.size());
+    for(std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(result[i], MathUtils::DoOBBsOverlap(a[i], b[i]) ? 1 : 0) << "case " << i;
+    }
+    EXPECT_EQ(result[0], 1);
+    EXPECT_EQ(result[1], 0);
+    EXPECT_EQ(result[4], 1);
+}
+
+TEST(NarrowphaseBatchBenchmarks, DISABLED_BatchVersusSingle) {
+    constexpr std::size_t shape_count = 20000;
+    constexpr std::size_t pair_count = 200000;
+    RandomShapes random{6u};
+    const auto discs = MakeShapes<Disc2>(shape_count, [&]() { return random.MakeDisc(); });
+    const auto spheres = MakeShapes<Sphere3>(shape_count, [&]() { return random.MakeSphere(); });
+    const auto boxes2 = MakeShapes<AABB2>(shape_count, [&]() { return random.MakeAABB2(); });
+    const auto boxes3 = MakeShapes<AABB3>(shape_count, [&]() { return random.MakeAABB3(); });
+    const auto obbs = MakeShapes<OBB2>(shape_count, [&]() { return random.MakeOBB2(); });
+    const auto pairs = MakeRandomPairs(shape_count, pair_count, random.GetEngine());
+    std::vector<std::uint8_t> result(pair_count);
+
+    const auto run = [&](const char* name, const auto& shapes, auto&& single, auto&& batch) {
+        RunBenchmark(std::string{name} + " single", 10, pair_count, [&]() {
+            for(std::size_t i = 0; i < pair_count; ++i) {
+                result[i] = single(shapes[pairs[i].first], shapes[pairs[i].second]) ? 1 : 0;
+            }
+            DoNotOptimize(result);
+        });
+        RunBenchmark(std::string{name} + " batch", 10, pair_count, [&]() {
+            batch(shapes.data(), pairs, result);
+            DoNotOptimize(result);
+        });
+    };
+    run("Disc2 pairs", discs
+        , [](const Disc2& a, const Disc2& b) { return MathUtils::DoDiscsOverlap(a, b); }
+        , [](const Disc2* s, const candidate_pairs_t& p, std::vector<std::uint8_t>& r) { MathUtils::DoDiscsOverlap(s, p, r); });
+    run("Sphere3 pairs", spheres
+        , [](const Sphere3& a, const Sphere3& b) { return MathUtils::DoSpheresOverlap(a, b); }
+        , [](const Sphere3* s, const candidate_pairs_t& p, std::vector<std::uint8_t>& r) { MathUtils::DoSpheresOverlap(s, p, r); });
+    run("AABB2 pairs", boxes2
+        , [](const AABB2& a, const AABB2& b) { return MathUtils::DoAABBsOverlap(a, b); }
+        , [](const AABB2* s, const candidate_pairs_t& p, std::vector<std::uint8_t>& r) { MathUtils::DoAABBsOverlap(s, p, r); });
+    run("AABB3 pairs", boxes3
+        , [](const AABB3& a, const AABB3& b) { return MathUtils::DoAABBsOverlap(a, b); }
+        , [](const AABB3* s, const candidate_pairs_t& p, std::vector<std::uint8_t>& r) { MathUtils::DoAABBsOverlap(s, p, r); });
+    run("OBB2 pairs", obbs
+        , [](const OBB2& a, const OBB2& b) { return MathUtils::DoOBBsOverlap(a, b); }
+        , [](const OBB2* s, const candidate_pairs_t& p, std::vector<std::uint8_t>& r) { MathUtils::DoOBBsOverlap(s, p, r); });
+
+    //Sphere centers and radii already stored as arrays, against the array-of-structures form.
+    std::vector<float> xs{};
+    std::vector<float> ys{};
+    std::vector<float> zs{};
+    std::vector<float> radii{};
+    for(const auto& sphere : spheres) {
+        xs.push_back(sphere.center.x);
+        ys.push_back(sphere.center.y);
+        zs.push_back(sphere.center.z);
+        radii.push_back(sphere.radius);
+    }
+    const auto half = shape_count / 2;
+    RunBenchmark("Sphere3 a[i]/b[i] batch", 100, half, [&]() {
+        MathUtils::DoSpheresOverlap(spheres.data(), spheres.data() + half, half, result);
+        DoNotOptimize(result);
+    });
+    RunBenchmark("Sphere3 SoA batch", 100, half, [&]() {
+        MathUtils::DoSpheresOverlap(xs.data(), ys.data(), zs.data(), radii.data(), xs.data() + half, ys.data() + half, zs.data() + half, radii.data() + half, half, result);
+        DoNotOptimize(result);
+    });
+}
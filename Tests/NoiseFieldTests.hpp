@@ -0,0 +1,208 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/Noise.hpp"
+#include "Engine/Math/NoiseField.hpp"
+#include "Engine/Math/Vector2.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+//Coordinates straddle zero so cells on both sides of the origin are hashed.
+std::vector<float> MakeNoiseCoordinates(std::size_t count, unsigned int seed) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<float> coord(-500.0f, 500.0f);
+    std::vector<float> result(count);
+    for(auto& c : result) {
+        c = coord(rng);
+    }
+    return result;
+}
+
+} //End anonymous
+
+TEST(NoiseField, BatchMatchesScalar) {
+    constexpr std::size_t count = 1031;
+    const auto xs = MakeNoiseCoordinates(count, 1u);
+    const auto ys = MakeNoiseCoordinates(count, 2u);
+    const auto zs = MakeNoiseCoordinates(count, 3u);
+    const auto ts = MakeNoiseCoordinates(count, 6u);
+    std::vector<float> out(count);
+    for(const auto octaves : {1u, 5u}) {
+        for(const auto renormalize : {true, false}) {
+            MathUtils::Compute2dFractalNoise(xs.data(), ys.data(), out.data(), count, 37.5f, octaves, 0.6f, 2.1f, renormalize, 11u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute2dFractalNoise(xs[i], ys[i], 37.5f, octaves, 0.6f, 2.1f, renormalize, 11u));
+            }
+            MathUtils::Compute2dPerlinNoise(xs.data(), ys.data(), out.data(), count, 37.5f, octaves, 0.6f, 2.1f, renormalize, 12u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute2dPerlinNoise(xs[i], ys[i], 37.5f, octaves, 0.6f, 2.1f, renormalize, 12u));
+            }
+            MathUtils::Compute3dFractalNoise(xs.data(), ys.data(), zs.data(), out.data(), count, 21.0f, octaves, 0.4f, 1.9f, renormalize, 13u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute3dFractalNoise(xs[i], ys[i], zs[i], 21.0f, octaves, 0.4f, 1.9f, renormalize, 13u));
+            }
+            MathUtils::Compute3dPerlinNoise(xs.data(), ys.data(), zs.data(), out.data(), count, 21.0f, octaves, 0.4f, 1.9f, renormalize, 14u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute3dPerlinNoise(xs[i], ys[i], zs[i], 21.0f, octaves, 0.4f, 1.9f, renormalize, 14u));
+            }
+            MathUtils::Compute2dSimplexNoise(xs.data(), ys.data(), out.data(), count, 37.5f, octaves, 0.6f, 2.1f, renormalize, 15u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute2dSimplexNoise(xs[i], ys[i], 37.5f, octaves, 0.6f, 2.1f, renormalize, 15u));
+            }
+            MathUtils::Compute3dSimplexNoise(xs.data(), ys.data(), zs.data(), out.data(), count, 21.0f, octaves, 0.4f, 1.9f, renormalize, 16u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute3dSimplexNoise(xs[i], ys[i], zs[i], 21.0f, octaves, 0.4f, 1.9f, renormalize, 16u));
+            }
+            MathUtils::Compute4dSimplexNoise(xs.data(), ys.data(), zs.data(), ts.data(), out.data(), count, 21.0f, octaves, 0.4f, 1.9f, renormalize, 17u);
+            for(std::size_t i = 0; i < count; ++i) {
+                ASSERT_EQ(out[i], MathUtils::Compute4dSimplexNoise(xs[i], ys[i], zs[i], ts[i], 21.0f, octaves, 0.4f, 1.9f, renormalize, 17u));
+            }
+        }
+    }
+}
+
+TEST(NoiseField, GridsMatchScalar) {
+    constexpr std::size_t width = 37;
+    constexpr std::size_t height = 23;
+    constexpr std::size_t depth = 5;
+    const Vector2 origin2{-12.25f, 7.5f};
+    const Vector2 spacing2{0.75f, -1.25f};
+    std::vector<float> out(width * height * depth);
+    MathUtils::Fill2dFractalNoise(out.data(), width, height, origin2, spacing2, 8.0f, 4, 0.5f, 2.0f, true, 3u);
+    for(std::size_t y = 0; y < height; ++y) {
+        for(std::size_t x = 0; x < width; ++x) {
+            const auto px = origin2.x + spacing2.x * static_cast<float>(x);
+            const auto py = origin2.y + spacing2.y * static_cast<float>(y);
+            ASSERT_EQ(out[y * width + x], MathUtils::Compute2dFractalNoise(px, py, 8.0f, 4, 0.5f, 2.0f, true, 3u));
+        }
+    }
+    MathUtils::Fill2dPerlinNoise(out.data(), width, height, origin2, spacing2, 8.0f, 4, 0.5f, 2.0f, true, 3u);
+    for(std::size_t y = 0; y < height; ++y) {
+        for(std::size_t x = 0; x < width; ++x) {
+            const auto px = origin2.x + spacing2.x * static_cast<float>(x);
+            const auto py = origin2.y + spacing2.y * static_cast<float>(y);
+            ASSERT_EQ(out[y * width + x], MathUtils::Compute2dPerlinNoise(px, py, 8.0f, 4, 0.5f, 2.0f, true, 3u));
+        }
+    }
+    MathUtils::Fill2dSimplexNoise(out.data(), width, height, origin2, spacing2, 8.0f, 4, 0.5f, 2.0f, true, 3u);
+    for(std::size_t y = 0; y < height; ++y) {
+        for(std::size_t x = 0; x < width; ++x) {
+            const auto px = origin2.x + spacing2.x * static_cast<float>(x);
+            const auto py = origin2.y + spacing2.y * static_cast<float>(y);
+            ASSERT_EQ(out[y * width + x], MathUtils::Compute2dSimplexNoise(px, py, 8.0f, 4, 0.5f, 2.0f, true, 3u));
+        }
+    }
+    const Vector3 origin3{-3.0f, 4.5f, -9.75f};
+    const Vector3 spacing3{0.5f, 0.25f, 1.5f};
+    MathUtils::Fill3dFractalNoise(out.data(), width, height, depth, origin3, spacing3, 6.0f, 3, 0.5f, 2.0f, true, 5u);
+    for(std::size_t z = 0; z < depth; ++z) {
+        for(std::size_t y = 0; y < height; ++y) {
+            for(std::size_t x = 0; x < width; ++x) {
+                const auto px = origin3.x + spacing3.x * static_cast<float>(x);
+                const auto py = origin3.y + spacing3.y * static_cast<float>(y);
+                const auto pz = origin3.z + spacing3.z * static_cast<float>(z);
+                ASSERT_EQ(out[(z * height + y) * width + x], MathUtils::Compute3dFractalNoise(px, py, pz, 6.0f, 3, 0.5f, 2.0f, true, 5u));
+            }
+        }
+    }
+    MathUtils::Fill3dPerlinNoise(out.data(), width, height, depth, origin3, spacing3, 6.0f, 3, 0.5f, 2.0f, true, 5u);
+    for(std::size_t z = 0; z < depth; ++z) {
+        for(std::size_t y = 0; y < height; ++y) {
+            for(std::size_t x = 0; x < width; ++x) {
+                const auto px = origin3.x + spacing3.x * static_cast<float>(x);
+                const auto py = origin3.y + spacing3.y * static_cast<float>(y);
+                const auto pz = origin3.z + spacing3.z * static_cast<float>(z);
+                ASSERT_EQ(out[(z * height + y) * width + x], MathUtils::Compute3dPerlinNoise(px, py, pz, 6.0f, 3, 0.5f, 2.0f, true, 5u));
+            }
+        }
+    }
+    MathUtils::Fill3dSimplexNoise(out.data(), width, height, depth, origin3, spacing3, 6.0f, 3, 0.5f, 2.0f, true, 5u);
+    for(std::size_t z = 0; z < depth; ++z) {
+        for(std::size_t y = 0; y < height; ++y) {
+            for(std::size_t x = 0; x < width; ++x) {
+                const auto px = origin3.x + spacing3.x * static_cast<float>(x);
+                const auto py = origin3.y + spacing3.y * static_cast<float>(y);
+                const auto pz = origin3.z + spacing3.z * static_cast<float>(z);
+                ASSERT_EQ(out[(z * height + y) * width + x], MathUtils::Compute3dSimplexNoise(px, py, pz, 6.0f, 3, 0.5f, 2.0f, true, 5u));
+            }
+        }
+    }
+}
+
+TEST(NoiseField, JobSystemMatchesSerial) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    constexpr std::size_t width = 300;
+    constexpr std::size_t height = 200;
+    std::vector<float> serial(width * height);
+    std::vector<float> parallel(width * height);
+    MathUtils::Fill2dPerlinNoise(serial.data(), width, height, Vector2::ZERO, Vector2::ONE, 64.0f, 6);
+    MathUtils::Fill2dPerlinNoise(parallel.data(), width, height, Vector2::ZERO, Vector2::ONE, 64.0f, 6, 0.5f, 2.0f, true, 0, &jobs);
+    EXPECT_EQ(serial, parallel);
+    const auto xs = MakeNoiseCoordinates(width * height, 4u);
+    const auto ys = MakeNoiseCoordinates(width * height, 5u);
+    MathUtils::Compute2dFractalNoise(xs.data(), ys.data(), serial.data(), xs.size(), 16.0f, 3);
+    MathUtils::Compute2dFractalNoise(xs.data(), ys.data(), parallel.data(), xs.size(), 16.0f, 3, 0.5f, 2.0f, true, 0, &jobs);
+    EXPECT_EQ(serial, parallel);
+    jobs.Shutdown();
+}
+
+TEST(NoiseFieldBenchmarks, DISABLED_FillThroughput) {
+    constexpr std::size_t width = 512;
+    constexpr std::size_t height = 512;
+    constexpr unsigned int octaves = 6;
+    std::vector<float> out(width * height);
+    RunBenchmark("Compute2dPerlinNoise per point", 5, width * height, [&]() {
+        for(std::size_t y = 0; y < height; ++y) {
+            for(std::size_t x = 0; x < width; ++x) {
+                out[y * width + x] = MathUtils::Compute2dPerlinNoise(static_cast<float>(x), static_cast<float>(y), 128.0f, octaves);
+            }
+        }
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Fill2dPerlinNoise", 5, width * height, [&]() {
+        MathUtils::Fill2dPerlinNoise(out.data(), width, height, Vector2::ZERO, Vector2::ONE, 128.0f, octaves);
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Compute2dFractalNoise per point", 5, width * height, [&]() {
+        for(std::size_t y = 0; y < height; ++y) {
+            for(std::size_t x = 0; x < width; ++x) {
+                out[y * width + x] = MathUtils::Compute2dFractalNoise(static_cast<float>(x), static_cast<float>(y), 128.0f, octaves);
+            }
+        }
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Fill2dFractalNoise", 5, width * height, [&]() {
+        MathUtils::Fill2dFractalNoise(out.data(), width, height, Vector2::ZERO, Vector2::ONE, 128.0f, octaves);
+        DoNotOptimize(out);
+    });
+    constexpr std::size_t depth = 16;
+    std::vector<float> volume(width * height * depth / 16);
+    RunBenchmark("Compute3dPerlinNoise per point", 5, volume.size(), [&]() {
+        for(std::size_t i = 0; i < volume.size(); ++i) {
+            const auto x = static_cast<float>(i % 128);
+            const auto y = static_cast<float>((i / 128) % 128);
+            const auto z = static_cast<float>(i / (128 * 128));
+            volume[i] = MathUtils::Compute3dPerlinNoise(x, y, z, 32.0f, octaves);
+        }
+        DoNotOptimize(volume);
+    });
+    RunBenchmark("Fill3dPerlinNoise", 5, volume.size(), [&]() {
+        MathUtils::Fill3dPerlinNoise(volume.data(), 128, 128, depth, Vector3::ZERO, Vector3::ONE, 32.0f, octaves);
+        DoNotOptimize(volume);
+    });
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    RunBenchmark("Fill2dPerlinNoise JobSystem", 5, width * height, [&]() {
+        MathUtils::Fill2dPerlinNoise(out.data(), width, height, Vector2::ZERO, Vector2::ONE, 128.0f, octaves, 0.5f, 2.0f, true, 0, &jobs);
+        DoNotOptimize(out);
+    });
+    jobs.Shutdown();
+}
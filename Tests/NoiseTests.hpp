@@ -0,0 +1,148 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Math/Noise.hpp"
+#include "Engine/Math/NoiseField.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+//Raw single octave samples, without renormalization.
+float RawSimplex2d(float x, float y, unsigned int seed) {
+    return MathUtils::Compute2dSimplexNoise(x, y, 1.0f, 1, 0.5f, 2.0f, false, seed);
+}
+
+float RawSimplex3d(float x, float y, float z, unsigned int seed) {
+    return MathUtils::Compute3dSimplexNoise(x, y, z, 1.0f, 1, 0.5f, 2.0f, false, seed);
+}
+
+float RawSimplex4d(float x, float y, float z, float t, unsigned int seed) {
+    return MathUtils::Compute4dSimplexNoise(x, y, z, t, 1.0f, 1, 0.5f, 2.0f, false, seed);
+}
+
+} //End anonymous
+
+TEST(Noise, SimplexIsDeterministicAndSeeded) {
+    std::mt19937 rng{1u};
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    int seed_differences = 0;
+    for(int i = 0; i < 100; ++i) {
+        const auto x = coord(rng);
+        const auto y = coord(rng);
+        const auto z = coord(rng);
+        const auto t = coord(rng);
+        EXPECT_EQ(RawSimplex2d(x, y, 7u), RawSimplex2d(x, y, 7u));
+        EXPECT_EQ(RawSimplex3d(x, y, z, 7u), RawSimplex3d(x, y, z, 7u));
+        EXPECT_EQ(RawSimplex4d(x, y, z, t, 7u), RawSimplex4d(x, y, z, t, 7u));
+        seed_differences += RawSimplex2d(x, y, 7u) != RawSimplex2d(x, y, 8u);
+        seed_differences += RawSimplex3d(x, y, z, 7u) != RawSimplex3d(x, y, z, 8u);
+        seed_differences += RawSimplex4d(x, y, z, t, 7u) != RawSimplex4d(x, y, z, t, 8u);
+    }
+    EXPECT_GT(seed_differences, 270);
+}
+
+TEST(Noise, SimplexVanishesAtLatticePoints) {
+    //Simplex lattice points are integer points moved back out of skewed space.
+    constexpr float unskew2 = 0.211324865405187118f;
+    constexpr float unskew3 = 1.0f / 6.0f;
+    constexpr float unskew4 = 0.138196601125010515f;
+    for(int i = -3; i <= 3; ++i) {
+        for(int j = -3; j <= 3; ++j) {
+            const auto x = static_cast<float>(i);
+            const auto y = static_cast<float>(j);
+            const auto z = static_cast<float>(i + j);
+            const auto t = static_cast<float>(i - 2 * j);
+            const auto s2 = (x + y) * unskew2;
+            const auto s3 = (x + y + z) * unskew3;
+            const auto s4 = (x + y + z + t) * unskew4;
+            EXPECT_NEAR(RawSimplex2d(x - s2, y - s2, 0u), 0.0f, 1e-4f);
+            EXPECT_NEAR(RawSimplex3d(x - s3, y - s3, z - s3, 0u), 0.0f, 1e-4f);
+            EXPECT_NEAR(RawSimplex4d(x - s4, y - s4, z - s4, t - s4, 0u), 0.0f, 1e-4f);
+        }
+    }
+}
+
+TEST(Noise, SimplexIsContinuousAndInRange) {
+    std::mt19937 rng{2u};
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    constexpr float step = 1e-3f;
+    float max_step_change = 0.0f;
+    float max_value = 0.0f;
+    float max_octaves = 0.0f;
+    for(int i = 0; i < 20000; ++i) {
+        const auto x = coord(rng);
+        const auto y = coord(rng);
+        const auto z = coord(rng);
+        const auto t = coord(rng);
+        const auto n2 = RawSimplex2d(x, y, 3u);
+        const auto n3 = RawSimplex3d(x, y, z, 3u);
+        const auto n4 = RawSimplex4d(x, y, z, t, 3u);
+        max_step_change = (std::max)(max_step_change, std::abs(RawSimplex2d(x + step, y + step, 3u) - n2));
+        max_step_change = (std::max)(max_step_change, std::abs(RawSimplex3d(x + step, y + step, z + step, 3u) - n3));
+        max_step_change = (std::max)(max_step_change, std::abs(RawSimplex4d(x + step, y + step, z + step, t + step, 3u) - n4));
+        max_value = (std::max)({max_value, std::abs(n2), std::abs(n3), std::abs(n4)});
+        max_octaves = (std::max)(max_octaves, std::abs(MathUtils::Compute3dSimplexNoise(x, y, z, 10.0f, 6)));
+    }
+    EXPECT_LT(max_step_change, 0.02f);
+    EXPECT_LT(max_value, 1.1f);
+    EXPECT_GT(max_value, 0.8f);
+    EXPECT_LE(max_octaves, 1.0f);
+}
+
+TEST(NoiseBenchmarks, DISABLED_SimplexVersusPerlin) {
+    constexpr std::size_t count = 1 << 16;
+    constexpr unsigned int octaves = 4;
+    std::mt19937 rng{4u};
+    std::uniform_real_distribution<float> coord(-1000.0f, 1000.0f);
+    std::vector<float> xs(count);
+    std::vector<float> ys(count);
+    std::vector<float> zs(count);
+    std::vector<float> ts(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        xs[i] = coord(rng);
+        ys[i] = coord(rng);
+        zs[i] = coord(rng);
+        ts[i] = coord(rng);
+    }
+    std::vector<float> out(count);
+    const auto run_scalar = [&](const char* name, auto fn) {
+        RunBenchmark(name, 5, count, [&]() {
+            for(std::size_t i = 0; i < count; ++i) {
+                out[i] = fn(i);
+            }
+            DoNotOptimize(out);
+        });
+    };
+    run_scalar("Compute2dPerlinNoise", [&](std::size_t i) { return MathUtils::Compute2dPerlinNoise(xs[i], ys[i], 32.0f, octaves); });
+    run_scalar("Compute2dSimplexNoise", [&](std::size_t i) { return MathUtils::Compute2dSimplexNoise(xs[i], ys[i], 32.0f, octaves); });
+    run_scalar("Compute3dPerlinNoise", [&](std::size_t i) { return MathUtils::Compute3dPerlinNoise(xs[i], ys[i], zs[i], 32.0f, octaves); });
+    run_scalar("Compute3dSimplexNoise", [&](std::size_t i) { return MathUtils::Compute3dSimplexNoise(xs[i], ys[i], zs[i], 32.0f, octaves); });
+    run_scalar("Compute4dPerlinNoise", [&](std::size_t i) { return MathUtils::Compute4dPerlinNoise(xs[i], ys[i], zs[i], ts[i], 32.0f, octaves); });
+    run_scalar("Compute4dSimplexNoise", [&](std::size_t i) { return MathUtils::Compute4dSimplexNoise(xs[i], ys[i], zs[i], ts[i], 32.0f, octaves); });
+    RunBenchmark("Compute2dPerlinNoise batch", 5, count, [&]() {
+        MathUtils::Compute2dPerlinNoise(xs.data(), ys.data(), out.data(), count, 32.0f, octaves);
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Compute2dSimplexNoise batch", 5, count, [&]() {
+        MathUtils::Compute2dSimplexNoise(xs.data(), ys.data(), out.data(), count, 32.0f, octaves);
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Compute3dPerlinNoise batch", 5, count, [&]() {
+        MathUtils::Compute3dPerlinNoise(xs.data(), ys.data(), zs.data(), out.data(), count, 32.0f, octaves);
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Compute3dSimplexNoise batch", 5, count, [&]() {
+        MathUtils::Compute3dSimplexNoise(xs.data(), ys.data(), zs.data(), out.data(), count, 32.0f, octaves);
+        DoNotOptimize(out);
+    });
+    RunBenchmark("Compute4dSimplexNoise batch", 5, count, [&]() {
+        MathUtils::Compute4dSimplexNoise(xs.data(), ys.data(), zs.data(), ts.data(), out.data(), count, 32.0f, octaves);
+        DoNotOptimize(out);
+    });
+}
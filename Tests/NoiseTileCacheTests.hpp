@@ -0,0 +1,166 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Noise.hpp"
+#include "Engine/Math/NoiseTileCache.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+NoiseTileCache::noise_settings_t MakeTerrainSettings(unsigned int seed) {
+    NoiseTileCache::noise_settings_t settings{};
+    settings.type = NoiseTileCache::NoiseType::Perlin;
+    settings.scale = 40.0f;
+    settings.numOctaves = 3;
+    settings.seed = seed;
+    return settings;
+}
+
+float ComputeDirect(const NoiseTileCache::noise_settings_t& s, const Vector2& p) {
+    if(s.type == NoiseTileCache::NoiseType::Simplex) {
+        return MathUtils::Compute2dSimplexNoise(p.x, p.y, s.scale, s.numOctaves, s.octavePersistence, s.octaveScale, s.renormalize, s.seed);
+    }
+    return MathUtils::Compute2dPerlinNoise(p.x, p.y, s.scale, s.numOctaves, s.octavePersistence, s.octaveScale, s.renormalize, s.seed);
+}
+
+} //End anonymous
+
+TEST(NoiseTileCache, MatchesNoiseAtSamplesAndInterpolatesBetween) {
+    //64 unit tiles with 65 samples per edge put a sample on every integer coordinate.
+    NoiseTileCache cache{64.0f, 65, 1 << 20};
+    const auto settings = MakeTerrainSettings(7u);
+    for(int y = -70; y <= 70; y += 7) {
+        for(int x = -70; x <= 70; x += 5) {
+            const Vector2 p{static_cast<float>(x), static_cast<float>(y)};
+            EXPECT_NEAR(cache.Sample(settings, p), ComputeDirect(settings, p), 1e-5f);
+        }
+    }
+    //Between samples the error is bilinear. Checked on simplex noise, which is continuous;
+    //Perlin and fractal noise step across their lattice lines.
+    auto smooth = settings;
+    smooth.type = NoiseTileCache::NoiseType::Simplex;
+    std::mt19937 rng{1u};
+    std::uniform_real_distribution<float> coord(-100.0f, 100.0f);
+    float max_error = 0.0f;
+    for(int i = 0; i < 2000; ++i) {
+        const Vector2 p{coord(rng), coord(rng)};
+        max_error = (std::max)(max_error, std::abs(cache.Sample(smooth, p) - ComputeDirect(smooth, p)));
+    }
+    EXPECT_LT(max_error, 0.03f);
+}
+
+TEST(NoiseTileCache, TracksHitsAndEvictsLeastRecentlyUsed) {
+    NoiseTileCache cache{16.0f, 17, 4 * 17 * 17 * sizeof(float)};
+    ASSERT_EQ(cache.GetTileCapacity(), 4u);
+    const auto settings = MakeTerrainSettings(1u);
+    for(int i = 0; i < 100; ++i) {
+        cache.Sample(settings, Vector2{1.0f + i * 0.1f, 2.0f});
+    }
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.lookups, 100u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 99u);
+    EXPECT_EQ(stats.tiles_computed, 1u);
+    EXPECT_FLOAT_EQ(stats.GetHitRate(), 0.99f);
+
+    //Touch five tiles; the first one in is the least recently used and goes.
+    for(int tile = 1; tile <= 4; ++tile) {
+        cache.Sample(settings, Vector2{tile * 16.0f + 1.0f, 2.0f});
+    }
+    stats = cache.GetStats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.resident_tiles, 4u);
+    EXPECT_EQ(stats.resident_bytes, 4u * cache.GetTileBytes());
+    EXPECT_FALSE(cache.IsResident(settings, Vector2{1.0f, 2.0f}));
+    EXPECT_TRUE(cache.IsResident(settings, Vector2{17.0f, 2.0f}));
+    EXPECT_EQ(stats.hits + stats.misses, stats.lookups);
+    EXPECT_GT(stats.max_miss_latency.count(), 0.0f);
+
+    cache.ResetStats();
+    EXPECT_EQ(cache.GetStats().lookups, 0u);
+    cache.Clear();
+    EXPECT_EQ(cache.GetStats().resident_tiles, 0u);
+}
+
+TEST(NoiseTileCache, KeysTilesBySettings) {
+    NoiseTileCache cache{32.0f, 33, 1 << 20};
+    auto a = MakeTerrainSettings(1u);
+    auto b = MakeTerrainSettings(2u);
+    auto c = a;
+    c.type = NoiseTileCache::NoiseType::Simplex;
+    const Vector2 p{3.5f, 4.25f};
+    const auto va = cache.Sample(a, p);
+    const auto vb = cache.Sample(b, p);
+    const auto vc = cache.Sample(c, p);
+    EXPECT_NE(va, vb);
+    EXPECT_NE(va, vc);
+    EXPECT_EQ(cache.GetStats().resident_tiles, 3u);
+    EXPECT_EQ(cache.Sample(a, p), va);
+}
+
+TEST(NoiseTileCache, PrefetchOnJobSystemMatchesOnDemand) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    NoiseTileCache prefetched{32.0f, 33, 1 << 20, &jobs};
+    NoiseTileCache on_demand{32.0f, 33, 1 << 20};
+    const auto settings = MakeTerrainSettings(3u);
+    const AABB2 region{Vector2{-40.0f, -40.0f}, Vector2{40.0f, 40.0f}};
+    prefetched.Prefetch(settings, region);
+    EXPECT_EQ(prefetched.GetStats().tiles_requested, 16u);
+    for(float y = -40.0f; y <= 40.0f; y += 3.3f) {
+        for(float x = -40.0f; x <= 40.0f; x += 2.9f) {
+            EXPECT_EQ(prefetched.Sample(settings, Vector2{x, y}), on_demand.Sample(settings, Vector2{x, y}));
+        }
+    }
+    EXPECT_EQ(prefetched.GetStats().tiles_requested, 16u);
+    EXPECT_EQ(prefetched.GetStats().tiles_computed, 16u);
+    NoiseTileCache serial{32.0f, 33, 1 << 20};
+    serial.Prefetch(settings, region);
+    EXPECT_EQ(serial.GetStats().tiles_computed, 16u);
+    EXPECT_TRUE(serial.IsResident(settings, Vector2{-40.0f, 39.0f}));
+    jobs.Shutdown();
+}
+
+TEST(NoiseTileCacheBenchmarks, DISABLED_ScrollingWindow) {
+    //A 128x128 sample window scrolls one unit per frame, as a streaming terrain would.
+    constexpr int window = 128;
+    constexpr int frames = 64;
+    const auto settings = MakeTerrainSettings(4u);
+    std::vector<float> out(window * window);
+    RunBenchmark("Compute2dPerlinNoise per sample", 1, window * window * frames, [&]() {
+        for(int frame = 0; frame < frames; ++frame) {
+            for(int y = 0; y < window; ++y) {
+                for(int x = 0; x < window; ++x) {
+                    out[y * window + x] = ComputeDirect(settings, Vector2{static_cast<float>(x + frame), static_cast<float>(y)});
+                }
+            }
+        }
+        DoNotOptimize(out);
+    });
+    NoiseTileCache cache{64.0f, 65, 16 << 20};
+    RunBenchmark("NoiseTileCache::Sample", 1, window * window * frames, [&]() {
+        for(int frame = 0; frame < frames; ++frame) {
+            for(int y = 0; y < window; ++y) {
+                for(int x = 0; x < window; ++x) {
+                    out[y * window + x] = cache.Sample(settings, Vector2{static_cast<float>(x + frame), static_cast<float>(y)});
+                }
+            }
+        }
+        DoNotOptimize(out);
+    });
+    const auto stats = cache.GetStats();
+    std::cout << "[ BENCHMARK] hit rate " << stats.GetHitRate()
+              << ", tiles computed " << stats.tiles_computed
+              << ", mean miss latency " << (stats.misses ? stats.total_miss_latency.count() / stats.misses : 0.0f) << " us"
+              << ", max miss latency " << stats.max_miss_latency.count() << " us\n";
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/PointSampling.hpp"
+#include "Engine/Math/Random.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace {
+
+template<typename VectorType>
+float MinPairDistance(const std::vector<VectorType>& points) {
+    float result = (std::numeric_limits<float>::max)();
+    for(std::size_t i = 0; i < points.size(); ++i) {
+        for(std::size_t j = i + 1; j < points.size(); ++j) {
+            result = (std::min)(result, MathUtils::CalcDistance(points[i], points[j]));
+        }
+    }
+    return result;
+}
+
+//What game code does without a sampler: keep uniform points that are far enough from every kept point.
+std::vector<Vector2> NaiveRejectionPoints(const AABB2& bounds, float minDistance, std::size_t attempts, unsigned int seed) {
+    RandomStream rng{seed};
+    std::vector<Vector2> result{};
+    for(std::size_t i = 0; i < attempts; ++i) {
+        const Vector2 candidate{rng.GetFloatInRange(bounds.mins.x, bounds.maxs.x), rng.GetFloatInRange(bounds.mins.y, bounds.maxs.y)};
+        const auto fits = std::none_of(result.begin(), result.end(), [&](const Vector2& p) { return MathUtils::CalcDistance(p, candidate) < minDistance; });
+        if(fits) {
+            result.push_back(candidate);
+        }
+    }
+    return result;
+}
+
+} //End anonymous
+
+TEST(PointSampling, PoissonDiscInAABB2KeepsSpacingAndFillsRegion) {
+    const AABB2 bounds{Vector2{-20.0f, -10.0f}, Vector2{20.0f, 10.0f}};
+    const auto points = MathUtils::GeneratePoissonDiscPoints(bounds, 1.0f, 3u);
+    EXPECT_GE(MinPairDistance(points), 1.0f);
+    EXPECT_TRUE(std::all_of(points.begin(), points.end(), [&](const Vector2& p) { return MathUtils::IsPointInside(bounds, p); }));
+    //Maximal Poisson-disc sets reach roughly 0.7 points per minDistance^2.
+    EXPECT_GT(points.size(), 440u);
+    //Nowhere in the region is left an empty gap of two spacings.
+    RandomStream probe{4u};
+    for(int i = 0; i < 500; ++i) {
+        const Vector2 p{probe.GetFloatInRange(-20.0f, 20.0f), probe.GetFloatInRange(-10.0f, 10.0f)};
+        const auto nearest = std::min_element(points.begin(), points.end(), [&](const Vector2& a, const Vector2& b) {
+            return MathUtils::CalcDistanceSquared(a, p) < MathUtils::CalcDistanceSquared(b, p);
+        });
+        EXPECT_LT(MathUtils::CalcDistance(*nearest, p), 2.0f);
+    }
+    EXPECT_EQ(points, MathUtils::GeneratePoissonDiscPoints(bounds, 1.0f, 3u));
+    EXPECT_NE(points, MathUtils::GeneratePoissonDiscPoints(bounds, 1.0f, 4u));
+}
+
+TEST(PointSampling, PoissonDiscInDisc2StaysInside) {
+    const Disc2 disc{Vector2{5.0f, -3.0f}, 12.0f};
+    const auto points = MathUtils::GeneratePoissonDiscPoints(disc, 1.5f, 1u);
+    EXPECT_GE(MinPairDistance(points), 1.5f);
+    EXPECT_TRUE(std::all_of(points.begin(), points.end(), [&](const Vector2& p) { return MathUtils::CalcDistance(p, disc.center) <= disc.radius + 1e-4f; }));
+    EXPECT_GT(points.size(), static_cast<std::size_t>(MathUtils::M_PI * 12.0f * 12.0f / (1.5f * 1.5f) * 0.55f));
+}
+
+TEST(PointSampling, PoissonDiscInAABB3KeepsSpacing) {
+    const AABB3 bounds{Vector3{0.0f, 0.0f, 0.0f}, Vector3{8.0f, 6.0f, 4.0f}};
+    const auto points = MathUtils::GeneratePoissonDiscPoints(bounds, 1.0f, 2u);
+    EXPECT_GE(MinPairDistance(points), 1.0f);
+    EXPECT_TRUE(std::all_of(points.begin(), points.end(), [&](const Vector3& p) { return MathUtils::IsPointInside(bounds, p); }));
+    EXPECT_GT(points.size(), 100u);
+}
+
+TEST(PointSampling, DegenerateInputsGiveNoPoints) {
+    EXPECT_TRUE(MathUtils::GeneratePoissonDiscPoints(AABB2{Vector2::ZERO, Vector2::ZERO}, 1.0f).empty());
+    EXPECT_TRUE(MathUtils::GeneratePoissonDiscPoints(AABB2{Vector2::ZERO, Vector2::ONE}, 0.0f).empty());
+    EXPECT_EQ(MathUtils::GeneratePoissonDiscPoints(AABB2{Vector2::ZERO, Vector2::ONE}, 5.0f).size(), 1u);
+}
+
+TEST(PointSampling, BlueNoiseTileKeepsSpacingAcrossCopies) {
+    const auto tile = MathUtils::GenerateBlueNoiseTile(0.05f, 9u);
+    ASSERT_GT(tile.size(), 200u);
+    EXPECT_TRUE(std::all_of(tile.begin(), tile.end(), [](const Vector2& p) { return 0.0f <= p.x && p.x < 1.0f && 0.0f <= p.y && p.y < 1.0f; }));
+    std::vector<Vector2> scattered{};
+    const AABB2 region{Vector2{-35.0f, -15.0f}, Vector2{45.0f, 25.0f}};
+    MathUtils::TileBlueNoisePoints(tile, 40.0f, region, scattered);
+    EXPECT_TRUE(std::all_of(scattered.begin(), scattered.end(), [&](const Vector2& p) { return MathUtils::IsPointInside(region, p); }));
+    //Copies meet without points closer than the scaled spacing.
+    EXPECT_GE(MinPairDistance(scattered), 0.05f * 40.0f * 0.999f);
+    EXPECT_GT(scattered.size(), tile.size() * 1.8f);
+}
+
+TEST(PointSamplingBenchmarks, DISABLED_PoissonDiscVersusRejection) {
+    const AABB2 bounds{Vector2{0.0f, 0.0f}, Vector2{60.0f, 60.0f}};
+    std::vector<Vector2> points{};
+    RunBenchmark("GeneratePoissonDiscPoints AABB2", 5, 1, [&]() {
+        points = MathUtils::GeneratePoissonDiscPoints(bounds, 1.0f, 1u);
+        DoNotOptimize(points);
+    });
+    std::cout << "[ BENCHMARK] Poisson-disc points " << points.size() << "\n";
+    std::vector<Vector2> naive{};
+    RunBenchmark("Naive rejection AABB2", 1, 1, [&]() {
+        naive = NaiveRejectionPoints(bounds, 1.0f, points.size() * 10, 1u);
+        DoNotOptimize(naive);
+    });
+    std::cout << "[ BENCHMARK] Naive rejection points " << naive.size() << "\n";
+    const auto tile = MathUtils::GenerateBlueNoiseTile(1.0f / 60.0f, 1u);
+    RunBenchmark("TileBlueNoisePoints", 5, 1, [&]() {
+        points.clear();
+        MathUtils::TileBlueNoisePoints(tile, 60.0f, AABB2{Vector2{-30.0f, -30.0f}, Vector2{30.0f, 30.0f}}, points);
+        DoNotOptimize(points);
+    });
+    std::cout << "[ BENCHMARK] Blue-noise tile points " << points.size() << "\n";
+    std::vector<Vector3> points3{};
+    RunBenchmark("GeneratePoissonDiscPoints AABB3", 5, 1, [&]() {
+        points3 = MathUtils::GeneratePoissonDiscPoints(AABB3{Vector3::ZERO, Vector3{20.0f, 20.0f, 20.0f}}, 1.0f, 1u);
+        DoNotOptimize(points3);
+    });
+    std::cout << "[ BENCHMARK] Poisson-disc 3D points " << points3.size() << "\n";
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/PoseSoA.hpp"
+#include "Engine/Math/Quaternion.hpp"
+#include "Engine/Math/QuaternionSoA.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+//Random unit quaternions; every fourth one is close to its neighbour so the near-parallel path is covered.
+std::vector<Quaternion> MakeRandomRotations(std::size_t count, unsigned int seed) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+    std::vector<Quaternion> result{};
+    result.reserve(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        result.push_back(Quaternion::CreateFromEulerAnglesDegrees(angle(rng), angle(rng), angle(rng)).GetNormalize());
+    }
+    return result;
+}
+
+std::vector<Quaternion> MakeTargets(const std::vector<Quaternion>& starts, unsigned int seed) {
+    auto result = MakeRandomRotations(starts.size(), seed);
+    for(std::size_t i = 0; i < result.size(); i += 4) {
+        result[i] = (starts[i] * Quaternion::CreateFromAxisAngle(Vector3::X_AXIS, 0.1f)).GetNormalize();
+    }
+    return result;
+}
+
+//Quaternions q and -q are the same rotation.
+float MaxComponentError(const Quaternion& a, const Quaternion& b) {
+    const auto sign = MathUtils::DotProduct(a, b) < 0.0f ? -1.0f : 1.0f;
+    float error = std::abs(a.w - sign * b.w);
+    error = (std::max)(error, std::abs(a.axis.x - sign * b.axis.x));
+    error = (std::max)(error, std::abs(a.axis.y - sign * b.axis.y));
+    return (std::max)(error, std::abs(a.axis.z - sign * b.axis.z));
+}
+
+Quaternion ReferenceNlerp(const Quaternion& a, const Quaternion& b, float t) {
+    const auto end = MathUtils::DotProduct(a, b) < 0.0f ? Quaternion(-b.w, -b.axis) : b;
+    return MathUtils::Interpolate(a, end, t);
+}
+
+} //End anonymous
+
+TEST(QuaternionSoA, RoundTripsThroughQuaternions) {
+    const auto rotations = MakeRandomRotations(13, 1u);
+    const QuaternionSoA soa{rotations};
+    ASSERT_EQ(soa.size(), rotations.size());
+    const auto back = soa.ToQuaternions();
+    for(std::size_t i = 0; i < rotations.size(); ++i) {
+        EXPECT_EQ(back[i], rotations[i]);
+        EXPECT_EQ(soa.Get(i), rotations[i]);
+    }
+    QuaternionSoA identities{3};
+    EXPECT_EQ(identities.Get(2), Quaternion::GetIdentity());
+}
+
+TEST(QuaternionSoA, SlerpMatchesReference) {
+    const auto starts = MakeRandomRotations(1027, 2u);
+    const auto ends = MakeTargets(starts, 3u);
+    const QuaternionSoA a{starts};
+    const QuaternionSoA b{ends};
+    QuaternionSoA slerp{};
+    QuaternionSoA fast{};
+    QuaternionSoA nlerp{};
+    float slerp_error = 0.0f;
+    float fast_error = 0.0f;
+    float nlerp_error = 0.0f;
+    for(const auto t : {0.0f, 0.1f, 0.25f, 0.5f, 0.8f, 1.0f}) {
+        QuaternionSoA::Slerp(a, b, t, slerp);
+        QuaternionSoA::SlerpFast(a, b, t, fast);
+        QuaternionSoA::Nlerp(a, b, t, nlerp);
+        for(std::size_t i = 0; i < starts.size(); ++i) {
+            const auto expected = MathUtils::SLERP(starts[i], ends[i], t);
+            slerp_error = (std::max)(slerp_error, MaxComponentError(slerp.Get(i), expected));
+            fast_error = (std::max)(fast_error, MaxComponentError(fast.Get(i), expected));
+            nlerp_error = (std::max)(nlerp_error, MaxComponentError(nlerp.Get(i), ReferenceNlerp(starts[i], ends[i], t)));
+        }
+    }
+    EXPECT_LT(slerp_error, 1e-6f);
+    EXPECT_LT(fast_error, 2e-3f);
+    EXPECT_LT(nlerp_error, 1e-6f);
+}
+
+TEST(QuaternionSoA, BlendsOnJobSystemMatchSerial) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    const auto starts = MakeRandomRotations(20001, 4u);
+    const QuaternionSoA a{starts};
+    const QuaternionSoA b{MakeTargets(starts, 5u)};
+    QuaternionSoA serial{};
+    QuaternionSoA parallel{};
+    QuaternionSoA::Slerp(a, b, 0.3f, serial);
+    QuaternionSoA::Slerp(a, b, 0.3f, parallel, &jobs);
+    EXPECT_EQ(serial.ToQuaternions(), parallel.ToQuaternions());
+    QuaternionSoA::Nlerp(a, b, 0.3f, serial);
+    QuaternionSoA::Nlerp(a, b, 0.3f, parallel, &jobs);
+    EXPECT_EQ(serial.ToQuaternions(), parallel.ToQuaternions());
+    jobs.Shutdown();
+}
+
+//Ranges past the end of the operands or result stop at GUARANTEE_OR_DIE, which puts up a modal
+//dialog and so is not death-tested; this covers a valid range touching only its own elements.
+TEST(QuaternionSoA, RangedBlendWritesOnlyItsRange) {
+    const auto starts = MakeRandomRotations(13, 8u);
+    const QuaternionSoA a{starts};
+    const QuaternionSoA b{MakeTargets(starts, 9u)};
+    QuaternionSoA full{};
+    QuaternionSoA::SlerpFast(a, b, 0.6f, full);
+    QuaternionSoA ranged(a.size());
+    QuaternionSoA::SlerpFast(a, b, 0.6f, ranged, 3, a.size());
+    for(std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(ranged.Get(i), i < 3 ? Quaternion::GetIdentity() : full.Get(i));
+    }
+}
+
+TEST(PoseSoA, BlendMatchesPerBoneBlend) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    constexpr std::size_t bone_count = 3001;
+    std::mt19937 rng{6u};
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+    const auto rotations_a = MakeRandomRotations(bone_count, 7u);
+    const auto rotations_b = MakeTargets(rotations_a, 8u);
+    PoseSoA a{bone_count};
+    PoseSoA b{bone_count};
+    for(std::size_t i = 0; i < bone_count; ++i) {
+        a.SetBone(i, Vector3{coord(rng), coord(rng), coord(rng)}, rotations_a[i], Vector3{scale(rng), scale(rng), scale(rng)});
+        b.SetBone(i, Vector3{coord(rng), coord(rng), coord(rng)}, rotations_b[i], Vector3{scale(rng), scale(rng), scale(rng)});
+    }
+    PoseSoA serial{};
+    PoseSoA parallel{};
+    PoseSoA::Blend(a, b, 0.75f, serial);
+    PoseSoA::Blend(a, b, 0.75f, parallel, &jobs);
+    ASSERT_EQ(serial.size(), bone_count);
+    for(std::size_t i = 0; i < bone_count; ++i) {
+        const auto translation = MathUtils::Interpolate(a.GetTranslation(i), b.GetTranslation(i), 0.75f);
+        const auto scale_expected = MathUtils::Interpolate(a.GetScale(i), b.GetScale(i), 0.75f);
+        EXPECT_TRUE(MathUtils::IsEquivalent(serial.GetTranslation(i), translation, 1e-5f));
+        EXPECT_TRUE(MathUtils::IsEquivalent(serial.GetScale(i), scale_expected, 1e-5f));
+        EXPECT_LT(MaxComponentError(serial.GetRotation(i), ReferenceNlerp(rotations_a[i], rotations_b[i], 0.75f)), 1e-6f);
+        EXPECT_EQ(serial.GetTranslation(i), parallel.GetTranslation(i));
+        EXPECT_EQ(serial.GetRotation(i), parallel.GetRotation(i));
+        EXPECT_EQ(serial.GetScale(i), parallel.GetScale(i));
+    }
+    PoseSoA identity{2};
+    EXPECT_EQ(identity.GetScale(1), Vector3::ONE);
+    EXPECT_EQ(identity.GetRotation(1), Quaternion::GetIdentity());
+    jobs.Shutdown();
+}
+
+TEST(QuaternionSoABenchmarks, DISABLED_BlendThroughput) {
+    constexpr std::size_t count = 1 << 18;
+    const auto starts = MakeRandomRotations(count, 9u);
+    const auto ends = MakeTargets(starts, 10u);
+    const QuaternionSoA a{starts};
+    const QuaternionSoA b{ends};
+    QuaternionSoA result{};
+    std::vector<Quaternion> scalar(count);
+    RunBenchmark("MathUtils::SLERP", 10, count, [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            scalar[i] = MathUtils::SLERP(starts[i], ends[i], 0.3f);
+        }
+        DoNotOptimize(scalar);
+    });
+    RunBenchmark("QuaternionSoA::Slerp", 10, count, [&]() {
+        QuaternionSoA::Slerp(a, b, 0.3f, result);
+        DoNotOptimize(result);
+    });
+    RunBenchmark("QuaternionSoA::SlerpFast", 10, count, [&]() {
+        QuaternionSoA::SlerpFast(a, b, 0.3f, result);
+        DoNotOptimize(result);
+    });
+    RunBenchmark("QuaternionSoA::Nlerp", 10, count, [&]() {
+        QuaternionSoA::Nlerp(a, b, 0.3f, result);
+        DoNotOptimize(result);
+    });
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    RunBenchmark("QuaternionSoA::Slerp JobSystem", 10, count, [&]() {
+        QuaternionSoA::Slerp(a, b, 0.3f, result, &jobs);
+        DoNotOptimize(result);
+    });
+    PoseSoA pose_a{count};
+    PoseSoA pose_b{count};
+    pose_a.GetRotations() = a;
+    pose_b.GetRotations() = b;
+    PoseSoA pose{};
+    RunBenchmark("PoseSoA::Blend bones", 10, count, [&]() {
+        PoseSoA::Blend(pose_a, pose_b, 0.3f, pose);
+        DoNotOptimize(pose);
+    });
+    RunBenchmark("PoseSoA::Blend bones JobSystem", 10, count, [&]() {
+        PoseSoA::Blend(pose_a, pose_b, 0.3f, pose, &jobs);
+        DoNotOptimize(pose);
+    });
+    jobs.Shutdown();
+}
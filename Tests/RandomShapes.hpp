@@ -0,0 +1,92 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/Vector3.hpp"
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+//Seeded shape generators shared by the spatial structure tests and benchmarks.
+//The same seed always gives the same shapes, so a failing case can be replayed.
+
+class RandomShapeSource {
+public:
+    explicit RandomShapeSource(unsigned int seed)
+        : _rng(seed)
+    {
+        /* DO NOTHING */
+    }
+
+    float GetFloatInRange(float minInclusive, float maxExclusive) {
+        return std::uniform_real_distribution<float>(minInclusive, maxExclusive)(_rng);
+    }
+
+    int GetIntInRange(int minInclusive, int maxInclusive) {
+        return std::uniform_int_distribution<int>(minInclusive, maxInclusive)(_rng);
+    }
+
+    //Uniform in the cube [-halfExtent, halfExtent) on each axis.
+    Vector3 GetPointInCube(float halfExtent) {
+        std::uniform_real_distribution<float> coord(-halfExtent, halfExtent);
+        const auto x = coord(_rng);
+        const auto y = coord(_rng);
+        const auto z = coord(_rng);
+        return Vector3{x, y, z};
+    }
+
+    //Uniform in the ball by rejection from its bounding cube.
+    Vector3 GetPointInBall(float radius) {
+        for(;;) {
+            const auto p = GetPointInCube(radius);
+            if(p.CalcLengthSquared() <= radius * radius) {
+                return p;
+            }
+        }
+    }
+
+private:
+    std::mt19937 _rng;
+};
+
+//Calls makeShape(source, index) count times with one generator seeded by seed.
+template<typename T, typename F>
+std::vector<T> MakeRandomShapes(std::size_t count, unsigned int seed, F&& makeShape) {
+    RandomShapeSource source{seed};
+    std::vector<T> result{};
+    result.reserve(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        result.push_back(makeShape(source, i));
+    }
+    return result;
+}
+
+inline std::vector<Vector3> MakeRandomPoints(std::size_t count, unsigned int seed, float halfExtent) {
+    return MakeRandomShapes<Vector3>(count, seed, [=](RandomShapeSource& source, std::size_t) { return source.GetPointInCube(halfExtent); });
+}
+
+inline std::vector<Vector3> MakeRandomBallPoints(std::size_t count, unsigned int seed, float radius) {
+    return MakeRandomShapes<Vector3>(count, seed, [=](RandomShapeSource& source, std::size_t) { return source.GetPointInBall(radius); });
+}
+
+//Boxes with their mins inside the cube of halfExtent and each side in [minSize, maxSize).
+inline std::vector<AABB3> MakeRandomBoxes(std::size_t count, unsigned int seed, float halfExtent, float minSize, float maxSize) {
+    return MakeRandomShapes<AABB3>(count, seed, [=](RandomShapeSource& source, std::size_t) {
+        const auto mins = source.GetPointInCube(halfExtent);
+        const auto x = source.GetFloatInRange(minSize, maxSize);
+        const auto y = source.GetFloatInRange(minSize, maxSize);
+        const auto z = source.GetFloatInRange(minSize, maxSize);
+        return AABB3{mins, mins + Vector3{x, y, z}};
+    });
+}
+
+inline std::vector<LineSegment3> MakeRandomSegments(std::size_t count, unsigned int seed, float halfExtent) {
+    return MakeRandomShapes<LineSegment3>(count, seed, [=](RandomShapeSource& source, std::size_t) {
+        const auto start = source.GetPointInCube(halfExtent);
+        const auto end = source.GetPointInCube(halfExtent);
+        return LineSegment3{start, end};
+    });
+}
@@ -0,0 +1,414 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/LineSegment2.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Random.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+//Counts of values per bucket must all be within tolerance of an even split.
+template<typename T>
+void ExpectEvenBuckets(const std::vector<T>& values, T minInclusive, T maxInclusive, std::size_t bucket_count, double tolerance) {
+    std::vector<std::size_t> buckets(bucket_count, 0u);
+    const auto extent = static_cast<double>(maxInclusive) - static_cast<double>(minInclusive);
+    for(const auto value : values) {
+        const auto unit = (static_cast<double>(value) - static_cast<double>(minInclusive)) / extent;
+        const auto index = (std::min)(static_cast<std::size_t>(unit * bucket_count), bucket_count - 1);
+        ++buckets[index];
+    }
+    const auto expected = static_cast<double>(values.size()) / bucket_count;
+    for(const auto count : buckets) {
+        EXPECT_NEAR(static_cast<double>(count), expected, expected * tolerance);
+    }
+}
+
+//Maps each point to a value that is uniform when the points are.
+template<typename VectorType, typename Measure>
+std::vector<float> MeasurePoints(const std::vector<VectorType>& points, Measure&& measure) {
+    std::vector<float> result(points.size());
+    std::transform(points.begin(), points.end(), result.begin(), measure);
+    return result;
+}
+
+} //End anonymous
+
+TEST(Random, PCG32MatchesReferenceSequence) {
+    //First values of the reference pcg32 demo: pcg32_srandom_r(&rng, 42u, 54u).
+    PCG32 rng{42u, 54u};
+    const std::uint32_t expected[] = {0xA15C02B7u, 0x7B47F409u, 0xBA1D3330u, 0x83D2F293u, 0xBFA4784Bu, 0xCBED606Eu};
+    for(const auto value : expected) {
+        EXPECT_EQ(rng(), value);
+    }
+}
+
+TEST(Random, PCG32DiscardMatchesStepping) {
+    PCG32 stepped{7u, 3u};
+    PCG32 jumped{7u, 3u};
+    for(int i = 0; i < 1000; ++i) {
+        stepped();
+    }
+    jumped.Discard(1000u);
+    EXPECT_EQ(stepped(), jumped());
+    PCG32 other_stream{7u, 4u};
+    EXPECT_NE(PCG32(7u, 3u)(), other_stream());
+}
+
+TEST(Random, GeneratorsDriveStdDistributions) {
+    PCG32 pcg{1u};
+    RandomStream stream{1u};
+    std::uniform_int_distribution<int> d(1, 6);
+    for(int i = 0; i < 1000; ++i) {
+        const auto a = d(pcg);
+        const auto b = d(stream);
+        EXPECT_TRUE(1 <= a && a <= 6);
+        EXPECT_TRUE(1 <= b && b <= 6);
+    }
+}
+
+TEST(Random, RandomStreamFillsMatchSingleDraws) {
+    RandomStream single{11u, 2u};
+    RandomStream filled{11u, 2u};
+    std::vector<float> floats(1027);
+    std::vector<int> ints(1027);
+    std::vector<std::uint32_t> uints(1027);
+    filled.FillFloats(floats.data(), floats.size(), -3.0f, 5.0f);
+    filled.FillInts(ints.data(), ints.size(), -10, 10);
+    filled.FillUints(uints.data(), uints.size());
+    for(const auto value : floats) {
+        EXPECT_EQ(value, single.GetFloatInRange(-3.0f, 5.0f));
+    }
+    for(const auto value : ints) {
+        EXPECT_EQ(value, single.GetIntInRange(-10, 10));
+    }
+    for(const auto value : uints) {
+        EXPECT_EQ(value, single());
+    }
+    EXPECT_EQ(filled.GetPosition(), single.GetPosition());
+    EXPECT_EQ(filled(), single());
+}
+
+TEST(Random, RandomStreamCrossesBlockBoundary) {
+    RandomStream stream{5u};
+    const std::uint64_t start = (std::uint64_t{1} << 32) - 6u;
+    stream.SetPosition(start);
+    std::vector<std::uint32_t> values(13);
+    stream.FillUints(values.data(), values.size());
+    for(std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], stream.GetValueAt(start + i));
+    }
+    //The block past 2^32 does not repeat the first block.
+    EXPECT_NE(stream.GetValueAt(std::uint64_t{1} << 32), stream.GetValueAt(0u));
+}
+
+TEST(Random, RandomStreamOnJobSystemMatchesSerial) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    RandomStream serial{3u};
+    RandomStream parallel{3u};
+    std::vector<float> expected(100003);
+    std::vector<float> actual(expected.size());
+    serial.FillFloats(expected.data(), expected.size(), 0.0f, 1.0f);
+    parallel.FillFloats(actual.data(), actual.size(), 0.0f, 1.0f, &jobs);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(serial.GetPosition(), parallel.GetPosition());
+    jobs.Shutdown();
+}
+
+TEST(Random, StreamsAreIndependent) {
+    RandomStream a{9u, 0u};
+    RandomStream b{9u, 1u};
+    RandomStream c{10u, 0u};
+    std::size_t same_ab = 0u;
+    std::size_t same_ac = 0u;
+    for(int i = 0; i < 1000; ++i) {
+        const auto value = a();
+        same_ab += value == b() ? 1u : 0u;
+        same_ac += value == c() ? 1u : 0u;
+    }
+    EXPECT_EQ(same_ab, 0u);
+    EXPECT_EQ(same_ac, 0u);
+}
+
+TEST(Random, DrawsAreInRangeAndEvenlySpread) {
+    RandomStream stream{21u};
+    PCG32 pcg{21u};
+    std::vector<float> floats(200000);
+    std::vector<int> ints(200000);
+    stream.FillFloats(floats.data(), floats.size(), -2.0f, 2.0f);
+    stream.FillInts(ints.data(), ints.size(), -8, 7);
+    EXPECT_TRUE(std::all_of(floats.begin(), floats.end(), [](float f) { return -2.0f <= f && f < 2.0f; }));
+    EXPECT_TRUE(std::all_of(ints.begin(), ints.end(), [](int i) { return -8 <= i && i <= 7; }));
+    ExpectEvenBuckets(floats, -2.0f, 2.0f, 16, 0.05);
+    ExpectEvenBuckets(ints, -8, 8, 16, 0.05);
+    pcg.FillFloats(floats.data(), floats.size(), 10.0f, 20.0f);
+    pcg.FillInts(ints.data(), ints.size(), 0, 15);
+    ExpectEvenBuckets(floats, 10.0f, 20.0f, 16, 0.05);
+    ExpectEvenBuckets(ints, 0, 16, 16, 0.05);
+    int full_range[4]{};
+    stream.FillInts(full_range, 4, (std::numeric_limits<int>::min)(), (std::numeric_limits<int>::max)());
+    EXPECT_NE(full_range[0], full_range[1]);
+}
+
+TEST(Random, IntLessThanNonPositiveBoundIsZero) {
+    RandomStream stream{5u};
+    PCG32 pcg{5u};
+    RandomStream stream_reference{5u};
+    PCG32 pcg_reference{5u};
+    for(const int bound : {0, -1, (std::numeric_limits<int>::min)()}) {
+        EXPECT_EQ(stream.GetIntLessThan(bound), 0);
+        EXPECT_EQ(pcg.GetIntLessThan(bound), 0);
+        stream_reference();
+        pcg_reference();
+    }
+    //Each call still consumes one value, so later draws line up with an unclamped sequence.
+    EXPECT_EQ(stream(), stream_reference());
+    EXPECT_EQ(pcg(), pcg_reference());
+    EXPECT_EQ(stream.GetIntLessThan(1), 0);
+    EXPECT_EQ(pcg.GetIntLessThan(1), 0);
+}
+
+TEST(Random, FillRandomFloatsIsInRange) {
+    std::vector<float> values(4099);
+    MathUtils::FillRandomFloats(values.data(), values.size(), 1.0f, 2.0f);
+    EXPECT_TRUE(std::all_of(values.begin(), values.end(), [](float f) { return 1.0f <= f && f <= 2.0f; }));
+    std::vector<int> ints(4099);
+    MathUtils::FillRandomInts(ints.data(), ints.size(), 3, 4);
+    EXPECT_TRUE(std::all_of(ints.begin(), ints.end(), [](int i) { return i == 3 || i == 4; }));
+}
+
+TEST(Random, RandomPointsInsideAreEvenlySpread) {
+    constexpr std::size_t count = 200000;
+    const AABB2 box2{Vector2{-3.0f, 1.0f}, Vector2{5.0f, 2.0f}};
+    std::vector<Vector2> points2(count);
+    MathUtils::FillRandomPointsInside(box2, points2.data(), count);
+    EXPECT_TRUE(std::all_of(points2.begin(), points2.end(), [&](const Vector2& p) { return MathUtils::IsPointInside(box2, p); }));
+    ExpectEvenBuckets(MeasurePoints(points2, [](const Vector2& p) { return p.x; }), -3.0f, 5.0f, 16, 0.05);
+    ExpectEvenBuckets(MeasurePoints(points2, [](const Vector2& p) { return p.y; }), 1.0f, 2.0f, 16, 0.05);
+
+    //Area inside radius r grows with r^2.
+    const Disc2 disc{Vector2{2.0f, -1.0f}, 4.0f};
+    MathUtils::FillRandomPointsInside(disc, points2.data(), count);
+    const auto disc_r2 = MeasurePoints(points2, [&](const Vector2& p) { return MathUtils::CalcDistanceSquared(p, disc.center) / (disc.radius * disc.radius); });
+    EXPECT_TRUE(std::all_of(disc_r2.begin(), disc_r2.end(), [](float f) { return f <= 1.0001f; }));
+    ExpectEvenBuckets(disc_r2, 0.0f, 1.0f, 16, 0.05);
+    ExpectEvenBuckets(MeasurePoints(points2, [&](const Vector2& p) { return std::atan2(p.y - disc.center.y, p.x - disc.center.x); }), -MathUtils::M_PI, MathUtils::M_PI, 16, 0.05);
+
+    const AABB3 box3{Vector3{0.0f, -1.0f, 2.0f}, Vector3{1.0f, 1.0f, 6.0f}};
+    std::vector<Vector3> points3(count);
+    MathUtils::FillRandomPointsInside(box3, points3.data(), count);
+    EXPECT_TRUE(std::all_of(points3.begin(), points3.end(), [&](const Vector3& p) { return MathUtils::IsPointInside(box3, p); }));
+    ExpectEvenBuckets(MeasurePoints(points3, [](const Vector3& p) { return p.y; }), -1.0f, 1.0f, 16, 0.05);
+    ExpectEvenBuckets(MeasurePoints(points3, [](const Vector3& p) { return p.z; }), 2.0f, 6.0f, 16, 0.05);
+
+    //Volume inside radius r grows with r^3; heights of the directions are uniform.
+    const Sphere3 sphere{Vector3{1.0f, 2.0f, 3.0f}, 2.0f};
+    MathUtils::FillRandomPointsInside(sphere, points3.data(), count);
+    const auto sphere_r3 = MeasurePoints(points3, [&](const Vector3& p) { return std::pow(MathUtils::CalcDistance(p, sphere.center) / sphere.radius, 3.0f); });
+    EXPECT_TRUE(std::all_of(sphere_r3.begin(), sphere_r3.end(), [](float f) { return f <= 1.0001f; }));
+    ExpectEvenBuckets(sphere_r3, 0.0f, 1.0f, 16, 0.05);
+    ExpectEvenBuckets(MeasurePoints(points3, [&](const Vector3& p) { return (p - sphere.center).GetNormalize().z; }), -1.0f, 1.0f, 16, 0.05);
+    ExpectEvenBuckets(MeasurePoints(points3, [&](const Vector3& p) { return std::atan2(p.y - sphere.center.y, p.x - sphere.center.x); }), -MathUtils::M_PI, MathUtils::M_PI, 16, 0.05);
+}
+
+TEST(Random, RandomPointsOnAreEvenlySpread) {
+    constexpr std::size_t count = 200000;
+    //A 3x1 box: distance walked along the perimeter from mins is uniform over [0, 8).
+    const AABB2 box2{Vector2{1.0f, 1.0f}, Vector2{4.0f, 2.0f}};
+    std::vector<Vector2> points2(count);
+    MathUtils::FillRandomPointsOn(box2, points2.data(), count);
+    const auto perimeter = MeasurePoints(points2, [&](const Vector2& p) {
+        if(p.y == box2.mins.y) return p.x - box2.mins.x;
+        if(p.x == box2.maxs.x) return 3.0f + (p.y - box2.mins.y);
+        if(p.y == box2.maxs.y) return 4.0f + (box2.maxs.x - p.x);
+        if(p.x == box2.mins.x) return 7.0f + (box2.maxs.y - p.y);
+        return -1.0f;
+    });
+    EXPECT_TRUE(std::all_of(perimeter.begin(), perimeter.end(), [](float f) { return 0.0f <= f && f <= 8.0f; }));
+    ExpectEvenBuckets(perimeter, 0.0f, 8.0f, 16, 0.05);
+
+    const Disc2 disc{Vector2{-2.0f, 3.0f}, 0.5f};
+    MathUtils::FillRandomPointsOn(disc, points2.data(), count);
+    EXPECT_TRUE(std::all_of(points2.begin(), points2.end(), [&](const Vector2& p) { return std::abs(MathUtils::CalcDistance(p, disc.center) - disc.radius) < 1e-4f; }));
+    ExpectEvenBuckets(MeasurePoints(points2, [&](const Vector2& p) { return std::atan2(p.y - disc.center.y, p.x - disc.center.x); }), -MathUtils::M_PI, MathUtils::M_PI, 16, 0.05);
+
+    const LineSegment2 line2{Vector2{1.0f, 1.0f}, Vector2{5.0f, -7.0f}};
+    MathUtils::FillRandomPointsOn(line2, points2.data(), count);
+    EXPECT_TRUE(std::all_of(points2.begin(), points2.end(), [](const Vector2& p) { return std::abs(p.y - (3.0f - 2.0f * p.x)) < 1e-4f; }));
+    ExpectEvenBuckets(MeasurePoints(points2, [](const Vector2& p) { return p.x; }), 1.0f, 5.0f, 16, 0.05);
+
+    //Faces of a 1x2x4 box: each gets its share of the area, and points spread evenly across it.
+    const AABB3 box3{Vector3{0.0f, 0.0f, 0.0f}, Vector3{1.0f, 2.0f, 4.0f}};
+    std::vector<Vector3> points3(count);
+    MathUtils::FillRandomPointsOn(box3, points3.data(), count);
+    std::size_t on_x_faces = 0u;
+    std::vector<float> xy_face_x{};
+    for(const auto& p : points3) {
+        const auto on_x = p.x == 0.0f || p.x == 1.0f;
+        const auto on_y = p.y == 0.0f || p.y == 2.0f;
+        const auto on_z = p.z == 0.0f || p.z == 4.0f;
+        ASSERT_TRUE(on_x || on_y || on_z);
+        ASSERT_TRUE(MathUtils::IsPointInside(box3, p));
+        on_x_faces += on_x ? 1u : 0u;
+        if(on_z) {
+            xy_face_x.push_back(p.x);
+        }
+    }
+    //x faces: 2 * 2 * 4 = 16 of the 28 units of area.
+    EXPECT_NEAR(static_cast<double>(on_x_faces) / count, 16.0 / 28.0, 0.01);
+    EXPECT_NEAR(static_cast<double>(xy_face_x.size()) / count, 4.0 / 28.0, 0.01);
+    ExpectEvenBuckets(xy_face_x, 0.0f, 1.0f, 8, 0.08);
+
+    const Sphere3 sphere{Vector3{1.0f, 2.0f, 3.0f}, 2.0f};
+    MathUtils::FillRandomPointsOn(sphere, points3.data(), count);
+    EXPECT_TRUE(std::all_of(points3.begin(), points3.end(), [&](const Vector3& p) { return std::abs(MathUtils::CalcDistance(p, sphere.center) - sphere.radius) < 1e-4f; }));
+    ExpectEvenBuckets(MeasurePoints(points3, [&](const Vector3& p) { return p.z - sphere.center.z; }), -2.0f, 2.0f, 16, 0.05);
+    ExpectEvenBuckets(MeasurePoints(points3, [&](const Vector3& p) { return std::atan2(p.y - sphere.center.y, p.x - sphere.center.x); }), -MathUtils::M_PI, MathUtils::M_PI, 16, 0.05);
+
+    const LineSegment3 line3{Vector3{0.0f, 0.0f, 0.0f}, Vector3{2.0f, 4.0f, -6.0f}};
+    MathUtils::FillRandomPointsOn(line3, points3.data(), count);
+    EXPECT_TRUE(std::all_of(points3.begin(), points3.end(), [](const Vector3& p) { return std::abs(p.y - 2.0f * p.x) < 1e-4f && std::abs(p.z + 3.0f * p.x) < 1e-4f; }));
+    ExpectEvenBuckets(MeasurePoints(points3, [](const Vector3& p) { return p.x; }), 0.0f, 2.0f, 16, 0.05);
+}
+
+TEST(Random, RandomPointsOnJobSystemMatchSerial) {
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    const Sphere3 sphere{Vector3{1.0f, 2.0f, 3.0f}, 2.0f};
+    std::vector<Vector3> expected(20011);
+    std::vector<Vector3> actual(expected.size());
+    auto& stream = MathUtils::GetRandomStream();
+    const auto saved = stream;
+    MathUtils::FillRandomPointsInside(sphere, expected.data(), expected.size());
+    const auto serial_position = stream.GetPosition();
+    stream = saved;
+    MathUtils::FillRandomPointsInside(sphere, actual.data(), actual.size(), &jobs);
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(stream.GetPosition(), serial_position);
+    EXPECT_EQ(serial_position, saved.GetPosition() + expected.size() * 5u);
+    jobs.Shutdown();
+}
+
+TEST(RandomBenchmarks, DISABLED_GeneratorThroughput) {
+    constexpr std::size_t count = 1 << 20;
+    std::vector<float> floats(count);
+    std::vector<int> ints(count);
+    RunBenchmark("MathUtils::GetRandomIntLessThan", 10, count, [&]() {
+        for(auto& value : ints) {
+            value = MathUtils::GetRandomIntLessThan(100);
+        }
+        DoNotOptimize(ints);
+    });
+    RunBenchmark("MathUtils::GetRandomFloatInRange", 10, count, [&]() {
+        for(auto& value : floats) {
+            value = MathUtils::GetRandomFloatInRange(-1.0f, 1.0f);
+        }
+        DoNotOptimize(floats);
+    });
+    PCG32 pcg{1u};
+    RunBenchmark("PCG32::GetIntLessThan", 10, count, [&]() {
+        for(auto& value : ints) {
+            value = pcg.GetIntLessThan(100);
+        }
+        DoNotOptimize(ints);
+    });
+    RunBenchmark("PCG32::GetFloatInRange", 10, count, [&]() {
+        for(auto& value : floats) {
+            value = pcg.GetFloatInRange(-1.0f, 1.0f);
+        }
+        DoNotOptimize(floats);
+    });
+    RunBenchmark("PCG32::FillFloats", 10, count, [&]() {
+        pcg.FillFloats(floats.data(), count, -1.0f, 1.0f);
+        DoNotOptimize(floats);
+    });
+    RandomStream stream{1u};
+    RunBenchmark("RandomStream::GetFloatInRange", 10, count, [&]() {
+        for(auto& value : floats) {
+            value = stream.GetFloatInRange(-1.0f, 1.0f);
+        }
+        DoNotOptimize(floats);
+    });
+    RunBenchmark("RandomStream::FillInts", 10, count, [&]() {
+        stream.FillInts(ints.data(), count, 0, 99);
+        DoNotOptimize(ints);
+    });
+    RunBenchmark("MathUtils::FillRandomFloats", 10, count, [&]() {
+        MathUtils::FillRandomFloats(floats.data(), count, -1.0f, 1.0f);
+        DoNotOptimize(floats);
+    });
+    JobSystem jobs(0, static_cast<std::size_t>(JobType::Max), nullptr);
+    RunBenchmark("MathUtils::FillRandomFloats JobSystem", 10, count, [&]() {
+        MathUtils::FillRandomFloats(floats.data(), count, -1.0f, 1.0f, &jobs);
+        DoNotOptimize(floats);
+    });
+    jobs.Shutdown();
+}
+
+TEST(RandomBenchmarks, DISABLED_RandomPointThroughput) {
+    constexpr std::size_t count = 1 << 18;
+    const Disc2 disc{Vector2{1.0f, 2.0f}, 3.0f};
+    const Sphere3 sphere{Vector3{1.0f, 2.0f, 3.0f}, 2.0f};
+    const AABB3 box{Vector3{0.0f, 0.0f, 0.0f}, Vector3{1.0f, 2.0f, 4.0f}};
+    std::vector<Vector2> points2(count);
+    std::vector<Vector3> points3(count);
+    RunBenchmark("MathUtils::GetRandomPointInside Disc2", 5, count, [&]() {
+        for(auto& p : points2) {
+            p = MathUtils::GetRandomPointInside(disc);
+        }
+        DoNotOptimize(points2);
+    });
+    RunBenchmark("MathUtils::FillRandomPointsInside Disc2", 5, count, [&]() {
+        MathUtils::FillRandomPointsInside(disc, points2.data(), count);
+        DoNotOptimize(points2);
+    });
+    RunBenchmark("MathUtils::GetRandomPointOn Sphere3", 5, count, [&]() {
+        for(auto& p : points3) {
+            p = MathUtils::GetRandomPointOn(sphere);
+        }
+        DoNotOptimize(points3);
+    });
+    RunBenchmark("MathUtils::FillRandomPointsOn Sphere3", 5, count, [&]() {
+        MathUtils::FillRandomPointsOn(sphere, points3.data(), count);
+        DoNotOptimize(points3);
+    });
+    RunBenchmark("MathUtils::GetRandomPointInside Sphere3", 5, count, [&]() {
+        for(auto& p : points3) {
+            p = MathUtils::GetRandomPointInside(sphere);
+        }
+        DoNotOptimize(points3);
+    });
+    RunBenchmark("MathUtils::FillRandomPointsInside Sphere3", 5, count, [&]() {
+        MathUtils::FillRandomPointsInside(sphere, points3.data(), count);
+        DoNotOptimize(points3);
+    });
+    RunBenchmark("MathUtils::GetRandomPointInside AABB3", 5, count, [&]() {
+        for(auto& p : points3) {
+            p = MathUtils::GetRandomPointInside(box);
+        }
+        DoNotOptimize(points3);
+    });
+    RunBenchmark("MathUtils::FillRandomPointsInside AABB3", 5, count, [&]() {
+        MathUtils::FillRandomPointsInside(box, points3.data(), count);
+        DoNotOptimize(points3);
+    });
+    RunBenchmark("MathUtils::FillRandomPointsOn AABB3", 5, count, [&]() {
+        MathUtils::FillRandomPointsOn(box, points3.data(), count);
+        DoNotOptimize(points3);
+    });
+}
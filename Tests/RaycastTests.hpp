@@ -0,0 +1,332 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Core/Vertex3D.hpp"
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/BVH.hpp"
+#include "Engine/Math/Capsule3.hpp"
+#include "Engine/Math/LineSegment3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Plane3.hpp"
+#include "Engine/Math/Raycast.hpp"
+#include "Engine/Math/Sphere3.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<LineSegment3> MakeRandomRaycastSegments(std::size_t count, unsigned int seed, float worldSize = 10.0f) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<float> coord(-worldSize, worldSize);
+    std::vector<LineSegment3> result{};
+    result.reserve(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        result.emplace_back(Vector3{coord(rng), coord(rng), coord(rng)}, Vector3{coord(rng), coord(rng), coord(rng)});
+    }
+    return result;
+}
+
+//Rolling heightfield of 2 * cells * cells triangles over [-size, size] in x and y.
+void MakeRaycastTestMesh(std::size_t cells, float size, std::vector<Vertex3D>& vbo, std::vector<unsigned int>& ibo) {
+    vbo.clear();
+    ibo.clear();
+    const auto step = 2.0f * size / static_cast<float>(cells);
+    for(std::size_t y = 0; y <= cells; ++y) {
+        for(std::size_t x = 0; x <= cells; ++x) {
+            const auto px = -size + step * static_cast<float>(x);
+            const auto py = -size + step * static_cast<float>(y);
+            vbo.emplace_back(Vector3{px, py, std::sin(px * 0.7f) * std::cos(py * 0.5f)});
+        }
+    }
+    const auto row = static_cast<unsigned int>(cells + 1);
+    for(unsigned int y = 0; y < cells; ++y) {
+        for(unsigned int x = 0; x < cells; ++x) {
+            const auto i = y * row + x;
+            ibo.insert(ibo.end(), {i, i + 1, i + row, i + 1, i + row + 1, i + row});
+        }
+    }
+}
+
+//Camera-style rays through a grid of points below the origin: neighbouring rays are close together.
+std::vector<LineSegment3> MakeCoherentRaycastSegments(std::size_t side, float size) {
+    std::vector<LineSegment3> result{};
+    const Vector3 eye{0.0f, 0.0f, 2.0f * size};
+    for(std::size_t y = 0; y < side; ++y) {
+        for(std::size_t x = 0; x < side; ++x) {
+            const auto px = size * (2.0f * (static_cast<float>(x) + 0.5f) / static_cast<float>(side) - 1.0f);
+            const auto py = size * (2.0f * (static_cast<float>(y) + 0.5f) / static_cast<float>(side) - 1.0f);
+            result.emplace_back(eye, Vector3{px, py, -2.0f * size});
+        }
+    }
+    return result;
+}
+
+void ExpectSameHit(const RaycastHit3& expected, const RaycastHit3& actual) {
+    EXPECT_NEAR(expected.t, actual.t, 1e-4f);
+    EXPECT_NEAR(expected.point.x, actual.point.x, 1e-3f);
+    EXPECT_NEAR(expected.point.y, actual.point.y, 1e-3f);
+    EXPECT_NEAR(expected.point.z, actual.point.z, 1e-3f);
+    EXPECT_NEAR(expected.normal.x, actual.normal.x, 1e-3f);
+    EXPECT_NEAR(expected.normal.y, actual.normal.y, 1e-3f);
+    EXPECT_NEAR(expected.normal.z, actual.normal.z, 1e-3f);
+}
+
+//Rays through a shared edge may report either triangle; only the normal can differ.
+void ExpectSameMeshHit(const RaycastHit3& expected, const RaycastHit3& actual) {
+    EXPECT_NEAR(expected.t, actual.t, 1e-4f);
+    EXPECT_NEAR(expected.point.x, actual.point.x, 1e-3f);
+    EXPECT_NEAR(expected.point.y, actual.point.y, 1e-3f);
+    EXPECT_NEAR(expected.point.z, actual.point.z, 1e-3f);
+    if(expected.index == actual.index) {
+        ExpectSameHit(expected, actual);
+    }
+}
+
+template<typename Shape>
+void ExpectPacketsMatchSingleRays(const std::vector<LineSegment3>& segments, const Shape& shape) {
+    for(std::size_t first = 0; first < segments.size(); first += RayPacket3::MAX_RAYS) {
+        RayPacket3 rays{};
+        //Odd-sized packets cover the partly filled lane groups.
+        rays.count = (std::min)(first % 3 ? RayPacket3::MAX_RAYS : std::size_t{5}, segments.size() - first);
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            rays.Set(lane, segments[first + lane]);
+        }
+        RayPacketHits3 hits{};
+        const auto updated = MathUtils::Raycast(rays, shape, hits);
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            RaycastHit3 expected{};
+            const bool is_hit = MathUtils::Raycast(segments[first + lane], shape, expected);
+            ASSERT_EQ(is_hit, hits.IsHit(lane));
+            ASSERT_EQ(is_hit, (updated & (1u << lane)) != 0);
+            if(is_hit) {
+                ExpectSameHit(expected, hits.Get(lane));
+            }
+        }
+    }
+}
+
+} //End anonymous
+
+TEST(Raycast, PrimitivesReportEntryPointAndNormal) {
+    RaycastHit3 hit{};
+    const AABB3 box{Vector3{-1.0f, -1.0f, -1.0f}, Vector3{1.0f, 1.0f, 1.0f}};
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 0.5f, 0.0f}, Vector3{5.0f, 0.5f, 0.0f}}, box, hit));
+    EXPECT_FLOAT_EQ(hit.t, 0.4f);
+    ExpectSameHit(RaycastHit3{Vector3{-1.0f, 0.5f, 0.0f}, Vector3{-1.0f, 0.0f, 0.0f}, 0.4f}, hit);
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 0.0f, 5.0f}, Vector3{0.0f, 0.0f, -5.0f}}, box, hit));
+    ExpectSameHit(RaycastHit3{Vector3{0.0f, 0.0f, 1.0f}, Vector3{0.0f, 0.0f, 1.0f}, 0.4f}, hit);
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 2.0f, 0.0f}, Vector3{5.0f, 2.0f, 0.0f}}, box, hit));
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 0.0f, 0.0f}, Vector3{-2.0f, 0.0f, 0.0f}}, box, hit));
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3::ZERO, Vector3{0.0f, 5.0f, 0.0f}}, box, hit));
+    ExpectSameHit(RaycastHit3{Vector3::ZERO, Vector3{0.0f, -1.0f, 0.0f}, 0.0f}, hit);
+
+    const Sphere3 sphere{Vector3{0.0f, 0.0f, 0.0f}, 2.0f};
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, -10.0f, 0.0f}, Vector3{0.0f, 10.0f, 0.0f}}, sphere, hit));
+    ExpectSameHit(RaycastHit3{Vector3{0.0f, -2.0f, 0.0f}, Vector3{0.0f, -1.0f, 0.0f}, 0.4f}, hit);
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{3.0f, -10.0f, 0.0f}, Vector3{3.0f, 10.0f, 0.0f}}, sphere, hit));
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 10.0f, 0.0f}, Vector3{0.0f, 20.0f, 0.0f}}, sphere, hit));
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.5f, 0.0f, 0.0f}, Vector3{10.0f, 0.0f, 0.0f}}, sphere, hit));
+    EXPECT_FLOAT_EQ(hit.t, 0.0f);
+
+    const Capsule3 capsule{Vector3{0.0f, -2.0f, 0.0f}, Vector3{0.0f, 2.0f, 0.0f}, 1.0f};
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 1.0f, 0.0f}, Vector3{5.0f, 1.0f, 0.0f}}, capsule, hit));
+    ExpectSameHit(RaycastHit3{Vector3{-1.0f, 1.0f, 0.0f}, Vector3{-1.0f, 0.0f, 0.0f}, 0.4f}, hit);
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 10.0f, 0.0f}, Vector3{0.0f, -10.0f, 0.0f}}, capsule, hit));
+    ExpectSameHit(RaycastHit3{Vector3{0.0f, 3.0f, 0.0f}, Vector3{0.0f, 1.0f, 0.0f}, 0.35f}, hit);
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 3.5f, 0.0f}, Vector3{5.0f, 3.5f, 0.0f}}, capsule, hit));
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 2.5f, 0.0f}, Vector3{5.0f, 2.5f, 0.0f}}, capsule, hit));
+    EXPECT_FLOAT_EQ(hit.t, 0.0f);
+
+    const Plane3 plane{Vector3{0.0f, 1.0f, 0.0f}, 1.0f};
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 5.0f, 0.0f}, Vector3{0.0f, -5.0f, 0.0f}}, plane, hit));
+    ExpectSameHit(RaycastHit3{Vector3{0.0f, 1.0f, 0.0f}, Vector3{0.0f, 1.0f, 0.0f}, 0.4f}, hit);
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, -5.0f, 0.0f}, Vector3{0.0f, 5.0f, 0.0f}}, plane, hit));
+    ExpectSameHit(RaycastHit3{Vector3{0.0f, 1.0f, 0.0f}, Vector3{0.0f, -1.0f, 0.0f}, 0.6f}, hit);
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 2.0f, 0.0f}, Vector3{5.0f, 2.0f, 0.0f}}, plane, hit));
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 5.0f, 0.0f}, Vector3{0.0f, 2.0f, 0.0f}}, plane, hit));
+
+    const Vector3 a{-1.0f, -1.0f, 0.0f};
+    const Vector3 b{1.0f, -1.0f, 0.0f};
+    const Vector3 c{0.0f, 1.0f, 0.0f};
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 0.0f, 4.0f}, Vector3{0.0f, 0.0f, -4.0f}}, a, b, c, hit));
+    ExpectSameHit(RaycastHit3{Vector3::ZERO, Vector3{0.0f, 0.0f, 1.0f}, 0.5f}, hit);
+    EXPECT_TRUE(MathUtils::Raycast(LineSegment3{Vector3{0.0f, 0.0f, -4.0f}, Vector3{0.0f, 0.0f, 4.0f}}, a, b, c, hit));
+    ExpectSameHit(RaycastHit3{Vector3::ZERO, Vector3{0.0f, 0.0f, -1.0f}, 0.5f}, hit);
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{0.9f, 0.9f, 4.0f}, Vector3{0.9f, 0.9f, -4.0f}}, a, b, c, hit));
+    EXPECT_FALSE(MathUtils::Raycast(LineSegment3{Vector3{-5.0f, 0.0f, 0.0f}, Vector3{5.0f, 0.0f, 0.0f}}, a, b, c, hit));
+}
+
+TEST(Raycast, PacketsMatchSingleRays) {
+    const auto segments = MakeRandomRaycastSegments(4000, 3u);
+    ExpectPacketsMatchSingleRays(segments, AABB3{Vector3{-3.0f, -2.0f, -1.0f}, Vector3{2.0f, 3.0f, 4.0f}});
+    ExpectPacketsMatchSingleRays(segments, Sphere3{Vector3{1.0f, -1.0f, 2.0f}, 3.5f});
+    ExpectPacketsMatchSingleRays(segments, Capsule3{Vector3{-4.0f, 1.0f, 0.0f}, Vector3{3.0f, -2.0f, 2.0f}, 2.0f});
+    ExpectPacketsMatchSingleRays(segments, Capsule3{Vector3{1.0f, 1.0f, 1.0f}, Vector3{1.0f, 1.0f, 1.0f}, 2.0f});
+    ExpectPacketsMatchSingleRays(segments, Plane3{Vector3{0.6f, 0.0f, 0.8f}, 1.5f});
+
+    //Axis-aligned segments take the parallel-slab paths of the box test.
+    std::vector<LineSegment3> flat{};
+    for(const auto& segment : MakeRandomRaycastSegments(400, 4u)) {
+        flat.emplace_back(segment.start, Vector3{segment.start.x, segment.start.y, segment.end.z});
+    }
+    ExpectPacketsMatchSingleRays(flat, AABB3{Vector3{-3.0f, -2.0f, -1.0f}, Vector3{2.0f, 3.0f, 4.0f}});
+
+    const Vector3 a{-6.0f, -5.0f, 1.0f};
+    const Vector3 b{7.0f, -3.0f, -2.0f};
+    const Vector3 c{0.0f, 8.0f, 3.0f};
+    for(std::size_t first = 0; first + RayPacket3::MAX_RAYS <= segments.size(); first += RayPacket3::MAX_RAYS) {
+        RayPacket3 rays{};
+        rays.count = RayPacket3::MAX_RAYS;
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            rays.Set(lane, segments[first + lane]);
+        }
+        RayPacketHits3 hits{};
+        MathUtils::Raycast(rays, a, b, c, hits);
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            RaycastHit3 expected{};
+            ASSERT_EQ(MathUtils::Raycast(segments[first + lane], a, b, c, expected), hits.IsHit(lane));
+            if(hits.IsHit(lane)) {
+                ExpectSameHit(expected, hits.Get(lane));
+            }
+        }
+    }
+}
+
+TEST(Raycast, PacketsKeepTheClosestHit) {
+    RayPacket3 rays{};
+    rays.count = 2;
+    rays.Set(0, LineSegment3{Vector3{-10.0f, 0.0f, 0.0f}, Vector3{10.0f, 0.0f, 0.0f}});
+    rays.Set(1, LineSegment3{Vector3{-10.0f, 5.0f, 0.0f}, Vector3{10.0f, 5.0f, 0.0f}});
+    RayPacketHits3 hits{};
+    EXPECT_FALSE(hits.IsHit(0));
+    EXPECT_FALSE(hits.IsHit(RayPacket3::MAX_RAYS - 1));
+    EXPECT_EQ(MathUtils::Raycast(rays, Sphere3{Vector3{5.0f, 0.0f, 0.0f}, 1.0f}, hits), 1u);
+    EXPECT_EQ(MathUtils::Raycast(rays, Sphere3{Vector3{-5.0f, 0.0f, 0.0f}, 1.0f}, hits), 1u);
+    EXPECT_EQ(MathUtils::Raycast(rays, Sphere3{Vector3{0.0f, 0.0f, 0.0f}, 1.0f}, hits), 0u);
+    EXPECT_EQ(MathUtils::Raycast(rays, AABB3{Vector3{2.0f, -10.0f, -1.0f}, Vector3{3.0f, 10.0f, 1.0f}}, hits), 2u);
+    EXPECT_FLOAT_EQ(hits.t[0], 0.2f);
+    EXPECT_FLOAT_EQ(hits.t[1], 0.6f);
+    EXPECT_FALSE(hits.IsHit(2));
+}
+
+TEST(Raycast, MeshRaycastMatchesBruteForce) {
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeRaycastTestMesh(40, 10.0f, vbo, ibo);
+    const BVH bvh{MathUtils::CalcTriangleBounds(vbo, ibo)};
+    auto segments = MakeRandomRaycastSegments(3000, 5u);
+    const auto coherent = MakeCoherentRaycastSegments(24, 10.0f);
+    segments.insert(segments.end(), coherent.begin(), coherent.end());
+    std::size_t hit_count = 0;
+    for(const auto& segment : segments) {
+        RaycastHit3 expected{};
+        bool expected_hit = false;
+        for(std::size_t i = 0; i < ibo.size() / 3; ++i) {
+            RaycastHit3 hit{};
+            if(MathUtils::Raycast(segment, vbo[ibo[3 * i]].position, vbo[ibo[3 * i + 1]].position, vbo[ibo[3 * i + 2]].position, hit) && (!expected_hit || hit.t < expected.t)) {
+                expected = hit;
+                expected.index = i;
+                expected_hit = true;
+            }
+        }
+        RaycastHit3 actual{};
+        ASSERT_EQ(expected_hit, MathUtils::Raycast(segment, bvh, vbo, ibo, actual));
+        if(expected_hit) {
+            ++hit_count;
+            ExpectSameMeshHit(expected, actual);
+        }
+    }
+    EXPECT_GT(hit_count, segments.size() / 4);
+
+    for(std::size_t first = 0; first < segments.size(); first += RayPacket3::MAX_RAYS) {
+        RayPacket3 rays{};
+        rays.count = (std::min)(RayPacket3::MAX_RAYS, segments.size() - first);
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            rays.Set(lane, segments[first + lane]);
+        }
+        RayPacketHits3 hits{};
+        MathUtils::Raycast(rays, bvh, vbo, ibo, hits);
+        for(std::size_t lane = 0; lane < rays.count; ++lane) {
+            RaycastHit3 expected{};
+            ASSERT_EQ(MathUtils::Raycast(segments[first + lane], bvh, vbo, ibo, expected), hits.IsHit(lane));
+            if(hits.IsHit(lane)) {
+                ExpectSameMeshHit(expected, hits.Get(lane));
+            }
+        }
+    }
+}
+
+TEST(RaycastBenchmarks, DISABLED_RaysPerSecond) {
+    const auto segments = MakeRandomRaycastSegments(1 << 16, 6u);
+    std::vector<RayPacket3> packets(segments.size() / RayPacket3::MAX_RAYS);
+    for(std::size_t i = 0; i < packets.size(); ++i) {
+        packets[i].count = RayPacket3::MAX_RAYS;
+        for(std::size_t lane = 0; lane < RayPacket3::MAX_RAYS; ++lane) {
+            packets[i].Set(lane, segments[i * RayPacket3::MAX_RAYS + lane]);
+        }
+    }
+    const auto run = [&](const std::string& name, const auto& shape) {
+        RunBenchmark(name + " single", 20, segments.size(), [&]() {
+            RaycastHit3 hit{};
+            std::size_t hits = 0;
+            for(const auto& segment : segments) {
+                hits += MathUtils::Raycast(segment, shape, hit);
+            }
+            DoNotOptimize(hits);
+        });
+        RunBenchmark(name + " packet", 20, segments.size(), [&]() {
+            RayPacketHits3 hits{};
+            std::uint32_t mask = 0;
+            for(const auto& packet : packets) {
+                hits.Reset();
+                mask |= MathUtils::Raycast(packet, shape, hits);
+            }
+            DoNotOptimize(mask);
+        });
+    };
+    run("AABB3", AABB3{Vector3{-3.0f, -2.0f, -1.0f}, Vector3{2.0f, 3.0f, 4.0f}});
+    run("Sphere3", Sphere3{Vector3{1.0f, -1.0f, 2.0f}, 3.5f});
+    run("Capsule3", Capsule3{Vector3{-4.0f, 1.0f, 0.0f}, Vector3{3.0f, -2.0f, 2.0f}, 2.0f});
+    run("Plane3", Plane3{Vector3{0.6f, 0.0f, 0.8f}, 1.5f});
+
+    std::vector<Vertex3D> vbo{};
+    std::vector<unsigned int> ibo{};
+    MakeRaycastTestMesh(200, 10.0f, vbo, ibo);
+    const BVH bvh{MathUtils::CalcTriangleBounds(vbo, ibo)};
+    const auto coherent = MakeCoherentRaycastSegments(256, 10.0f);
+    //Lanes of a packet are neighbouring pixels of 4 x 2 tiles.
+    std::vector<RayPacket3> coherent_packets{};
+    for(std::size_t y = 0; y < 256; y += 2) {
+        for(std::size_t x = 0; x < 256; x += 4) {
+            RayPacket3 packet{};
+            packet.count = RayPacket3::MAX_RAYS;
+            for(std::size_t lane = 0; lane < RayPacket3::MAX_RAYS; ++lane) {
+                packet.Set(lane, coherent[(y + lane / 4) * 256 + x + lane % 4]);
+            }
+            coherent_packets.push_back(packet);
+        }
+    }
+    RunBenchmark("Mesh (80k triangles) single", 5, coherent.size(), [&]() {
+        RaycastHit3 hit{};
+        std::size_t hits = 0;
+        for(const auto& segment : coherent) {
+            hits += MathUtils::Raycast(segment, bvh, vbo, ibo, hit);
+        }
+        DoNotOptimize(hits);
+    });
+    RunBenchmark("Mesh (80k triangles) packet", 5, coherent.size(), [&]() {
+        RayPacketHits3 hits{};
+        std::uint32_t mask = 0;
+        for(const auto& packet : coherent_packets) {
+            hits.Reset();
+            mask |= MathUtils::Raycast(packet, bvh, vbo, ibo, hits);
+        }
+        DoNotOptimize(mask);
+    });
+}
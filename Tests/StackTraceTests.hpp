@@ -0,0 +1,111 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Profiling/StackTrace.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#define STACKTRACETESTS_NOINLINE __declspec(noinline)
+#else
+#define STACKTRACETESTS_NOINLINE __attribute__((noinline))
+#endif
+
+//Not static: the symbol must be visible to the symbolizer (exported with -rdynamic on Linux).
+//The work after the capture keeps the capture from being a tail call that would drop this frame.
+STACKTRACETESTS_NOINLINE inline StackTrace StackTraceTestsKnownFrame(unsigned long framesToCapture) {
+    StackTrace result(0ul, framesToCapture);
+    DoNotOptimize(result);
+    return result;
+}
+
+STACKTRACETESTS_NOINLINE inline StackTrace StackTraceTestsKnownCaller(unsigned long framesToCapture = 8ul) {
+    auto result = StackTraceTestsKnownFrame(framesToCapture);
+    return result;
+}
+
+//Index of the first of the leading frames whose symbol contains name, or frames.size() if none does.
+//Capture and symbolizer internals may add a frame or two above the known ones.
+inline std::size_t StackTraceTestsFindFrame(const std::vector<StackTrace::frame_t>& frames, const std::string& name, std::size_t first = 0) {
+    const auto last = (std::min)(frames.size(), first + 4);
+    for(auto i = first; i < last; ++i) {
+        if(frames[i].symbol.find(name) != std::string::npos) {
+            return i;
+        }
+    }
+    return frames.size();
+}
+
+#ifdef PROFILE_BUILD
+
+TEST(StackTrace, CaptureRecordsFrames) {
+    StackTrace st{};
+    EXPECT_GT(st.GetFrameCount(), 0ul);
+    EXPECT_NE(st.GetFrameAddress(0), nullptr);
+    EXPECT_EQ(st.GetFrameAddress(st.GetFrameCount()), nullptr);
+}
+
+TEST(StackTrace, CaptureRespectsFramesToCapture) {
+    StackTrace st(0ul, 2ul);
+    EXPECT_LE(st.GetFrameCount(), 2ul);
+}
+
+TEST(StackTrace, SymbolizesKnownFrames) {
+    auto st = StackTraceTestsKnownCaller();
+    ASSERT_GE(st.GetFrameCount(), 2ul);
+    const auto frames = st.GetFrames();
+    ASSERT_EQ(frames.size(), st.GetFrameCount());
+    const auto known_frame = StackTraceTestsFindFrame(frames, "StackTraceTestsKnownFrame");
+    ASSERT_LT(known_frame, frames.size()) << frames[0].symbol;
+    const auto known_caller = StackTraceTestsFindFrame(frames, "StackTraceTestsKnownCaller", known_frame + 1);
+    EXPECT_LT(known_caller, frames.size()) << frames[known_frame].symbol;
+}
+
+TEST(StackTrace, SymbolizationIsCached) {
+    auto st = StackTraceTestsKnownCaller();
+    const auto first = st.GetFrames();
+    const auto second = st.GetFrames();
+    ASSERT_EQ(first.size(), second.size());
+    for(std::size_t i = 0; i < first.size(); ++i) {
+        EXPECT_EQ(first[i].address, second[i].address);
+        EXPECT_EQ(first[i].symbol, second[i].symbol);
+        EXPECT_EQ(first[i].line, second[i].line);
+    }
+    StackTrace::ClearSymbolCache();
+    const auto third = st.GetFrames();
+    ASSERT_EQ(first.size(), third.size());
+    EXPECT_EQ(first[0].symbol, third[0].symbol);
+}
+
+TEST(StackTrace, SameCallSiteHashesEqual) {
+    //Only the two known frames are captured so the test body's own call sites do not matter.
+    auto a = StackTraceTestsKnownCaller(2ul);
+    auto b = StackTraceTestsKnownCaller(2ul);
+    EXPECT_TRUE(a == b);
+    std::vector<StackTrace> copies(2, a);
+    EXPECT_TRUE(copies[0] == a);
+    EXPECT_TRUE(copies[1] != StackTraceTestsKnownFrame(2ul));
+}
+
+TEST(StackTraceBenchmarks, DISABLED_CaptureCost) {
+    RunBenchmark("StackTrace capture (30 frames)", 100000, [] {
+        StackTrace st{};
+        DoNotOptimize(st);
+    });
+    auto st = StackTraceTestsKnownCaller();
+    StackTrace::ClearSymbolCache();
+    RunBenchmark("StackTrace symbolize (cold)", 1, [&st] {
+        StackTrace::ClearSymbolCache();
+        DoNotOptimize(st.GetFrames());
+    });
+    RunBenchmark("StackTrace symbolize (cached)", 10000, [&st] {
+        DoNotOptimize(st.GetFrames());
+    });
+}
+
+#endif
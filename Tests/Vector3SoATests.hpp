@@ -0,0 +1,179 @@
+#pragma once
+
+#include "pch.h"
+
+#include "Benchmark.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Vector3.hpp"
+#include "Engine/Math/Vector3SoA.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<Vector3> MakeRandomVector3s(std::size_t count, unsigned int seed) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    std::vector<Vector3> result(count);
+    for(auto& v : result) {
+        v = Vector3{coord(rng), coord(rng), coord(rng)};
+    }
+    return result;
+}
+
+void ExpectVector3Near(const Vector3& a, const Vector3& b, float tolerance) {
+    EXPECT_NEAR(a.x, b.x, tolerance);
+    EXPECT_NEAR(a.y, b.y, tolerance);
+    EXPECT_NEAR(a.z, b.z, tolerance);
+}
+
+} //End anonymous
+
+TEST(Vector3SoA, RoundTripsThroughVector3s) {
+    const auto vectors = MakeRandomVector3s(13, 1u);
+    const Vector3SoA soa{vectors};
+    ASSERT_EQ(soa.size(), vectors.size());
+    const auto back = soa.ToVector3s();
+    ASSERT_EQ(back.size(), vectors.size());
+    for(std::size_t i = 0; i < vectors.size(); ++i) {
+        EXPECT_EQ(back[i], vectors[i]);
+        EXPECT_EQ(soa.Get(i), vectors[i]);
+        EXPECT_FLOAT_EQ(soa.GetYs()[i], vectors[i].y);
+    }
+}
+
+TEST(Vector3SoA, PushBackAndSet) {
+    Vector3SoA soa{};
+    EXPECT_TRUE(soa.empty());
+    soa.push_back(Vector3::X_AXIS);
+    soa.push_back(Vector3::Y_AXIS);
+    soa.Set(0, Vector3::Z_AXIS);
+    ASSERT_EQ(soa.size(), 2u);
+    EXPECT_EQ(soa.Get(0), Vector3::Z_AXIS);
+    EXPECT_EQ(soa.Get(1), Vector3::Y_AXIS);
+    soa.clear();
+    EXPECT_TRUE(soa.empty());
+}
+
+TEST(Vector3SoA, ElementwiseKernelsMatchVector3) {
+    //Not a multiple of four, to cover the tail.
+    const auto a = MakeRandomVector3s(103, 2u);
+    const auto b = MakeRandomVector3s(103, 3u);
+    const Vector3SoA sa{a};
+    const Vector3SoA sb{b};
+    Vector3SoA sum{};
+    Vector3SoA difference{};
+    Vector3SoA scaled{};
+    Vector3SoA cross{};
+    Vector3SoA lerped{};
+    Vector3SoA normalized{};
+    Vector3SoA::Add(sa, sb, sum);
+    Vector3SoA::Subtract(sa, sb, difference);
+    Vector3SoA::Scale(sa, 2.5f, scaled);
+    Vector3SoA::Cross(sa, sb, cross);
+    Vector3SoA::Lerp(sa, sb, 0.25f, lerped);
+    Vector3SoA::Normalize(sa, normalized);
+    for(std::size_t i = 0; i < a.size(); ++i) {
+        ExpectVector3Near(sum.Get(i), a[i] + b[i], 1e-5f);
+        ExpectVector3Near(difference.Get(i), a[i] - b[i], 1e-5f);
+        ExpectVector3Near(scaled.Get(i), a[i] * 2.5f, 1e-5f);
+        ExpectVector3Near(cross.Get(i), MathUtils::CrossProduct(a[i], b[i]), 1e-4f);
+        ExpectVector3Near(lerped.Get(i), MathUtils::Interpolate(a[i], b[i], 0.25f), 1e-5f);
+        ExpectVector3Near(normalized.Get(i), a[i].GetNormalize(), 1e-6f);
+    }
+}
+
+TEST(Vector3SoA, ScalarKernelsMatchVector3) {
+    const auto a = MakeRandomVector3s(103, 4u);
+    const auto b = MakeRandomVector3s(103, 5u);
+    const Vector3SoA sa{a};
+    const Vector3SoA sb{b};
+    std::vector<float> dots{};
+    std::vector<float> lengths{};
+    std::vector<float> lengths_squared{};
+    std::vector<float> distances{};
+    Vector3SoA::Dot(sa, sb, dots);
+    Vector3SoA::Length(sa, lengths);
+    Vector3SoA::LengthSquared(sa, lengths_squared);
+    Vector3SoA::Distance(sa, sb, distances);
+    ASSERT_EQ(dots.size(), a.size());
+    for(std::size_t i = 0; i < a.size(); ++i) {
+        EXPECT_NEAR(dots[i], MathUtils::DotProduct(a[i], b[i]), 1e-4f);
+        EXPECT_NEAR(lengths[i], a[i].CalcLength(), 1e-5f);
+        EXPECT_NEAR(lengths_squared[i], a[i].CalcLengthSquared(), 1e-4f);
+        EXPECT_NEAR(distances[i], (a[i] - b[i]).CalcLength(), 1e-5f);
+    }
+}
+
+TEST(Vector3SoA, NormalizeLeavesZeroVectorsZero) {
+    Vector3SoA soa{std::vector<Vector3>{Vector3::ZERO, Vector3{3.0f, 0.0f, 4.0f}, Vector3::ZERO, Vector3::ZERO, Vector3::ZERO}};
+    Vector3SoA::Normalize(soa, soa);
+    EXPECT_EQ(soa.Get(0), Vector3::ZERO);
+    ExpectVector3Near(soa.Get(1), Vector3{0.6f, 0.0f, 0.8f}, 1e-6f);
+    EXPECT_EQ(soa.Get(4), Vector3::ZERO);
+}
+
+TEST(Vector3SoA, ResultMayAliasOperand) {
+    const auto a = MakeRandomVector3s(9, 6u);
+    const auto b = MakeRandomVector3s(9, 7u);
+    Vector3SoA sa{a};
+    const Vector3SoA sb{b};
+    Vector3SoA::Cross(sa, sb, sa);
+    for(std::size_t i = 0; i < a.size(); ++i) {
+        ExpectVector3Near(sa.Get(i), MathUtils::CrossProduct(a[i], b[i]), 1e-4f);
+    }
+}
+
+//Operands of different sizes stop at GUARANTEE_OR_DIE. FatalError puts up a modal dialog, so that
+//is not death-tested here; this covers the other half of the contract, that results take the operands' size.
+TEST(Vector3SoA, ResultIsResizedToOperands) {
+    const Vector3SoA a{MakeRandomVector3s(6, 8u)};
+    const Vector3SoA b{MakeRandomVector3s(6, 9u)};
+    Vector3SoA larger(11);
+    Vector3SoA smaller(2);
+    Vector3SoA::Add(a, b, larger);
+    Vector3SoA::Lerp(a, b, 0.5f, smaller);
+    EXPECT_EQ(larger.size(), a.size());
+    EXPECT_EQ(smaller.size(), a.size());
+    std::vector<float> dots(13, 1.0f);
+    std::vector<float> distances{};
+    Vector3SoA::Dot(a, b, dots);
+    Vector3SoA::Distance(a, b, distances);
+    EXPECT_EQ(dots.size(), a.size());
+    EXPECT_EQ(distances.size(), a.size());
+    const Vector3SoA empty{};
+    Vector3SoA::Cross(empty, empty, larger);
+    EXPECT_TRUE(larger.empty());
+}
+
+TEST(Vector3SoABenchmarks, DISABLED_NormalizeAndDot) {
+    const auto a = MakeRandomVector3s(1000000, 8u);
+    const auto b = MakeRandomVector3s(1000000, 9u);
+    const Vector3SoA sa{a};
+    const Vector3SoA sb{b};
+    std::vector<Vector3> normalized(a.size());
+    Vector3SoA snormalized{};
+    std::vector<float> dots(a.size());
+    RunBenchmark("Vector3 GetNormalize loop", 20, a.size(), [&]() {
+        for(std::size_t i = 0; i < a.size(); ++i) {
+            normalized[i] = a[i].GetNormalize();
+        }
+        DoNotOptimize(normalized);
+    });
+    RunBenchmark("Vector3SoA::Normalize", 20, a.size(), [&]() {
+        Vector3SoA::Normalize(sa, snormalized);
+        DoNotOptimize(snormalized);
+    });
+    RunBenchmark("Vector3 DotProduct loop", 20, a.size(), [&]() {
+        for(std::size_t i = 0; i < a.size(); ++i) {
+            dots[i] = MathUtils::DotProduct(a[i], b[i]);
+        }
+        DoNotOptimize(dots);
+    });
+    RunBenchmark("Vector3SoA::Dot", 20, a.size(), [&]() {
+        Vector3SoA::Dot(sa, sb, dots);
+        DoNotOptimize(dots);
+    });
+}
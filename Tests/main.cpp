@@ -8,6 +8,52 @@
 
 #include "StringUtilsTests.hpp"
 
+#include "StackTraceTests.hpp"
+
+#include "HitchRecorderTests.hpp"
+
+#include "InstrumentedMutexTests.hpp"
+
+#include "InputRecordingTests.hpp"
+
+#include "ClockTests.hpp"
+
+#include "Matrix4Tests.hpp"
+
+#include "Vector3SoATests.hpp"
+
+#include "FrustumTests.hpp"
+
+#include "BVHTests.hpp"
+
+#include "Broadphase2DTests.hpp"
+
+#include "NarrowphaseBatchTests.hpp"
+
+#include "ConstexprMathTests.hpp"
+
+#include "FastMathTests.hpp"
+
+#include "QuaternionSoATests.hpp"
+
+#include "NoiseFieldTests.hpp"
+
+#include "NoiseTests.hpp"
+
+#include "RandomTests.hpp"
+
+#include "NoiseTileCacheTests.hpp"
+
+#include "PointSamplingTests.hpp"
+
+#include "LooseOctree3DTests.hpp"
+
+#include "RaycastTests.hpp"
+
+#include "MeshBVHTests.hpp"
+
+#include "BoundingVolumesTests.hpp"
+
 
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);